@@ -0,0 +1,554 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniApiRecorder.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// "HREC"
+static const uint32 HoudiniApiRecordingMagic = 0x43455248;
+static const int32 HoudiniApiRecordingVersion = 2;
+
+static FAutoConsoleCommand CCmdHoudiniApiRecorderStart(
+	TEXT("HoudiniEngine.HAPIRecorder.Start"),
+	TEXT("Start recording all the HAPI calls."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHoudiniApiRecorder::StartRecording(); }));
+
+static FAutoConsoleCommand CCmdHoudiniApiRecorderStop(
+	TEXT("HoudiniEngine.HAPIRecorder.Stop"),
+	TEXT("Stop recording the HAPI calls and save them to the given file."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FHoudiniApiRecorder::StopRecording(Args.Num() > 0 ? Args[0] : FString());
+	}));
+
+static FAutoConsoleCommand CCmdHoudiniApiRecorderReplay(
+	TEXT("HoudiniEngine.HAPIRecorder.Replay"),
+	TEXT("Replace HAPI with the replay of the given recording."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0)
+			FHoudiniApiRecorder::StartReplay(Args[0]);
+	}));
+
+static FAutoConsoleCommand CCmdHoudiniApiRecorderStopReplay(
+	TEXT("HoudiniEngine.HAPIRecorder.StopReplay"),
+	TEXT("Stop replaying a HAPI recording."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHoudiniApiRecorder::StopReplay(); }));
+
+// The hooked FHoudiniApi functions, and the hooks themselves, are generated in HoudiniApiRecorderHooks.inl
+enum class EHoudiniApiFunction : uint16;
+
+namespace HoudiniApiRecorder
+{
+	enum class EMode : uint8
+	{
+		None,
+		Recording,
+		Replaying
+	};
+
+	struct FRecord
+	{
+		uint16 Function = 0;
+		// Scalar and string arguments
+		TArray<uint8> Key;
+		// Returned value
+		TArray<uint8> Result;
+		// Size and content of each output buffer
+		TArray<uint8> Outputs;
+	};
+
+	static EMode Mode = EMode::None;
+	static FCriticalSection Lock;
+	static TArray<FRecord> Records;
+
+	// Replay: the records of each function + key, in recorded order, and the next one to use
+	static TMap<uint32, TArray<int32>> RecordsPerKey;
+	static TMap<uint32, int32> ReplayCursors;
+
+	static FHoudiniApiRecorder::FStats Stats;
+
+	static uint32
+	HashKey(const uint16& InFunction, const TArray<uint8>& InKey)
+	{
+		return FCrc::MemCrc32(InKey.GetData(), InKey.Num(), InFunction);
+	}
+
+	static void
+	IndexRecords()
+	{
+		RecordsPerKey.Reset();
+		ReplayCursors.Reset();
+		Stats.NumBytes = 0;
+		for (int32 RecordIdx = 0; RecordIdx < Records.Num(); RecordIdx++)
+		{
+			const FRecord& CurRecord = Records[RecordIdx];
+			RecordsPerKey.FindOrAdd(HashKey(CurRecord.Function, CurRecord.Key)).Add(RecordIdx);
+			Stats.NumBytes += CurRecord.Key.Num() + CurRecord.Result.Num() + CurRecord.Outputs.Num();
+		}
+		Stats.NumRecords = Records.Num();
+	}
+
+	// A hooked HAPI call being recorded or replayed
+	class FCall
+	{
+		public:
+
+			FCall(const EHoudiniApiFunction& InFunction, const bool& bInRecordOnce = false)
+				: Function((uint16)InFunction)
+				, CallMode(Mode)
+				, bRecordOnce(bInRecordOnce)
+			{
+			}
+
+			// Arguments identifying the call. Structs are keyed field by field (see KeyFields), as their padding is undefined
+			template<typename T>
+			void Key(const T& InValue)
+			{
+				static_assert(TIsArithmetic<T>::Value || TIsEnum<T>::Value, "Only scalars can be keyed by value");
+				if (CallMode != EMode::None)
+					Record.Key.Append((const uint8*)&InValue, sizeof(T));
+			}
+
+			void Key(const char* InString)
+			{
+				if (CallMode == EMode::None)
+					return;
+
+				const int32 Length = InString ? FCStringAnsi::Strlen(InString) : -1;
+				Key(Length);
+				if (Length > 0)
+					Record.Key.Append((const uint8*)InString, Length);
+			}
+
+			// Returns true if the call is replayed, finds the recorded call
+			bool Replay()
+			{
+				if (CallMode != EMode::Replaying)
+					return false;
+
+				const uint32 Hash = HashKey(Function, Record.Key);
+				FScopeLock ScopeLock(&Lock);
+				const TArray<int32>* FoundRecords = RecordsPerKey.Find(Hash);
+				if (!FoundRecords || FoundRecords->Num() <= 0)
+				{
+					Stats.NumMissedCalls++;
+					return true;
+				}
+
+				int32& Cursor = ReplayCursors.FindOrAdd(Hash);
+				if (Cursor < FoundRecords->Num())
+				{
+					ReplayedRecord = &Records[(*FoundRecords)[Cursor++]];
+				}
+				else
+				{
+					ReplayedRecord = &Records[FoundRecords->Last()];
+					Stats.NumRepeatedCalls++;
+				}
+
+				if (ReplayedRecord->Function != Function || ReplayedRecord->Key != Record.Key)
+				{
+					// Hash collision
+					ReplayedRecord = nullptr;
+					Stats.NumMissedCalls++;
+					return true;
+				}
+
+				Stats.NumReplayedCalls++;
+				return true;
+			}
+
+			template<typename T>
+			T ReplayResult(const T& InMissedValue)
+			{
+				T Result = InMissedValue;
+				if (ReplayedRecord && ReplayedRecord->Result.Num() == sizeof(T))
+					FMemory::Memcpy(&Result, ReplayedRecord->Result.GetData(), sizeof(T));
+
+				return Result;
+			}
+
+			// An output buffer of InCount values
+			template<typename T>
+			void Output(T* InValues, const int32& InCount)
+			{
+				const int32 NumBytes = InValues ? FMath::Max(InCount, 0) * (int32)sizeof(T) : 0;
+				if (CallMode == EMode::Recording)
+				{
+					Record.Outputs.Append((const uint8*)&NumBytes, sizeof(NumBytes));
+					Record.Outputs.Append((const uint8*)InValues, NumBytes);
+				}
+				else if (CallMode == EMode::Replaying && ReplayedRecord)
+				{
+					const TArray<uint8>& Outputs = ReplayedRecord->Outputs;
+					if (OutputOffset + (int32)sizeof(int32) > Outputs.Num())
+						return;
+
+					int32 NumRecordedBytes = 0;
+					FMemory::Memcpy(&NumRecordedBytes, Outputs.GetData() + OutputOffset, sizeof(int32));
+					OutputOffset += sizeof(int32);
+
+					NumRecordedBytes = FMath::Min(NumRecordedBytes, Outputs.Num() - OutputOffset);
+					if (NumBytes > 0 && NumRecordedBytes > 0)
+						FMemory::Memcpy(InValues, Outputs.GetData() + OutputOffset, FMath::Min(NumBytes, NumRecordedBytes));
+
+					OutputOffset += NumRecordedBytes;
+				}
+			}
+
+			template<typename T>
+			T Finish(const T& InResult)
+			{
+				if (CallMode == EMode::Recording)
+				{
+					Record.Result.Append((const uint8*)&InResult, sizeof(T));
+					Commit();
+				}
+
+				return InResult;
+			}
+
+			void Finish()
+			{
+				if (CallMode == EMode::Recording)
+					Commit();
+			}
+
+		private:
+
+			void Commit()
+			{
+				Record.Function = Function;
+
+				FScopeLock ScopeLock(&Lock);
+				// Calls that always return the same thing (the struct initializers) only need to be recorded once
+				if (bRecordOnce && RecordsPerKey.Contains(HashKey(Function, Record.Key)))
+					return;
+
+				const int32 RecordIdx = Records.Add(MoveTemp(Record));
+				RecordsPerKey.FindOrAdd(HashKey(Records[RecordIdx].Function, Records[RecordIdx].Key)).Add(RecordIdx);
+			}
+
+			uint16 Function;
+			EMode CallMode;
+			bool bRecordOnce;
+
+			FRecord Record;
+			const FRecord* ReplayedRecord = nullptr;
+			int32 OutputOffset = 0;
+	};
+
+}
+
+#include "HoudiniApiRecorderHooks.inl"
+
+bool
+FHoudiniApiRecorder::StartRecording()
+{
+	using namespace HoudiniApiRecorder;
+
+	if (Mode != EMode::None)
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI recorder: already recording or replaying."));
+		return false;
+	}
+
+	if (!FHoudiniApi::IsHAPIInitialized())
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI recorder: HAPI must be initialized to record its calls."));
+		return false;
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		Records.Reset();
+		RecordsPerKey.Reset();
+		ReplayCursors.Reset();
+		Stats = FStats();
+	}
+
+	FHoudiniApiRecorderHooks::Install();
+	Mode = EMode::Recording;
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: started recording."));
+	return true;
+}
+
+bool
+FHoudiniApiRecorder::StopRecording(const FString& InFilePath)
+{
+	using namespace HoudiniApiRecorder;
+
+	if (Mode != EMode::Recording)
+		return false;
+
+	Mode = EMode::None;
+	FHoudiniApiRecorderHooks::Uninstall();
+
+	FScopeLock ScopeLock(&Lock);
+	IndexRecords();
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: recorded %d calls (%.2f MB)."), Stats.NumRecords, Stats.NumBytes / (1024.0 * 1024.0));
+
+	if (InFilePath.IsEmpty())
+		return true;
+
+	// Serialize the records...
+	TArray<uint8> RecordsData;
+	{
+		FMemoryWriter Writer(RecordsData);
+		int32 NumRecords = Records.Num();
+		Writer << NumRecords;
+		for (FRecord& CurRecord : Records)
+		{
+			Writer << CurRecord.Function;
+			Writer << CurRecord.Key;
+			Writer << CurRecord.Result;
+			Writer << CurRecord.Outputs;
+		}
+	}
+
+	// ... and compress them
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, RecordsData.Num());
+	TArray<uint8> CompressedData;
+	CompressedData.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, CompressedData.GetData(), CompressedSize, RecordsData.GetData(), RecordsData.Num()))
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: failed to compress the recording."));
+		return false;
+	}
+	CompressedData.SetNum(CompressedSize, false);
+
+	TArray<uint8> FileData;
+	FMemoryWriter FileWriter(FileData);
+	uint32 Magic = HoudiniApiRecordingMagic;
+	int32 Version = HoudiniApiRecordingVersion;
+	FileWriter << Magic;
+	FileWriter << Version;
+
+	// The function names, so the recording doesn't depend on the order of the functions
+	TArray<FString> FunctionNames;
+	for (int32 FunctionIdx = 0; FunctionIdx < (int32)EHoudiniApiFunction::Count; FunctionIdx++)
+		FunctionNames.Add(ANSI_TO_TCHAR(HoudiniApiFunctionNames[FunctionIdx]));
+	FileWriter << FunctionNames;
+
+	int32 UncompressedSize = RecordsData.Num();
+	FileWriter << UncompressedSize;
+	FileWriter << CompressedData;
+
+	if (!FFileHelper::SaveArrayToFile(FileData, *InFilePath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: failed to save the recording to %s."), *InFilePath);
+		return false;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: saved %s (%.2f MB)."), *InFilePath, FileData.Num() / (1024.0 * 1024.0));
+	return true;
+}
+
+bool
+FHoudiniApiRecorder::StartReplay(const FString& InFilePath)
+{
+	using namespace HoudiniApiRecorder;
+
+	if (Mode != EMode::None)
+	{
+		HOUDINI_LOG_WARNING(TEXT("HAPI recorder: already recording or replaying."));
+		return false;
+	}
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *InFilePath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: failed to load %s."), *InFilePath);
+		return false;
+	}
+
+	FMemoryReader FileReader(FileData);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	FileReader << Magic;
+	FileReader << Version;
+	if (Magic != HoudiniApiRecordingMagic || Version != HoudiniApiRecordingVersion)
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: %s is not a valid HAPI recording."), *InFilePath);
+		return false;
+	}
+
+	TArray<FString> FunctionNames;
+	int32 UncompressedSize = 0;
+	TArray<uint8> CompressedData;
+	FileReader << FunctionNames;
+	FileReader << UncompressedSize;
+	FileReader << CompressedData;
+
+	TArray<uint8> RecordsData;
+	RecordsData.SetNumUninitialized(UncompressedSize);
+	if (FileReader.IsError() 
+		|| !FCompression::UncompressMemory(NAME_Zlib, RecordsData.GetData(), UncompressedSize, CompressedData.GetData(), CompressedData.Num()))
+	{
+		HOUDINI_LOG_ERROR(TEXT("HAPI recorder: failed to read %s."), *InFilePath);
+		return false;
+	}
+
+	// Map the recorded functions to ours
+	TMap<FString, int32> FunctionIndices;
+	for (int32 FunctionIdx = 0; FunctionIdx < (int32)EHoudiniApiFunction::Count; FunctionIdx++)
+		FunctionIndices.Add(ANSI_TO_TCHAR(HoudiniApiFunctionNames[FunctionIdx]), FunctionIdx);
+
+	TArray<int32> RecordedFunctionToFunction;
+	for (const FString& CurName : FunctionNames)
+	{
+		const int32* FoundIndex = FunctionIndices.Find(CurName);
+		RecordedFunctionToFunction.Add(FoundIndex ? *FoundIndex : INDEX_NONE);
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		Records.Reset();
+		Stats = FStats();
+
+		FMemoryReader Reader(RecordsData);
+		int32 NumRecords = 0;
+		Reader << NumRecords;
+		Records.Reserve(NumRecords);
+		for (int32 RecordIdx = 0; RecordIdx < NumRecords && !Reader.IsError(); RecordIdx++)
+		{
+			FRecord CurRecord;
+			Reader << CurRecord.Function;
+			Reader << CurRecord.Key;
+			Reader << CurRecord.Result;
+			Reader << CurRecord.Outputs;
+
+			if (!RecordedFunctionToFunction.IsValidIndex(CurRecord.Function) || RecordedFunctionToFunction[CurRecord.Function] == INDEX_NONE)
+				continue;
+
+			CurRecord.Function = (uint16)RecordedFunctionToFunction[CurRecord.Function];
+			Records.Add(MoveTemp(CurRecord));
+		}
+
+		IndexRecords();
+	}
+
+	FHoudiniApiRecorderHooks::Install();
+	Mode = EMode::Replaying;
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: replaying %s (%d calls)."), *InFilePath, Stats.NumRecords);
+	return true;
+}
+
+void
+FHoudiniApiRecorder::RewindReplay()
+{
+	using namespace HoudiniApiRecorder;
+
+	FScopeLock ScopeLock(&Lock);
+	ReplayCursors.Reset();
+	Stats.NumReplayedCalls = 0;
+	Stats.NumRepeatedCalls = 0;
+	Stats.NumMissedCalls = 0;
+}
+
+void
+FHoudiniApiRecorder::StopReplay()
+{
+	using namespace HoudiniApiRecorder;
+
+	if (Mode != EMode::Replaying)
+		return;
+
+	Mode = EMode::None;
+	FHoudiniApiRecorderHooks::Uninstall();
+
+	HOUDINI_LOG_MESSAGE(TEXT("HAPI recorder: stopped replaying (%d calls replayed, %d repeated, %d missed)."),
+		Stats.NumReplayedCalls, Stats.NumRepeatedCalls, Stats.NumMissedCalls);
+}
+
+void
+FHoudiniApiRecorder::Reset()
+{
+	using namespace HoudiniApiRecorder;
+
+	if (Mode == EMode::Recording)
+		StopRecording(FString());
+	else if (Mode == EMode::Replaying)
+		StopReplay();
+
+	FScopeLock ScopeLock(&Lock);
+	Records.Empty();
+	RecordsPerKey.Empty();
+	ReplayCursors.Empty();
+	Stats = FStats();
+}
+
+bool
+FHoudiniApiRecorder::IsRecording()
+{
+	return HoudiniApiRecorder::Mode == HoudiniApiRecorder::EMode::Recording;
+}
+
+bool
+FHoudiniApiRecorder::IsReplaying()
+{
+	return HoudiniApiRecorder::Mode == HoudiniApiRecorder::EMode::Replaying;
+}
+
+void
+FHoudiniApiRecorder::GetRecordedAssetIds(TArray<HAPI_NodeId>& OutAssetIds)
+{
+	using namespace HoudiniApiRecorder;
+
+	OutAssetIds.Reset();
+
+	FScopeLock ScopeLock(&Lock);
+	for (const FRecord& CurRecord : Records)
+	{
+		// The key of GetAssetInfo starts with the asset's node id
+		if (CurRecord.Function != (uint16)EHoudiniApiFunction::GetAssetInfo || CurRecord.Key.Num() < (int32)sizeof(HAPI_NodeId))
+			continue;
+
+		HAPI_NodeId AssetId = -1;
+		FMemory::Memcpy(&AssetId, CurRecord.Key.GetData(), sizeof(HAPI_NodeId));
+		if (AssetId >= 0)
+			OutAssetIds.AddUnique(AssetId);
+	}
+}
+
+FHoudiniApiRecorder::FStats
+FHoudiniApiRecorder::GetStats()
+{
+	FScopeLock ScopeLock(&HoudiniApiRecorder::Lock);
+	return HoudiniApiRecorder::Stats;
+}
@@ -0,0 +1,89 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+// Records the HAPI calls made through FHoudiniApi, with their results and returned buffers, and replays
+// them deterministically without a Houdini Engine session (and without libHAPI).
+//
+// Both modes work by swapping the FHoudiniApi function pointers with hooks. When recording, the hooks
+// call the real functions and store, per call, the scalar and string arguments (the call's key), the
+// result and the content of every output buffer. When replaying, the hooks find the next recorded call
+// with the same key and copy the recorded outputs back into the caller's buffers. Input arrays are not
+// part of the key: calls with the same key are replayed in their recorded order, and once a key has been
+// exhausted its last call keeps being replayed. A call with an unknown key fails (HAPI_RESULT_FAILURE).
+//
+// This allows running the translators headless against the recording of a real cook (see the
+// Houdini.Core.Benchmarks.HAPIReplay test). The recorder is driven from the game thread, the hooks
+// themselves are thread safe.
+//
+// The hooks (HoudiniApiRecorderHooks.inl) are generated from HoudiniApi.h by Scripts/GenerateHoudiniApiRecorderHooks.py,
+// run it again whenever HoudiniApi.h is regenerated.
+class HOUDINIENGINE_API FHoudiniApiRecorder
+{
+	public:
+
+		struct FStats
+		{
+			// Number of calls in the recording
+			int32 NumRecords = 0;
+			// Size of the recorded keys, results and outputs
+			int64 NumBytes = 0;
+			// Replayed calls, replayed calls that reused an exhausted key's last call, unknown calls
+			int32 NumReplayedCalls = 0;
+			int32 NumRepeatedCalls = 0;
+			int32 NumMissedCalls = 0;
+		};
+
+		// Start recording all HAPI calls. HAPI must be initialized.
+		static bool StartRecording();
+
+		// Stop recording and save the recorded calls, if InFilePath is not empty.
+		static bool StopRecording(const FString& InFilePath);
+
+		// Load a recording and replace HAPI with its replay. HAPI does not need to be initialized.
+		static bool StartReplay(const FString& InFilePath);
+
+		// Restart the replay from the first recorded calls.
+		static void RewindReplay();
+
+		// Stop replaying and restore the previous HAPI functions.
+		static void StopReplay();
+
+		// Stop recording or replaying, discarding any recorded call.
+		static void Reset();
+
+		static bool IsRecording();
+		static bool IsReplaying();
+
+		// The node ids of the assets queried in the recording (ie the HDAs that were cooked)
+		static void GetRecordedAssetIds(TArray<HAPI_NodeId>& OutAssetIds);
+
+		static FStats GetStats();
+};
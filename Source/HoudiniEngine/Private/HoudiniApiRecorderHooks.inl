@@ -0,0 +1,5636 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Generated by Source/HoudiniEngine/Scripts/GenerateHoudiniApiRecorderHooks.py from HoudiniApi.h, do not edit.
+// Included by HoudiniApiRecorder.cpp.
+
+// The hooked FHoudiniApi functions
+enum class EHoudiniApiFunction : uint16
+{
+	AddAttribute,
+	AddGroup,
+	AssetInfo_Create,
+	AssetInfo_Init,
+	AttributeInfo_Create,
+	AttributeInfo_Init,
+	BindCustomImplementation,
+	CancelPDGCook,
+	CheckForSpecificErrors,
+	Cleanup,
+	ClearConnectionError,
+	CloseSession,
+	CommitGeo,
+	CommitWorkitems,
+	ComposeChildNodeList,
+	ComposeNodeCookResult,
+	ComposeObjectList,
+	ConnectNodeInput,
+	ConvertMatrixToEuler,
+	ConvertMatrixToQuat,
+	ConvertTransform,
+	ConvertTransformEulerToMatrix,
+	ConvertTransformQuatToMatrix,
+	CookNode,
+	CookOptions_AreEqual,
+	CookOptions_Create,
+	CookOptions_Init,
+	CookPDG,
+	CreateCustomSession,
+	CreateHeightFieldInput,
+	CreateHeightfieldInputVolumeNode,
+	CreateInProcessSession,
+	CreateInputNode,
+	CreateNode,
+	CreateThriftNamedPipeSession,
+	CreateThriftSocketSession,
+	CreateWorkitem,
+	CurveInfo_Create,
+	CurveInfo_Init,
+	DeleteAttribute,
+	DeleteGroup,
+	DeleteNode,
+	DirtyPDGNode,
+	DisconnectNodeInput,
+	DisconnectNodeOutputsAt,
+	ExtractImageToFile,
+	ExtractImageToMemory,
+	GeoInfo_Create,
+	GeoInfo_GetGroupCountByType,
+	GeoInfo_Init,
+	GetActiveCacheCount,
+	GetActiveCacheNames,
+	GetAssetDefinitionParmCounts,
+	GetAssetDefinitionParmInfos,
+	GetAssetDefinitionParmValues,
+	GetAssetInfo,
+	GetAttributeFloat64ArrayData,
+	GetAttributeFloat64Data,
+	GetAttributeFloatArrayData,
+	GetAttributeFloatData,
+	GetAttributeInfo,
+	GetAttributeInt16ArrayData,
+	GetAttributeInt16Data,
+	GetAttributeInt64ArrayData,
+	GetAttributeInt64Data,
+	GetAttributeInt8ArrayData,
+	GetAttributeInt8Data,
+	GetAttributeIntArrayData,
+	GetAttributeIntData,
+	GetAttributeNames,
+	GetAttributeStringArrayData,
+	GetAttributeStringData,
+	GetAttributeUInt8ArrayData,
+	GetAttributeUInt8Data,
+	GetAvailableAssetCount,
+	GetAvailableAssets,
+	GetBoxInfo,
+	GetCacheProperty,
+	GetComposedChildNodeList,
+	GetComposedNodeCookResult,
+	GetComposedObjectList,
+	GetComposedObjectTransforms,
+	GetConnectionError,
+	GetConnectionErrorLength,
+	GetCookingCurrentCount,
+	GetCookingTotalCount,
+	GetCurveCounts,
+	GetCurveInfo,
+	GetCurveKnots,
+	GetCurveOrders,
+	GetDisplayGeoInfo,
+	GetEnvInt,
+	GetFaceCounts,
+	GetFirstVolumeTile,
+	GetGeoInfo,
+	GetGeoSize,
+	GetGroupCountOnPackedInstancePart,
+	GetGroupMembership,
+	GetGroupMembershipOnPackedInstancePart,
+	GetGroupNames,
+	GetGroupNamesOnPackedInstancePart,
+	GetHIPFileNodeCount,
+	GetHIPFileNodeIds,
+	GetHandleBindingInfo,
+	GetHandleInfo,
+	GetHeightFieldData,
+	GetImageFilePath,
+	GetImageInfo,
+	GetImageMemoryBuffer,
+	GetImagePlaneCount,
+	GetImagePlanes,
+	GetInstanceTransformsOnPart,
+	GetInstancedObjectIds,
+	GetInstancedPartIds,
+	GetInstancerPartTransforms,
+	GetManagerNodeId,
+	GetMaterialInfo,
+	GetMaterialNodeIdsOnFaces,
+	GetNextVolumeTile,
+	GetNodeInfo,
+	GetNodeInputName,
+	GetNodeOutputName,
+	GetNodePath,
+	GetNumWorkitems,
+	GetObjectInfo,
+	GetObjectTransform,
+	GetOutputNodeId,
+	GetPDGEvents,
+	GetPDGGraphContextId,
+	GetPDGGraphContexts,
+	GetPDGState,
+	GetParameters,
+	GetParmChoiceLists,
+	GetParmExpression,
+	GetParmFile,
+	GetParmFloatValue,
+	GetParmFloatValues,
+	GetParmIdFromName,
+	GetParmInfo,
+	GetParmInfoFromName,
+	GetParmIntValue,
+	GetParmIntValues,
+	GetParmNodeValue,
+	GetParmStringValue,
+	GetParmStringValues,
+	GetParmTagName,
+	GetParmTagValue,
+	GetParmWithTag,
+	GetPartInfo,
+	GetPreset,
+	GetPresetBufLength,
+	GetServerEnvInt,
+	GetServerEnvString,
+	GetServerEnvVarCount,
+	GetServerEnvVarList,
+	GetSessionEnvInt,
+	GetSessionSyncInfo,
+	GetSphereInfo,
+	GetStatus,
+	GetStatusString,
+	GetStatusStringBufLength,
+	GetString,
+	GetStringBatch,
+	GetStringBatchSize,
+	GetStringBufLength,
+	GetSupportedImageFileFormatCount,
+	GetSupportedImageFileFormats,
+	GetTime,
+	GetTimelineOptions,
+	GetTotalCookCount,
+	GetUseHoudiniTime,
+	GetVertexList,
+	GetViewport,
+	GetVolumeBounds,
+	GetVolumeInfo,
+	GetVolumeTileFloatData,
+	GetVolumeTileIntData,
+	GetVolumeVisualInfo,
+	GetVolumeVoxelFloatData,
+	GetVolumeVoxelIntData,
+	GetWorkitemDataLength,
+	GetWorkitemFloatData,
+	GetWorkitemInfo,
+	GetWorkitemIntData,
+	GetWorkitemResultInfo,
+	GetWorkitemStringData,
+	GetWorkitems,
+	HandleBindingInfo_Create,
+	HandleBindingInfo_Init,
+	HandleInfo_Create,
+	HandleInfo_Init,
+	ImageFileFormat_Create,
+	ImageFileFormat_Init,
+	ImageInfo_Create,
+	ImageInfo_Init,
+	Initialize,
+	InsertMultiparmInstance,
+	Interrupt,
+	IsInitialized,
+	IsNodeValid,
+	IsSessionValid,
+	Keyframe_Create,
+	Keyframe_Init,
+	LoadAssetLibraryFromFile,
+	LoadAssetLibraryFromMemory,
+	LoadGeoFromFile,
+	LoadGeoFromMemory,
+	LoadHIPFile,
+	LoadNodeFromFile,
+	MaterialInfo_Create,
+	MaterialInfo_Init,
+	MergeHIPFile,
+	NodeInfo_Create,
+	NodeInfo_Init,
+	ObjectInfo_Create,
+	ObjectInfo_Init,
+	ParmChoiceInfo_Create,
+	ParmChoiceInfo_Init,
+	ParmHasExpression,
+	ParmHasTag,
+	ParmInfo_Create,
+	ParmInfo_GetFloatValueCount,
+	ParmInfo_GetIntValueCount,
+	ParmInfo_GetStringValueCount,
+	ParmInfo_Init,
+	ParmInfo_IsFloat,
+	ParmInfo_IsInt,
+	ParmInfo_IsNode,
+	ParmInfo_IsNonValue,
+	ParmInfo_IsPath,
+	ParmInfo_IsString,
+	PartInfo_Create,
+	PartInfo_GetAttributeCountByOwner,
+	PartInfo_GetElementCountByAttributeOwner,
+	PartInfo_GetElementCountByGroupType,
+	PartInfo_Init,
+	PausePDGCook,
+	PythonThreadInterpreterLock,
+	QueryNodeInput,
+	QueryNodeOutputConnectedCount,
+	QueryNodeOutputConnectedNodes,
+	RemoveCustomString,
+	RemoveMultiparmInstance,
+	RemoveParmExpression,
+	RenameNode,
+	RenderCOPToImage,
+	RenderTextureToImage,
+	ResetSimulation,
+	RevertGeo,
+	RevertParmToDefault,
+	RevertParmToDefaults,
+	SaveGeoToFile,
+	SaveGeoToMemory,
+	SaveHIPFile,
+	SaveNodeToFile,
+	SessionSyncInfo_Create,
+	SetAnimCurve,
+	SetAttributeFloat64Data,
+	SetAttributeFloatData,
+	SetAttributeInt16Data,
+	SetAttributeInt64Data,
+	SetAttributeInt8Data,
+	SetAttributeIntData,
+	SetAttributeStringData,
+	SetAttributeUInt8Data,
+	SetCacheProperty,
+	SetCurveCounts,
+	SetCurveInfo,
+	SetCurveKnots,
+	SetCurveOrders,
+	SetCustomString,
+	SetFaceCounts,
+	SetGroupMembership,
+	SetHeightFieldData,
+	SetImageInfo,
+	SetNodeDisplay,
+	SetObjectTransform,
+	SetParmExpression,
+	SetParmFloatValue,
+	SetParmFloatValues,
+	SetParmIntValue,
+	SetParmIntValues,
+	SetParmNodeValue,
+	SetParmStringValue,
+	SetPartInfo,
+	SetPreset,
+	SetServerEnvInt,
+	SetServerEnvString,
+	SetSessionSync,
+	SetSessionSyncInfo,
+	SetTime,
+	SetTimelineOptions,
+	SetTransformAnimCurve,
+	SetUseHoudiniTime,
+	SetVertexList,
+	SetViewport,
+	SetVolumeInfo,
+	SetVolumeTileFloatData,
+	SetVolumeTileIntData,
+	SetVolumeVoxelFloatData,
+	SetVolumeVoxelIntData,
+	SetWorkitemFloatData,
+	SetWorkitemIntData,
+	SetWorkitemStringData,
+	StartThriftNamedPipeServer,
+	StartThriftSocketServer,
+	ThriftServerOptions_Create,
+	ThriftServerOptions_Init,
+	TimelineOptions_Create,
+	TimelineOptions_Init,
+	TransformEuler_Create,
+	TransformEuler_Init,
+	Transform_Create,
+	Transform_Init,
+	Viewport_Create,
+	VolumeInfo_Create,
+	VolumeInfo_Init,
+	VolumeTileInfo_Create,
+	VolumeTileInfo_Init,
+	Count
+};
+
+static const char* HoudiniApiFunctionNames[] =
+{
+	"AddAttribute",
+	"AddGroup",
+	"AssetInfo_Create",
+	"AssetInfo_Init",
+	"AttributeInfo_Create",
+	"AttributeInfo_Init",
+	"BindCustomImplementation",
+	"CancelPDGCook",
+	"CheckForSpecificErrors",
+	"Cleanup",
+	"ClearConnectionError",
+	"CloseSession",
+	"CommitGeo",
+	"CommitWorkitems",
+	"ComposeChildNodeList",
+	"ComposeNodeCookResult",
+	"ComposeObjectList",
+	"ConnectNodeInput",
+	"ConvertMatrixToEuler",
+	"ConvertMatrixToQuat",
+	"ConvertTransform",
+	"ConvertTransformEulerToMatrix",
+	"ConvertTransformQuatToMatrix",
+	"CookNode",
+	"CookOptions_AreEqual",
+	"CookOptions_Create",
+	"CookOptions_Init",
+	"CookPDG",
+	"CreateCustomSession",
+	"CreateHeightFieldInput",
+	"CreateHeightfieldInputVolumeNode",
+	"CreateInProcessSession",
+	"CreateInputNode",
+	"CreateNode",
+	"CreateThriftNamedPipeSession",
+	"CreateThriftSocketSession",
+	"CreateWorkitem",
+	"CurveInfo_Create",
+	"CurveInfo_Init",
+	"DeleteAttribute",
+	"DeleteGroup",
+	"DeleteNode",
+	"DirtyPDGNode",
+	"DisconnectNodeInput",
+	"DisconnectNodeOutputsAt",
+	"ExtractImageToFile",
+	"ExtractImageToMemory",
+	"GeoInfo_Create",
+	"GeoInfo_GetGroupCountByType",
+	"GeoInfo_Init",
+	"GetActiveCacheCount",
+	"GetActiveCacheNames",
+	"GetAssetDefinitionParmCounts",
+	"GetAssetDefinitionParmInfos",
+	"GetAssetDefinitionParmValues",
+	"GetAssetInfo",
+	"GetAttributeFloat64ArrayData",
+	"GetAttributeFloat64Data",
+	"GetAttributeFloatArrayData",
+	"GetAttributeFloatData",
+	"GetAttributeInfo",
+	"GetAttributeInt16ArrayData",
+	"GetAttributeInt16Data",
+	"GetAttributeInt64ArrayData",
+	"GetAttributeInt64Data",
+	"GetAttributeInt8ArrayData",
+	"GetAttributeInt8Data",
+	"GetAttributeIntArrayData",
+	"GetAttributeIntData",
+	"GetAttributeNames",
+	"GetAttributeStringArrayData",
+	"GetAttributeStringData",
+	"GetAttributeUInt8ArrayData",
+	"GetAttributeUInt8Data",
+	"GetAvailableAssetCount",
+	"GetAvailableAssets",
+	"GetBoxInfo",
+	"GetCacheProperty",
+	"GetComposedChildNodeList",
+	"GetComposedNodeCookResult",
+	"GetComposedObjectList",
+	"GetComposedObjectTransforms",
+	"GetConnectionError",
+	"GetConnectionErrorLength",
+	"GetCookingCurrentCount",
+	"GetCookingTotalCount",
+	"GetCurveCounts",
+	"GetCurveInfo",
+	"GetCurveKnots",
+	"GetCurveOrders",
+	"GetDisplayGeoInfo",
+	"GetEnvInt",
+	"GetFaceCounts",
+	"GetFirstVolumeTile",
+	"GetGeoInfo",
+	"GetGeoSize",
+	"GetGroupCountOnPackedInstancePart",
+	"GetGroupMembership",
+	"GetGroupMembershipOnPackedInstancePart",
+	"GetGroupNames",
+	"GetGroupNamesOnPackedInstancePart",
+	"GetHIPFileNodeCount",
+	"GetHIPFileNodeIds",
+	"GetHandleBindingInfo",
+	"GetHandleInfo",
+	"GetHeightFieldData",
+	"GetImageFilePath",
+	"GetImageInfo",
+	"GetImageMemoryBuffer",
+	"GetImagePlaneCount",
+	"GetImagePlanes",
+	"GetInstanceTransformsOnPart",
+	"GetInstancedObjectIds",
+	"GetInstancedPartIds",
+	"GetInstancerPartTransforms",
+	"GetManagerNodeId",
+	"GetMaterialInfo",
+	"GetMaterialNodeIdsOnFaces",
+	"GetNextVolumeTile",
+	"GetNodeInfo",
+	"GetNodeInputName",
+	"GetNodeOutputName",
+	"GetNodePath",
+	"GetNumWorkitems",
+	"GetObjectInfo",
+	"GetObjectTransform",
+	"GetOutputNodeId",
+	"GetPDGEvents",
+	"GetPDGGraphContextId",
+	"GetPDGGraphContexts",
+	"GetPDGState",
+	"GetParameters",
+	"GetParmChoiceLists",
+	"GetParmExpression",
+	"GetParmFile",
+	"GetParmFloatValue",
+	"GetParmFloatValues",
+	"GetParmIdFromName",
+	"GetParmInfo",
+	"GetParmInfoFromName",
+	"GetParmIntValue",
+	"GetParmIntValues",
+	"GetParmNodeValue",
+	"GetParmStringValue",
+	"GetParmStringValues",
+	"GetParmTagName",
+	"GetParmTagValue",
+	"GetParmWithTag",
+	"GetPartInfo",
+	"GetPreset",
+	"GetPresetBufLength",
+	"GetServerEnvInt",
+	"GetServerEnvString",
+	"GetServerEnvVarCount",
+	"GetServerEnvVarList",
+	"GetSessionEnvInt",
+	"GetSessionSyncInfo",
+	"GetSphereInfo",
+	"GetStatus",
+	"GetStatusString",
+	"GetStatusStringBufLength",
+	"GetString",
+	"GetStringBatch",
+	"GetStringBatchSize",
+	"GetStringBufLength",
+	"GetSupportedImageFileFormatCount",
+	"GetSupportedImageFileFormats",
+	"GetTime",
+	"GetTimelineOptions",
+	"GetTotalCookCount",
+	"GetUseHoudiniTime",
+	"GetVertexList",
+	"GetViewport",
+	"GetVolumeBounds",
+	"GetVolumeInfo",
+	"GetVolumeTileFloatData",
+	"GetVolumeTileIntData",
+	"GetVolumeVisualInfo",
+	"GetVolumeVoxelFloatData",
+	"GetVolumeVoxelIntData",
+	"GetWorkitemDataLength",
+	"GetWorkitemFloatData",
+	"GetWorkitemInfo",
+	"GetWorkitemIntData",
+	"GetWorkitemResultInfo",
+	"GetWorkitemStringData",
+	"GetWorkitems",
+	"HandleBindingInfo_Create",
+	"HandleBindingInfo_Init",
+	"HandleInfo_Create",
+	"HandleInfo_Init",
+	"ImageFileFormat_Create",
+	"ImageFileFormat_Init",
+	"ImageInfo_Create",
+	"ImageInfo_Init",
+	"Initialize",
+	"InsertMultiparmInstance",
+	"Interrupt",
+	"IsInitialized",
+	"IsNodeValid",
+	"IsSessionValid",
+	"Keyframe_Create",
+	"Keyframe_Init",
+	"LoadAssetLibraryFromFile",
+	"LoadAssetLibraryFromMemory",
+	"LoadGeoFromFile",
+	"LoadGeoFromMemory",
+	"LoadHIPFile",
+	"LoadNodeFromFile",
+	"MaterialInfo_Create",
+	"MaterialInfo_Init",
+	"MergeHIPFile",
+	"NodeInfo_Create",
+	"NodeInfo_Init",
+	"ObjectInfo_Create",
+	"ObjectInfo_Init",
+	"ParmChoiceInfo_Create",
+	"ParmChoiceInfo_Init",
+	"ParmHasExpression",
+	"ParmHasTag",
+	"ParmInfo_Create",
+	"ParmInfo_GetFloatValueCount",
+	"ParmInfo_GetIntValueCount",
+	"ParmInfo_GetStringValueCount",
+	"ParmInfo_Init",
+	"ParmInfo_IsFloat",
+	"ParmInfo_IsInt",
+	"ParmInfo_IsNode",
+	"ParmInfo_IsNonValue",
+	"ParmInfo_IsPath",
+	"ParmInfo_IsString",
+	"PartInfo_Create",
+	"PartInfo_GetAttributeCountByOwner",
+	"PartInfo_GetElementCountByAttributeOwner",
+	"PartInfo_GetElementCountByGroupType",
+	"PartInfo_Init",
+	"PausePDGCook",
+	"PythonThreadInterpreterLock",
+	"QueryNodeInput",
+	"QueryNodeOutputConnectedCount",
+	"QueryNodeOutputConnectedNodes",
+	"RemoveCustomString",
+	"RemoveMultiparmInstance",
+	"RemoveParmExpression",
+	"RenameNode",
+	"RenderCOPToImage",
+	"RenderTextureToImage",
+	"ResetSimulation",
+	"RevertGeo",
+	"RevertParmToDefault",
+	"RevertParmToDefaults",
+	"SaveGeoToFile",
+	"SaveGeoToMemory",
+	"SaveHIPFile",
+	"SaveNodeToFile",
+	"SessionSyncInfo_Create",
+	"SetAnimCurve",
+	"SetAttributeFloat64Data",
+	"SetAttributeFloatData",
+	"SetAttributeInt16Data",
+	"SetAttributeInt64Data",
+	"SetAttributeInt8Data",
+	"SetAttributeIntData",
+	"SetAttributeStringData",
+	"SetAttributeUInt8Data",
+	"SetCacheProperty",
+	"SetCurveCounts",
+	"SetCurveInfo",
+	"SetCurveKnots",
+	"SetCurveOrders",
+	"SetCustomString",
+	"SetFaceCounts",
+	"SetGroupMembership",
+	"SetHeightFieldData",
+	"SetImageInfo",
+	"SetNodeDisplay",
+	"SetObjectTransform",
+	"SetParmExpression",
+	"SetParmFloatValue",
+	"SetParmFloatValues",
+	"SetParmIntValue",
+	"SetParmIntValues",
+	"SetParmNodeValue",
+	"SetParmStringValue",
+	"SetPartInfo",
+	"SetPreset",
+	"SetServerEnvInt",
+	"SetServerEnvString",
+	"SetSessionSync",
+	"SetSessionSyncInfo",
+	"SetTime",
+	"SetTimelineOptions",
+	"SetTransformAnimCurve",
+	"SetUseHoudiniTime",
+	"SetVertexList",
+	"SetViewport",
+	"SetVolumeInfo",
+	"SetVolumeTileFloatData",
+	"SetVolumeTileIntData",
+	"SetVolumeVoxelFloatData",
+	"SetVolumeVoxelIntData",
+	"SetWorkitemFloatData",
+	"SetWorkitemIntData",
+	"SetWorkitemStringData",
+	"StartThriftNamedPipeServer",
+	"StartThriftSocketServer",
+	"ThriftServerOptions_Create",
+	"ThriftServerOptions_Init",
+	"TimelineOptions_Create",
+	"TimelineOptions_Init",
+	"TransformEuler_Create",
+	"TransformEuler_Init",
+	"Transform_Create",
+	"Transform_Init",
+	"Viewport_Create",
+	"VolumeInfo_Create",
+	"VolumeInfo_Init",
+	"VolumeTileInfo_Create",
+	"VolumeTileInfo_Init",
+};
+
+namespace HoudiniApiRecorder
+{
+	static void
+	KeyFields(FCall& Call, const HAPI_CookOptions* InStruct)
+	{
+		Call.Key(InStruct != nullptr);
+		if (!InStruct)
+			return;
+
+		Call.Key(InStruct->splitGeosByGroup);
+		Call.Key(InStruct->splitGeosByAttribute);
+		Call.Key(InStruct->splitAttrSH);
+		Call.Key(InStruct->maxVerticesPerPrimitive);
+		Call.Key(InStruct->refineCurveToLinear);
+		Call.Key(InStruct->curveRefineLOD);
+		Call.Key(InStruct->clearErrorsAndWarnings);
+		Call.Key(InStruct->cookTemplatedGeos);
+		Call.Key(InStruct->splitPointsByVertexAttributes);
+		Call.Key(InStruct->packedPrimInstancingMode);
+		Call.Key(InStruct->handleBoxPartTypes);
+		Call.Key(InStruct->handleSpherePartTypes);
+		Call.Key(InStruct->checkPartChanges);
+		Call.Key(InStruct->cacheMeshTopology);
+		Call.Key(InStruct->extraFlags);
+	}
+
+	static void
+	KeyFields(FCall& Call, const HAPI_GeoInfo* InStruct)
+	{
+		Call.Key(InStruct != nullptr);
+		if (!InStruct)
+			return;
+
+		Call.Key(InStruct->type);
+		Call.Key(InStruct->nameSH);
+		Call.Key(InStruct->nodeId);
+		Call.Key(InStruct->isEditable);
+		Call.Key(InStruct->isTemplated);
+		Call.Key(InStruct->isDisplayGeo);
+		Call.Key(InStruct->hasGeoChanged);
+		Call.Key(InStruct->hasMaterialChanged);
+		Call.Key(InStruct->pointGroupCount);
+		Call.Key(InStruct->primitiveGroupCount);
+		Call.Key(InStruct->edgeGroupCount);
+		Call.Key(InStruct->partCount);
+	}
+
+	static void
+	KeyFields(FCall& Call, const HAPI_ParmInfo* InStruct)
+	{
+		Call.Key(InStruct != nullptr);
+		if (!InStruct)
+			return;
+
+		Call.Key(InStruct->id);
+		Call.Key(InStruct->parentId);
+		Call.Key(InStruct->childIndex);
+		Call.Key(InStruct->type);
+		Call.Key(InStruct->scriptType);
+		Call.Key(InStruct->typeInfoSH);
+		Call.Key(InStruct->permissions);
+		Call.Key(InStruct->tagCount);
+		Call.Key(InStruct->size);
+		Call.Key(InStruct->choiceListType);
+		Call.Key(InStruct->choiceCount);
+		Call.Key(InStruct->nameSH);
+		Call.Key(InStruct->labelSH);
+		Call.Key(InStruct->templateNameSH);
+		Call.Key(InStruct->helpSH);
+		Call.Key(InStruct->hasMin);
+		Call.Key(InStruct->hasMax);
+		Call.Key(InStruct->hasUIMin);
+		Call.Key(InStruct->hasUIMax);
+		Call.Key(InStruct->min);
+		Call.Key(InStruct->max);
+		Call.Key(InStruct->UIMin);
+		Call.Key(InStruct->UIMax);
+		Call.Key(InStruct->invisible);
+		Call.Key(InStruct->disabled);
+		Call.Key(InStruct->spare);
+		Call.Key(InStruct->joinNext);
+		Call.Key(InStruct->labelNone);
+		Call.Key(InStruct->intValuesIndex);
+		Call.Key(InStruct->floatValuesIndex);
+		Call.Key(InStruct->stringValuesIndex);
+		Call.Key(InStruct->choiceIndex);
+		Call.Key(InStruct->inputNodeType);
+		Call.Key(InStruct->inputNodeFlag);
+		Call.Key(InStruct->isChildOfMultiParm);
+		Call.Key(InStruct->instanceNum);
+		Call.Key(InStruct->instanceLength);
+		Call.Key(InStruct->instanceCount);
+		Call.Key(InStruct->instanceStartOffset);
+		Call.Key(InStruct->rampType);
+		Call.Key(InStruct->visibilityConditionSH);
+		Call.Key(InStruct->disabledConditionSH);
+	}
+
+	static void
+	KeyFields(FCall& Call, const HAPI_PartInfo* InStruct)
+	{
+		Call.Key(InStruct != nullptr);
+		if (!InStruct)
+			return;
+
+		Call.Key(InStruct->id);
+		Call.Key(InStruct->nameSH);
+		Call.Key(InStruct->type);
+		Call.Key(InStruct->faceCount);
+		Call.Key(InStruct->vertexCount);
+		Call.Key(InStruct->pointCount);
+		for (int32 Idx = 0; Idx < HAPI_ATTROWNER_MAX; Idx++)
+			Call.Key(InStruct->attributeCounts[Idx]);
+		Call.Key(InStruct->isInstanced);
+		Call.Key(InStruct->instancedPartCount);
+		Call.Key(InStruct->instanceCount);
+		Call.Key(InStruct->hasChanged);
+	}
+}
+
+// The hooks replacing FHoudiniApi's functions while recording or replaying
+struct FHoudiniApiRecorderHooks
+{
+	using FCall = HoudiniApiRecorder::FCall;
+
+	// The functions that were hooked
+	struct Original
+	{
+		static FHoudiniApi::AddAttributeFuncPtr AddAttribute;
+		static FHoudiniApi::AddGroupFuncPtr AddGroup;
+		static FHoudiniApi::AssetInfo_CreateFuncPtr AssetInfo_Create;
+		static FHoudiniApi::AssetInfo_InitFuncPtr AssetInfo_Init;
+		static FHoudiniApi::AttributeInfo_CreateFuncPtr AttributeInfo_Create;
+		static FHoudiniApi::AttributeInfo_InitFuncPtr AttributeInfo_Init;
+		static FHoudiniApi::BindCustomImplementationFuncPtr BindCustomImplementation;
+		static FHoudiniApi::CancelPDGCookFuncPtr CancelPDGCook;
+		static FHoudiniApi::CheckForSpecificErrorsFuncPtr CheckForSpecificErrors;
+		static FHoudiniApi::CleanupFuncPtr Cleanup;
+		static FHoudiniApi::ClearConnectionErrorFuncPtr ClearConnectionError;
+		static FHoudiniApi::CloseSessionFuncPtr CloseSession;
+		static FHoudiniApi::CommitGeoFuncPtr CommitGeo;
+		static FHoudiniApi::CommitWorkitemsFuncPtr CommitWorkitems;
+		static FHoudiniApi::ComposeChildNodeListFuncPtr ComposeChildNodeList;
+		static FHoudiniApi::ComposeNodeCookResultFuncPtr ComposeNodeCookResult;
+		static FHoudiniApi::ComposeObjectListFuncPtr ComposeObjectList;
+		static FHoudiniApi::ConnectNodeInputFuncPtr ConnectNodeInput;
+		static FHoudiniApi::ConvertMatrixToEulerFuncPtr ConvertMatrixToEuler;
+		static FHoudiniApi::ConvertMatrixToQuatFuncPtr ConvertMatrixToQuat;
+		static FHoudiniApi::ConvertTransformFuncPtr ConvertTransform;
+		static FHoudiniApi::ConvertTransformEulerToMatrixFuncPtr ConvertTransformEulerToMatrix;
+		static FHoudiniApi::ConvertTransformQuatToMatrixFuncPtr ConvertTransformQuatToMatrix;
+		static FHoudiniApi::CookNodeFuncPtr CookNode;
+		static FHoudiniApi::CookOptions_AreEqualFuncPtr CookOptions_AreEqual;
+		static FHoudiniApi::CookOptions_CreateFuncPtr CookOptions_Create;
+		static FHoudiniApi::CookOptions_InitFuncPtr CookOptions_Init;
+		static FHoudiniApi::CookPDGFuncPtr CookPDG;
+		static FHoudiniApi::CreateCustomSessionFuncPtr CreateCustomSession;
+		static FHoudiniApi::CreateHeightFieldInputFuncPtr CreateHeightFieldInput;
+		static FHoudiniApi::CreateHeightfieldInputVolumeNodeFuncPtr CreateHeightfieldInputVolumeNode;
+		static FHoudiniApi::CreateInProcessSessionFuncPtr CreateInProcessSession;
+		static FHoudiniApi::CreateInputNodeFuncPtr CreateInputNode;
+		static FHoudiniApi::CreateNodeFuncPtr CreateNode;
+		static FHoudiniApi::CreateThriftNamedPipeSessionFuncPtr CreateThriftNamedPipeSession;
+		static FHoudiniApi::CreateThriftSocketSessionFuncPtr CreateThriftSocketSession;
+		static FHoudiniApi::CreateWorkitemFuncPtr CreateWorkitem;
+		static FHoudiniApi::CurveInfo_CreateFuncPtr CurveInfo_Create;
+		static FHoudiniApi::CurveInfo_InitFuncPtr CurveInfo_Init;
+		static FHoudiniApi::DeleteAttributeFuncPtr DeleteAttribute;
+		static FHoudiniApi::DeleteGroupFuncPtr DeleteGroup;
+		static FHoudiniApi::DeleteNodeFuncPtr DeleteNode;
+		static FHoudiniApi::DirtyPDGNodeFuncPtr DirtyPDGNode;
+		static FHoudiniApi::DisconnectNodeInputFuncPtr DisconnectNodeInput;
+		static FHoudiniApi::DisconnectNodeOutputsAtFuncPtr DisconnectNodeOutputsAt;
+		static FHoudiniApi::ExtractImageToFileFuncPtr ExtractImageToFile;
+		static FHoudiniApi::ExtractImageToMemoryFuncPtr ExtractImageToMemory;
+		static FHoudiniApi::GeoInfo_CreateFuncPtr GeoInfo_Create;
+		static FHoudiniApi::GeoInfo_GetGroupCountByTypeFuncPtr GeoInfo_GetGroupCountByType;
+		static FHoudiniApi::GeoInfo_InitFuncPtr GeoInfo_Init;
+		static FHoudiniApi::GetActiveCacheCountFuncPtr GetActiveCacheCount;
+		static FHoudiniApi::GetActiveCacheNamesFuncPtr GetActiveCacheNames;
+		static FHoudiniApi::GetAssetDefinitionParmCountsFuncPtr GetAssetDefinitionParmCounts;
+		static FHoudiniApi::GetAssetDefinitionParmInfosFuncPtr GetAssetDefinitionParmInfos;
+		static FHoudiniApi::GetAssetDefinitionParmValuesFuncPtr GetAssetDefinitionParmValues;
+		static FHoudiniApi::GetAssetInfoFuncPtr GetAssetInfo;
+		static FHoudiniApi::GetAttributeFloat64ArrayDataFuncPtr GetAttributeFloat64ArrayData;
+		static FHoudiniApi::GetAttributeFloat64DataFuncPtr GetAttributeFloat64Data;
+		static FHoudiniApi::GetAttributeFloatArrayDataFuncPtr GetAttributeFloatArrayData;
+		static FHoudiniApi::GetAttributeFloatDataFuncPtr GetAttributeFloatData;
+		static FHoudiniApi::GetAttributeInfoFuncPtr GetAttributeInfo;
+		static FHoudiniApi::GetAttributeInt16ArrayDataFuncPtr GetAttributeInt16ArrayData;
+		static FHoudiniApi::GetAttributeInt16DataFuncPtr GetAttributeInt16Data;
+		static FHoudiniApi::GetAttributeInt64ArrayDataFuncPtr GetAttributeInt64ArrayData;
+		static FHoudiniApi::GetAttributeInt64DataFuncPtr GetAttributeInt64Data;
+		static FHoudiniApi::GetAttributeInt8ArrayDataFuncPtr GetAttributeInt8ArrayData;
+		static FHoudiniApi::GetAttributeInt8DataFuncPtr GetAttributeInt8Data;
+		static FHoudiniApi::GetAttributeIntArrayDataFuncPtr GetAttributeIntArrayData;
+		static FHoudiniApi::GetAttributeIntDataFuncPtr GetAttributeIntData;
+		static FHoudiniApi::GetAttributeNamesFuncPtr GetAttributeNames;
+		static FHoudiniApi::GetAttributeStringArrayDataFuncPtr GetAttributeStringArrayData;
+		static FHoudiniApi::GetAttributeStringDataFuncPtr GetAttributeStringData;
+		static FHoudiniApi::GetAttributeUInt8ArrayDataFuncPtr GetAttributeUInt8ArrayData;
+		static FHoudiniApi::GetAttributeUInt8DataFuncPtr GetAttributeUInt8Data;
+		static FHoudiniApi::GetAvailableAssetCountFuncPtr GetAvailableAssetCount;
+		static FHoudiniApi::GetAvailableAssetsFuncPtr GetAvailableAssets;
+		static FHoudiniApi::GetBoxInfoFuncPtr GetBoxInfo;
+		static FHoudiniApi::GetCachePropertyFuncPtr GetCacheProperty;
+		static FHoudiniApi::GetComposedChildNodeListFuncPtr GetComposedChildNodeList;
+		static FHoudiniApi::GetComposedNodeCookResultFuncPtr GetComposedNodeCookResult;
+		static FHoudiniApi::GetComposedObjectListFuncPtr GetComposedObjectList;
+		static FHoudiniApi::GetComposedObjectTransformsFuncPtr GetComposedObjectTransforms;
+		static FHoudiniApi::GetConnectionErrorFuncPtr GetConnectionError;
+		static FHoudiniApi::GetConnectionErrorLengthFuncPtr GetConnectionErrorLength;
+		static FHoudiniApi::GetCookingCurrentCountFuncPtr GetCookingCurrentCount;
+		static FHoudiniApi::GetCookingTotalCountFuncPtr GetCookingTotalCount;
+		static FHoudiniApi::GetCurveCountsFuncPtr GetCurveCounts;
+		static FHoudiniApi::GetCurveInfoFuncPtr GetCurveInfo;
+		static FHoudiniApi::GetCurveKnotsFuncPtr GetCurveKnots;
+		static FHoudiniApi::GetCurveOrdersFuncPtr GetCurveOrders;
+		static FHoudiniApi::GetDisplayGeoInfoFuncPtr GetDisplayGeoInfo;
+		static FHoudiniApi::GetEnvIntFuncPtr GetEnvInt;
+		static FHoudiniApi::GetFaceCountsFuncPtr GetFaceCounts;
+		static FHoudiniApi::GetFirstVolumeTileFuncPtr GetFirstVolumeTile;
+		static FHoudiniApi::GetGeoInfoFuncPtr GetGeoInfo;
+		static FHoudiniApi::GetGeoSizeFuncPtr GetGeoSize;
+		static FHoudiniApi::GetGroupCountOnPackedInstancePartFuncPtr GetGroupCountOnPackedInstancePart;
+		static FHoudiniApi::GetGroupMembershipFuncPtr GetGroupMembership;
+		static FHoudiniApi::GetGroupMembershipOnPackedInstancePartFuncPtr GetGroupMembershipOnPackedInstancePart;
+		static FHoudiniApi::GetGroupNamesFuncPtr GetGroupNames;
+		static FHoudiniApi::GetGroupNamesOnPackedInstancePartFuncPtr GetGroupNamesOnPackedInstancePart;
+		static FHoudiniApi::GetHIPFileNodeCountFuncPtr GetHIPFileNodeCount;
+		static FHoudiniApi::GetHIPFileNodeIdsFuncPtr GetHIPFileNodeIds;
+		static FHoudiniApi::GetHandleBindingInfoFuncPtr GetHandleBindingInfo;
+		static FHoudiniApi::GetHandleInfoFuncPtr GetHandleInfo;
+		static FHoudiniApi::GetHeightFieldDataFuncPtr GetHeightFieldData;
+		static FHoudiniApi::GetImageFilePathFuncPtr GetImageFilePath;
+		static FHoudiniApi::GetImageInfoFuncPtr GetImageInfo;
+		static FHoudiniApi::GetImageMemoryBufferFuncPtr GetImageMemoryBuffer;
+		static FHoudiniApi::GetImagePlaneCountFuncPtr GetImagePlaneCount;
+		static FHoudiniApi::GetImagePlanesFuncPtr GetImagePlanes;
+		static FHoudiniApi::GetInstanceTransformsOnPartFuncPtr GetInstanceTransformsOnPart;
+		static FHoudiniApi::GetInstancedObjectIdsFuncPtr GetInstancedObjectIds;
+		static FHoudiniApi::GetInstancedPartIdsFuncPtr GetInstancedPartIds;
+		static FHoudiniApi::GetInstancerPartTransformsFuncPtr GetInstancerPartTransforms;
+		static FHoudiniApi::GetManagerNodeIdFuncPtr GetManagerNodeId;
+		static FHoudiniApi::GetMaterialInfoFuncPtr GetMaterialInfo;
+		static FHoudiniApi::GetMaterialNodeIdsOnFacesFuncPtr GetMaterialNodeIdsOnFaces;
+		static FHoudiniApi::GetNextVolumeTileFuncPtr GetNextVolumeTile;
+		static FHoudiniApi::GetNodeInfoFuncPtr GetNodeInfo;
+		static FHoudiniApi::GetNodeInputNameFuncPtr GetNodeInputName;
+		static FHoudiniApi::GetNodeOutputNameFuncPtr GetNodeOutputName;
+		static FHoudiniApi::GetNodePathFuncPtr GetNodePath;
+		static FHoudiniApi::GetNumWorkitemsFuncPtr GetNumWorkitems;
+		static FHoudiniApi::GetObjectInfoFuncPtr GetObjectInfo;
+		static FHoudiniApi::GetObjectTransformFuncPtr GetObjectTransform;
+		static FHoudiniApi::GetOutputNodeIdFuncPtr GetOutputNodeId;
+		static FHoudiniApi::GetPDGEventsFuncPtr GetPDGEvents;
+		static FHoudiniApi::GetPDGGraphContextIdFuncPtr GetPDGGraphContextId;
+		static FHoudiniApi::GetPDGGraphContextsFuncPtr GetPDGGraphContexts;
+		static FHoudiniApi::GetPDGStateFuncPtr GetPDGState;
+		static FHoudiniApi::GetParametersFuncPtr GetParameters;
+		static FHoudiniApi::GetParmChoiceListsFuncPtr GetParmChoiceLists;
+		static FHoudiniApi::GetParmExpressionFuncPtr GetParmExpression;
+		static FHoudiniApi::GetParmFileFuncPtr GetParmFile;
+		static FHoudiniApi::GetParmFloatValueFuncPtr GetParmFloatValue;
+		static FHoudiniApi::GetParmFloatValuesFuncPtr GetParmFloatValues;
+		static FHoudiniApi::GetParmIdFromNameFuncPtr GetParmIdFromName;
+		static FHoudiniApi::GetParmInfoFuncPtr GetParmInfo;
+		static FHoudiniApi::GetParmInfoFromNameFuncPtr GetParmInfoFromName;
+		static FHoudiniApi::GetParmIntValueFuncPtr GetParmIntValue;
+		static FHoudiniApi::GetParmIntValuesFuncPtr GetParmIntValues;
+		static FHoudiniApi::GetParmNodeValueFuncPtr GetParmNodeValue;
+		static FHoudiniApi::GetParmStringValueFuncPtr GetParmStringValue;
+		static FHoudiniApi::GetParmStringValuesFuncPtr GetParmStringValues;
+		static FHoudiniApi::GetParmTagNameFuncPtr GetParmTagName;
+		static FHoudiniApi::GetParmTagValueFuncPtr GetParmTagValue;
+		static FHoudiniApi::GetParmWithTagFuncPtr GetParmWithTag;
+		static FHoudiniApi::GetPartInfoFuncPtr GetPartInfo;
+		static FHoudiniApi::GetPresetFuncPtr GetPreset;
+		static FHoudiniApi::GetPresetBufLengthFuncPtr GetPresetBufLength;
+		static FHoudiniApi::GetServerEnvIntFuncPtr GetServerEnvInt;
+		static FHoudiniApi::GetServerEnvStringFuncPtr GetServerEnvString;
+		static FHoudiniApi::GetServerEnvVarCountFuncPtr GetServerEnvVarCount;
+		static FHoudiniApi::GetServerEnvVarListFuncPtr GetServerEnvVarList;
+		static FHoudiniApi::GetSessionEnvIntFuncPtr GetSessionEnvInt;
+		static FHoudiniApi::GetSessionSyncInfoFuncPtr GetSessionSyncInfo;
+		static FHoudiniApi::GetSphereInfoFuncPtr GetSphereInfo;
+		static FHoudiniApi::GetStatusFuncPtr GetStatus;
+		static FHoudiniApi::GetStatusStringFuncPtr GetStatusString;
+		static FHoudiniApi::GetStatusStringBufLengthFuncPtr GetStatusStringBufLength;
+		static FHoudiniApi::GetStringFuncPtr GetString;
+		static FHoudiniApi::GetStringBatchFuncPtr GetStringBatch;
+		static FHoudiniApi::GetStringBatchSizeFuncPtr GetStringBatchSize;
+		static FHoudiniApi::GetStringBufLengthFuncPtr GetStringBufLength;
+		static FHoudiniApi::GetSupportedImageFileFormatCountFuncPtr GetSupportedImageFileFormatCount;
+		static FHoudiniApi::GetSupportedImageFileFormatsFuncPtr GetSupportedImageFileFormats;
+		static FHoudiniApi::GetTimeFuncPtr GetTime;
+		static FHoudiniApi::GetTimelineOptionsFuncPtr GetTimelineOptions;
+		static FHoudiniApi::GetTotalCookCountFuncPtr GetTotalCookCount;
+		static FHoudiniApi::GetUseHoudiniTimeFuncPtr GetUseHoudiniTime;
+		static FHoudiniApi::GetVertexListFuncPtr GetVertexList;
+		static FHoudiniApi::GetViewportFuncPtr GetViewport;
+		static FHoudiniApi::GetVolumeBoundsFuncPtr GetVolumeBounds;
+		static FHoudiniApi::GetVolumeInfoFuncPtr GetVolumeInfo;
+		static FHoudiniApi::GetVolumeTileFloatDataFuncPtr GetVolumeTileFloatData;
+		static FHoudiniApi::GetVolumeTileIntDataFuncPtr GetVolumeTileIntData;
+		static FHoudiniApi::GetVolumeVisualInfoFuncPtr GetVolumeVisualInfo;
+		static FHoudiniApi::GetVolumeVoxelFloatDataFuncPtr GetVolumeVoxelFloatData;
+		static FHoudiniApi::GetVolumeVoxelIntDataFuncPtr GetVolumeVoxelIntData;
+		static FHoudiniApi::GetWorkitemDataLengthFuncPtr GetWorkitemDataLength;
+		static FHoudiniApi::GetWorkitemFloatDataFuncPtr GetWorkitemFloatData;
+		static FHoudiniApi::GetWorkitemInfoFuncPtr GetWorkitemInfo;
+		static FHoudiniApi::GetWorkitemIntDataFuncPtr GetWorkitemIntData;
+		static FHoudiniApi::GetWorkitemResultInfoFuncPtr GetWorkitemResultInfo;
+		static FHoudiniApi::GetWorkitemStringDataFuncPtr GetWorkitemStringData;
+		static FHoudiniApi::GetWorkitemsFuncPtr GetWorkitems;
+		static FHoudiniApi::HandleBindingInfo_CreateFuncPtr HandleBindingInfo_Create;
+		static FHoudiniApi::HandleBindingInfo_InitFuncPtr HandleBindingInfo_Init;
+		static FHoudiniApi::HandleInfo_CreateFuncPtr HandleInfo_Create;
+		static FHoudiniApi::HandleInfo_InitFuncPtr HandleInfo_Init;
+		static FHoudiniApi::ImageFileFormat_CreateFuncPtr ImageFileFormat_Create;
+		static FHoudiniApi::ImageFileFormat_InitFuncPtr ImageFileFormat_Init;
+		static FHoudiniApi::ImageInfo_CreateFuncPtr ImageInfo_Create;
+		static FHoudiniApi::ImageInfo_InitFuncPtr ImageInfo_Init;
+		static FHoudiniApi::InitializeFuncPtr Initialize;
+		static FHoudiniApi::InsertMultiparmInstanceFuncPtr InsertMultiparmInstance;
+		static FHoudiniApi::InterruptFuncPtr Interrupt;
+		static FHoudiniApi::IsInitializedFuncPtr IsInitialized;
+		static FHoudiniApi::IsNodeValidFuncPtr IsNodeValid;
+		static FHoudiniApi::IsSessionValidFuncPtr IsSessionValid;
+		static FHoudiniApi::Keyframe_CreateFuncPtr Keyframe_Create;
+		static FHoudiniApi::Keyframe_InitFuncPtr Keyframe_Init;
+		static FHoudiniApi::LoadAssetLibraryFromFileFuncPtr LoadAssetLibraryFromFile;
+		static FHoudiniApi::LoadAssetLibraryFromMemoryFuncPtr LoadAssetLibraryFromMemory;
+		static FHoudiniApi::LoadGeoFromFileFuncPtr LoadGeoFromFile;
+		static FHoudiniApi::LoadGeoFromMemoryFuncPtr LoadGeoFromMemory;
+		static FHoudiniApi::LoadHIPFileFuncPtr LoadHIPFile;
+		static FHoudiniApi::LoadNodeFromFileFuncPtr LoadNodeFromFile;
+		static FHoudiniApi::MaterialInfo_CreateFuncPtr MaterialInfo_Create;
+		static FHoudiniApi::MaterialInfo_InitFuncPtr MaterialInfo_Init;
+		static FHoudiniApi::MergeHIPFileFuncPtr MergeHIPFile;
+		static FHoudiniApi::NodeInfo_CreateFuncPtr NodeInfo_Create;
+		static FHoudiniApi::NodeInfo_InitFuncPtr NodeInfo_Init;
+		static FHoudiniApi::ObjectInfo_CreateFuncPtr ObjectInfo_Create;
+		static FHoudiniApi::ObjectInfo_InitFuncPtr ObjectInfo_Init;
+		static FHoudiniApi::ParmChoiceInfo_CreateFuncPtr ParmChoiceInfo_Create;
+		static FHoudiniApi::ParmChoiceInfo_InitFuncPtr ParmChoiceInfo_Init;
+		static FHoudiniApi::ParmHasExpressionFuncPtr ParmHasExpression;
+		static FHoudiniApi::ParmHasTagFuncPtr ParmHasTag;
+		static FHoudiniApi::ParmInfo_CreateFuncPtr ParmInfo_Create;
+		static FHoudiniApi::ParmInfo_GetFloatValueCountFuncPtr ParmInfo_GetFloatValueCount;
+		static FHoudiniApi::ParmInfo_GetIntValueCountFuncPtr ParmInfo_GetIntValueCount;
+		static FHoudiniApi::ParmInfo_GetStringValueCountFuncPtr ParmInfo_GetStringValueCount;
+		static FHoudiniApi::ParmInfo_InitFuncPtr ParmInfo_Init;
+		static FHoudiniApi::ParmInfo_IsFloatFuncPtr ParmInfo_IsFloat;
+		static FHoudiniApi::ParmInfo_IsIntFuncPtr ParmInfo_IsInt;
+		static FHoudiniApi::ParmInfo_IsNodeFuncPtr ParmInfo_IsNode;
+		static FHoudiniApi::ParmInfo_IsNonValueFuncPtr ParmInfo_IsNonValue;
+		static FHoudiniApi::ParmInfo_IsPathFuncPtr ParmInfo_IsPath;
+		static FHoudiniApi::ParmInfo_IsStringFuncPtr ParmInfo_IsString;
+		static FHoudiniApi::PartInfo_CreateFuncPtr PartInfo_Create;
+		static FHoudiniApi::PartInfo_GetAttributeCountByOwnerFuncPtr PartInfo_GetAttributeCountByOwner;
+		static FHoudiniApi::PartInfo_GetElementCountByAttributeOwnerFuncPtr PartInfo_GetElementCountByAttributeOwner;
+		static FHoudiniApi::PartInfo_GetElementCountByGroupTypeFuncPtr PartInfo_GetElementCountByGroupType;
+		static FHoudiniApi::PartInfo_InitFuncPtr PartInfo_Init;
+		static FHoudiniApi::PausePDGCookFuncPtr PausePDGCook;
+		static FHoudiniApi::PythonThreadInterpreterLockFuncPtr PythonThreadInterpreterLock;
+		static FHoudiniApi::QueryNodeInputFuncPtr QueryNodeInput;
+		static FHoudiniApi::QueryNodeOutputConnectedCountFuncPtr QueryNodeOutputConnectedCount;
+		static FHoudiniApi::QueryNodeOutputConnectedNodesFuncPtr QueryNodeOutputConnectedNodes;
+		static FHoudiniApi::RemoveCustomStringFuncPtr RemoveCustomString;
+		static FHoudiniApi::RemoveMultiparmInstanceFuncPtr RemoveMultiparmInstance;
+		static FHoudiniApi::RemoveParmExpressionFuncPtr RemoveParmExpression;
+		static FHoudiniApi::RenameNodeFuncPtr RenameNode;
+		static FHoudiniApi::RenderCOPToImageFuncPtr RenderCOPToImage;
+		static FHoudiniApi::RenderTextureToImageFuncPtr RenderTextureToImage;
+		static FHoudiniApi::ResetSimulationFuncPtr ResetSimulation;
+		static FHoudiniApi::RevertGeoFuncPtr RevertGeo;
+		static FHoudiniApi::RevertParmToDefaultFuncPtr RevertParmToDefault;
+		static FHoudiniApi::RevertParmToDefaultsFuncPtr RevertParmToDefaults;
+		static FHoudiniApi::SaveGeoToFileFuncPtr SaveGeoToFile;
+		static FHoudiniApi::SaveGeoToMemoryFuncPtr SaveGeoToMemory;
+		static FHoudiniApi::SaveHIPFileFuncPtr SaveHIPFile;
+		static FHoudiniApi::SaveNodeToFileFuncPtr SaveNodeToFile;
+		static FHoudiniApi::SessionSyncInfo_CreateFuncPtr SessionSyncInfo_Create;
+		static FHoudiniApi::SetAnimCurveFuncPtr SetAnimCurve;
+		static FHoudiniApi::SetAttributeFloat64DataFuncPtr SetAttributeFloat64Data;
+		static FHoudiniApi::SetAttributeFloatDataFuncPtr SetAttributeFloatData;
+		static FHoudiniApi::SetAttributeInt16DataFuncPtr SetAttributeInt16Data;
+		static FHoudiniApi::SetAttributeInt64DataFuncPtr SetAttributeInt64Data;
+		static FHoudiniApi::SetAttributeInt8DataFuncPtr SetAttributeInt8Data;
+		static FHoudiniApi::SetAttributeIntDataFuncPtr SetAttributeIntData;
+		static FHoudiniApi::SetAttributeStringDataFuncPtr SetAttributeStringData;
+		static FHoudiniApi::SetAttributeUInt8DataFuncPtr SetAttributeUInt8Data;
+		static FHoudiniApi::SetCachePropertyFuncPtr SetCacheProperty;
+		static FHoudiniApi::SetCurveCountsFuncPtr SetCurveCounts;
+		static FHoudiniApi::SetCurveInfoFuncPtr SetCurveInfo;
+		static FHoudiniApi::SetCurveKnotsFuncPtr SetCurveKnots;
+		static FHoudiniApi::SetCurveOrdersFuncPtr SetCurveOrders;
+		static FHoudiniApi::SetCustomStringFuncPtr SetCustomString;
+		static FHoudiniApi::SetFaceCountsFuncPtr SetFaceCounts;
+		static FHoudiniApi::SetGroupMembershipFuncPtr SetGroupMembership;
+		static FHoudiniApi::SetHeightFieldDataFuncPtr SetHeightFieldData;
+		static FHoudiniApi::SetImageInfoFuncPtr SetImageInfo;
+		static FHoudiniApi::SetNodeDisplayFuncPtr SetNodeDisplay;
+		static FHoudiniApi::SetObjectTransformFuncPtr SetObjectTransform;
+		static FHoudiniApi::SetParmExpressionFuncPtr SetParmExpression;
+		static FHoudiniApi::SetParmFloatValueFuncPtr SetParmFloatValue;
+		static FHoudiniApi::SetParmFloatValuesFuncPtr SetParmFloatValues;
+		static FHoudiniApi::SetParmIntValueFuncPtr SetParmIntValue;
+		static FHoudiniApi::SetParmIntValuesFuncPtr SetParmIntValues;
+		static FHoudiniApi::SetParmNodeValueFuncPtr SetParmNodeValue;
+		static FHoudiniApi::SetParmStringValueFuncPtr SetParmStringValue;
+		static FHoudiniApi::SetPartInfoFuncPtr SetPartInfo;
+		static FHoudiniApi::SetPresetFuncPtr SetPreset;
+		static FHoudiniApi::SetServerEnvIntFuncPtr SetServerEnvInt;
+		static FHoudiniApi::SetServerEnvStringFuncPtr SetServerEnvString;
+		static FHoudiniApi::SetSessionSyncFuncPtr SetSessionSync;
+		static FHoudiniApi::SetSessionSyncInfoFuncPtr SetSessionSyncInfo;
+		static FHoudiniApi::SetTimeFuncPtr SetTime;
+		static FHoudiniApi::SetTimelineOptionsFuncPtr SetTimelineOptions;
+		static FHoudiniApi::SetTransformAnimCurveFuncPtr SetTransformAnimCurve;
+		static FHoudiniApi::SetUseHoudiniTimeFuncPtr SetUseHoudiniTime;
+		static FHoudiniApi::SetVertexListFuncPtr SetVertexList;
+		static FHoudiniApi::SetViewportFuncPtr SetViewport;
+		static FHoudiniApi::SetVolumeInfoFuncPtr SetVolumeInfo;
+		static FHoudiniApi::SetVolumeTileFloatDataFuncPtr SetVolumeTileFloatData;
+		static FHoudiniApi::SetVolumeTileIntDataFuncPtr SetVolumeTileIntData;
+		static FHoudiniApi::SetVolumeVoxelFloatDataFuncPtr SetVolumeVoxelFloatData;
+		static FHoudiniApi::SetVolumeVoxelIntDataFuncPtr SetVolumeVoxelIntData;
+		static FHoudiniApi::SetWorkitemFloatDataFuncPtr SetWorkitemFloatData;
+		static FHoudiniApi::SetWorkitemIntDataFuncPtr SetWorkitemIntData;
+		static FHoudiniApi::SetWorkitemStringDataFuncPtr SetWorkitemStringData;
+		static FHoudiniApi::StartThriftNamedPipeServerFuncPtr StartThriftNamedPipeServer;
+		static FHoudiniApi::StartThriftSocketServerFuncPtr StartThriftSocketServer;
+		static FHoudiniApi::ThriftServerOptions_CreateFuncPtr ThriftServerOptions_Create;
+		static FHoudiniApi::ThriftServerOptions_InitFuncPtr ThriftServerOptions_Init;
+		static FHoudiniApi::TimelineOptions_CreateFuncPtr TimelineOptions_Create;
+		static FHoudiniApi::TimelineOptions_InitFuncPtr TimelineOptions_Init;
+		static FHoudiniApi::TransformEuler_CreateFuncPtr TransformEuler_Create;
+		static FHoudiniApi::TransformEuler_InitFuncPtr TransformEuler_Init;
+		static FHoudiniApi::Transform_CreateFuncPtr Transform_Create;
+		static FHoudiniApi::Transform_InitFuncPtr Transform_Init;
+		static FHoudiniApi::Viewport_CreateFuncPtr Viewport_Create;
+		static FHoudiniApi::VolumeInfo_CreateFuncPtr VolumeInfo_Create;
+		static FHoudiniApi::VolumeInfo_InitFuncPtr VolumeInfo_Init;
+		static FHoudiniApi::VolumeTileInfo_CreateFuncPtr VolumeTileInfo_Create;
+		static FHoudiniApi::VolumeTileInfo_InitFuncPtr VolumeTileInfo_Init;
+	};
+
+	static HAPI_Result AddAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info)
+	{
+		FCall Call(EHoudiniApiFunction::AddAttribute);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::AddAttribute(session, node_id, part_id, name, attr_info);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result AddGroup(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name)
+	{
+		FCall Call(EHoudiniApiFunction::AddGroup);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(group_type);
+		Call.Key(group_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::AddGroup(session, node_id, part_id, group_type, group_name);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_AssetInfo AssetInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::AssetInfo_Create, true);
+		const HAPI_AssetInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_AssetInfo>(HAPI_AssetInfo()) : Original::AssetInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void AssetInfo_Init(HAPI_AssetInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::AssetInfo_Init, true);
+		if (!Call.Replay())
+			Original::AssetInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_AttributeInfo AttributeInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::AttributeInfo_Create, true);
+		const HAPI_AttributeInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_AttributeInfo>(HAPI_AttributeInfo()) : Original::AttributeInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void AttributeInfo_Init(HAPI_AttributeInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::AttributeInfo_Init, true);
+		if (!Call.Replay())
+			Original::AttributeInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result BindCustomImplementation(HAPI_SessionType session_type, const char * dll_path)
+	{
+		FCall Call(EHoudiniApiFunction::BindCustomImplementation);
+		Call.Key(session_type);
+		Call.Key(dll_path);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::BindCustomImplementation(session_type, dll_path);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CancelPDGCook(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id)
+	{
+		FCall Call(EHoudiniApiFunction::CancelPDGCook);
+		Call.Key(graph_context_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CancelPDGCook(session, graph_context_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CheckForSpecificErrors(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ErrorCodeBits errors_to_look_for, HAPI_ErrorCodeBits * errors_found)
+	{
+		FCall Call(EHoudiniApiFunction::CheckForSpecificErrors);
+		Call.Key(node_id);
+		Call.Key(errors_to_look_for);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CheckForSpecificErrors(session, node_id, errors_to_look_for, errors_found);
+		Call.Output(errors_found, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result Cleanup(const HAPI_Session * session)
+	{
+		FCall Call(EHoudiniApiFunction::Cleanup);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::Cleanup(session);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ClearConnectionError()
+	{
+		FCall Call(EHoudiniApiFunction::ClearConnectionError);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ClearConnectionError();
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CloseSession(const HAPI_Session * session)
+	{
+		FCall Call(EHoudiniApiFunction::CloseSession);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CloseSession(session);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CommitGeo(const HAPI_Session * session, HAPI_NodeId node_id)
+	{
+		FCall Call(EHoudiniApiFunction::CommitGeo);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CommitGeo(session, node_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CommitWorkitems(const HAPI_Session * session, HAPI_NodeId node_id)
+	{
+		FCall Call(EHoudiniApiFunction::CommitWorkitems);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CommitWorkitems(session, node_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ComposeChildNodeList(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeTypeBits node_type_filter, HAPI_NodeFlagsBits node_flags_filter, HAPI_Bool recursive, int * count)
+	{
+		FCall Call(EHoudiniApiFunction::ComposeChildNodeList);
+		Call.Key(parent_node_id);
+		Call.Key(node_type_filter);
+		Call.Key(node_flags_filter);
+		Call.Key(recursive);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ComposeChildNodeList(session, parent_node_id, node_type_filter, node_flags_filter, recursive, count);
+		Call.Output(count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ComposeNodeCookResult(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_StatusVerbosity verbosity, int * buffer_length)
+	{
+		FCall Call(EHoudiniApiFunction::ComposeNodeCookResult);
+		Call.Key(node_id);
+		Call.Key(verbosity);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ComposeNodeCookResult(session, node_id, verbosity, buffer_length);
+		Call.Output(buffer_length, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ComposeObjectList(const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * categories, int * object_count)
+	{
+		FCall Call(EHoudiniApiFunction::ComposeObjectList);
+		Call.Key(parent_node_id);
+		Call.Key(categories);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ComposeObjectList(session, parent_node_id, categories, object_count);
+		Call.Output(object_count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ConnectNodeInput(const HAPI_Session * session, HAPI_NodeId node_id, int input_index, HAPI_NodeId node_id_to_connect, int output_index)
+	{
+		FCall Call(EHoudiniApiFunction::ConnectNodeInput);
+		Call.Key(node_id);
+		Call.Key(input_index);
+		Call.Key(node_id_to_connect);
+		Call.Key(output_index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ConnectNodeInput(session, node_id, input_index, node_id_to_connect, output_index);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ConvertMatrixToEuler(const HAPI_Session * session, const float * matrix, HAPI_RSTOrder rst_order, HAPI_XYZOrder rot_order, HAPI_TransformEuler * transform_out)
+	{
+		FCall Call(EHoudiniApiFunction::ConvertMatrixToEuler);
+		Call.Key(rst_order);
+		Call.Key(rot_order);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ConvertMatrixToEuler(session, matrix, rst_order, rot_order, transform_out);
+		Call.Output(transform_out, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ConvertMatrixToQuat(const HAPI_Session * session, const float * matrix, HAPI_RSTOrder rst_order, HAPI_Transform * transform_out)
+	{
+		FCall Call(EHoudiniApiFunction::ConvertMatrixToQuat);
+		Call.Key(rst_order);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ConvertMatrixToQuat(session, matrix, rst_order, transform_out);
+		Call.Output(transform_out, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ConvertTransform(const HAPI_Session * session, const HAPI_TransformEuler * transform_in, HAPI_RSTOrder rst_order, HAPI_XYZOrder rot_order, HAPI_TransformEuler * transform_out)
+	{
+		FCall Call(EHoudiniApiFunction::ConvertTransform);
+		Call.Key(rst_order);
+		Call.Key(rot_order);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ConvertTransform(session, transform_in, rst_order, rot_order, transform_out);
+		Call.Output(transform_out, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ConvertTransformEulerToMatrix(const HAPI_Session * session, const HAPI_TransformEuler * transform, float * matrix)
+	{
+		FCall Call(EHoudiniApiFunction::ConvertTransformEulerToMatrix);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ConvertTransformEulerToMatrix(session, transform, matrix);
+		Call.Output(matrix, 16);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ConvertTransformQuatToMatrix(const HAPI_Session * session, const HAPI_Transform * transform, float * matrix)
+	{
+		FCall Call(EHoudiniApiFunction::ConvertTransformQuatToMatrix);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ConvertTransformQuatToMatrix(session, transform, matrix);
+		Call.Output(matrix, 16);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CookNode(const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_CookOptions * cook_options)
+	{
+		FCall Call(EHoudiniApiFunction::CookNode);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CookNode(session, node_id, cook_options);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Bool CookOptions_AreEqual(const HAPI_CookOptions * left, const HAPI_CookOptions * right)
+	{
+		FCall Call(EHoudiniApiFunction::CookOptions_AreEqual);
+		HoudiniApiRecorder::KeyFields(Call, left);
+		HoudiniApiRecorder::KeyFields(Call, right);
+		const HAPI_Bool Result = Call.Replay() ? Call.ReplayResult<HAPI_Bool>(HAPI_Bool()) : Original::CookOptions_AreEqual(left, right);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_CookOptions CookOptions_Create()
+	{
+		FCall Call(EHoudiniApiFunction::CookOptions_Create, true);
+		const HAPI_CookOptions Result = Call.Replay() ? Call.ReplayResult<HAPI_CookOptions>(HAPI_CookOptions()) : Original::CookOptions_Create();
+		return Call.Finish(Result);
+	}
+
+	static void CookOptions_Init(HAPI_CookOptions * in)
+	{
+		FCall Call(EHoudiniApiFunction::CookOptions_Init, true);
+		if (!Call.Replay())
+			Original::CookOptions_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result CookPDG(const HAPI_Session * session, HAPI_NodeId cook_node_id, int generate_only, int blocking)
+	{
+		FCall Call(EHoudiniApiFunction::CookPDG);
+		Call.Key(cook_node_id);
+		Call.Key(generate_only);
+		Call.Key(blocking);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CookPDG(session, cook_node_id, generate_only, blocking);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateCustomSession(HAPI_SessionType session_type, void * session_info, HAPI_Session * session)
+	{
+		FCall Call(EHoudiniApiFunction::CreateCustomSession);
+		Call.Key(session_type);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateCustomSession(session_type, session_info, session);
+		Call.Output(session, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateHeightFieldInput(const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * name, int xsize, int ysize, float voxelsize, HAPI_HeightFieldSampling sampling, HAPI_NodeId * heightfield_node_id, HAPI_NodeId * height_node_id, HAPI_NodeId * mask_node_id, HAPI_NodeId * merge_node_id)
+	{
+		FCall Call(EHoudiniApiFunction::CreateHeightFieldInput);
+		Call.Key(parent_node_id);
+		Call.Key(name);
+		Call.Key(xsize);
+		Call.Key(ysize);
+		Call.Key(voxelsize);
+		Call.Key(sampling);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateHeightFieldInput(session, parent_node_id, name, xsize, ysize, voxelsize, sampling, heightfield_node_id, height_node_id, mask_node_id, merge_node_id);
+		Call.Output(heightfield_node_id, 1);
+		Call.Output(height_node_id, 1);
+		Call.Output(mask_node_id, 1);
+		Call.Output(merge_node_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateHeightfieldInputVolumeNode(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeId * new_node_id, const char * name, int xsize, int ysize, float voxelsize)
+	{
+		FCall Call(EHoudiniApiFunction::CreateHeightfieldInputVolumeNode);
+		Call.Key(parent_node_id);
+		Call.Key(name);
+		Call.Key(xsize);
+		Call.Key(ysize);
+		Call.Key(voxelsize);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateHeightfieldInputVolumeNode(session, parent_node_id, new_node_id, name, xsize, ysize, voxelsize);
+		Call.Output(new_node_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateInProcessSession(HAPI_Session * session)
+	{
+		FCall Call(EHoudiniApiFunction::CreateInProcessSession);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateInProcessSession(session);
+		Call.Output(session, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateInputNode(const HAPI_Session * session, HAPI_NodeId * node_id, const char * name)
+	{
+		FCall Call(EHoudiniApiFunction::CreateInputNode);
+		Call.Key(name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateInputNode(session, node_id, name);
+		Call.Output(node_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateNode(const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * operator_name, const char * node_label, HAPI_Bool cook_on_creation, HAPI_NodeId * new_node_id)
+	{
+		FCall Call(EHoudiniApiFunction::CreateNode);
+		Call.Key(parent_node_id);
+		Call.Key(operator_name);
+		Call.Key(node_label);
+		Call.Key(cook_on_creation);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateNode(session, parent_node_id, operator_name, node_label, cook_on_creation, new_node_id);
+		Call.Output(new_node_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateThriftNamedPipeSession(HAPI_Session * session, const char * pipe_name)
+	{
+		FCall Call(EHoudiniApiFunction::CreateThriftNamedPipeSession);
+		Call.Key(pipe_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateThriftNamedPipeSession(session, pipe_name);
+		Call.Output(session, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateThriftSocketSession(HAPI_Session * session, const char * host_name, int port)
+	{
+		FCall Call(EHoudiniApiFunction::CreateThriftSocketSession);
+		Call.Key(host_name);
+		Call.Key(port);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateThriftSocketSession(session, host_name, port);
+		Call.Output(session, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result CreateWorkitem(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId * workitem_id, const char * name, int index)
+	{
+		FCall Call(EHoudiniApiFunction::CreateWorkitem);
+		Call.Key(node_id);
+		Call.Key(name);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::CreateWorkitem(session, node_id, workitem_id, name, index);
+		Call.Output(workitem_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_CurveInfo CurveInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::CurveInfo_Create, true);
+		const HAPI_CurveInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_CurveInfo>(HAPI_CurveInfo()) : Original::CurveInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void CurveInfo_Init(HAPI_CurveInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::CurveInfo_Init, true);
+		if (!Call.Replay())
+			Original::CurveInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result DeleteAttribute(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info)
+	{
+		FCall Call(EHoudiniApiFunction::DeleteAttribute);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::DeleteAttribute(session, node_id, part_id, name, attr_info);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result DeleteGroup(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name)
+	{
+		FCall Call(EHoudiniApiFunction::DeleteGroup);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(group_type);
+		Call.Key(group_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::DeleteGroup(session, node_id, part_id, group_type, group_name);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result DeleteNode(const HAPI_Session * session, HAPI_NodeId node_id)
+	{
+		FCall Call(EHoudiniApiFunction::DeleteNode);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::DeleteNode(session, node_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result DirtyPDGNode(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_Bool clean_results)
+	{
+		FCall Call(EHoudiniApiFunction::DirtyPDGNode);
+		Call.Key(node_id);
+		Call.Key(clean_results);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::DirtyPDGNode(session, node_id, clean_results);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result DisconnectNodeInput(const HAPI_Session * session, HAPI_NodeId node_id, int input_index)
+	{
+		FCall Call(EHoudiniApiFunction::DisconnectNodeInput);
+		Call.Key(node_id);
+		Call.Key(input_index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::DisconnectNodeInput(session, node_id, input_index);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result DisconnectNodeOutputsAt(const HAPI_Session * session, HAPI_NodeId node_id, int output_index)
+	{
+		FCall Call(EHoudiniApiFunction::DisconnectNodeOutputsAt);
+		Call.Key(node_id);
+		Call.Key(output_index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::DisconnectNodeOutputsAt(session, node_id, output_index);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ExtractImageToFile(const HAPI_Session * session, HAPI_NodeId material_node_id, const char * image_file_format_name, const char * image_planes, const char * destination_folder_path, const char * destination_file_name, int * destination_file_path)
+	{
+		FCall Call(EHoudiniApiFunction::ExtractImageToFile);
+		Call.Key(material_node_id);
+		Call.Key(image_file_format_name);
+		Call.Key(image_planes);
+		Call.Key(destination_folder_path);
+		Call.Key(destination_file_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ExtractImageToFile(session, material_node_id, image_file_format_name, image_planes, destination_folder_path, destination_file_name, destination_file_path);
+		Call.Output(destination_file_path, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ExtractImageToMemory(const HAPI_Session * session, HAPI_NodeId material_node_id, const char * image_file_format_name, const char * image_planes, int * buffer_size)
+	{
+		FCall Call(EHoudiniApiFunction::ExtractImageToMemory);
+		Call.Key(material_node_id);
+		Call.Key(image_file_format_name);
+		Call.Key(image_planes);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ExtractImageToMemory(session, material_node_id, image_file_format_name, image_planes, buffer_size);
+		Call.Output(buffer_size, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_GeoInfo GeoInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::GeoInfo_Create, true);
+		const HAPI_GeoInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_GeoInfo>(HAPI_GeoInfo()) : Original::GeoInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static int GeoInfo_GetGroupCountByType(HAPI_GeoInfo * in, HAPI_GroupType type)
+	{
+		FCall Call(EHoudiniApiFunction::GeoInfo_GetGroupCountByType);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		Call.Key(type);
+		const int Result = Call.Replay() ? Call.ReplayResult<int>(int()) : Original::GeoInfo_GetGroupCountByType(in, type);
+		return Call.Finish(Result);
+	}
+
+	static void GeoInfo_Init(HAPI_GeoInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::GeoInfo_Init, true);
+		if (!Call.Replay())
+			Original::GeoInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result GetActiveCacheCount(const HAPI_Session * session, int * active_cache_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetActiveCacheCount);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetActiveCacheCount(session, active_cache_count);
+		Call.Output(active_cache_count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetActiveCacheNames(const HAPI_Session * session, HAPI_StringHandle * cache_names_array, int active_cache_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetActiveCacheNames);
+		Call.Key(active_cache_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetActiveCacheNames(session, cache_names_array, active_cache_count);
+		Call.Output(cache_names_array, active_cache_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAssetDefinitionParmCounts(const HAPI_Session * session, HAPI_AssetLibraryId library_id, const char * asset_name, int * parm_count, int * int_value_count, int * float_value_count, int * string_value_count, int * choice_value_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetAssetDefinitionParmCounts);
+		Call.Key(library_id);
+		Call.Key(asset_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAssetDefinitionParmCounts(session, library_id, asset_name, parm_count, int_value_count, float_value_count, string_value_count, choice_value_count);
+		Call.Output(parm_count, 1);
+		Call.Output(int_value_count, 1);
+		Call.Output(float_value_count, 1);
+		Call.Output(string_value_count, 1);
+		Call.Output(choice_value_count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAssetDefinitionParmInfos(const HAPI_Session * session, HAPI_AssetLibraryId library_id, const char * asset_name, HAPI_ParmInfo * parm_infos_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAssetDefinitionParmInfos);
+		Call.Key(library_id);
+		Call.Key(asset_name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAssetDefinitionParmInfos(session, library_id, asset_name, parm_infos_array, start, length);
+		Call.Output(parm_infos_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAssetDefinitionParmValues(const HAPI_Session * session, HAPI_AssetLibraryId library_id, const char * asset_name, int * int_values_array, int int_start, int int_length, float * float_values_array, int float_start, int float_length, HAPI_Bool string_evaluate, HAPI_StringHandle * string_values_array, int string_start, int string_length, HAPI_ParmChoiceInfo * choice_values_array, int choice_start, int choice_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAssetDefinitionParmValues);
+		Call.Key(library_id);
+		Call.Key(asset_name);
+		Call.Key(int_start);
+		Call.Key(int_length);
+		Call.Key(float_start);
+		Call.Key(float_length);
+		Call.Key(string_evaluate);
+		Call.Key(string_start);
+		Call.Key(string_length);
+		Call.Key(choice_start);
+		Call.Key(choice_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAssetDefinitionParmValues(session, library_id, asset_name, int_values_array, int_start, int_length, float_values_array, float_start, float_length, string_evaluate, string_values_array, string_start, string_length, choice_values_array, choice_start, choice_length);
+		Call.Output(int_values_array, int_length);
+		Call.Output(float_values_array, float_length);
+		Call.Output(string_values_array, string_length);
+		Call.Output(choice_values_array, choice_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAssetInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_AssetInfo * asset_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetAssetInfo);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAssetInfo(session, node_id, asset_info);
+		Call.Output(asset_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeFloat64ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, double * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeFloat64ArrayData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(data_fixed_length);
+		Call.Key(start);
+		Call.Key(sizes_fixed_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeFloat64ArrayData(session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_fixed_array, data_fixed_length);
+		Call.Output(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeFloat64Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, double * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeFloat64Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(stride);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeFloat64Data(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_array, length * (stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1)));
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeFloatArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, float * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeFloatArrayData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(data_fixed_length);
+		Call.Key(start);
+		Call.Key(sizes_fixed_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeFloatArrayData(session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_fixed_array, data_fixed_length);
+		Call.Output(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, float * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeFloatData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(stride);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeFloatData(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_array, length * (stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1)));
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeOwner owner, HAPI_AttributeInfo * attr_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeInfo);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(owner);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeInfo(session, node_id, part_id, name, owner, attr_info);
+		Call.Output(attr_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeInt16ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_Int16 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeInt16ArrayData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(data_fixed_length);
+		Call.Key(start);
+		Call.Key(sizes_fixed_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeInt16ArrayData(session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_fixed_array, data_fixed_length);
+		Call.Output(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeInt16Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int16 * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeInt16Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(stride);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeInt16Data(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_array, length * (stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1)));
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeInt64ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_Int64 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeInt64ArrayData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(data_fixed_length);
+		Call.Key(start);
+		Call.Key(sizes_fixed_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeInt64ArrayData(session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_fixed_array, data_fixed_length);
+		Call.Output(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeInt64Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int64 * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeInt64Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(stride);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeInt64Data(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_array, length * (stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1)));
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeInt8ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_Int8 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeInt8ArrayData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(data_fixed_length);
+		Call.Key(start);
+		Call.Key(sizes_fixed_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeInt8ArrayData(session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_fixed_array, data_fixed_length);
+		Call.Output(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeInt8Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_Int8 * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeInt8Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(stride);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeInt8Data(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_array, length * (stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1)));
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeIntArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeIntArrayData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(data_fixed_length);
+		Call.Key(start);
+		Call.Key(sizes_fixed_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeIntArrayData(session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_fixed_array, data_fixed_length);
+		Call.Output(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, int * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeIntData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(stride);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeIntData(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_array, length * (stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1)));
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeNames(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_AttributeOwner owner, HAPI_StringHandle * attribute_names_array, int count)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeNames);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(owner);
+		Call.Key(count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeNames(session, node_id, part_id, owner, attribute_names_array, count);
+		Call.Output(attribute_names_array, count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeStringArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeStringArrayData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(data_fixed_length);
+		Call.Key(start);
+		Call.Key(sizes_fixed_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeStringArrayData(session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_fixed_array, data_fixed_length);
+		Call.Output(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeStringData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeStringData(session, node_id, part_id, name, attr_info, data_array, start, length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_array, length * (attr_info ? attr_info->tupleSize : 1));
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeUInt8ArrayData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_UInt8 * data_fixed_array, int data_fixed_length, int * sizes_fixed_array, int start, int sizes_fixed_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeUInt8ArrayData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(data_fixed_length);
+		Call.Key(start);
+		Call.Key(sizes_fixed_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeUInt8ArrayData(session, node_id, part_id, name, attr_info, data_fixed_array, data_fixed_length, sizes_fixed_array, start, sizes_fixed_length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_fixed_array, data_fixed_length);
+		Call.Output(sizes_fixed_array, sizes_fixed_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAttributeUInt8Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, HAPI_UInt8 * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetAttributeUInt8Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(stride);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAttributeUInt8Data(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		Call.Output(attr_info, 1);
+		Call.Output(data_array, length * (stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1)));
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAvailableAssetCount(const HAPI_Session * session, HAPI_AssetLibraryId library_id, int * asset_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetAvailableAssetCount);
+		Call.Key(library_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAvailableAssetCount(session, library_id, asset_count);
+		Call.Output(asset_count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetAvailableAssets(const HAPI_Session * session, HAPI_AssetLibraryId library_id, HAPI_StringHandle * asset_names_array, int asset_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetAvailableAssets);
+		Call.Key(library_id);
+		Call.Key(asset_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetAvailableAssets(session, library_id, asset_names_array, asset_count);
+		Call.Output(asset_names_array, asset_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetBoxInfo(const HAPI_Session * session, HAPI_NodeId geo_node_id, HAPI_PartId part_id, HAPI_BoxInfo * box_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetBoxInfo);
+		Call.Key(geo_node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetBoxInfo(session, geo_node_id, part_id, box_info);
+		Call.Output(box_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetCacheProperty(const HAPI_Session * session, const char * cache_name, HAPI_CacheProperty cache_property, int * property_value)
+	{
+		FCall Call(EHoudiniApiFunction::GetCacheProperty);
+		Call.Key(cache_name);
+		Call.Key(cache_property);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetCacheProperty(session, cache_name, cache_property, property_value);
+		Call.Output(property_value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetComposedChildNodeList(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeId * child_node_ids_array, int count)
+	{
+		FCall Call(EHoudiniApiFunction::GetComposedChildNodeList);
+		Call.Key(parent_node_id);
+		Call.Key(count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetComposedChildNodeList(session, parent_node_id, child_node_ids_array, count);
+		Call.Output(child_node_ids_array, count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetComposedNodeCookResult(const HAPI_Session * session, char * string_value, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetComposedNodeCookResult);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetComposedNodeCookResult(session, string_value, length);
+		Call.Output(string_value, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetComposedObjectList(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_ObjectInfo * object_infos_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetComposedObjectList);
+		Call.Key(parent_node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetComposedObjectList(session, parent_node_id, object_infos_array, start, length);
+		Call.Output(object_infos_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetComposedObjectTransforms(const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_RSTOrder rst_order, HAPI_Transform * transform_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetComposedObjectTransforms);
+		Call.Key(parent_node_id);
+		Call.Key(rst_order);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetComposedObjectTransforms(session, parent_node_id, rst_order, transform_array, start, length);
+		Call.Output(transform_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetConnectionError(char * string_value, int length, HAPI_Bool clear)
+	{
+		FCall Call(EHoudiniApiFunction::GetConnectionError);
+		Call.Key(length);
+		Call.Key(clear);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetConnectionError(string_value, length, clear);
+		Call.Output(string_value, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetConnectionErrorLength(int * buffer_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetConnectionErrorLength);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetConnectionErrorLength(buffer_length);
+		Call.Output(buffer_length, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetCookingCurrentCount(const HAPI_Session * session, int * count)
+	{
+		FCall Call(EHoudiniApiFunction::GetCookingCurrentCount);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetCookingCurrentCount(session, count);
+		Call.Output(count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetCookingTotalCount(const HAPI_Session * session, int * count)
+	{
+		FCall Call(EHoudiniApiFunction::GetCookingTotalCount);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetCookingTotalCount(session, count);
+		Call.Output(count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetCurveCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * counts_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetCurveCounts);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetCurveCounts(session, node_id, part_id, counts_array, start, length);
+		Call.Output(counts_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetCurveInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_CurveInfo * info)
+	{
+		FCall Call(EHoudiniApiFunction::GetCurveInfo);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetCurveInfo(session, node_id, part_id, info);
+		Call.Output(info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetCurveKnots(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * knots_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetCurveKnots);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetCurveKnots(session, node_id, part_id, knots_array, start, length);
+		Call.Output(knots_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetCurveOrders(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * orders_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetCurveOrders);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetCurveOrders(session, node_id, part_id, orders_array, start, length);
+		Call.Output(orders_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetDisplayGeoInfo(const HAPI_Session * session, HAPI_NodeId object_node_id, HAPI_GeoInfo * geo_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetDisplayGeoInfo);
+		Call.Key(object_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetDisplayGeoInfo(session, object_node_id, geo_info);
+		Call.Output(geo_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetEnvInt(HAPI_EnvIntType int_type, int * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetEnvInt);
+		Call.Key(int_type);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetEnvInt(int_type, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetFaceCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * face_counts_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetFaceCounts);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetFaceCounts(session, node_id, part_id, face_counts_array, start, length);
+		Call.Output(face_counts_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetFirstVolumeTile(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeTileInfo * tile)
+	{
+		FCall Call(EHoudiniApiFunction::GetFirstVolumeTile);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetFirstVolumeTile(session, node_id, part_id, tile);
+		Call.Output(tile, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetGeoInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GeoInfo * geo_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetGeoInfo);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetGeoInfo(session, node_id, geo_info);
+		Call.Output(geo_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetGeoSize(const HAPI_Session * session, HAPI_NodeId node_id, const char * format, int * size)
+	{
+		FCall Call(EHoudiniApiFunction::GetGeoSize);
+		Call.Key(node_id);
+		Call.Key(format);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetGeoSize(session, node_id, format, size);
+		Call.Output(size, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetGroupCountOnPackedInstancePart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * pointGroupCount, int * primitiveGroupCount)
+	{
+		FCall Call(EHoudiniApiFunction::GetGroupCountOnPackedInstancePart);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetGroupCountOnPackedInstancePart(session, node_id, part_id, pointGroupCount, primitiveGroupCount);
+		Call.Output(pointGroupCount, 1);
+		Call.Output(primitiveGroupCount, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetGroupMembership(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name, HAPI_Bool * membership_array_all_equal, int * membership_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetGroupMembership);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(group_type);
+		Call.Key(group_name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetGroupMembership(session, node_id, part_id, group_type, group_name, membership_array_all_equal, membership_array, start, length);
+		Call.Output(membership_array_all_equal, 1);
+		Call.Output(membership_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetGroupMembershipOnPackedInstancePart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name, HAPI_Bool * membership_array_all_equal, int * membership_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetGroupMembershipOnPackedInstancePart);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(group_type);
+		Call.Key(group_name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetGroupMembershipOnPackedInstancePart(session, node_id, part_id, group_type, group_name, membership_array_all_equal, membership_array, start, length);
+		Call.Output(membership_array_all_equal, 1);
+		Call.Output(membership_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetGroupNames(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GroupType group_type, HAPI_StringHandle * group_names_array, int group_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetGroupNames);
+		Call.Key(node_id);
+		Call.Key(group_type);
+		Call.Key(group_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetGroupNames(session, node_id, group_type, group_names_array, group_count);
+		Call.Output(group_names_array, group_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetGroupNamesOnPackedInstancePart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, HAPI_StringHandle * group_names_array, int group_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetGroupNamesOnPackedInstancePart);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(group_type);
+		Call.Key(group_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetGroupNamesOnPackedInstancePart(session, node_id, part_id, group_type, group_names_array, group_count);
+		Call.Output(group_names_array, group_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetHIPFileNodeCount(const HAPI_Session *session, HAPI_HIPFileId id, int * count)
+	{
+		FCall Call(EHoudiniApiFunction::GetHIPFileNodeCount);
+		Call.Key(id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetHIPFileNodeCount(session, id, count);
+		Call.Output(count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetHIPFileNodeIds(const HAPI_Session *session, HAPI_HIPFileId id, HAPI_NodeId * node_ids, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetHIPFileNodeIds);
+		Call.Key(id);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetHIPFileNodeIds(session, id, node_ids, length);
+		Call.Output(node_ids, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetHandleBindingInfo(const HAPI_Session * session, HAPI_NodeId node_id, int handle_index, HAPI_HandleBindingInfo * handle_binding_infos_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetHandleBindingInfo);
+		Call.Key(node_id);
+		Call.Key(handle_index);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetHandleBindingInfo(session, node_id, handle_index, handle_binding_infos_array, start, length);
+		Call.Output(handle_binding_infos_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetHandleInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_HandleInfo * handle_infos_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetHandleInfo);
+		Call.Key(node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetHandleInfo(session, node_id, handle_infos_array, start, length);
+		Call.Output(handle_infos_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetHeightFieldData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * values_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetHeightFieldData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetHeightFieldData(session, node_id, part_id, values_array, start, length);
+		Call.Output(values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetImageFilePath(const HAPI_Session * session, HAPI_NodeId material_node_id, const char * image_file_format_name, const char * image_planes, const char * destination_folder_path, const char * destination_file_name, HAPI_ParmId texture_parm_id, int * destination_file_path)
+	{
+		FCall Call(EHoudiniApiFunction::GetImageFilePath);
+		Call.Key(material_node_id);
+		Call.Key(image_file_format_name);
+		Call.Key(image_planes);
+		Call.Key(destination_folder_path);
+		Call.Key(destination_file_name);
+		Call.Key(texture_parm_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetImageFilePath(session, material_node_id, image_file_format_name, image_planes, destination_folder_path, destination_file_name, texture_parm_id, destination_file_path);
+		Call.Output(destination_file_path, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetImageInfo(const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_ImageInfo * image_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetImageInfo);
+		Call.Key(material_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetImageInfo(session, material_node_id, image_info);
+		Call.Output(image_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetImageMemoryBuffer(const HAPI_Session * session, HAPI_NodeId material_node_id, char * buffer, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetImageMemoryBuffer);
+		Call.Key(material_node_id);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetImageMemoryBuffer(session, material_node_id, buffer, length);
+		Call.Output(buffer, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetImagePlaneCount(const HAPI_Session * session, HAPI_NodeId material_node_id, int * image_plane_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetImagePlaneCount);
+		Call.Key(material_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetImagePlaneCount(session, material_node_id, image_plane_count);
+		Call.Output(image_plane_count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetImagePlanes(const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_StringHandle * image_planes_array, int image_plane_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetImagePlanes);
+		Call.Key(material_node_id);
+		Call.Key(image_plane_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetImagePlanes(session, material_node_id, image_planes_array, image_plane_count);
+		Call.Output(image_planes_array, image_plane_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetInstanceTransformsOnPart(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, HAPI_Transform * transforms_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetInstanceTransformsOnPart);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(rst_order);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetInstanceTransformsOnPart(session, node_id, part_id, rst_order, transforms_array, start, length);
+		Call.Output(transforms_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetInstancedObjectIds(const HAPI_Session * session, HAPI_NodeId object_node_id, HAPI_NodeId * instanced_node_id_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetInstancedObjectIds);
+		Call.Key(object_node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetInstancedObjectIds(session, object_node_id, instanced_node_id_array, start, length);
+		Call.Output(instanced_node_id_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetInstancedPartIds(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartId * instanced_parts_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetInstancedPartIds);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetInstancedPartIds(session, node_id, part_id, instanced_parts_array, start, length);
+		Call.Output(instanced_parts_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetInstancerPartTransforms(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order, HAPI_Transform * transforms_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetInstancerPartTransforms);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(rst_order);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetInstancerPartTransforms(session, node_id, part_id, rst_order, transforms_array, start, length);
+		Call.Output(transforms_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetManagerNodeId(const HAPI_Session * session, HAPI_NodeType node_type, HAPI_NodeId * node_id)
+	{
+		FCall Call(EHoudiniApiFunction::GetManagerNodeId);
+		Call.Key(node_type);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetManagerNodeId(session, node_type, node_id);
+		Call.Output(node_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetMaterialInfo(const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_MaterialInfo * material_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetMaterialInfo);
+		Call.Key(material_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetMaterialInfo(session, material_node_id, material_info);
+		Call.Output(material_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetMaterialNodeIdsOnFaces(const HAPI_Session * session, HAPI_NodeId geometry_node_id, HAPI_PartId part_id, HAPI_Bool * are_all_the_same, HAPI_NodeId * material_ids_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetMaterialNodeIdsOnFaces);
+		Call.Key(geometry_node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetMaterialNodeIdsOnFaces(session, geometry_node_id, part_id, are_all_the_same, material_ids_array, start, length);
+		Call.Output(are_all_the_same, 1);
+		Call.Output(material_ids_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetNextVolumeTile(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeTileInfo * tile)
+	{
+		FCall Call(EHoudiniApiFunction::GetNextVolumeTile);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetNextVolumeTile(session, node_id, part_id, tile);
+		Call.Output(tile, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetNodeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeInfo * node_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetNodeInfo);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetNodeInfo(session, node_id, node_info);
+		Call.Output(node_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetNodeInputName(const HAPI_Session * session, HAPI_NodeId node_id, int input_idx, HAPI_StringHandle * name)
+	{
+		FCall Call(EHoudiniApiFunction::GetNodeInputName);
+		Call.Key(node_id);
+		Call.Key(input_idx);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetNodeInputName(session, node_id, input_idx, name);
+		Call.Output(name, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetNodeOutputName(const HAPI_Session * session, HAPI_NodeId node_id, int output_idx, HAPI_StringHandle * name)
+	{
+		FCall Call(EHoudiniApiFunction::GetNodeOutputName);
+		Call.Key(node_id);
+		Call.Key(output_idx);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetNodeOutputName(session, node_id, output_idx, name);
+		Call.Output(name, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetNodePath(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_StringHandle * path)
+	{
+		FCall Call(EHoudiniApiFunction::GetNodePath);
+		Call.Key(node_id);
+		Call.Key(relative_to_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetNodePath(session, node_id, relative_to_node_id, path);
+		Call.Output(path, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetNumWorkitems(const HAPI_Session * session, HAPI_NodeId node_id, int * num)
+	{
+		FCall Call(EHoudiniApiFunction::GetNumWorkitems);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetNumWorkitems(session, node_id, num);
+		Call.Output(num, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetObjectInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ObjectInfo * object_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetObjectInfo);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetObjectInfo(session, node_id, object_info);
+		Call.Output(object_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetObjectTransform(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_RSTOrder rst_order, HAPI_Transform * transform)
+	{
+		FCall Call(EHoudiniApiFunction::GetObjectTransform);
+		Call.Key(node_id);
+		Call.Key(relative_to_node_id);
+		Call.Key(rst_order);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetObjectTransform(session, node_id, relative_to_node_id, rst_order, transform);
+		Call.Output(transform, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetOutputNodeId(const HAPI_Session * session, HAPI_NodeId node_id, int output, HAPI_NodeId * output_node_id)
+	{
+		FCall Call(EHoudiniApiFunction::GetOutputNodeId);
+		Call.Key(node_id);
+		Call.Key(output);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetOutputNodeId(session, node_id, output, output_node_id);
+		Call.Output(output_node_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetPDGEvents(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id, HAPI_PDG_EventInfo * event_array, int length, int * event_count, int * remaining_events)
+	{
+		FCall Call(EHoudiniApiFunction::GetPDGEvents);
+		Call.Key(graph_context_id);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetPDGEvents(session, graph_context_id, event_array, length, event_count, remaining_events);
+		Call.Output(event_array, length);
+		Call.Output(event_count, 1);
+		Call.Output(remaining_events, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetPDGGraphContextId(const HAPI_Session * session, HAPI_NodeId top_node_id, HAPI_PDG_GraphContextId * context_id)
+	{
+		FCall Call(EHoudiniApiFunction::GetPDGGraphContextId);
+		Call.Key(top_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetPDGGraphContextId(session, top_node_id, context_id);
+		Call.Output(context_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetPDGGraphContexts(const HAPI_Session * session, int * num_contexts, HAPI_StringHandle * context_names_array, HAPI_PDG_GraphContextId * context_id_array, int count)
+	{
+		FCall Call(EHoudiniApiFunction::GetPDGGraphContexts);
+		Call.Key(count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetPDGGraphContexts(session, num_contexts, context_names_array, context_id_array, count);
+		Call.Output(num_contexts, 1);
+		Call.Output(context_names_array, count);
+		Call.Output(context_id_array, count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetPDGState(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id, int * pdg_state)
+	{
+		FCall Call(EHoudiniApiFunction::GetPDGState);
+		Call.Key(graph_context_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetPDGState(session, graph_context_id, pdg_state);
+		Call.Output(pdg_state, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParameters(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmInfo * parm_infos_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetParameters);
+		Call.Key(node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParameters(session, node_id, parm_infos_array, start, length);
+		Call.Output(parm_infos_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmChoiceLists(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmChoiceInfo * parm_choices_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmChoiceLists);
+		Call.Key(node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmChoiceLists(session, node_id, parm_choices_array, start, length);
+		Call.Output(parm_choices_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmExpression(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, HAPI_StringHandle * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmExpression);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmExpression(session, node_id, parm_name, index, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmFile(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, const char * destination_directory, const char * destination_file_name)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmFile);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(destination_directory);
+		Call.Key(destination_file_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmFile(session, node_id, parm_name, destination_directory, destination_file_name);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmFloatValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, float * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmFloatValue);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmFloatValue(session, node_id, parm_name, index, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmFloatValues(const HAPI_Session * session, HAPI_NodeId node_id, float * values_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmFloatValues);
+		Call.Key(node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmFloatValues(session, node_id, values_array, start, length);
+		Call.Output(values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmIdFromName(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_ParmId * parm_id)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmIdFromName);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmIdFromName(session, node_id, parm_name, parm_id);
+		Call.Output(parm_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, HAPI_ParmInfo * parm_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmInfo);
+		Call.Key(node_id);
+		Call.Key(parm_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmInfo(session, node_id, parm_id, parm_info);
+		Call.Output(parm_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmInfoFromName(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_ParmInfo * parm_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmInfoFromName);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmInfoFromName(session, node_id, parm_name, parm_info);
+		Call.Output(parm_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmIntValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, int * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmIntValue);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmIntValue(session, node_id, parm_name, index, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmIntValues(const HAPI_Session * session, HAPI_NodeId node_id, int * values_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmIntValues);
+		Call.Key(node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmIntValues(session, node_id, values_array, start, length);
+		Call.Output(values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmNodeValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_NodeId * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmNodeValue);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmNodeValue(session, node_id, parm_name, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmStringValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, HAPI_Bool evaluate, HAPI_StringHandle * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmStringValue);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(index);
+		Call.Key(evaluate);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmStringValue(session, node_id, parm_name, index, evaluate, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmStringValues(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_Bool evaluate, HAPI_StringHandle * values_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmStringValues);
+		Call.Key(node_id);
+		Call.Key(evaluate);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmStringValues(session, node_id, evaluate, values_array, start, length);
+		Call.Output(values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmTagName(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int tag_index, HAPI_StringHandle * tag_name)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmTagName);
+		Call.Key(node_id);
+		Call.Key(parm_id);
+		Call.Key(tag_index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmTagName(session, node_id, parm_id, tag_index, tag_name);
+		Call.Output(tag_name, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmTagValue(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, const char * tag_name, HAPI_StringHandle * tag_value)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmTagValue);
+		Call.Key(node_id);
+		Call.Key(parm_id);
+		Call.Key(tag_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmTagValue(session, node_id, parm_id, tag_name, tag_value);
+		Call.Output(tag_value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetParmWithTag(const HAPI_Session * session, HAPI_NodeId node_id, const char * tag_name, HAPI_ParmId * parm_id)
+	{
+		FCall Call(EHoudiniApiFunction::GetParmWithTag);
+		Call.Key(node_id);
+		Call.Key(tag_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetParmWithTag(session, node_id, tag_name, parm_id);
+		Call.Output(parm_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetPartInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartInfo * part_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetPartInfo);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetPartInfo(session, node_id, part_id, part_info);
+		Call.Output(part_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetPreset(const HAPI_Session * session, HAPI_NodeId node_id, char * buffer, int buffer_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetPreset);
+		Call.Key(node_id);
+		Call.Key(buffer_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetPreset(session, node_id, buffer, buffer_length);
+		Call.Output(buffer, buffer_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetPresetBufLength(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PresetType preset_type, const char * preset_name, int * buffer_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetPresetBufLength);
+		Call.Key(node_id);
+		Call.Key(preset_type);
+		Call.Key(preset_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetPresetBufLength(session, node_id, preset_type, preset_name, buffer_length);
+		Call.Output(buffer_length, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetServerEnvInt(const HAPI_Session * session, const char * variable_name, int * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetServerEnvInt);
+		Call.Key(variable_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetServerEnvInt(session, variable_name, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetServerEnvString(const HAPI_Session * session, const char * variable_name, HAPI_StringHandle * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetServerEnvString);
+		Call.Key(variable_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetServerEnvString(session, variable_name, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetServerEnvVarCount(const HAPI_Session * session, int * env_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetServerEnvVarCount);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetServerEnvVarCount(session, env_count);
+		Call.Output(env_count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetServerEnvVarList(const HAPI_Session * session, HAPI_StringHandle * values_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetServerEnvVarList);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetServerEnvVarList(session, values_array, start, length);
+		Call.Output(values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetSessionEnvInt(const HAPI_Session * session, HAPI_SessionEnvIntType int_type, int * value)
+	{
+		FCall Call(EHoudiniApiFunction::GetSessionEnvInt);
+		Call.Key(int_type);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetSessionEnvInt(session, int_type, value);
+		Call.Output(value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetSessionSyncInfo(const HAPI_Session * session, HAPI_SessionSyncInfo * session_sync_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetSessionSyncInfo);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetSessionSyncInfo(session, session_sync_info);
+		Call.Output(session_sync_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetSphereInfo(const HAPI_Session * session, HAPI_NodeId geo_node_id, HAPI_PartId part_id, HAPI_SphereInfo * sphere_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetSphereInfo);
+		Call.Key(geo_node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetSphereInfo(session, geo_node_id, part_id, sphere_info);
+		Call.Output(sphere_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetStatus(const HAPI_Session * session, HAPI_StatusType status_type, int * status)
+	{
+		FCall Call(EHoudiniApiFunction::GetStatus);
+		Call.Key(status_type);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetStatus(session, status_type, status);
+		Call.Output(status, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetStatusString(const HAPI_Session * session, HAPI_StatusType status_type, char * string_value, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetStatusString);
+		Call.Key(status_type);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetStatusString(session, status_type, string_value, length);
+		Call.Output(string_value, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetStatusStringBufLength(const HAPI_Session * session, HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity, int * buffer_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetStatusStringBufLength);
+		Call.Key(status_type);
+		Call.Key(verbosity);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetStatusStringBufLength(session, status_type, verbosity, buffer_length);
+		Call.Output(buffer_length, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetString(const HAPI_Session * session, HAPI_StringHandle string_handle, char * string_value, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetString);
+		Call.Key(string_handle);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetString(session, string_handle, string_value, length);
+		Call.Output(string_value, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetStringBatch(const HAPI_Session * session, char * char_buffer, int char_array_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetStringBatch);
+		Call.Key(char_array_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetStringBatch(session, char_buffer, char_array_length);
+		Call.Output(char_buffer, char_array_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetStringBatchSize(const HAPI_Session * session, const int * string_handle_array, int string_handle_count, int * string_buffer_size)
+	{
+		FCall Call(EHoudiniApiFunction::GetStringBatchSize);
+		Call.Key(string_handle_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetStringBatchSize(session, string_handle_array, string_handle_count, string_buffer_size);
+		Call.Output(string_buffer_size, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetStringBufLength(const HAPI_Session * session, HAPI_StringHandle string_handle, int * buffer_length)
+	{
+		FCall Call(EHoudiniApiFunction::GetStringBufLength);
+		Call.Key(string_handle);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetStringBufLength(session, string_handle, buffer_length);
+		Call.Output(buffer_length, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetSupportedImageFileFormatCount(const HAPI_Session * session, int * file_format_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetSupportedImageFileFormatCount);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetSupportedImageFileFormatCount(session, file_format_count);
+		Call.Output(file_format_count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetSupportedImageFileFormats(const HAPI_Session * session, HAPI_ImageFileFormat * formats_array, int file_format_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetSupportedImageFileFormats);
+		Call.Key(file_format_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetSupportedImageFileFormats(session, formats_array, file_format_count);
+		Call.Output(formats_array, file_format_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetTime(const HAPI_Session * session, float * time)
+	{
+		FCall Call(EHoudiniApiFunction::GetTime);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetTime(session, time);
+		Call.Output(time, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetTimelineOptions(const HAPI_Session * session, HAPI_TimelineOptions * timeline_options)
+	{
+		FCall Call(EHoudiniApiFunction::GetTimelineOptions);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetTimelineOptions(session, timeline_options);
+		Call.Output(timeline_options, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetTotalCookCount(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeTypeBits node_type_filter, HAPI_NodeFlagsBits node_flags_filter, HAPI_Bool recursive, int * count)
+	{
+		FCall Call(EHoudiniApiFunction::GetTotalCookCount);
+		Call.Key(node_id);
+		Call.Key(node_type_filter);
+		Call.Key(node_flags_filter);
+		Call.Key(recursive);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetTotalCookCount(session, node_id, node_type_filter, node_flags_filter, recursive, count);
+		Call.Output(count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetUseHoudiniTime(const HAPI_Session * session, HAPI_Bool * enabled)
+	{
+		FCall Call(EHoudiniApiFunction::GetUseHoudiniTime);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetUseHoudiniTime(session, enabled);
+		Call.Output(enabled, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetVertexList(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * vertex_list_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetVertexList);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetVertexList(session, node_id, part_id, vertex_list_array, start, length);
+		Call.Output(vertex_list_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetViewport(const HAPI_Session * session, HAPI_Viewport * viewport)
+	{
+		FCall Call(EHoudiniApiFunction::GetViewport);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetViewport(session, viewport);
+		Call.Output(viewport, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetVolumeBounds(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * x_min, float * y_min, float * z_min, float * x_max, float * y_max, float * z_max, float * x_center, float * y_center, float * z_center)
+	{
+		FCall Call(EHoudiniApiFunction::GetVolumeBounds);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetVolumeBounds(session, node_id, part_id, x_min, y_min, z_min, x_max, y_max, z_max, x_center, y_center, z_center);
+		Call.Output(x_min, 1);
+		Call.Output(y_min, 1);
+		Call.Output(z_min, 1);
+		Call.Output(x_max, 1);
+		Call.Output(y_max, 1);
+		Call.Output(z_max, 1);
+		Call.Output(x_center, 1);
+		Call.Output(y_center, 1);
+		Call.Output(z_center, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetVolumeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeInfo * volume_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetVolumeInfo);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetVolumeInfo(session, node_id, part_id, volume_info);
+		Call.Output(volume_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetVolumeTileFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float fill_value, const HAPI_VolumeTileInfo * tile, float * values_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetVolumeTileFloatData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(fill_value);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetVolumeTileFloatData(session, node_id, part_id, fill_value, tile, values_array, length);
+		Call.Output(values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetVolumeTileIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int fill_value, const HAPI_VolumeTileInfo * tile, int * values_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetVolumeTileIntData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(fill_value);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetVolumeTileIntData(session, node_id, part_id, fill_value, tile, values_array, length);
+		Call.Output(values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetVolumeVisualInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeVisualInfo * visual_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetVolumeVisualInfo);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetVolumeVisualInfo(session, node_id, part_id, visual_info);
+		Call.Output(visual_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetVolumeVoxelFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int x_index, int y_index, int z_index, float * values_array, int value_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetVolumeVoxelFloatData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(x_index);
+		Call.Key(y_index);
+		Call.Key(z_index);
+		Call.Key(value_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetVolumeVoxelFloatData(session, node_id, part_id, x_index, y_index, z_index, values_array, value_count);
+		Call.Output(values_array, value_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetVolumeVoxelIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int x_index, int y_index, int z_index, int * values_array, int value_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetVolumeVoxelIntData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(x_index);
+		Call.Key(y_index);
+		Call.Key(z_index);
+		Call.Key(value_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetVolumeVoxelIntData(session, node_id, part_id, x_index, y_index, z_index, values_array, value_count);
+		Call.Output(values_array, value_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetWorkitemDataLength(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId workitem_id, const char * data_name, int * length)
+	{
+		FCall Call(EHoudiniApiFunction::GetWorkitemDataLength);
+		Call.Key(node_id);
+		Call.Key(workitem_id);
+		Call.Key(data_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetWorkitemDataLength(session, node_id, workitem_id, data_name, length);
+		Call.Output(length, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetWorkitemFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId workitem_id, const char * data_name, float * data_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetWorkitemFloatData);
+		Call.Key(node_id);
+		Call.Key(workitem_id);
+		Call.Key(data_name);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetWorkitemFloatData(session, node_id, workitem_id, data_name, data_array, length);
+		Call.Output(data_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetWorkitemInfo(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id, HAPI_PDG_WorkitemId workitem_id, HAPI_PDG_WorkitemInfo * workitem_info)
+	{
+		FCall Call(EHoudiniApiFunction::GetWorkitemInfo);
+		Call.Key(graph_context_id);
+		Call.Key(workitem_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetWorkitemInfo(session, graph_context_id, workitem_id, workitem_info);
+		Call.Output(workitem_info, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetWorkitemIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId workitem_id, const char * data_name, int * data_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetWorkitemIntData);
+		Call.Key(node_id);
+		Call.Key(workitem_id);
+		Call.Key(data_name);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetWorkitemIntData(session, node_id, workitem_id, data_name, data_array, length);
+		Call.Output(data_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetWorkitemResultInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId workitem_id, HAPI_PDG_WorkitemResultInfo * resultinfo_array, int resultinfo_count)
+	{
+		FCall Call(EHoudiniApiFunction::GetWorkitemResultInfo);
+		Call.Key(node_id);
+		Call.Key(workitem_id);
+		Call.Key(resultinfo_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetWorkitemResultInfo(session, node_id, workitem_id, resultinfo_array, resultinfo_count);
+		Call.Output(resultinfo_array, resultinfo_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetWorkitemStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId workitem_id, const char * data_name, HAPI_StringHandle * data_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetWorkitemStringData);
+		Call.Key(node_id);
+		Call.Key(workitem_id);
+		Call.Key(data_name);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetWorkitemStringData(session, node_id, workitem_id, data_name, data_array, length);
+		Call.Output(data_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result GetWorkitems(const HAPI_Session * session, HAPI_NodeId node_id, int * workitem_ids_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::GetWorkitems);
+		Call.Key(node_id);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::GetWorkitems(session, node_id, workitem_ids_array, length);
+		Call.Output(workitem_ids_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_HandleBindingInfo HandleBindingInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::HandleBindingInfo_Create, true);
+		const HAPI_HandleBindingInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_HandleBindingInfo>(HAPI_HandleBindingInfo()) : Original::HandleBindingInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void HandleBindingInfo_Init(HAPI_HandleBindingInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::HandleBindingInfo_Init, true);
+		if (!Call.Replay())
+			Original::HandleBindingInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_HandleInfo HandleInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::HandleInfo_Create, true);
+		const HAPI_HandleInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_HandleInfo>(HAPI_HandleInfo()) : Original::HandleInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void HandleInfo_Init(HAPI_HandleInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::HandleInfo_Init, true);
+		if (!Call.Replay())
+			Original::HandleInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_ImageFileFormat ImageFileFormat_Create()
+	{
+		FCall Call(EHoudiniApiFunction::ImageFileFormat_Create, true);
+		const HAPI_ImageFileFormat Result = Call.Replay() ? Call.ReplayResult<HAPI_ImageFileFormat>(HAPI_ImageFileFormat()) : Original::ImageFileFormat_Create();
+		return Call.Finish(Result);
+	}
+
+	static void ImageFileFormat_Init(HAPI_ImageFileFormat *in)
+	{
+		FCall Call(EHoudiniApiFunction::ImageFileFormat_Init, true);
+		if (!Call.Replay())
+			Original::ImageFileFormat_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_ImageInfo ImageInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::ImageInfo_Create, true);
+		const HAPI_ImageInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_ImageInfo>(HAPI_ImageInfo()) : Original::ImageInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void ImageInfo_Init(HAPI_ImageInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ImageInfo_Init, true);
+		if (!Call.Replay())
+			Original::ImageInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result Initialize(const HAPI_Session * session, const HAPI_CookOptions * cook_options, HAPI_Bool use_cooking_thread, int cooking_thread_stack_size, const char * houdini_environment_files, const char * otl_search_path, const char * dso_search_path, const char * image_dso_search_path, const char * audio_dso_search_path)
+	{
+		FCall Call(EHoudiniApiFunction::Initialize);
+		Call.Key(use_cooking_thread);
+		Call.Key(cooking_thread_stack_size);
+		Call.Key(houdini_environment_files);
+		Call.Key(otl_search_path);
+		Call.Key(dso_search_path);
+		Call.Key(image_dso_search_path);
+		Call.Key(audio_dso_search_path);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::Initialize(session, cook_options, use_cooking_thread, cooking_thread_stack_size, houdini_environment_files, otl_search_path, dso_search_path, image_dso_search_path, audio_dso_search_path);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result InsertMultiparmInstance(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int instance_position)
+	{
+		FCall Call(EHoudiniApiFunction::InsertMultiparmInstance);
+		Call.Key(node_id);
+		Call.Key(parm_id);
+		Call.Key(instance_position);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::InsertMultiparmInstance(session, node_id, parm_id, instance_position);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result Interrupt(const HAPI_Session * session)
+	{
+		FCall Call(EHoudiniApiFunction::Interrupt);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::Interrupt(session);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result IsInitialized(const HAPI_Session * session)
+	{
+		FCall Call(EHoudiniApiFunction::IsInitialized);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::IsInitialized(session);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result IsNodeValid(const HAPI_Session * session, HAPI_NodeId node_id, int unique_node_id, HAPI_Bool * answer)
+	{
+		FCall Call(EHoudiniApiFunction::IsNodeValid);
+		Call.Key(node_id);
+		Call.Key(unique_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::IsNodeValid(session, node_id, unique_node_id, answer);
+		Call.Output(answer, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result IsSessionValid(const HAPI_Session * session)
+	{
+		FCall Call(EHoudiniApiFunction::IsSessionValid);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::IsSessionValid(session);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Keyframe Keyframe_Create()
+	{
+		FCall Call(EHoudiniApiFunction::Keyframe_Create, true);
+		const HAPI_Keyframe Result = Call.Replay() ? Call.ReplayResult<HAPI_Keyframe>(HAPI_Keyframe()) : Original::Keyframe_Create();
+		return Call.Finish(Result);
+	}
+
+	static void Keyframe_Init(HAPI_Keyframe * in)
+	{
+		FCall Call(EHoudiniApiFunction::Keyframe_Init, true);
+		if (!Call.Replay())
+			Original::Keyframe_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result LoadAssetLibraryFromFile(const HAPI_Session * session, const char * file_path, HAPI_Bool allow_overwrite, HAPI_AssetLibraryId * library_id)
+	{
+		FCall Call(EHoudiniApiFunction::LoadAssetLibraryFromFile);
+		Call.Key(file_path);
+		Call.Key(allow_overwrite);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::LoadAssetLibraryFromFile(session, file_path, allow_overwrite, library_id);
+		Call.Output(library_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result LoadAssetLibraryFromMemory(const HAPI_Session * session, const char * library_buffer, int library_buffer_length, HAPI_Bool allow_overwrite, HAPI_AssetLibraryId * library_id)
+	{
+		FCall Call(EHoudiniApiFunction::LoadAssetLibraryFromMemory);
+		Call.Key(library_buffer_length);
+		Call.Key(allow_overwrite);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::LoadAssetLibraryFromMemory(session, library_buffer, library_buffer_length, allow_overwrite, library_id);
+		Call.Output(library_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result LoadGeoFromFile(const HAPI_Session * session, HAPI_NodeId node_id, const char * file_name)
+	{
+		FCall Call(EHoudiniApiFunction::LoadGeoFromFile);
+		Call.Key(node_id);
+		Call.Key(file_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::LoadGeoFromFile(session, node_id, file_name);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result LoadGeoFromMemory(const HAPI_Session * session, HAPI_NodeId node_id, const char * format, const char * buffer, int length)
+	{
+		FCall Call(EHoudiniApiFunction::LoadGeoFromMemory);
+		Call.Key(node_id);
+		Call.Key(format);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::LoadGeoFromMemory(session, node_id, format, buffer, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result LoadHIPFile(const HAPI_Session * session, const char * file_name, HAPI_Bool cook_on_load)
+	{
+		FCall Call(EHoudiniApiFunction::LoadHIPFile);
+		Call.Key(file_name);
+		Call.Key(cook_on_load);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::LoadHIPFile(session, file_name, cook_on_load);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result LoadNodeFromFile(const HAPI_Session * session, const char * file_name, HAPI_NodeId parent_node_id, const char * node_label, HAPI_Bool cook_on_load, HAPI_NodeId * new_node_id)
+	{
+		FCall Call(EHoudiniApiFunction::LoadNodeFromFile);
+		Call.Key(file_name);
+		Call.Key(parent_node_id);
+		Call.Key(node_label);
+		Call.Key(cook_on_load);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::LoadNodeFromFile(session, file_name, parent_node_id, node_label, cook_on_load, new_node_id);
+		Call.Output(new_node_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_MaterialInfo MaterialInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::MaterialInfo_Create, true);
+		const HAPI_MaterialInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_MaterialInfo>(HAPI_MaterialInfo()) : Original::MaterialInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void MaterialInfo_Init(HAPI_MaterialInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::MaterialInfo_Init, true);
+		if (!Call.Replay())
+			Original::MaterialInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result MergeHIPFile(const HAPI_Session * session, const char * file_name, HAPI_Bool cook_on_load, HAPI_HIPFileId * file_id)
+	{
+		FCall Call(EHoudiniApiFunction::MergeHIPFile);
+		Call.Key(file_name);
+		Call.Key(cook_on_load);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::MergeHIPFile(session, file_name, cook_on_load, file_id);
+		Call.Output(file_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_NodeInfo NodeInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::NodeInfo_Create, true);
+		const HAPI_NodeInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_NodeInfo>(HAPI_NodeInfo()) : Original::NodeInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void NodeInfo_Init(HAPI_NodeInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::NodeInfo_Init, true);
+		if (!Call.Replay())
+			Original::NodeInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_ObjectInfo ObjectInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::ObjectInfo_Create, true);
+		const HAPI_ObjectInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_ObjectInfo>(HAPI_ObjectInfo()) : Original::ObjectInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void ObjectInfo_Init(HAPI_ObjectInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ObjectInfo_Init, true);
+		if (!Call.Replay())
+			Original::ObjectInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_ParmChoiceInfo ParmChoiceInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::ParmChoiceInfo_Create, true);
+		const HAPI_ParmChoiceInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_ParmChoiceInfo>(HAPI_ParmChoiceInfo()) : Original::ParmChoiceInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void ParmChoiceInfo_Init(HAPI_ParmChoiceInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmChoiceInfo_Init, true);
+		if (!Call.Replay())
+			Original::ParmChoiceInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result ParmHasExpression(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, HAPI_Bool * has_expression)
+	{
+		FCall Call(EHoudiniApiFunction::ParmHasExpression);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ParmHasExpression(session, node_id, parm_name, index, has_expression);
+		Call.Output(has_expression, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ParmHasTag(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, const char * tag_name, HAPI_Bool * has_tag)
+	{
+		FCall Call(EHoudiniApiFunction::ParmHasTag);
+		Call.Key(node_id);
+		Call.Key(parm_id);
+		Call.Key(tag_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ParmHasTag(session, node_id, parm_id, tag_name, has_tag);
+		Call.Output(has_tag, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_ParmInfo ParmInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_Create, true);
+		const HAPI_ParmInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_ParmInfo>(HAPI_ParmInfo()) : Original::ParmInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static int ParmInfo_GetFloatValueCount(const HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_GetFloatValueCount);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const int Result = Call.Replay() ? Call.ReplayResult<int>(int()) : Original::ParmInfo_GetFloatValueCount(in);
+		return Call.Finish(Result);
+	}
+
+	static int ParmInfo_GetIntValueCount(const HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_GetIntValueCount);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const int Result = Call.Replay() ? Call.ReplayResult<int>(int()) : Original::ParmInfo_GetIntValueCount(in);
+		return Call.Finish(Result);
+	}
+
+	static int ParmInfo_GetStringValueCount(const HAPI_ParmInfo* in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_GetStringValueCount);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const int Result = Call.Replay() ? Call.ReplayResult<int>(int()) : Original::ParmInfo_GetStringValueCount(in);
+		return Call.Finish(Result);
+	}
+
+	static void ParmInfo_Init(HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_Init, true);
+		if (!Call.Replay())
+			Original::ParmInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Bool ParmInfo_IsFloat(const HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_IsFloat);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const HAPI_Bool Result = Call.Replay() ? Call.ReplayResult<HAPI_Bool>(HAPI_Bool()) : Original::ParmInfo_IsFloat(in);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Bool ParmInfo_IsInt(const HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_IsInt);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const HAPI_Bool Result = Call.Replay() ? Call.ReplayResult<HAPI_Bool>(HAPI_Bool()) : Original::ParmInfo_IsInt(in);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Bool ParmInfo_IsNode(const HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_IsNode);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const HAPI_Bool Result = Call.Replay() ? Call.ReplayResult<HAPI_Bool>(HAPI_Bool()) : Original::ParmInfo_IsNode(in);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Bool ParmInfo_IsNonValue(const HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_IsNonValue);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const HAPI_Bool Result = Call.Replay() ? Call.ReplayResult<HAPI_Bool>(HAPI_Bool()) : Original::ParmInfo_IsNonValue(in);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Bool ParmInfo_IsPath(const HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_IsPath);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const HAPI_Bool Result = Call.Replay() ? Call.ReplayResult<HAPI_Bool>(HAPI_Bool()) : Original::ParmInfo_IsPath(in);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Bool ParmInfo_IsString(const HAPI_ParmInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::ParmInfo_IsString);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		const HAPI_Bool Result = Call.Replay() ? Call.ReplayResult<HAPI_Bool>(HAPI_Bool()) : Original::ParmInfo_IsString(in);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_PartInfo PartInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::PartInfo_Create, true);
+		const HAPI_PartInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_PartInfo>(HAPI_PartInfo()) : Original::PartInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static int PartInfo_GetAttributeCountByOwner(HAPI_PartInfo * in, HAPI_AttributeOwner owner)
+	{
+		FCall Call(EHoudiniApiFunction::PartInfo_GetAttributeCountByOwner);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		Call.Key(owner);
+		const int Result = Call.Replay() ? Call.ReplayResult<int>(int()) : Original::PartInfo_GetAttributeCountByOwner(in, owner);
+		return Call.Finish(Result);
+	}
+
+	static int PartInfo_GetElementCountByAttributeOwner(HAPI_PartInfo * in, HAPI_AttributeOwner owner)
+	{
+		FCall Call(EHoudiniApiFunction::PartInfo_GetElementCountByAttributeOwner);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		Call.Key(owner);
+		const int Result = Call.Replay() ? Call.ReplayResult<int>(int()) : Original::PartInfo_GetElementCountByAttributeOwner(in, owner);
+		return Call.Finish(Result);
+	}
+
+	static int PartInfo_GetElementCountByGroupType(HAPI_PartInfo * in, HAPI_GroupType type)
+	{
+		FCall Call(EHoudiniApiFunction::PartInfo_GetElementCountByGroupType);
+		HoudiniApiRecorder::KeyFields(Call, in);
+		Call.Key(type);
+		const int Result = Call.Replay() ? Call.ReplayResult<int>(int()) : Original::PartInfo_GetElementCountByGroupType(in, type);
+		return Call.Finish(Result);
+	}
+
+	static void PartInfo_Init(HAPI_PartInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::PartInfo_Init, true);
+		if (!Call.Replay())
+			Original::PartInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Result PausePDGCook(const HAPI_Session * session, HAPI_PDG_GraphContextId graph_context_id)
+	{
+		FCall Call(EHoudiniApiFunction::PausePDGCook);
+		Call.Key(graph_context_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::PausePDGCook(session, graph_context_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result PythonThreadInterpreterLock(const HAPI_Session * session, HAPI_Bool locked)
+	{
+		FCall Call(EHoudiniApiFunction::PythonThreadInterpreterLock);
+		Call.Key(locked);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::PythonThreadInterpreterLock(session, locked);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result QueryNodeInput(const HAPI_Session * session, HAPI_NodeId node_to_query, int input_index, HAPI_NodeId * connected_node_id)
+	{
+		FCall Call(EHoudiniApiFunction::QueryNodeInput);
+		Call.Key(node_to_query);
+		Call.Key(input_index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::QueryNodeInput(session, node_to_query, input_index, connected_node_id);
+		Call.Output(connected_node_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result QueryNodeOutputConnectedCount(const HAPI_Session * session, HAPI_NodeId node_id, int output_idx, HAPI_Bool into_subnets, HAPI_Bool through_dots, int * connected_count)
+	{
+		FCall Call(EHoudiniApiFunction::QueryNodeOutputConnectedCount);
+		Call.Key(node_id);
+		Call.Key(output_idx);
+		Call.Key(into_subnets);
+		Call.Key(through_dots);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::QueryNodeOutputConnectedCount(session, node_id, output_idx, into_subnets, through_dots, connected_count);
+		Call.Output(connected_count, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result QueryNodeOutputConnectedNodes(const HAPI_Session * session, HAPI_NodeId node_id, int output_idx, HAPI_Bool into_subnets, HAPI_Bool through_dots, HAPI_NodeId * connected_node_ids_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::QueryNodeOutputConnectedNodes);
+		Call.Key(node_id);
+		Call.Key(output_idx);
+		Call.Key(into_subnets);
+		Call.Key(through_dots);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::QueryNodeOutputConnectedNodes(session, node_id, output_idx, into_subnets, through_dots, connected_node_ids_array, start, length);
+		Call.Output(connected_node_ids_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RemoveCustomString(const HAPI_Session * session, const HAPI_StringHandle string_handle)
+	{
+		FCall Call(EHoudiniApiFunction::RemoveCustomString);
+		Call.Key(string_handle);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RemoveCustomString(session, string_handle);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RemoveMultiparmInstance(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int instance_position)
+	{
+		FCall Call(EHoudiniApiFunction::RemoveMultiparmInstance);
+		Call.Key(node_id);
+		Call.Key(parm_id);
+		Call.Key(instance_position);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RemoveMultiparmInstance(session, node_id, parm_id, instance_position);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RemoveParmExpression(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int index)
+	{
+		FCall Call(EHoudiniApiFunction::RemoveParmExpression);
+		Call.Key(node_id);
+		Call.Key(parm_id);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RemoveParmExpression(session, node_id, parm_id, index);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RenameNode(const HAPI_Session * session, HAPI_NodeId node_id, const char * new_name)
+	{
+		FCall Call(EHoudiniApiFunction::RenameNode);
+		Call.Key(node_id);
+		Call.Key(new_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RenameNode(session, node_id, new_name);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RenderCOPToImage(const HAPI_Session * session, HAPI_NodeId cop_node_id)
+	{
+		FCall Call(EHoudiniApiFunction::RenderCOPToImage);
+		Call.Key(cop_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RenderCOPToImage(session, cop_node_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RenderTextureToImage(const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_ParmId parm_id)
+	{
+		FCall Call(EHoudiniApiFunction::RenderTextureToImage);
+		Call.Key(material_node_id);
+		Call.Key(parm_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RenderTextureToImage(session, material_node_id, parm_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result ResetSimulation(const HAPI_Session * session, HAPI_NodeId node_id)
+	{
+		FCall Call(EHoudiniApiFunction::ResetSimulation);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::ResetSimulation(session, node_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RevertGeo(const HAPI_Session * session, HAPI_NodeId node_id)
+	{
+		FCall Call(EHoudiniApiFunction::RevertGeo);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RevertGeo(session, node_id);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RevertParmToDefault(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index)
+	{
+		FCall Call(EHoudiniApiFunction::RevertParmToDefault);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RevertParmToDefault(session, node_id, parm_name, index);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result RevertParmToDefaults(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name)
+	{
+		FCall Call(EHoudiniApiFunction::RevertParmToDefaults);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::RevertParmToDefaults(session, node_id, parm_name);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SaveGeoToFile(const HAPI_Session * session, HAPI_NodeId node_id, const char * file_name)
+	{
+		FCall Call(EHoudiniApiFunction::SaveGeoToFile);
+		Call.Key(node_id);
+		Call.Key(file_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SaveGeoToFile(session, node_id, file_name);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SaveGeoToMemory(const HAPI_Session * session, HAPI_NodeId node_id, char * buffer, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SaveGeoToMemory);
+		Call.Key(node_id);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SaveGeoToMemory(session, node_id, buffer, length);
+		Call.Output(buffer, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SaveHIPFile(const HAPI_Session * session, const char * file_path, HAPI_Bool lock_nodes)
+	{
+		FCall Call(EHoudiniApiFunction::SaveHIPFile);
+		Call.Key(file_path);
+		Call.Key(lock_nodes);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SaveHIPFile(session, file_path, lock_nodes);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SaveNodeToFile(const HAPI_Session * session, HAPI_NodeId node_id, const char * file_name)
+	{
+		FCall Call(EHoudiniApiFunction::SaveNodeToFile);
+		Call.Key(node_id);
+		Call.Key(file_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SaveNodeToFile(session, node_id, file_name);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_SessionSyncInfo SessionSyncInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::SessionSyncInfo_Create, true);
+		const HAPI_SessionSyncInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_SessionSyncInfo>(HAPI_SessionSyncInfo()) : Original::SessionSyncInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAnimCurve(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, int parm_index, const HAPI_Keyframe * curve_keyframes_array, int keyframe_count)
+	{
+		FCall Call(EHoudiniApiFunction::SetAnimCurve);
+		Call.Key(node_id);
+		Call.Key(parm_id);
+		Call.Key(parm_index);
+		Call.Key(keyframe_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAnimCurve(session, node_id, parm_id, parm_index, curve_keyframes_array, keyframe_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAttributeFloat64Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const double * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetAttributeFloat64Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAttributeFloat64Data(session, node_id, part_id, name, attr_info, data_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAttributeFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const float * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetAttributeFloatData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAttributeFloatData(session, node_id, part_id, name, attr_info, data_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAttributeInt16Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int16 * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetAttributeInt16Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAttributeInt16Data(session, node_id, part_id, name, attr_info, data_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAttributeInt64Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int64 * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetAttributeInt64Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAttributeInt64Data(session, node_id, part_id, name, attr_info, data_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAttributeInt8Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_Int8 * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetAttributeInt8Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAttributeInt8Data(session, node_id, part_id, name, attr_info, data_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAttributeIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const int * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetAttributeIntData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAttributeIntData(session, node_id, part_id, name, attr_info, data_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAttributeStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char ** data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetAttributeStringData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAttributeStringData(session, node_id, part_id, name, attr_info, data_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetAttributeUInt8Data(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const HAPI_UInt8 * data_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetAttributeUInt8Data);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetAttributeUInt8Data(session, node_id, part_id, name, attr_info, data_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetCacheProperty(const HAPI_Session * session, const char * cache_name, HAPI_CacheProperty cache_property, int property_value)
+	{
+		FCall Call(EHoudiniApiFunction::SetCacheProperty);
+		Call.Key(cache_name);
+		Call.Key(cache_property);
+		Call.Key(property_value);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetCacheProperty(session, cache_name, cache_property, property_value);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetCurveCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * counts_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetCurveCounts);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetCurveCounts(session, node_id, part_id, counts_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetCurveInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_CurveInfo * info)
+	{
+		FCall Call(EHoudiniApiFunction::SetCurveInfo);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetCurveInfo(session, node_id, part_id, info);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetCurveKnots(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const float * knots_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetCurveKnots);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetCurveKnots(session, node_id, part_id, knots_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetCurveOrders(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * orders_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetCurveOrders);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetCurveOrders(session, node_id, part_id, orders_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetCustomString(const HAPI_Session * session, const char * string_value, HAPI_StringHandle * handle_value)
+	{
+		FCall Call(EHoudiniApiFunction::SetCustomString);
+		Call.Key(string_value);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetCustomString(session, string_value, handle_value);
+		Call.Output(handle_value, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetFaceCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * face_counts_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetFaceCounts);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetFaceCounts(session, node_id, part_id, face_counts_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetGroupMembership(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name, const int * membership_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetGroupMembership);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(group_type);
+		Call.Key(group_name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetGroupMembership(session, node_id, part_id, group_type, group_name, membership_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetHeightFieldData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const float * values_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetHeightFieldData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(name);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetHeightFieldData(session, node_id, part_id, name, values_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetImageInfo(const HAPI_Session * session, HAPI_NodeId material_node_id, const HAPI_ImageInfo * image_info)
+	{
+		FCall Call(EHoudiniApiFunction::SetImageInfo);
+		Call.Key(material_node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetImageInfo(session, material_node_id, image_info);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetNodeDisplay(const HAPI_Session * session, HAPI_NodeId node_id, int onOff)
+	{
+		FCall Call(EHoudiniApiFunction::SetNodeDisplay);
+		Call.Key(node_id);
+		Call.Key(onOff);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetNodeDisplay(session, node_id, onOff);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetObjectTransform(const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_TransformEuler * trans)
+	{
+		FCall Call(EHoudiniApiFunction::SetObjectTransform);
+		Call.Key(node_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetObjectTransform(session, node_id, trans);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetParmExpression(const HAPI_Session * session, HAPI_NodeId node_id, const char * value, HAPI_ParmId parm_id, int index)
+	{
+		FCall Call(EHoudiniApiFunction::SetParmExpression);
+		Call.Key(node_id);
+		Call.Key(value);
+		Call.Key(parm_id);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetParmExpression(session, node_id, value, parm_id, index);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetParmFloatValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, float value)
+	{
+		FCall Call(EHoudiniApiFunction::SetParmFloatValue);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(index);
+		Call.Key(value);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetParmFloatValue(session, node_id, parm_name, index, value);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetParmFloatValues(const HAPI_Session * session, HAPI_NodeId node_id, const float * values_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetParmFloatValues);
+		Call.Key(node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetParmFloatValues(session, node_id, values_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetParmIntValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, int value)
+	{
+		FCall Call(EHoudiniApiFunction::SetParmIntValue);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(index);
+		Call.Key(value);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetParmIntValue(session, node_id, parm_name, index, value);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetParmIntValues(const HAPI_Session * session, HAPI_NodeId node_id, const int * values_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetParmIntValues);
+		Call.Key(node_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetParmIntValues(session, node_id, values_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetParmNodeValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_NodeId value)
+	{
+		FCall Call(EHoudiniApiFunction::SetParmNodeValue);
+		Call.Key(node_id);
+		Call.Key(parm_name);
+		Call.Key(value);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetParmNodeValue(session, node_id, parm_name, value);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetParmStringValue(const HAPI_Session * session, HAPI_NodeId node_id, const char * value, HAPI_ParmId parm_id, int index)
+	{
+		FCall Call(EHoudiniApiFunction::SetParmStringValue);
+		Call.Key(node_id);
+		Call.Key(value);
+		Call.Key(parm_id);
+		Call.Key(index);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetParmStringValue(session, node_id, value, parm_id, index);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetPartInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_PartInfo * part_info)
+	{
+		FCall Call(EHoudiniApiFunction::SetPartInfo);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetPartInfo(session, node_id, part_id, part_info);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetPreset(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PresetType preset_type, const char * preset_name, const char * buffer, int buffer_length)
+	{
+		FCall Call(EHoudiniApiFunction::SetPreset);
+		Call.Key(node_id);
+		Call.Key(preset_type);
+		Call.Key(preset_name);
+		Call.Key(buffer_length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetPreset(session, node_id, preset_type, preset_name, buffer, buffer_length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetServerEnvInt(const HAPI_Session * session, const char * variable_name, int value)
+	{
+		FCall Call(EHoudiniApiFunction::SetServerEnvInt);
+		Call.Key(variable_name);
+		Call.Key(value);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetServerEnvInt(session, variable_name, value);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetServerEnvString(const HAPI_Session * session, const char * variable_name, const char * value)
+	{
+		FCall Call(EHoudiniApiFunction::SetServerEnvString);
+		Call.Key(variable_name);
+		Call.Key(value);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetServerEnvString(session, variable_name, value);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetSessionSync(const HAPI_Session * session, HAPI_Bool enable)
+	{
+		FCall Call(EHoudiniApiFunction::SetSessionSync);
+		Call.Key(enable);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetSessionSync(session, enable);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetSessionSyncInfo(const HAPI_Session * session, const HAPI_SessionSyncInfo * session_sync_info)
+	{
+		FCall Call(EHoudiniApiFunction::SetSessionSyncInfo);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetSessionSyncInfo(session, session_sync_info);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetTime(const HAPI_Session * session, float time)
+	{
+		FCall Call(EHoudiniApiFunction::SetTime);
+		Call.Key(time);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetTime(session, time);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetTimelineOptions(const HAPI_Session * session, const HAPI_TimelineOptions * timeline_options)
+	{
+		FCall Call(EHoudiniApiFunction::SetTimelineOptions);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetTimelineOptions(session, timeline_options);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetTransformAnimCurve(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_TransformComponent trans_comp, const HAPI_Keyframe * curve_keyframes_array, int keyframe_count)
+	{
+		FCall Call(EHoudiniApiFunction::SetTransformAnimCurve);
+		Call.Key(node_id);
+		Call.Key(trans_comp);
+		Call.Key(keyframe_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetTransformAnimCurve(session, node_id, trans_comp, curve_keyframes_array, keyframe_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetUseHoudiniTime(const HAPI_Session * session, HAPI_Bool enabled)
+	{
+		FCall Call(EHoudiniApiFunction::SetUseHoudiniTime);
+		Call.Key(enabled);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetUseHoudiniTime(session, enabled);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetVertexList(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * vertex_list_array, int start, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetVertexList);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(start);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetVertexList(session, node_id, part_id, vertex_list_array, start, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetViewport(const HAPI_Session * session, const HAPI_Viewport * viewport)
+	{
+		FCall Call(EHoudiniApiFunction::SetViewport);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetViewport(session, viewport);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetVolumeInfo(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeInfo * volume_info)
+	{
+		FCall Call(EHoudiniApiFunction::SetVolumeInfo);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetVolumeInfo(session, node_id, part_id, volume_info);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetVolumeTileFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeTileInfo * tile, const float * values_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetVolumeTileFloatData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetVolumeTileFloatData(session, node_id, part_id, tile, values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetVolumeTileIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeTileInfo * tile, const int * values_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetVolumeTileIntData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetVolumeTileIntData(session, node_id, part_id, tile, values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetVolumeVoxelFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int x_index, int y_index, int z_index, const float * values_array, int value_count)
+	{
+		FCall Call(EHoudiniApiFunction::SetVolumeVoxelFloatData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(x_index);
+		Call.Key(y_index);
+		Call.Key(z_index);
+		Call.Key(value_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetVolumeVoxelFloatData(session, node_id, part_id, x_index, y_index, z_index, values_array, value_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetVolumeVoxelIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int x_index, int y_index, int z_index, const int * values_array, int value_count)
+	{
+		FCall Call(EHoudiniApiFunction::SetVolumeVoxelIntData);
+		Call.Key(node_id);
+		Call.Key(part_id);
+		Call.Key(x_index);
+		Call.Key(y_index);
+		Call.Key(z_index);
+		Call.Key(value_count);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetVolumeVoxelIntData(session, node_id, part_id, x_index, y_index, z_index, values_array, value_count);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetWorkitemFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId workitem_id, const char * data_name, const float * values_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetWorkitemFloatData);
+		Call.Key(node_id);
+		Call.Key(workitem_id);
+		Call.Key(data_name);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetWorkitemFloatData(session, node_id, workitem_id, data_name, values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetWorkitemIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId workitem_id, const char * data_name, const int * values_array, int length)
+	{
+		FCall Call(EHoudiniApiFunction::SetWorkitemIntData);
+		Call.Key(node_id);
+		Call.Key(workitem_id);
+		Call.Key(data_name);
+		Call.Key(length);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetWorkitemIntData(session, node_id, workitem_id, data_name, values_array, length);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result SetWorkitemStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PDG_WorkitemId workitem_id, const char * data_name, int data_index, const char * value)
+	{
+		FCall Call(EHoudiniApiFunction::SetWorkitemStringData);
+		Call.Key(node_id);
+		Call.Key(workitem_id);
+		Call.Key(data_name);
+		Call.Key(data_index);
+		Call.Key(value);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::SetWorkitemStringData(session, node_id, workitem_id, data_name, data_index, value);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result StartThriftNamedPipeServer(const HAPI_ThriftServerOptions * options, const char * pipe_name, HAPI_ProcessId * process_id)
+	{
+		FCall Call(EHoudiniApiFunction::StartThriftNamedPipeServer);
+		Call.Key(pipe_name);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::StartThriftNamedPipeServer(options, pipe_name, process_id);
+		Call.Output(process_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_Result StartThriftSocketServer(const HAPI_ThriftServerOptions * options, int port, HAPI_ProcessId * process_id)
+	{
+		FCall Call(EHoudiniApiFunction::StartThriftSocketServer);
+		Call.Key(port);
+		const HAPI_Result Result = Call.Replay() ? Call.ReplayResult<HAPI_Result>(HAPI_RESULT_FAILURE) : Original::StartThriftSocketServer(options, port, process_id);
+		Call.Output(process_id, 1);
+		return Call.Finish(Result);
+	}
+
+	static HAPI_ThriftServerOptions ThriftServerOptions_Create()
+	{
+		FCall Call(EHoudiniApiFunction::ThriftServerOptions_Create, true);
+		const HAPI_ThriftServerOptions Result = Call.Replay() ? Call.ReplayResult<HAPI_ThriftServerOptions>(HAPI_ThriftServerOptions()) : Original::ThriftServerOptions_Create();
+		return Call.Finish(Result);
+	}
+
+	static void ThriftServerOptions_Init(HAPI_ThriftServerOptions * in)
+	{
+		FCall Call(EHoudiniApiFunction::ThriftServerOptions_Init, true);
+		if (!Call.Replay())
+			Original::ThriftServerOptions_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_TimelineOptions TimelineOptions_Create()
+	{
+		FCall Call(EHoudiniApiFunction::TimelineOptions_Create, true);
+		const HAPI_TimelineOptions Result = Call.Replay() ? Call.ReplayResult<HAPI_TimelineOptions>(HAPI_TimelineOptions()) : Original::TimelineOptions_Create();
+		return Call.Finish(Result);
+	}
+
+	static void TimelineOptions_Init(HAPI_TimelineOptions * in)
+	{
+		FCall Call(EHoudiniApiFunction::TimelineOptions_Init, true);
+		if (!Call.Replay())
+			Original::TimelineOptions_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_TransformEuler TransformEuler_Create()
+	{
+		FCall Call(EHoudiniApiFunction::TransformEuler_Create, true);
+		const HAPI_TransformEuler Result = Call.Replay() ? Call.ReplayResult<HAPI_TransformEuler>(HAPI_TransformEuler()) : Original::TransformEuler_Create();
+		return Call.Finish(Result);
+	}
+
+	static void TransformEuler_Init(HAPI_TransformEuler * in)
+	{
+		FCall Call(EHoudiniApiFunction::TransformEuler_Init, true);
+		if (!Call.Replay())
+			Original::TransformEuler_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Transform Transform_Create()
+	{
+		FCall Call(EHoudiniApiFunction::Transform_Create, true);
+		const HAPI_Transform Result = Call.Replay() ? Call.ReplayResult<HAPI_Transform>(HAPI_Transform()) : Original::Transform_Create();
+		return Call.Finish(Result);
+	}
+
+	static void Transform_Init(HAPI_Transform * in)
+	{
+		FCall Call(EHoudiniApiFunction::Transform_Init, true);
+		if (!Call.Replay())
+			Original::Transform_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_Viewport Viewport_Create()
+	{
+		FCall Call(EHoudiniApiFunction::Viewport_Create, true);
+		const HAPI_Viewport Result = Call.Replay() ? Call.ReplayResult<HAPI_Viewport>(HAPI_Viewport()) : Original::Viewport_Create();
+		return Call.Finish(Result);
+	}
+
+	static HAPI_VolumeInfo VolumeInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::VolumeInfo_Create, true);
+		const HAPI_VolumeInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_VolumeInfo>(HAPI_VolumeInfo()) : Original::VolumeInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void VolumeInfo_Init(HAPI_VolumeInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::VolumeInfo_Init, true);
+		if (!Call.Replay())
+			Original::VolumeInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static HAPI_VolumeTileInfo VolumeTileInfo_Create()
+	{
+		FCall Call(EHoudiniApiFunction::VolumeTileInfo_Create, true);
+		const HAPI_VolumeTileInfo Result = Call.Replay() ? Call.ReplayResult<HAPI_VolumeTileInfo>(HAPI_VolumeTileInfo()) : Original::VolumeTileInfo_Create();
+		return Call.Finish(Result);
+	}
+
+	static void VolumeTileInfo_Init(HAPI_VolumeTileInfo * in)
+	{
+		FCall Call(EHoudiniApiFunction::VolumeTileInfo_Init, true);
+		if (!Call.Replay())
+			Original::VolumeTileInfo_Init(in);
+		Call.Output(in, 1);
+		Call.Finish();
+	}
+
+	static void Install();
+	static void Uninstall();
+};
+
+FHoudiniApi::AddAttributeFuncPtr FHoudiniApiRecorderHooks::Original::AddAttribute = nullptr;
+FHoudiniApi::AddGroupFuncPtr FHoudiniApiRecorderHooks::Original::AddGroup = nullptr;
+FHoudiniApi::AssetInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::AssetInfo_Create = nullptr;
+FHoudiniApi::AssetInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::AssetInfo_Init = nullptr;
+FHoudiniApi::AttributeInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::AttributeInfo_Create = nullptr;
+FHoudiniApi::AttributeInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::AttributeInfo_Init = nullptr;
+FHoudiniApi::BindCustomImplementationFuncPtr FHoudiniApiRecorderHooks::Original::BindCustomImplementation = nullptr;
+FHoudiniApi::CancelPDGCookFuncPtr FHoudiniApiRecorderHooks::Original::CancelPDGCook = nullptr;
+FHoudiniApi::CheckForSpecificErrorsFuncPtr FHoudiniApiRecorderHooks::Original::CheckForSpecificErrors = nullptr;
+FHoudiniApi::CleanupFuncPtr FHoudiniApiRecorderHooks::Original::Cleanup = nullptr;
+FHoudiniApi::ClearConnectionErrorFuncPtr FHoudiniApiRecorderHooks::Original::ClearConnectionError = nullptr;
+FHoudiniApi::CloseSessionFuncPtr FHoudiniApiRecorderHooks::Original::CloseSession = nullptr;
+FHoudiniApi::CommitGeoFuncPtr FHoudiniApiRecorderHooks::Original::CommitGeo = nullptr;
+FHoudiniApi::CommitWorkitemsFuncPtr FHoudiniApiRecorderHooks::Original::CommitWorkitems = nullptr;
+FHoudiniApi::ComposeChildNodeListFuncPtr FHoudiniApiRecorderHooks::Original::ComposeChildNodeList = nullptr;
+FHoudiniApi::ComposeNodeCookResultFuncPtr FHoudiniApiRecorderHooks::Original::ComposeNodeCookResult = nullptr;
+FHoudiniApi::ComposeObjectListFuncPtr FHoudiniApiRecorderHooks::Original::ComposeObjectList = nullptr;
+FHoudiniApi::ConnectNodeInputFuncPtr FHoudiniApiRecorderHooks::Original::ConnectNodeInput = nullptr;
+FHoudiniApi::ConvertMatrixToEulerFuncPtr FHoudiniApiRecorderHooks::Original::ConvertMatrixToEuler = nullptr;
+FHoudiniApi::ConvertMatrixToQuatFuncPtr FHoudiniApiRecorderHooks::Original::ConvertMatrixToQuat = nullptr;
+FHoudiniApi::ConvertTransformFuncPtr FHoudiniApiRecorderHooks::Original::ConvertTransform = nullptr;
+FHoudiniApi::ConvertTransformEulerToMatrixFuncPtr FHoudiniApiRecorderHooks::Original::ConvertTransformEulerToMatrix = nullptr;
+FHoudiniApi::ConvertTransformQuatToMatrixFuncPtr FHoudiniApiRecorderHooks::Original::ConvertTransformQuatToMatrix = nullptr;
+FHoudiniApi::CookNodeFuncPtr FHoudiniApiRecorderHooks::Original::CookNode = nullptr;
+FHoudiniApi::CookOptions_AreEqualFuncPtr FHoudiniApiRecorderHooks::Original::CookOptions_AreEqual = nullptr;
+FHoudiniApi::CookOptions_CreateFuncPtr FHoudiniApiRecorderHooks::Original::CookOptions_Create = nullptr;
+FHoudiniApi::CookOptions_InitFuncPtr FHoudiniApiRecorderHooks::Original::CookOptions_Init = nullptr;
+FHoudiniApi::CookPDGFuncPtr FHoudiniApiRecorderHooks::Original::CookPDG = nullptr;
+FHoudiniApi::CreateCustomSessionFuncPtr FHoudiniApiRecorderHooks::Original::CreateCustomSession = nullptr;
+FHoudiniApi::CreateHeightFieldInputFuncPtr FHoudiniApiRecorderHooks::Original::CreateHeightFieldInput = nullptr;
+FHoudiniApi::CreateHeightfieldInputVolumeNodeFuncPtr FHoudiniApiRecorderHooks::Original::CreateHeightfieldInputVolumeNode = nullptr;
+FHoudiniApi::CreateInProcessSessionFuncPtr FHoudiniApiRecorderHooks::Original::CreateInProcessSession = nullptr;
+FHoudiniApi::CreateInputNodeFuncPtr FHoudiniApiRecorderHooks::Original::CreateInputNode = nullptr;
+FHoudiniApi::CreateNodeFuncPtr FHoudiniApiRecorderHooks::Original::CreateNode = nullptr;
+FHoudiniApi::CreateThriftNamedPipeSessionFuncPtr FHoudiniApiRecorderHooks::Original::CreateThriftNamedPipeSession = nullptr;
+FHoudiniApi::CreateThriftSocketSessionFuncPtr FHoudiniApiRecorderHooks::Original::CreateThriftSocketSession = nullptr;
+FHoudiniApi::CreateWorkitemFuncPtr FHoudiniApiRecorderHooks::Original::CreateWorkitem = nullptr;
+FHoudiniApi::CurveInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::CurveInfo_Create = nullptr;
+FHoudiniApi::CurveInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::CurveInfo_Init = nullptr;
+FHoudiniApi::DeleteAttributeFuncPtr FHoudiniApiRecorderHooks::Original::DeleteAttribute = nullptr;
+FHoudiniApi::DeleteGroupFuncPtr FHoudiniApiRecorderHooks::Original::DeleteGroup = nullptr;
+FHoudiniApi::DeleteNodeFuncPtr FHoudiniApiRecorderHooks::Original::DeleteNode = nullptr;
+FHoudiniApi::DirtyPDGNodeFuncPtr FHoudiniApiRecorderHooks::Original::DirtyPDGNode = nullptr;
+FHoudiniApi::DisconnectNodeInputFuncPtr FHoudiniApiRecorderHooks::Original::DisconnectNodeInput = nullptr;
+FHoudiniApi::DisconnectNodeOutputsAtFuncPtr FHoudiniApiRecorderHooks::Original::DisconnectNodeOutputsAt = nullptr;
+FHoudiniApi::ExtractImageToFileFuncPtr FHoudiniApiRecorderHooks::Original::ExtractImageToFile = nullptr;
+FHoudiniApi::ExtractImageToMemoryFuncPtr FHoudiniApiRecorderHooks::Original::ExtractImageToMemory = nullptr;
+FHoudiniApi::GeoInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::GeoInfo_Create = nullptr;
+FHoudiniApi::GeoInfo_GetGroupCountByTypeFuncPtr FHoudiniApiRecorderHooks::Original::GeoInfo_GetGroupCountByType = nullptr;
+FHoudiniApi::GeoInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::GeoInfo_Init = nullptr;
+FHoudiniApi::GetActiveCacheCountFuncPtr FHoudiniApiRecorderHooks::Original::GetActiveCacheCount = nullptr;
+FHoudiniApi::GetActiveCacheNamesFuncPtr FHoudiniApiRecorderHooks::Original::GetActiveCacheNames = nullptr;
+FHoudiniApi::GetAssetDefinitionParmCountsFuncPtr FHoudiniApiRecorderHooks::Original::GetAssetDefinitionParmCounts = nullptr;
+FHoudiniApi::GetAssetDefinitionParmInfosFuncPtr FHoudiniApiRecorderHooks::Original::GetAssetDefinitionParmInfos = nullptr;
+FHoudiniApi::GetAssetDefinitionParmValuesFuncPtr FHoudiniApiRecorderHooks::Original::GetAssetDefinitionParmValues = nullptr;
+FHoudiniApi::GetAssetInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetAssetInfo = nullptr;
+FHoudiniApi::GetAttributeFloat64ArrayDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeFloat64ArrayData = nullptr;
+FHoudiniApi::GetAttributeFloat64DataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeFloat64Data = nullptr;
+FHoudiniApi::GetAttributeFloatArrayDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeFloatArrayData = nullptr;
+FHoudiniApi::GetAttributeFloatDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeFloatData = nullptr;
+FHoudiniApi::GetAttributeInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeInfo = nullptr;
+FHoudiniApi::GetAttributeInt16ArrayDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeInt16ArrayData = nullptr;
+FHoudiniApi::GetAttributeInt16DataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeInt16Data = nullptr;
+FHoudiniApi::GetAttributeInt64ArrayDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeInt64ArrayData = nullptr;
+FHoudiniApi::GetAttributeInt64DataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeInt64Data = nullptr;
+FHoudiniApi::GetAttributeInt8ArrayDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeInt8ArrayData = nullptr;
+FHoudiniApi::GetAttributeInt8DataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeInt8Data = nullptr;
+FHoudiniApi::GetAttributeIntArrayDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeIntArrayData = nullptr;
+FHoudiniApi::GetAttributeIntDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeIntData = nullptr;
+FHoudiniApi::GetAttributeNamesFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeNames = nullptr;
+FHoudiniApi::GetAttributeStringArrayDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeStringArrayData = nullptr;
+FHoudiniApi::GetAttributeStringDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeStringData = nullptr;
+FHoudiniApi::GetAttributeUInt8ArrayDataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeUInt8ArrayData = nullptr;
+FHoudiniApi::GetAttributeUInt8DataFuncPtr FHoudiniApiRecorderHooks::Original::GetAttributeUInt8Data = nullptr;
+FHoudiniApi::GetAvailableAssetCountFuncPtr FHoudiniApiRecorderHooks::Original::GetAvailableAssetCount = nullptr;
+FHoudiniApi::GetAvailableAssetsFuncPtr FHoudiniApiRecorderHooks::Original::GetAvailableAssets = nullptr;
+FHoudiniApi::GetBoxInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetBoxInfo = nullptr;
+FHoudiniApi::GetCachePropertyFuncPtr FHoudiniApiRecorderHooks::Original::GetCacheProperty = nullptr;
+FHoudiniApi::GetComposedChildNodeListFuncPtr FHoudiniApiRecorderHooks::Original::GetComposedChildNodeList = nullptr;
+FHoudiniApi::GetComposedNodeCookResultFuncPtr FHoudiniApiRecorderHooks::Original::GetComposedNodeCookResult = nullptr;
+FHoudiniApi::GetComposedObjectListFuncPtr FHoudiniApiRecorderHooks::Original::GetComposedObjectList = nullptr;
+FHoudiniApi::GetComposedObjectTransformsFuncPtr FHoudiniApiRecorderHooks::Original::GetComposedObjectTransforms = nullptr;
+FHoudiniApi::GetConnectionErrorFuncPtr FHoudiniApiRecorderHooks::Original::GetConnectionError = nullptr;
+FHoudiniApi::GetConnectionErrorLengthFuncPtr FHoudiniApiRecorderHooks::Original::GetConnectionErrorLength = nullptr;
+FHoudiniApi::GetCookingCurrentCountFuncPtr FHoudiniApiRecorderHooks::Original::GetCookingCurrentCount = nullptr;
+FHoudiniApi::GetCookingTotalCountFuncPtr FHoudiniApiRecorderHooks::Original::GetCookingTotalCount = nullptr;
+FHoudiniApi::GetCurveCountsFuncPtr FHoudiniApiRecorderHooks::Original::GetCurveCounts = nullptr;
+FHoudiniApi::GetCurveInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetCurveInfo = nullptr;
+FHoudiniApi::GetCurveKnotsFuncPtr FHoudiniApiRecorderHooks::Original::GetCurveKnots = nullptr;
+FHoudiniApi::GetCurveOrdersFuncPtr FHoudiniApiRecorderHooks::Original::GetCurveOrders = nullptr;
+FHoudiniApi::GetDisplayGeoInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetDisplayGeoInfo = nullptr;
+FHoudiniApi::GetEnvIntFuncPtr FHoudiniApiRecorderHooks::Original::GetEnvInt = nullptr;
+FHoudiniApi::GetFaceCountsFuncPtr FHoudiniApiRecorderHooks::Original::GetFaceCounts = nullptr;
+FHoudiniApi::GetFirstVolumeTileFuncPtr FHoudiniApiRecorderHooks::Original::GetFirstVolumeTile = nullptr;
+FHoudiniApi::GetGeoInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetGeoInfo = nullptr;
+FHoudiniApi::GetGeoSizeFuncPtr FHoudiniApiRecorderHooks::Original::GetGeoSize = nullptr;
+FHoudiniApi::GetGroupCountOnPackedInstancePartFuncPtr FHoudiniApiRecorderHooks::Original::GetGroupCountOnPackedInstancePart = nullptr;
+FHoudiniApi::GetGroupMembershipFuncPtr FHoudiniApiRecorderHooks::Original::GetGroupMembership = nullptr;
+FHoudiniApi::GetGroupMembershipOnPackedInstancePartFuncPtr FHoudiniApiRecorderHooks::Original::GetGroupMembershipOnPackedInstancePart = nullptr;
+FHoudiniApi::GetGroupNamesFuncPtr FHoudiniApiRecorderHooks::Original::GetGroupNames = nullptr;
+FHoudiniApi::GetGroupNamesOnPackedInstancePartFuncPtr FHoudiniApiRecorderHooks::Original::GetGroupNamesOnPackedInstancePart = nullptr;
+FHoudiniApi::GetHIPFileNodeCountFuncPtr FHoudiniApiRecorderHooks::Original::GetHIPFileNodeCount = nullptr;
+FHoudiniApi::GetHIPFileNodeIdsFuncPtr FHoudiniApiRecorderHooks::Original::GetHIPFileNodeIds = nullptr;
+FHoudiniApi::GetHandleBindingInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetHandleBindingInfo = nullptr;
+FHoudiniApi::GetHandleInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetHandleInfo = nullptr;
+FHoudiniApi::GetHeightFieldDataFuncPtr FHoudiniApiRecorderHooks::Original::GetHeightFieldData = nullptr;
+FHoudiniApi::GetImageFilePathFuncPtr FHoudiniApiRecorderHooks::Original::GetImageFilePath = nullptr;
+FHoudiniApi::GetImageInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetImageInfo = nullptr;
+FHoudiniApi::GetImageMemoryBufferFuncPtr FHoudiniApiRecorderHooks::Original::GetImageMemoryBuffer = nullptr;
+FHoudiniApi::GetImagePlaneCountFuncPtr FHoudiniApiRecorderHooks::Original::GetImagePlaneCount = nullptr;
+FHoudiniApi::GetImagePlanesFuncPtr FHoudiniApiRecorderHooks::Original::GetImagePlanes = nullptr;
+FHoudiniApi::GetInstanceTransformsOnPartFuncPtr FHoudiniApiRecorderHooks::Original::GetInstanceTransformsOnPart = nullptr;
+FHoudiniApi::GetInstancedObjectIdsFuncPtr FHoudiniApiRecorderHooks::Original::GetInstancedObjectIds = nullptr;
+FHoudiniApi::GetInstancedPartIdsFuncPtr FHoudiniApiRecorderHooks::Original::GetInstancedPartIds = nullptr;
+FHoudiniApi::GetInstancerPartTransformsFuncPtr FHoudiniApiRecorderHooks::Original::GetInstancerPartTransforms = nullptr;
+FHoudiniApi::GetManagerNodeIdFuncPtr FHoudiniApiRecorderHooks::Original::GetManagerNodeId = nullptr;
+FHoudiniApi::GetMaterialInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetMaterialInfo = nullptr;
+FHoudiniApi::GetMaterialNodeIdsOnFacesFuncPtr FHoudiniApiRecorderHooks::Original::GetMaterialNodeIdsOnFaces = nullptr;
+FHoudiniApi::GetNextVolumeTileFuncPtr FHoudiniApiRecorderHooks::Original::GetNextVolumeTile = nullptr;
+FHoudiniApi::GetNodeInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetNodeInfo = nullptr;
+FHoudiniApi::GetNodeInputNameFuncPtr FHoudiniApiRecorderHooks::Original::GetNodeInputName = nullptr;
+FHoudiniApi::GetNodeOutputNameFuncPtr FHoudiniApiRecorderHooks::Original::GetNodeOutputName = nullptr;
+FHoudiniApi::GetNodePathFuncPtr FHoudiniApiRecorderHooks::Original::GetNodePath = nullptr;
+FHoudiniApi::GetNumWorkitemsFuncPtr FHoudiniApiRecorderHooks::Original::GetNumWorkitems = nullptr;
+FHoudiniApi::GetObjectInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetObjectInfo = nullptr;
+FHoudiniApi::GetObjectTransformFuncPtr FHoudiniApiRecorderHooks::Original::GetObjectTransform = nullptr;
+FHoudiniApi::GetOutputNodeIdFuncPtr FHoudiniApiRecorderHooks::Original::GetOutputNodeId = nullptr;
+FHoudiniApi::GetPDGEventsFuncPtr FHoudiniApiRecorderHooks::Original::GetPDGEvents = nullptr;
+FHoudiniApi::GetPDGGraphContextIdFuncPtr FHoudiniApiRecorderHooks::Original::GetPDGGraphContextId = nullptr;
+FHoudiniApi::GetPDGGraphContextsFuncPtr FHoudiniApiRecorderHooks::Original::GetPDGGraphContexts = nullptr;
+FHoudiniApi::GetPDGStateFuncPtr FHoudiniApiRecorderHooks::Original::GetPDGState = nullptr;
+FHoudiniApi::GetParametersFuncPtr FHoudiniApiRecorderHooks::Original::GetParameters = nullptr;
+FHoudiniApi::GetParmChoiceListsFuncPtr FHoudiniApiRecorderHooks::Original::GetParmChoiceLists = nullptr;
+FHoudiniApi::GetParmExpressionFuncPtr FHoudiniApiRecorderHooks::Original::GetParmExpression = nullptr;
+FHoudiniApi::GetParmFileFuncPtr FHoudiniApiRecorderHooks::Original::GetParmFile = nullptr;
+FHoudiniApi::GetParmFloatValueFuncPtr FHoudiniApiRecorderHooks::Original::GetParmFloatValue = nullptr;
+FHoudiniApi::GetParmFloatValuesFuncPtr FHoudiniApiRecorderHooks::Original::GetParmFloatValues = nullptr;
+FHoudiniApi::GetParmIdFromNameFuncPtr FHoudiniApiRecorderHooks::Original::GetParmIdFromName = nullptr;
+FHoudiniApi::GetParmInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetParmInfo = nullptr;
+FHoudiniApi::GetParmInfoFromNameFuncPtr FHoudiniApiRecorderHooks::Original::GetParmInfoFromName = nullptr;
+FHoudiniApi::GetParmIntValueFuncPtr FHoudiniApiRecorderHooks::Original::GetParmIntValue = nullptr;
+FHoudiniApi::GetParmIntValuesFuncPtr FHoudiniApiRecorderHooks::Original::GetParmIntValues = nullptr;
+FHoudiniApi::GetParmNodeValueFuncPtr FHoudiniApiRecorderHooks::Original::GetParmNodeValue = nullptr;
+FHoudiniApi::GetParmStringValueFuncPtr FHoudiniApiRecorderHooks::Original::GetParmStringValue = nullptr;
+FHoudiniApi::GetParmStringValuesFuncPtr FHoudiniApiRecorderHooks::Original::GetParmStringValues = nullptr;
+FHoudiniApi::GetParmTagNameFuncPtr FHoudiniApiRecorderHooks::Original::GetParmTagName = nullptr;
+FHoudiniApi::GetParmTagValueFuncPtr FHoudiniApiRecorderHooks::Original::GetParmTagValue = nullptr;
+FHoudiniApi::GetParmWithTagFuncPtr FHoudiniApiRecorderHooks::Original::GetParmWithTag = nullptr;
+FHoudiniApi::GetPartInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetPartInfo = nullptr;
+FHoudiniApi::GetPresetFuncPtr FHoudiniApiRecorderHooks::Original::GetPreset = nullptr;
+FHoudiniApi::GetPresetBufLengthFuncPtr FHoudiniApiRecorderHooks::Original::GetPresetBufLength = nullptr;
+FHoudiniApi::GetServerEnvIntFuncPtr FHoudiniApiRecorderHooks::Original::GetServerEnvInt = nullptr;
+FHoudiniApi::GetServerEnvStringFuncPtr FHoudiniApiRecorderHooks::Original::GetServerEnvString = nullptr;
+FHoudiniApi::GetServerEnvVarCountFuncPtr FHoudiniApiRecorderHooks::Original::GetServerEnvVarCount = nullptr;
+FHoudiniApi::GetServerEnvVarListFuncPtr FHoudiniApiRecorderHooks::Original::GetServerEnvVarList = nullptr;
+FHoudiniApi::GetSessionEnvIntFuncPtr FHoudiniApiRecorderHooks::Original::GetSessionEnvInt = nullptr;
+FHoudiniApi::GetSessionSyncInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetSessionSyncInfo = nullptr;
+FHoudiniApi::GetSphereInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetSphereInfo = nullptr;
+FHoudiniApi::GetStatusFuncPtr FHoudiniApiRecorderHooks::Original::GetStatus = nullptr;
+FHoudiniApi::GetStatusStringFuncPtr FHoudiniApiRecorderHooks::Original::GetStatusString = nullptr;
+FHoudiniApi::GetStatusStringBufLengthFuncPtr FHoudiniApiRecorderHooks::Original::GetStatusStringBufLength = nullptr;
+FHoudiniApi::GetStringFuncPtr FHoudiniApiRecorderHooks::Original::GetString = nullptr;
+FHoudiniApi::GetStringBatchFuncPtr FHoudiniApiRecorderHooks::Original::GetStringBatch = nullptr;
+FHoudiniApi::GetStringBatchSizeFuncPtr FHoudiniApiRecorderHooks::Original::GetStringBatchSize = nullptr;
+FHoudiniApi::GetStringBufLengthFuncPtr FHoudiniApiRecorderHooks::Original::GetStringBufLength = nullptr;
+FHoudiniApi::GetSupportedImageFileFormatCountFuncPtr FHoudiniApiRecorderHooks::Original::GetSupportedImageFileFormatCount = nullptr;
+FHoudiniApi::GetSupportedImageFileFormatsFuncPtr FHoudiniApiRecorderHooks::Original::GetSupportedImageFileFormats = nullptr;
+FHoudiniApi::GetTimeFuncPtr FHoudiniApiRecorderHooks::Original::GetTime = nullptr;
+FHoudiniApi::GetTimelineOptionsFuncPtr FHoudiniApiRecorderHooks::Original::GetTimelineOptions = nullptr;
+FHoudiniApi::GetTotalCookCountFuncPtr FHoudiniApiRecorderHooks::Original::GetTotalCookCount = nullptr;
+FHoudiniApi::GetUseHoudiniTimeFuncPtr FHoudiniApiRecorderHooks::Original::GetUseHoudiniTime = nullptr;
+FHoudiniApi::GetVertexListFuncPtr FHoudiniApiRecorderHooks::Original::GetVertexList = nullptr;
+FHoudiniApi::GetViewportFuncPtr FHoudiniApiRecorderHooks::Original::GetViewport = nullptr;
+FHoudiniApi::GetVolumeBoundsFuncPtr FHoudiniApiRecorderHooks::Original::GetVolumeBounds = nullptr;
+FHoudiniApi::GetVolumeInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetVolumeInfo = nullptr;
+FHoudiniApi::GetVolumeTileFloatDataFuncPtr FHoudiniApiRecorderHooks::Original::GetVolumeTileFloatData = nullptr;
+FHoudiniApi::GetVolumeTileIntDataFuncPtr FHoudiniApiRecorderHooks::Original::GetVolumeTileIntData = nullptr;
+FHoudiniApi::GetVolumeVisualInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetVolumeVisualInfo = nullptr;
+FHoudiniApi::GetVolumeVoxelFloatDataFuncPtr FHoudiniApiRecorderHooks::Original::GetVolumeVoxelFloatData = nullptr;
+FHoudiniApi::GetVolumeVoxelIntDataFuncPtr FHoudiniApiRecorderHooks::Original::GetVolumeVoxelIntData = nullptr;
+FHoudiniApi::GetWorkitemDataLengthFuncPtr FHoudiniApiRecorderHooks::Original::GetWorkitemDataLength = nullptr;
+FHoudiniApi::GetWorkitemFloatDataFuncPtr FHoudiniApiRecorderHooks::Original::GetWorkitemFloatData = nullptr;
+FHoudiniApi::GetWorkitemInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetWorkitemInfo = nullptr;
+FHoudiniApi::GetWorkitemIntDataFuncPtr FHoudiniApiRecorderHooks::Original::GetWorkitemIntData = nullptr;
+FHoudiniApi::GetWorkitemResultInfoFuncPtr FHoudiniApiRecorderHooks::Original::GetWorkitemResultInfo = nullptr;
+FHoudiniApi::GetWorkitemStringDataFuncPtr FHoudiniApiRecorderHooks::Original::GetWorkitemStringData = nullptr;
+FHoudiniApi::GetWorkitemsFuncPtr FHoudiniApiRecorderHooks::Original::GetWorkitems = nullptr;
+FHoudiniApi::HandleBindingInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::HandleBindingInfo_Create = nullptr;
+FHoudiniApi::HandleBindingInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::HandleBindingInfo_Init = nullptr;
+FHoudiniApi::HandleInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::HandleInfo_Create = nullptr;
+FHoudiniApi::HandleInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::HandleInfo_Init = nullptr;
+FHoudiniApi::ImageFileFormat_CreateFuncPtr FHoudiniApiRecorderHooks::Original::ImageFileFormat_Create = nullptr;
+FHoudiniApi::ImageFileFormat_InitFuncPtr FHoudiniApiRecorderHooks::Original::ImageFileFormat_Init = nullptr;
+FHoudiniApi::ImageInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::ImageInfo_Create = nullptr;
+FHoudiniApi::ImageInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::ImageInfo_Init = nullptr;
+FHoudiniApi::InitializeFuncPtr FHoudiniApiRecorderHooks::Original::Initialize = nullptr;
+FHoudiniApi::InsertMultiparmInstanceFuncPtr FHoudiniApiRecorderHooks::Original::InsertMultiparmInstance = nullptr;
+FHoudiniApi::InterruptFuncPtr FHoudiniApiRecorderHooks::Original::Interrupt = nullptr;
+FHoudiniApi::IsInitializedFuncPtr FHoudiniApiRecorderHooks::Original::IsInitialized = nullptr;
+FHoudiniApi::IsNodeValidFuncPtr FHoudiniApiRecorderHooks::Original::IsNodeValid = nullptr;
+FHoudiniApi::IsSessionValidFuncPtr FHoudiniApiRecorderHooks::Original::IsSessionValid = nullptr;
+FHoudiniApi::Keyframe_CreateFuncPtr FHoudiniApiRecorderHooks::Original::Keyframe_Create = nullptr;
+FHoudiniApi::Keyframe_InitFuncPtr FHoudiniApiRecorderHooks::Original::Keyframe_Init = nullptr;
+FHoudiniApi::LoadAssetLibraryFromFileFuncPtr FHoudiniApiRecorderHooks::Original::LoadAssetLibraryFromFile = nullptr;
+FHoudiniApi::LoadAssetLibraryFromMemoryFuncPtr FHoudiniApiRecorderHooks::Original::LoadAssetLibraryFromMemory = nullptr;
+FHoudiniApi::LoadGeoFromFileFuncPtr FHoudiniApiRecorderHooks::Original::LoadGeoFromFile = nullptr;
+FHoudiniApi::LoadGeoFromMemoryFuncPtr FHoudiniApiRecorderHooks::Original::LoadGeoFromMemory = nullptr;
+FHoudiniApi::LoadHIPFileFuncPtr FHoudiniApiRecorderHooks::Original::LoadHIPFile = nullptr;
+FHoudiniApi::LoadNodeFromFileFuncPtr FHoudiniApiRecorderHooks::Original::LoadNodeFromFile = nullptr;
+FHoudiniApi::MaterialInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::MaterialInfo_Create = nullptr;
+FHoudiniApi::MaterialInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::MaterialInfo_Init = nullptr;
+FHoudiniApi::MergeHIPFileFuncPtr FHoudiniApiRecorderHooks::Original::MergeHIPFile = nullptr;
+FHoudiniApi::NodeInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::NodeInfo_Create = nullptr;
+FHoudiniApi::NodeInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::NodeInfo_Init = nullptr;
+FHoudiniApi::ObjectInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::ObjectInfo_Create = nullptr;
+FHoudiniApi::ObjectInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::ObjectInfo_Init = nullptr;
+FHoudiniApi::ParmChoiceInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::ParmChoiceInfo_Create = nullptr;
+FHoudiniApi::ParmChoiceInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::ParmChoiceInfo_Init = nullptr;
+FHoudiniApi::ParmHasExpressionFuncPtr FHoudiniApiRecorderHooks::Original::ParmHasExpression = nullptr;
+FHoudiniApi::ParmHasTagFuncPtr FHoudiniApiRecorderHooks::Original::ParmHasTag = nullptr;
+FHoudiniApi::ParmInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_Create = nullptr;
+FHoudiniApi::ParmInfo_GetFloatValueCountFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_GetFloatValueCount = nullptr;
+FHoudiniApi::ParmInfo_GetIntValueCountFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_GetIntValueCount = nullptr;
+FHoudiniApi::ParmInfo_GetStringValueCountFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_GetStringValueCount = nullptr;
+FHoudiniApi::ParmInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_Init = nullptr;
+FHoudiniApi::ParmInfo_IsFloatFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_IsFloat = nullptr;
+FHoudiniApi::ParmInfo_IsIntFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_IsInt = nullptr;
+FHoudiniApi::ParmInfo_IsNodeFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_IsNode = nullptr;
+FHoudiniApi::ParmInfo_IsNonValueFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_IsNonValue = nullptr;
+FHoudiniApi::ParmInfo_IsPathFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_IsPath = nullptr;
+FHoudiniApi::ParmInfo_IsStringFuncPtr FHoudiniApiRecorderHooks::Original::ParmInfo_IsString = nullptr;
+FHoudiniApi::PartInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::PartInfo_Create = nullptr;
+FHoudiniApi::PartInfo_GetAttributeCountByOwnerFuncPtr FHoudiniApiRecorderHooks::Original::PartInfo_GetAttributeCountByOwner = nullptr;
+FHoudiniApi::PartInfo_GetElementCountByAttributeOwnerFuncPtr FHoudiniApiRecorderHooks::Original::PartInfo_GetElementCountByAttributeOwner = nullptr;
+FHoudiniApi::PartInfo_GetElementCountByGroupTypeFuncPtr FHoudiniApiRecorderHooks::Original::PartInfo_GetElementCountByGroupType = nullptr;
+FHoudiniApi::PartInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::PartInfo_Init = nullptr;
+FHoudiniApi::PausePDGCookFuncPtr FHoudiniApiRecorderHooks::Original::PausePDGCook = nullptr;
+FHoudiniApi::PythonThreadInterpreterLockFuncPtr FHoudiniApiRecorderHooks::Original::PythonThreadInterpreterLock = nullptr;
+FHoudiniApi::QueryNodeInputFuncPtr FHoudiniApiRecorderHooks::Original::QueryNodeInput = nullptr;
+FHoudiniApi::QueryNodeOutputConnectedCountFuncPtr FHoudiniApiRecorderHooks::Original::QueryNodeOutputConnectedCount = nullptr;
+FHoudiniApi::QueryNodeOutputConnectedNodesFuncPtr FHoudiniApiRecorderHooks::Original::QueryNodeOutputConnectedNodes = nullptr;
+FHoudiniApi::RemoveCustomStringFuncPtr FHoudiniApiRecorderHooks::Original::RemoveCustomString = nullptr;
+FHoudiniApi::RemoveMultiparmInstanceFuncPtr FHoudiniApiRecorderHooks::Original::RemoveMultiparmInstance = nullptr;
+FHoudiniApi::RemoveParmExpressionFuncPtr FHoudiniApiRecorderHooks::Original::RemoveParmExpression = nullptr;
+FHoudiniApi::RenameNodeFuncPtr FHoudiniApiRecorderHooks::Original::RenameNode = nullptr;
+FHoudiniApi::RenderCOPToImageFuncPtr FHoudiniApiRecorderHooks::Original::RenderCOPToImage = nullptr;
+FHoudiniApi::RenderTextureToImageFuncPtr FHoudiniApiRecorderHooks::Original::RenderTextureToImage = nullptr;
+FHoudiniApi::ResetSimulationFuncPtr FHoudiniApiRecorderHooks::Original::ResetSimulation = nullptr;
+FHoudiniApi::RevertGeoFuncPtr FHoudiniApiRecorderHooks::Original::RevertGeo = nullptr;
+FHoudiniApi::RevertParmToDefaultFuncPtr FHoudiniApiRecorderHooks::Original::RevertParmToDefault = nullptr;
+FHoudiniApi::RevertParmToDefaultsFuncPtr FHoudiniApiRecorderHooks::Original::RevertParmToDefaults = nullptr;
+FHoudiniApi::SaveGeoToFileFuncPtr FHoudiniApiRecorderHooks::Original::SaveGeoToFile = nullptr;
+FHoudiniApi::SaveGeoToMemoryFuncPtr FHoudiniApiRecorderHooks::Original::SaveGeoToMemory = nullptr;
+FHoudiniApi::SaveHIPFileFuncPtr FHoudiniApiRecorderHooks::Original::SaveHIPFile = nullptr;
+FHoudiniApi::SaveNodeToFileFuncPtr FHoudiniApiRecorderHooks::Original::SaveNodeToFile = nullptr;
+FHoudiniApi::SessionSyncInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::SessionSyncInfo_Create = nullptr;
+FHoudiniApi::SetAnimCurveFuncPtr FHoudiniApiRecorderHooks::Original::SetAnimCurve = nullptr;
+FHoudiniApi::SetAttributeFloat64DataFuncPtr FHoudiniApiRecorderHooks::Original::SetAttributeFloat64Data = nullptr;
+FHoudiniApi::SetAttributeFloatDataFuncPtr FHoudiniApiRecorderHooks::Original::SetAttributeFloatData = nullptr;
+FHoudiniApi::SetAttributeInt16DataFuncPtr FHoudiniApiRecorderHooks::Original::SetAttributeInt16Data = nullptr;
+FHoudiniApi::SetAttributeInt64DataFuncPtr FHoudiniApiRecorderHooks::Original::SetAttributeInt64Data = nullptr;
+FHoudiniApi::SetAttributeInt8DataFuncPtr FHoudiniApiRecorderHooks::Original::SetAttributeInt8Data = nullptr;
+FHoudiniApi::SetAttributeIntDataFuncPtr FHoudiniApiRecorderHooks::Original::SetAttributeIntData = nullptr;
+FHoudiniApi::SetAttributeStringDataFuncPtr FHoudiniApiRecorderHooks::Original::SetAttributeStringData = nullptr;
+FHoudiniApi::SetAttributeUInt8DataFuncPtr FHoudiniApiRecorderHooks::Original::SetAttributeUInt8Data = nullptr;
+FHoudiniApi::SetCachePropertyFuncPtr FHoudiniApiRecorderHooks::Original::SetCacheProperty = nullptr;
+FHoudiniApi::SetCurveCountsFuncPtr FHoudiniApiRecorderHooks::Original::SetCurveCounts = nullptr;
+FHoudiniApi::SetCurveInfoFuncPtr FHoudiniApiRecorderHooks::Original::SetCurveInfo = nullptr;
+FHoudiniApi::SetCurveKnotsFuncPtr FHoudiniApiRecorderHooks::Original::SetCurveKnots = nullptr;
+FHoudiniApi::SetCurveOrdersFuncPtr FHoudiniApiRecorderHooks::Original::SetCurveOrders = nullptr;
+FHoudiniApi::SetCustomStringFuncPtr FHoudiniApiRecorderHooks::Original::SetCustomString = nullptr;
+FHoudiniApi::SetFaceCountsFuncPtr FHoudiniApiRecorderHooks::Original::SetFaceCounts = nullptr;
+FHoudiniApi::SetGroupMembershipFuncPtr FHoudiniApiRecorderHooks::Original::SetGroupMembership = nullptr;
+FHoudiniApi::SetHeightFieldDataFuncPtr FHoudiniApiRecorderHooks::Original::SetHeightFieldData = nullptr;
+FHoudiniApi::SetImageInfoFuncPtr FHoudiniApiRecorderHooks::Original::SetImageInfo = nullptr;
+FHoudiniApi::SetNodeDisplayFuncPtr FHoudiniApiRecorderHooks::Original::SetNodeDisplay = nullptr;
+FHoudiniApi::SetObjectTransformFuncPtr FHoudiniApiRecorderHooks::Original::SetObjectTransform = nullptr;
+FHoudiniApi::SetParmExpressionFuncPtr FHoudiniApiRecorderHooks::Original::SetParmExpression = nullptr;
+FHoudiniApi::SetParmFloatValueFuncPtr FHoudiniApiRecorderHooks::Original::SetParmFloatValue = nullptr;
+FHoudiniApi::SetParmFloatValuesFuncPtr FHoudiniApiRecorderHooks::Original::SetParmFloatValues = nullptr;
+FHoudiniApi::SetParmIntValueFuncPtr FHoudiniApiRecorderHooks::Original::SetParmIntValue = nullptr;
+FHoudiniApi::SetParmIntValuesFuncPtr FHoudiniApiRecorderHooks::Original::SetParmIntValues = nullptr;
+FHoudiniApi::SetParmNodeValueFuncPtr FHoudiniApiRecorderHooks::Original::SetParmNodeValue = nullptr;
+FHoudiniApi::SetParmStringValueFuncPtr FHoudiniApiRecorderHooks::Original::SetParmStringValue = nullptr;
+FHoudiniApi::SetPartInfoFuncPtr FHoudiniApiRecorderHooks::Original::SetPartInfo = nullptr;
+FHoudiniApi::SetPresetFuncPtr FHoudiniApiRecorderHooks::Original::SetPreset = nullptr;
+FHoudiniApi::SetServerEnvIntFuncPtr FHoudiniApiRecorderHooks::Original::SetServerEnvInt = nullptr;
+FHoudiniApi::SetServerEnvStringFuncPtr FHoudiniApiRecorderHooks::Original::SetServerEnvString = nullptr;
+FHoudiniApi::SetSessionSyncFuncPtr FHoudiniApiRecorderHooks::Original::SetSessionSync = nullptr;
+FHoudiniApi::SetSessionSyncInfoFuncPtr FHoudiniApiRecorderHooks::Original::SetSessionSyncInfo = nullptr;
+FHoudiniApi::SetTimeFuncPtr FHoudiniApiRecorderHooks::Original::SetTime = nullptr;
+FHoudiniApi::SetTimelineOptionsFuncPtr FHoudiniApiRecorderHooks::Original::SetTimelineOptions = nullptr;
+FHoudiniApi::SetTransformAnimCurveFuncPtr FHoudiniApiRecorderHooks::Original::SetTransformAnimCurve = nullptr;
+FHoudiniApi::SetUseHoudiniTimeFuncPtr FHoudiniApiRecorderHooks::Original::SetUseHoudiniTime = nullptr;
+FHoudiniApi::SetVertexListFuncPtr FHoudiniApiRecorderHooks::Original::SetVertexList = nullptr;
+FHoudiniApi::SetViewportFuncPtr FHoudiniApiRecorderHooks::Original::SetViewport = nullptr;
+FHoudiniApi::SetVolumeInfoFuncPtr FHoudiniApiRecorderHooks::Original::SetVolumeInfo = nullptr;
+FHoudiniApi::SetVolumeTileFloatDataFuncPtr FHoudiniApiRecorderHooks::Original::SetVolumeTileFloatData = nullptr;
+FHoudiniApi::SetVolumeTileIntDataFuncPtr FHoudiniApiRecorderHooks::Original::SetVolumeTileIntData = nullptr;
+FHoudiniApi::SetVolumeVoxelFloatDataFuncPtr FHoudiniApiRecorderHooks::Original::SetVolumeVoxelFloatData = nullptr;
+FHoudiniApi::SetVolumeVoxelIntDataFuncPtr FHoudiniApiRecorderHooks::Original::SetVolumeVoxelIntData = nullptr;
+FHoudiniApi::SetWorkitemFloatDataFuncPtr FHoudiniApiRecorderHooks::Original::SetWorkitemFloatData = nullptr;
+FHoudiniApi::SetWorkitemIntDataFuncPtr FHoudiniApiRecorderHooks::Original::SetWorkitemIntData = nullptr;
+FHoudiniApi::SetWorkitemStringDataFuncPtr FHoudiniApiRecorderHooks::Original::SetWorkitemStringData = nullptr;
+FHoudiniApi::StartThriftNamedPipeServerFuncPtr FHoudiniApiRecorderHooks::Original::StartThriftNamedPipeServer = nullptr;
+FHoudiniApi::StartThriftSocketServerFuncPtr FHoudiniApiRecorderHooks::Original::StartThriftSocketServer = nullptr;
+FHoudiniApi::ThriftServerOptions_CreateFuncPtr FHoudiniApiRecorderHooks::Original::ThriftServerOptions_Create = nullptr;
+FHoudiniApi::ThriftServerOptions_InitFuncPtr FHoudiniApiRecorderHooks::Original::ThriftServerOptions_Init = nullptr;
+FHoudiniApi::TimelineOptions_CreateFuncPtr FHoudiniApiRecorderHooks::Original::TimelineOptions_Create = nullptr;
+FHoudiniApi::TimelineOptions_InitFuncPtr FHoudiniApiRecorderHooks::Original::TimelineOptions_Init = nullptr;
+FHoudiniApi::TransformEuler_CreateFuncPtr FHoudiniApiRecorderHooks::Original::TransformEuler_Create = nullptr;
+FHoudiniApi::TransformEuler_InitFuncPtr FHoudiniApiRecorderHooks::Original::TransformEuler_Init = nullptr;
+FHoudiniApi::Transform_CreateFuncPtr FHoudiniApiRecorderHooks::Original::Transform_Create = nullptr;
+FHoudiniApi::Transform_InitFuncPtr FHoudiniApiRecorderHooks::Original::Transform_Init = nullptr;
+FHoudiniApi::Viewport_CreateFuncPtr FHoudiniApiRecorderHooks::Original::Viewport_Create = nullptr;
+FHoudiniApi::VolumeInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::VolumeInfo_Create = nullptr;
+FHoudiniApi::VolumeInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::VolumeInfo_Init = nullptr;
+FHoudiniApi::VolumeTileInfo_CreateFuncPtr FHoudiniApiRecorderHooks::Original::VolumeTileInfo_Create = nullptr;
+FHoudiniApi::VolumeTileInfo_InitFuncPtr FHoudiniApiRecorderHooks::Original::VolumeTileInfo_Init = nullptr;
+
+void
+FHoudiniApiRecorderHooks::Install()
+{
+	Original::AddAttribute = FHoudiniApi::AddAttribute;
+	FHoudiniApi::AddAttribute = &FHoudiniApiRecorderHooks::AddAttribute;
+	Original::AddGroup = FHoudiniApi::AddGroup;
+	FHoudiniApi::AddGroup = &FHoudiniApiRecorderHooks::AddGroup;
+	Original::AssetInfo_Create = FHoudiniApi::AssetInfo_Create;
+	FHoudiniApi::AssetInfo_Create = &FHoudiniApiRecorderHooks::AssetInfo_Create;
+	Original::AssetInfo_Init = FHoudiniApi::AssetInfo_Init;
+	FHoudiniApi::AssetInfo_Init = &FHoudiniApiRecorderHooks::AssetInfo_Init;
+	Original::AttributeInfo_Create = FHoudiniApi::AttributeInfo_Create;
+	FHoudiniApi::AttributeInfo_Create = &FHoudiniApiRecorderHooks::AttributeInfo_Create;
+	Original::AttributeInfo_Init = FHoudiniApi::AttributeInfo_Init;
+	FHoudiniApi::AttributeInfo_Init = &FHoudiniApiRecorderHooks::AttributeInfo_Init;
+	Original::BindCustomImplementation = FHoudiniApi::BindCustomImplementation;
+	FHoudiniApi::BindCustomImplementation = &FHoudiniApiRecorderHooks::BindCustomImplementation;
+	Original::CancelPDGCook = FHoudiniApi::CancelPDGCook;
+	FHoudiniApi::CancelPDGCook = &FHoudiniApiRecorderHooks::CancelPDGCook;
+	Original::CheckForSpecificErrors = FHoudiniApi::CheckForSpecificErrors;
+	FHoudiniApi::CheckForSpecificErrors = &FHoudiniApiRecorderHooks::CheckForSpecificErrors;
+	Original::Cleanup = FHoudiniApi::Cleanup;
+	FHoudiniApi::Cleanup = &FHoudiniApiRecorderHooks::Cleanup;
+	Original::ClearConnectionError = FHoudiniApi::ClearConnectionError;
+	FHoudiniApi::ClearConnectionError = &FHoudiniApiRecorderHooks::ClearConnectionError;
+	Original::CloseSession = FHoudiniApi::CloseSession;
+	FHoudiniApi::CloseSession = &FHoudiniApiRecorderHooks::CloseSession;
+	Original::CommitGeo = FHoudiniApi::CommitGeo;
+	FHoudiniApi::CommitGeo = &FHoudiniApiRecorderHooks::CommitGeo;
+	Original::CommitWorkitems = FHoudiniApi::CommitWorkitems;
+	FHoudiniApi::CommitWorkitems = &FHoudiniApiRecorderHooks::CommitWorkitems;
+	Original::ComposeChildNodeList = FHoudiniApi::ComposeChildNodeList;
+	FHoudiniApi::ComposeChildNodeList = &FHoudiniApiRecorderHooks::ComposeChildNodeList;
+	Original::ComposeNodeCookResult = FHoudiniApi::ComposeNodeCookResult;
+	FHoudiniApi::ComposeNodeCookResult = &FHoudiniApiRecorderHooks::ComposeNodeCookResult;
+	Original::ComposeObjectList = FHoudiniApi::ComposeObjectList;
+	FHoudiniApi::ComposeObjectList = &FHoudiniApiRecorderHooks::ComposeObjectList;
+	Original::ConnectNodeInput = FHoudiniApi::ConnectNodeInput;
+	FHoudiniApi::ConnectNodeInput = &FHoudiniApiRecorderHooks::ConnectNodeInput;
+	Original::ConvertMatrixToEuler = FHoudiniApi::ConvertMatrixToEuler;
+	FHoudiniApi::ConvertMatrixToEuler = &FHoudiniApiRecorderHooks::ConvertMatrixToEuler;
+	Original::ConvertMatrixToQuat = FHoudiniApi::ConvertMatrixToQuat;
+	FHoudiniApi::ConvertMatrixToQuat = &FHoudiniApiRecorderHooks::ConvertMatrixToQuat;
+	Original::ConvertTransform = FHoudiniApi::ConvertTransform;
+	FHoudiniApi::ConvertTransform = &FHoudiniApiRecorderHooks::ConvertTransform;
+	Original::ConvertTransformEulerToMatrix = FHoudiniApi::ConvertTransformEulerToMatrix;
+	FHoudiniApi::ConvertTransformEulerToMatrix = &FHoudiniApiRecorderHooks::ConvertTransformEulerToMatrix;
+	Original::ConvertTransformQuatToMatrix = FHoudiniApi::ConvertTransformQuatToMatrix;
+	FHoudiniApi::ConvertTransformQuatToMatrix = &FHoudiniApiRecorderHooks::ConvertTransformQuatToMatrix;
+	Original::CookNode = FHoudiniApi::CookNode;
+	FHoudiniApi::CookNode = &FHoudiniApiRecorderHooks::CookNode;
+	Original::CookOptions_AreEqual = FHoudiniApi::CookOptions_AreEqual;
+	FHoudiniApi::CookOptions_AreEqual = &FHoudiniApiRecorderHooks::CookOptions_AreEqual;
+	Original::CookOptions_Create = FHoudiniApi::CookOptions_Create;
+	FHoudiniApi::CookOptions_Create = &FHoudiniApiRecorderHooks::CookOptions_Create;
+	Original::CookOptions_Init = FHoudiniApi::CookOptions_Init;
+	FHoudiniApi::CookOptions_Init = &FHoudiniApiRecorderHooks::CookOptions_Init;
+	Original::CookPDG = FHoudiniApi::CookPDG;
+	FHoudiniApi::CookPDG = &FHoudiniApiRecorderHooks::CookPDG;
+	Original::CreateCustomSession = FHoudiniApi::CreateCustomSession;
+	FHoudiniApi::CreateCustomSession = &FHoudiniApiRecorderHooks::CreateCustomSession;
+	Original::CreateHeightFieldInput = FHoudiniApi::CreateHeightFieldInput;
+	FHoudiniApi::CreateHeightFieldInput = &FHoudiniApiRecorderHooks::CreateHeightFieldInput;
+	Original::CreateHeightfieldInputVolumeNode = FHoudiniApi::CreateHeightfieldInputVolumeNode;
+	FHoudiniApi::CreateHeightfieldInputVolumeNode = &FHoudiniApiRecorderHooks::CreateHeightfieldInputVolumeNode;
+	Original::CreateInProcessSession = FHoudiniApi::CreateInProcessSession;
+	FHoudiniApi::CreateInProcessSession = &FHoudiniApiRecorderHooks::CreateInProcessSession;
+	Original::CreateInputNode = FHoudiniApi::CreateInputNode;
+	FHoudiniApi::CreateInputNode = &FHoudiniApiRecorderHooks::CreateInputNode;
+	Original::CreateNode = FHoudiniApi::CreateNode;
+	FHoudiniApi::CreateNode = &FHoudiniApiRecorderHooks::CreateNode;
+	Original::CreateThriftNamedPipeSession = FHoudiniApi::CreateThriftNamedPipeSession;
+	FHoudiniApi::CreateThriftNamedPipeSession = &FHoudiniApiRecorderHooks::CreateThriftNamedPipeSession;
+	Original::CreateThriftSocketSession = FHoudiniApi::CreateThriftSocketSession;
+	FHoudiniApi::CreateThriftSocketSession = &FHoudiniApiRecorderHooks::CreateThriftSocketSession;
+	Original::CreateWorkitem = FHoudiniApi::CreateWorkitem;
+	FHoudiniApi::CreateWorkitem = &FHoudiniApiRecorderHooks::CreateWorkitem;
+	Original::CurveInfo_Create = FHoudiniApi::CurveInfo_Create;
+	FHoudiniApi::CurveInfo_Create = &FHoudiniApiRecorderHooks::CurveInfo_Create;
+	Original::CurveInfo_Init = FHoudiniApi::CurveInfo_Init;
+	FHoudiniApi::CurveInfo_Init = &FHoudiniApiRecorderHooks::CurveInfo_Init;
+	Original::DeleteAttribute = FHoudiniApi::DeleteAttribute;
+	FHoudiniApi::DeleteAttribute = &FHoudiniApiRecorderHooks::DeleteAttribute;
+	Original::DeleteGroup = FHoudiniApi::DeleteGroup;
+	FHoudiniApi::DeleteGroup = &FHoudiniApiRecorderHooks::DeleteGroup;
+	Original::DeleteNode = FHoudiniApi::DeleteNode;
+	FHoudiniApi::DeleteNode = &FHoudiniApiRecorderHooks::DeleteNode;
+	Original::DirtyPDGNode = FHoudiniApi::DirtyPDGNode;
+	FHoudiniApi::DirtyPDGNode = &FHoudiniApiRecorderHooks::DirtyPDGNode;
+	Original::DisconnectNodeInput = FHoudiniApi::DisconnectNodeInput;
+	FHoudiniApi::DisconnectNodeInput = &FHoudiniApiRecorderHooks::DisconnectNodeInput;
+	Original::DisconnectNodeOutputsAt = FHoudiniApi::DisconnectNodeOutputsAt;
+	FHoudiniApi::DisconnectNodeOutputsAt = &FHoudiniApiRecorderHooks::DisconnectNodeOutputsAt;
+	Original::ExtractImageToFile = FHoudiniApi::ExtractImageToFile;
+	FHoudiniApi::ExtractImageToFile = &FHoudiniApiRecorderHooks::ExtractImageToFile;
+	Original::ExtractImageToMemory = FHoudiniApi::ExtractImageToMemory;
+	FHoudiniApi::ExtractImageToMemory = &FHoudiniApiRecorderHooks::ExtractImageToMemory;
+	Original::GeoInfo_Create = FHoudiniApi::GeoInfo_Create;
+	FHoudiniApi::GeoInfo_Create = &FHoudiniApiRecorderHooks::GeoInfo_Create;
+	Original::GeoInfo_GetGroupCountByType = FHoudiniApi::GeoInfo_GetGroupCountByType;
+	FHoudiniApi::GeoInfo_GetGroupCountByType = &FHoudiniApiRecorderHooks::GeoInfo_GetGroupCountByType;
+	Original::GeoInfo_Init = FHoudiniApi::GeoInfo_Init;
+	FHoudiniApi::GeoInfo_Init = &FHoudiniApiRecorderHooks::GeoInfo_Init;
+	Original::GetActiveCacheCount = FHoudiniApi::GetActiveCacheCount;
+	FHoudiniApi::GetActiveCacheCount = &FHoudiniApiRecorderHooks::GetActiveCacheCount;
+	Original::GetActiveCacheNames = FHoudiniApi::GetActiveCacheNames;
+	FHoudiniApi::GetActiveCacheNames = &FHoudiniApiRecorderHooks::GetActiveCacheNames;
+	Original::GetAssetDefinitionParmCounts = FHoudiniApi::GetAssetDefinitionParmCounts;
+	FHoudiniApi::GetAssetDefinitionParmCounts = &FHoudiniApiRecorderHooks::GetAssetDefinitionParmCounts;
+	Original::GetAssetDefinitionParmInfos = FHoudiniApi::GetAssetDefinitionParmInfos;
+	FHoudiniApi::GetAssetDefinitionParmInfos = &FHoudiniApiRecorderHooks::GetAssetDefinitionParmInfos;
+	Original::GetAssetDefinitionParmValues = FHoudiniApi::GetAssetDefinitionParmValues;
+	FHoudiniApi::GetAssetDefinitionParmValues = &FHoudiniApiRecorderHooks::GetAssetDefinitionParmValues;
+	Original::GetAssetInfo = FHoudiniApi::GetAssetInfo;
+	FHoudiniApi::GetAssetInfo = &FHoudiniApiRecorderHooks::GetAssetInfo;
+	Original::GetAttributeFloat64ArrayData = FHoudiniApi::GetAttributeFloat64ArrayData;
+	FHoudiniApi::GetAttributeFloat64ArrayData = &FHoudiniApiRecorderHooks::GetAttributeFloat64ArrayData;
+	Original::GetAttributeFloat64Data = FHoudiniApi::GetAttributeFloat64Data;
+	FHoudiniApi::GetAttributeFloat64Data = &FHoudiniApiRecorderHooks::GetAttributeFloat64Data;
+	Original::GetAttributeFloatArrayData = FHoudiniApi::GetAttributeFloatArrayData;
+	FHoudiniApi::GetAttributeFloatArrayData = &FHoudiniApiRecorderHooks::GetAttributeFloatArrayData;
+	Original::GetAttributeFloatData = FHoudiniApi::GetAttributeFloatData;
+	FHoudiniApi::GetAttributeFloatData = &FHoudiniApiRecorderHooks::GetAttributeFloatData;
+	Original::GetAttributeInfo = FHoudiniApi::GetAttributeInfo;
+	FHoudiniApi::GetAttributeInfo = &FHoudiniApiRecorderHooks::GetAttributeInfo;
+	Original::GetAttributeInt16ArrayData = FHoudiniApi::GetAttributeInt16ArrayData;
+	FHoudiniApi::GetAttributeInt16ArrayData = &FHoudiniApiRecorderHooks::GetAttributeInt16ArrayData;
+	Original::GetAttributeInt16Data = FHoudiniApi::GetAttributeInt16Data;
+	FHoudiniApi::GetAttributeInt16Data = &FHoudiniApiRecorderHooks::GetAttributeInt16Data;
+	Original::GetAttributeInt64ArrayData = FHoudiniApi::GetAttributeInt64ArrayData;
+	FHoudiniApi::GetAttributeInt64ArrayData = &FHoudiniApiRecorderHooks::GetAttributeInt64ArrayData;
+	Original::GetAttributeInt64Data = FHoudiniApi::GetAttributeInt64Data;
+	FHoudiniApi::GetAttributeInt64Data = &FHoudiniApiRecorderHooks::GetAttributeInt64Data;
+	Original::GetAttributeInt8ArrayData = FHoudiniApi::GetAttributeInt8ArrayData;
+	FHoudiniApi::GetAttributeInt8ArrayData = &FHoudiniApiRecorderHooks::GetAttributeInt8ArrayData;
+	Original::GetAttributeInt8Data = FHoudiniApi::GetAttributeInt8Data;
+	FHoudiniApi::GetAttributeInt8Data = &FHoudiniApiRecorderHooks::GetAttributeInt8Data;
+	Original::GetAttributeIntArrayData = FHoudiniApi::GetAttributeIntArrayData;
+	FHoudiniApi::GetAttributeIntArrayData = &FHoudiniApiRecorderHooks::GetAttributeIntArrayData;
+	Original::GetAttributeIntData = FHoudiniApi::GetAttributeIntData;
+	FHoudiniApi::GetAttributeIntData = &FHoudiniApiRecorderHooks::GetAttributeIntData;
+	Original::GetAttributeNames = FHoudiniApi::GetAttributeNames;
+	FHoudiniApi::GetAttributeNames = &FHoudiniApiRecorderHooks::GetAttributeNames;
+	Original::GetAttributeStringArrayData = FHoudiniApi::GetAttributeStringArrayData;
+	FHoudiniApi::GetAttributeStringArrayData = &FHoudiniApiRecorderHooks::GetAttributeStringArrayData;
+	Original::GetAttributeStringData = FHoudiniApi::GetAttributeStringData;
+	FHoudiniApi::GetAttributeStringData = &FHoudiniApiRecorderHooks::GetAttributeStringData;
+	Original::GetAttributeUInt8ArrayData = FHoudiniApi::GetAttributeUInt8ArrayData;
+	FHoudiniApi::GetAttributeUInt8ArrayData = &FHoudiniApiRecorderHooks::GetAttributeUInt8ArrayData;
+	Original::GetAttributeUInt8Data = FHoudiniApi::GetAttributeUInt8Data;
+	FHoudiniApi::GetAttributeUInt8Data = &FHoudiniApiRecorderHooks::GetAttributeUInt8Data;
+	Original::GetAvailableAssetCount = FHoudiniApi::GetAvailableAssetCount;
+	FHoudiniApi::GetAvailableAssetCount = &FHoudiniApiRecorderHooks::GetAvailableAssetCount;
+	Original::GetAvailableAssets = FHoudiniApi::GetAvailableAssets;
+	FHoudiniApi::GetAvailableAssets = &FHoudiniApiRecorderHooks::GetAvailableAssets;
+	Original::GetBoxInfo = FHoudiniApi::GetBoxInfo;
+	FHoudiniApi::GetBoxInfo = &FHoudiniApiRecorderHooks::GetBoxInfo;
+	Original::GetCacheProperty = FHoudiniApi::GetCacheProperty;
+	FHoudiniApi::GetCacheProperty = &FHoudiniApiRecorderHooks::GetCacheProperty;
+	Original::GetComposedChildNodeList = FHoudiniApi::GetComposedChildNodeList;
+	FHoudiniApi::GetComposedChildNodeList = &FHoudiniApiRecorderHooks::GetComposedChildNodeList;
+	Original::GetComposedNodeCookResult = FHoudiniApi::GetComposedNodeCookResult;
+	FHoudiniApi::GetComposedNodeCookResult = &FHoudiniApiRecorderHooks::GetComposedNodeCookResult;
+	Original::GetComposedObjectList = FHoudiniApi::GetComposedObjectList;
+	FHoudiniApi::GetComposedObjectList = &FHoudiniApiRecorderHooks::GetComposedObjectList;
+	Original::GetComposedObjectTransforms = FHoudiniApi::GetComposedObjectTransforms;
+	FHoudiniApi::GetComposedObjectTransforms = &FHoudiniApiRecorderHooks::GetComposedObjectTransforms;
+	Original::GetConnectionError = FHoudiniApi::GetConnectionError;
+	FHoudiniApi::GetConnectionError = &FHoudiniApiRecorderHooks::GetConnectionError;
+	Original::GetConnectionErrorLength = FHoudiniApi::GetConnectionErrorLength;
+	FHoudiniApi::GetConnectionErrorLength = &FHoudiniApiRecorderHooks::GetConnectionErrorLength;
+	Original::GetCookingCurrentCount = FHoudiniApi::GetCookingCurrentCount;
+	FHoudiniApi::GetCookingCurrentCount = &FHoudiniApiRecorderHooks::GetCookingCurrentCount;
+	Original::GetCookingTotalCount = FHoudiniApi::GetCookingTotalCount;
+	FHoudiniApi::GetCookingTotalCount = &FHoudiniApiRecorderHooks::GetCookingTotalCount;
+	Original::GetCurveCounts = FHoudiniApi::GetCurveCounts;
+	FHoudiniApi::GetCurveCounts = &FHoudiniApiRecorderHooks::GetCurveCounts;
+	Original::GetCurveInfo = FHoudiniApi::GetCurveInfo;
+	FHoudiniApi::GetCurveInfo = &FHoudiniApiRecorderHooks::GetCurveInfo;
+	Original::GetCurveKnots = FHoudiniApi::GetCurveKnots;
+	FHoudiniApi::GetCurveKnots = &FHoudiniApiRecorderHooks::GetCurveKnots;
+	Original::GetCurveOrders = FHoudiniApi::GetCurveOrders;
+	FHoudiniApi::GetCurveOrders = &FHoudiniApiRecorderHooks::GetCurveOrders;
+	Original::GetDisplayGeoInfo = FHoudiniApi::GetDisplayGeoInfo;
+	FHoudiniApi::GetDisplayGeoInfo = &FHoudiniApiRecorderHooks::GetDisplayGeoInfo;
+	Original::GetEnvInt = FHoudiniApi::GetEnvInt;
+	FHoudiniApi::GetEnvInt = &FHoudiniApiRecorderHooks::GetEnvInt;
+	Original::GetFaceCounts = FHoudiniApi::GetFaceCounts;
+	FHoudiniApi::GetFaceCounts = &FHoudiniApiRecorderHooks::GetFaceCounts;
+	Original::GetFirstVolumeTile = FHoudiniApi::GetFirstVolumeTile;
+	FHoudiniApi::GetFirstVolumeTile = &FHoudiniApiRecorderHooks::GetFirstVolumeTile;
+	Original::GetGeoInfo = FHoudiniApi::GetGeoInfo;
+	FHoudiniApi::GetGeoInfo = &FHoudiniApiRecorderHooks::GetGeoInfo;
+	Original::GetGeoSize = FHoudiniApi::GetGeoSize;
+	FHoudiniApi::GetGeoSize = &FHoudiniApiRecorderHooks::GetGeoSize;
+	Original::GetGroupCountOnPackedInstancePart = FHoudiniApi::GetGroupCountOnPackedInstancePart;
+	FHoudiniApi::GetGroupCountOnPackedInstancePart = &FHoudiniApiRecorderHooks::GetGroupCountOnPackedInstancePart;
+	Original::GetGroupMembership = FHoudiniApi::GetGroupMembership;
+	FHoudiniApi::GetGroupMembership = &FHoudiniApiRecorderHooks::GetGroupMembership;
+	Original::GetGroupMembershipOnPackedInstancePart = FHoudiniApi::GetGroupMembershipOnPackedInstancePart;
+	FHoudiniApi::GetGroupMembershipOnPackedInstancePart = &FHoudiniApiRecorderHooks::GetGroupMembershipOnPackedInstancePart;
+	Original::GetGroupNames = FHoudiniApi::GetGroupNames;
+	FHoudiniApi::GetGroupNames = &FHoudiniApiRecorderHooks::GetGroupNames;
+	Original::GetGroupNamesOnPackedInstancePart = FHoudiniApi::GetGroupNamesOnPackedInstancePart;
+	FHoudiniApi::GetGroupNamesOnPackedInstancePart = &FHoudiniApiRecorderHooks::GetGroupNamesOnPackedInstancePart;
+	Original::GetHIPFileNodeCount = FHoudiniApi::GetHIPFileNodeCount;
+	FHoudiniApi::GetHIPFileNodeCount = &FHoudiniApiRecorderHooks::GetHIPFileNodeCount;
+	Original::GetHIPFileNodeIds = FHoudiniApi::GetHIPFileNodeIds;
+	FHoudiniApi::GetHIPFileNodeIds = &FHoudiniApiRecorderHooks::GetHIPFileNodeIds;
+	Original::GetHandleBindingInfo = FHoudiniApi::GetHandleBindingInfo;
+	FHoudiniApi::GetHandleBindingInfo = &FHoudiniApiRecorderHooks::GetHandleBindingInfo;
+	Original::GetHandleInfo = FHoudiniApi::GetHandleInfo;
+	FHoudiniApi::GetHandleInfo = &FHoudiniApiRecorderHooks::GetHandleInfo;
+	Original::GetHeightFieldData = FHoudiniApi::GetHeightFieldData;
+	FHoudiniApi::GetHeightFieldData = &FHoudiniApiRecorderHooks::GetHeightFieldData;
+	Original::GetImageFilePath = FHoudiniApi::GetImageFilePath;
+	FHoudiniApi::GetImageFilePath = &FHoudiniApiRecorderHooks::GetImageFilePath;
+	Original::GetImageInfo = FHoudiniApi::GetImageInfo;
+	FHoudiniApi::GetImageInfo = &FHoudiniApiRecorderHooks::GetImageInfo;
+	Original::GetImageMemoryBuffer = FHoudiniApi::GetImageMemoryBuffer;
+	FHoudiniApi::GetImageMemoryBuffer = &FHoudiniApiRecorderHooks::GetImageMemoryBuffer;
+	Original::GetImagePlaneCount = FHoudiniApi::GetImagePlaneCount;
+	FHoudiniApi::GetImagePlaneCount = &FHoudiniApiRecorderHooks::GetImagePlaneCount;
+	Original::GetImagePlanes = FHoudiniApi::GetImagePlanes;
+	FHoudiniApi::GetImagePlanes = &FHoudiniApiRecorderHooks::GetImagePlanes;
+	Original::GetInstanceTransformsOnPart = FHoudiniApi::GetInstanceTransformsOnPart;
+	FHoudiniApi::GetInstanceTransformsOnPart = &FHoudiniApiRecorderHooks::GetInstanceTransformsOnPart;
+	Original::GetInstancedObjectIds = FHoudiniApi::GetInstancedObjectIds;
+	FHoudiniApi::GetInstancedObjectIds = &FHoudiniApiRecorderHooks::GetInstancedObjectIds;
+	Original::GetInstancedPartIds = FHoudiniApi::GetInstancedPartIds;
+	FHoudiniApi::GetInstancedPartIds = &FHoudiniApiRecorderHooks::GetInstancedPartIds;
+	Original::GetInstancerPartTransforms = FHoudiniApi::GetInstancerPartTransforms;
+	FHoudiniApi::GetInstancerPartTransforms = &FHoudiniApiRecorderHooks::GetInstancerPartTransforms;
+	Original::GetManagerNodeId = FHoudiniApi::GetManagerNodeId;
+	FHoudiniApi::GetManagerNodeId = &FHoudiniApiRecorderHooks::GetManagerNodeId;
+	Original::GetMaterialInfo = FHoudiniApi::GetMaterialInfo;
+	FHoudiniApi::GetMaterialInfo = &FHoudiniApiRecorderHooks::GetMaterialInfo;
+	Original::GetMaterialNodeIdsOnFaces = FHoudiniApi::GetMaterialNodeIdsOnFaces;
+	FHoudiniApi::GetMaterialNodeIdsOnFaces = &FHoudiniApiRecorderHooks::GetMaterialNodeIdsOnFaces;
+	Original::GetNextVolumeTile = FHoudiniApi::GetNextVolumeTile;
+	FHoudiniApi::GetNextVolumeTile = &FHoudiniApiRecorderHooks::GetNextVolumeTile;
+	Original::GetNodeInfo = FHoudiniApi::GetNodeInfo;
+	FHoudiniApi::GetNodeInfo = &FHoudiniApiRecorderHooks::GetNodeInfo;
+	Original::GetNodeInputName = FHoudiniApi::GetNodeInputName;
+	FHoudiniApi::GetNodeInputName = &FHoudiniApiRecorderHooks::GetNodeInputName;
+	Original::GetNodeOutputName = FHoudiniApi::GetNodeOutputName;
+	FHoudiniApi::GetNodeOutputName = &FHoudiniApiRecorderHooks::GetNodeOutputName;
+	Original::GetNodePath = FHoudiniApi::GetNodePath;
+	FHoudiniApi::GetNodePath = &FHoudiniApiRecorderHooks::GetNodePath;
+	Original::GetNumWorkitems = FHoudiniApi::GetNumWorkitems;
+	FHoudiniApi::GetNumWorkitems = &FHoudiniApiRecorderHooks::GetNumWorkitems;
+	Original::GetObjectInfo = FHoudiniApi::GetObjectInfo;
+	FHoudiniApi::GetObjectInfo = &FHoudiniApiRecorderHooks::GetObjectInfo;
+	Original::GetObjectTransform = FHoudiniApi::GetObjectTransform;
+	FHoudiniApi::GetObjectTransform = &FHoudiniApiRecorderHooks::GetObjectTransform;
+	Original::GetOutputNodeId = FHoudiniApi::GetOutputNodeId;
+	FHoudiniApi::GetOutputNodeId = &FHoudiniApiRecorderHooks::GetOutputNodeId;
+	Original::GetPDGEvents = FHoudiniApi::GetPDGEvents;
+	FHoudiniApi::GetPDGEvents = &FHoudiniApiRecorderHooks::GetPDGEvents;
+	Original::GetPDGGraphContextId = FHoudiniApi::GetPDGGraphContextId;
+	FHoudiniApi::GetPDGGraphContextId = &FHoudiniApiRecorderHooks::GetPDGGraphContextId;
+	Original::GetPDGGraphContexts = FHoudiniApi::GetPDGGraphContexts;
+	FHoudiniApi::GetPDGGraphContexts = &FHoudiniApiRecorderHooks::GetPDGGraphContexts;
+	Original::GetPDGState = FHoudiniApi::GetPDGState;
+	FHoudiniApi::GetPDGState = &FHoudiniApiRecorderHooks::GetPDGState;
+	Original::GetParameters = FHoudiniApi::GetParameters;
+	FHoudiniApi::GetParameters = &FHoudiniApiRecorderHooks::GetParameters;
+	Original::GetParmChoiceLists = FHoudiniApi::GetParmChoiceLists;
+	FHoudiniApi::GetParmChoiceLists = &FHoudiniApiRecorderHooks::GetParmChoiceLists;
+	Original::GetParmExpression = FHoudiniApi::GetParmExpression;
+	FHoudiniApi::GetParmExpression = &FHoudiniApiRecorderHooks::GetParmExpression;
+	Original::GetParmFile = FHoudiniApi::GetParmFile;
+	FHoudiniApi::GetParmFile = &FHoudiniApiRecorderHooks::GetParmFile;
+	Original::GetParmFloatValue = FHoudiniApi::GetParmFloatValue;
+	FHoudiniApi::GetParmFloatValue = &FHoudiniApiRecorderHooks::GetParmFloatValue;
+	Original::GetParmFloatValues = FHoudiniApi::GetParmFloatValues;
+	FHoudiniApi::GetParmFloatValues = &FHoudiniApiRecorderHooks::GetParmFloatValues;
+	Original::GetParmIdFromName = FHoudiniApi::GetParmIdFromName;
+	FHoudiniApi::GetParmIdFromName = &FHoudiniApiRecorderHooks::GetParmIdFromName;
+	Original::GetParmInfo = FHoudiniApi::GetParmInfo;
+	FHoudiniApi::GetParmInfo = &FHoudiniApiRecorderHooks::GetParmInfo;
+	Original::GetParmInfoFromName = FHoudiniApi::GetParmInfoFromName;
+	FHoudiniApi::GetParmInfoFromName = &FHoudiniApiRecorderHooks::GetParmInfoFromName;
+	Original::GetParmIntValue = FHoudiniApi::GetParmIntValue;
+	FHoudiniApi::GetParmIntValue = &FHoudiniApiRecorderHooks::GetParmIntValue;
+	Original::GetParmIntValues = FHoudiniApi::GetParmIntValues;
+	FHoudiniApi::GetParmIntValues = &FHoudiniApiRecorderHooks::GetParmIntValues;
+	Original::GetParmNodeValue = FHoudiniApi::GetParmNodeValue;
+	FHoudiniApi::GetParmNodeValue = &FHoudiniApiRecorderHooks::GetParmNodeValue;
+	Original::GetParmStringValue = FHoudiniApi::GetParmStringValue;
+	FHoudiniApi::GetParmStringValue = &FHoudiniApiRecorderHooks::GetParmStringValue;
+	Original::GetParmStringValues = FHoudiniApi::GetParmStringValues;
+	FHoudiniApi::GetParmStringValues = &FHoudiniApiRecorderHooks::GetParmStringValues;
+	Original::GetParmTagName = FHoudiniApi::GetParmTagName;
+	FHoudiniApi::GetParmTagName = &FHoudiniApiRecorderHooks::GetParmTagName;
+	Original::GetParmTagValue = FHoudiniApi::GetParmTagValue;
+	FHoudiniApi::GetParmTagValue = &FHoudiniApiRecorderHooks::GetParmTagValue;
+	Original::GetParmWithTag = FHoudiniApi::GetParmWithTag;
+	FHoudiniApi::GetParmWithTag = &FHoudiniApiRecorderHooks::GetParmWithTag;
+	Original::GetPartInfo = FHoudiniApi::GetPartInfo;
+	FHoudiniApi::GetPartInfo = &FHoudiniApiRecorderHooks::GetPartInfo;
+	Original::GetPreset = FHoudiniApi::GetPreset;
+	FHoudiniApi::GetPreset = &FHoudiniApiRecorderHooks::GetPreset;
+	Original::GetPresetBufLength = FHoudiniApi::GetPresetBufLength;
+	FHoudiniApi::GetPresetBufLength = &FHoudiniApiRecorderHooks::GetPresetBufLength;
+	Original::GetServerEnvInt = FHoudiniApi::GetServerEnvInt;
+	FHoudiniApi::GetServerEnvInt = &FHoudiniApiRecorderHooks::GetServerEnvInt;
+	Original::GetServerEnvString = FHoudiniApi::GetServerEnvString;
+	FHoudiniApi::GetServerEnvString = &FHoudiniApiRecorderHooks::GetServerEnvString;
+	Original::GetServerEnvVarCount = FHoudiniApi::GetServerEnvVarCount;
+	FHoudiniApi::GetServerEnvVarCount = &FHoudiniApiRecorderHooks::GetServerEnvVarCount;
+	Original::GetServerEnvVarList = FHoudiniApi::GetServerEnvVarList;
+	FHoudiniApi::GetServerEnvVarList = &FHoudiniApiRecorderHooks::GetServerEnvVarList;
+	Original::GetSessionEnvInt = FHoudiniApi::GetSessionEnvInt;
+	FHoudiniApi::GetSessionEnvInt = &FHoudiniApiRecorderHooks::GetSessionEnvInt;
+	Original::GetSessionSyncInfo = FHoudiniApi::GetSessionSyncInfo;
+	FHoudiniApi::GetSessionSyncInfo = &FHoudiniApiRecorderHooks::GetSessionSyncInfo;
+	Original::GetSphereInfo = FHoudiniApi::GetSphereInfo;
+	FHoudiniApi::GetSphereInfo = &FHoudiniApiRecorderHooks::GetSphereInfo;
+	Original::GetStatus = FHoudiniApi::GetStatus;
+	FHoudiniApi::GetStatus = &FHoudiniApiRecorderHooks::GetStatus;
+	Original::GetStatusString = FHoudiniApi::GetStatusString;
+	FHoudiniApi::GetStatusString = &FHoudiniApiRecorderHooks::GetStatusString;
+	Original::GetStatusStringBufLength = FHoudiniApi::GetStatusStringBufLength;
+	FHoudiniApi::GetStatusStringBufLength = &FHoudiniApiRecorderHooks::GetStatusStringBufLength;
+	Original::GetString = FHoudiniApi::GetString;
+	FHoudiniApi::GetString = &FHoudiniApiRecorderHooks::GetString;
+	Original::GetStringBatch = FHoudiniApi::GetStringBatch;
+	FHoudiniApi::GetStringBatch = &FHoudiniApiRecorderHooks::GetStringBatch;
+	Original::GetStringBatchSize = FHoudiniApi::GetStringBatchSize;
+	FHoudiniApi::GetStringBatchSize = &FHoudiniApiRecorderHooks::GetStringBatchSize;
+	Original::GetStringBufLength = FHoudiniApi::GetStringBufLength;
+	FHoudiniApi::GetStringBufLength = &FHoudiniApiRecorderHooks::GetStringBufLength;
+	Original::GetSupportedImageFileFormatCount = FHoudiniApi::GetSupportedImageFileFormatCount;
+	FHoudiniApi::GetSupportedImageFileFormatCount = &FHoudiniApiRecorderHooks::GetSupportedImageFileFormatCount;
+	Original::GetSupportedImageFileFormats = FHoudiniApi::GetSupportedImageFileFormats;
+	FHoudiniApi::GetSupportedImageFileFormats = &FHoudiniApiRecorderHooks::GetSupportedImageFileFormats;
+	Original::GetTime = FHoudiniApi::GetTime;
+	FHoudiniApi::GetTime = &FHoudiniApiRecorderHooks::GetTime;
+	Original::GetTimelineOptions = FHoudiniApi::GetTimelineOptions;
+	FHoudiniApi::GetTimelineOptions = &FHoudiniApiRecorderHooks::GetTimelineOptions;
+	Original::GetTotalCookCount = FHoudiniApi::GetTotalCookCount;
+	FHoudiniApi::GetTotalCookCount = &FHoudiniApiRecorderHooks::GetTotalCookCount;
+	Original::GetUseHoudiniTime = FHoudiniApi::GetUseHoudiniTime;
+	FHoudiniApi::GetUseHoudiniTime = &FHoudiniApiRecorderHooks::GetUseHoudiniTime;
+	Original::GetVertexList = FHoudiniApi::GetVertexList;
+	FHoudiniApi::GetVertexList = &FHoudiniApiRecorderHooks::GetVertexList;
+	Original::GetViewport = FHoudiniApi::GetViewport;
+	FHoudiniApi::GetViewport = &FHoudiniApiRecorderHooks::GetViewport;
+	Original::GetVolumeBounds = FHoudiniApi::GetVolumeBounds;
+	FHoudiniApi::GetVolumeBounds = &FHoudiniApiRecorderHooks::GetVolumeBounds;
+	Original::GetVolumeInfo = FHoudiniApi::GetVolumeInfo;
+	FHoudiniApi::GetVolumeInfo = &FHoudiniApiRecorderHooks::GetVolumeInfo;
+	Original::GetVolumeTileFloatData = FHoudiniApi::GetVolumeTileFloatData;
+	FHoudiniApi::GetVolumeTileFloatData = &FHoudiniApiRecorderHooks::GetVolumeTileFloatData;
+	Original::GetVolumeTileIntData = FHoudiniApi::GetVolumeTileIntData;
+	FHoudiniApi::GetVolumeTileIntData = &FHoudiniApiRecorderHooks::GetVolumeTileIntData;
+	Original::GetVolumeVisualInfo = FHoudiniApi::GetVolumeVisualInfo;
+	FHoudiniApi::GetVolumeVisualInfo = &FHoudiniApiRecorderHooks::GetVolumeVisualInfo;
+	Original::GetVolumeVoxelFloatData = FHoudiniApi::GetVolumeVoxelFloatData;
+	FHoudiniApi::GetVolumeVoxelFloatData = &FHoudiniApiRecorderHooks::GetVolumeVoxelFloatData;
+	Original::GetVolumeVoxelIntData = FHoudiniApi::GetVolumeVoxelIntData;
+	FHoudiniApi::GetVolumeVoxelIntData = &FHoudiniApiRecorderHooks::GetVolumeVoxelIntData;
+	Original::GetWorkitemDataLength = FHoudiniApi::GetWorkitemDataLength;
+	FHoudiniApi::GetWorkitemDataLength = &FHoudiniApiRecorderHooks::GetWorkitemDataLength;
+	Original::GetWorkitemFloatData = FHoudiniApi::GetWorkitemFloatData;
+	FHoudiniApi::GetWorkitemFloatData = &FHoudiniApiRecorderHooks::GetWorkitemFloatData;
+	Original::GetWorkitemInfo = FHoudiniApi::GetWorkitemInfo;
+	FHoudiniApi::GetWorkitemInfo = &FHoudiniApiRecorderHooks::GetWorkitemInfo;
+	Original::GetWorkitemIntData = FHoudiniApi::GetWorkitemIntData;
+	FHoudiniApi::GetWorkitemIntData = &FHoudiniApiRecorderHooks::GetWorkitemIntData;
+	Original::GetWorkitemResultInfo = FHoudiniApi::GetWorkitemResultInfo;
+	FHoudiniApi::GetWorkitemResultInfo = &FHoudiniApiRecorderHooks::GetWorkitemResultInfo;
+	Original::GetWorkitemStringData = FHoudiniApi::GetWorkitemStringData;
+	FHoudiniApi::GetWorkitemStringData = &FHoudiniApiRecorderHooks::GetWorkitemStringData;
+	Original::GetWorkitems = FHoudiniApi::GetWorkitems;
+	FHoudiniApi::GetWorkitems = &FHoudiniApiRecorderHooks::GetWorkitems;
+	Original::HandleBindingInfo_Create = FHoudiniApi::HandleBindingInfo_Create;
+	FHoudiniApi::HandleBindingInfo_Create = &FHoudiniApiRecorderHooks::HandleBindingInfo_Create;
+	Original::HandleBindingInfo_Init = FHoudiniApi::HandleBindingInfo_Init;
+	FHoudiniApi::HandleBindingInfo_Init = &FHoudiniApiRecorderHooks::HandleBindingInfo_Init;
+	Original::HandleInfo_Create = FHoudiniApi::HandleInfo_Create;
+	FHoudiniApi::HandleInfo_Create = &FHoudiniApiRecorderHooks::HandleInfo_Create;
+	Original::HandleInfo_Init = FHoudiniApi::HandleInfo_Init;
+	FHoudiniApi::HandleInfo_Init = &FHoudiniApiRecorderHooks::HandleInfo_Init;
+	Original::ImageFileFormat_Create = FHoudiniApi::ImageFileFormat_Create;
+	FHoudiniApi::ImageFileFormat_Create = &FHoudiniApiRecorderHooks::ImageFileFormat_Create;
+	Original::ImageFileFormat_Init = FHoudiniApi::ImageFileFormat_Init;
+	FHoudiniApi::ImageFileFormat_Init = &FHoudiniApiRecorderHooks::ImageFileFormat_Init;
+	Original::ImageInfo_Create = FHoudiniApi::ImageInfo_Create;
+	FHoudiniApi::ImageInfo_Create = &FHoudiniApiRecorderHooks::ImageInfo_Create;
+	Original::ImageInfo_Init = FHoudiniApi::ImageInfo_Init;
+	FHoudiniApi::ImageInfo_Init = &FHoudiniApiRecorderHooks::ImageInfo_Init;
+	Original::Initialize = FHoudiniApi::Initialize;
+	FHoudiniApi::Initialize = &FHoudiniApiRecorderHooks::Initialize;
+	Original::InsertMultiparmInstance = FHoudiniApi::InsertMultiparmInstance;
+	FHoudiniApi::InsertMultiparmInstance = &FHoudiniApiRecorderHooks::InsertMultiparmInstance;
+	Original::Interrupt = FHoudiniApi::Interrupt;
+	FHoudiniApi::Interrupt = &FHoudiniApiRecorderHooks::Interrupt;
+	Original::IsInitialized = FHoudiniApi::IsInitialized;
+	FHoudiniApi::IsInitialized = &FHoudiniApiRecorderHooks::IsInitialized;
+	Original::IsNodeValid = FHoudiniApi::IsNodeValid;
+	FHoudiniApi::IsNodeValid = &FHoudiniApiRecorderHooks::IsNodeValid;
+	Original::IsSessionValid = FHoudiniApi::IsSessionValid;
+	FHoudiniApi::IsSessionValid = &FHoudiniApiRecorderHooks::IsSessionValid;
+	Original::Keyframe_Create = FHoudiniApi::Keyframe_Create;
+	FHoudiniApi::Keyframe_Create = &FHoudiniApiRecorderHooks::Keyframe_Create;
+	Original::Keyframe_Init = FHoudiniApi::Keyframe_Init;
+	FHoudiniApi::Keyframe_Init = &FHoudiniApiRecorderHooks::Keyframe_Init;
+	Original::LoadAssetLibraryFromFile = FHoudiniApi::LoadAssetLibraryFromFile;
+	FHoudiniApi::LoadAssetLibraryFromFile = &FHoudiniApiRecorderHooks::LoadAssetLibraryFromFile;
+	Original::LoadAssetLibraryFromMemory = FHoudiniApi::LoadAssetLibraryFromMemory;
+	FHoudiniApi::LoadAssetLibraryFromMemory = &FHoudiniApiRecorderHooks::LoadAssetLibraryFromMemory;
+	Original::LoadGeoFromFile = FHoudiniApi::LoadGeoFromFile;
+	FHoudiniApi::LoadGeoFromFile = &FHoudiniApiRecorderHooks::LoadGeoFromFile;
+	Original::LoadGeoFromMemory = FHoudiniApi::LoadGeoFromMemory;
+	FHoudiniApi::LoadGeoFromMemory = &FHoudiniApiRecorderHooks::LoadGeoFromMemory;
+	Original::LoadHIPFile = FHoudiniApi::LoadHIPFile;
+	FHoudiniApi::LoadHIPFile = &FHoudiniApiRecorderHooks::LoadHIPFile;
+	Original::LoadNodeFromFile = FHoudiniApi::LoadNodeFromFile;
+	FHoudiniApi::LoadNodeFromFile = &FHoudiniApiRecorderHooks::LoadNodeFromFile;
+	Original::MaterialInfo_Create = FHoudiniApi::MaterialInfo_Create;
+	FHoudiniApi::MaterialInfo_Create = &FHoudiniApiRecorderHooks::MaterialInfo_Create;
+	Original::MaterialInfo_Init = FHoudiniApi::MaterialInfo_Init;
+	FHoudiniApi::MaterialInfo_Init = &FHoudiniApiRecorderHooks::MaterialInfo_Init;
+	Original::MergeHIPFile = FHoudiniApi::MergeHIPFile;
+	FHoudiniApi::MergeHIPFile = &FHoudiniApiRecorderHooks::MergeHIPFile;
+	Original::NodeInfo_Create = FHoudiniApi::NodeInfo_Create;
+	FHoudiniApi::NodeInfo_Create = &FHoudiniApiRecorderHooks::NodeInfo_Create;
+	Original::NodeInfo_Init = FHoudiniApi::NodeInfo_Init;
+	FHoudiniApi::NodeInfo_Init = &FHoudiniApiRecorderHooks::NodeInfo_Init;
+	Original::ObjectInfo_Create = FHoudiniApi::ObjectInfo_Create;
+	FHoudiniApi::ObjectInfo_Create = &FHoudiniApiRecorderHooks::ObjectInfo_Create;
+	Original::ObjectInfo_Init = FHoudiniApi::ObjectInfo_Init;
+	FHoudiniApi::ObjectInfo_Init = &FHoudiniApiRecorderHooks::ObjectInfo_Init;
+	Original::ParmChoiceInfo_Create = FHoudiniApi::ParmChoiceInfo_Create;
+	FHoudiniApi::ParmChoiceInfo_Create = &FHoudiniApiRecorderHooks::ParmChoiceInfo_Create;
+	Original::ParmChoiceInfo_Init = FHoudiniApi::ParmChoiceInfo_Init;
+	FHoudiniApi::ParmChoiceInfo_Init = &FHoudiniApiRecorderHooks::ParmChoiceInfo_Init;
+	Original::ParmHasExpression = FHoudiniApi::ParmHasExpression;
+	FHoudiniApi::ParmHasExpression = &FHoudiniApiRecorderHooks::ParmHasExpression;
+	Original::ParmHasTag = FHoudiniApi::ParmHasTag;
+	FHoudiniApi::ParmHasTag = &FHoudiniApiRecorderHooks::ParmHasTag;
+	Original::ParmInfo_Create = FHoudiniApi::ParmInfo_Create;
+	FHoudiniApi::ParmInfo_Create = &FHoudiniApiRecorderHooks::ParmInfo_Create;
+	Original::ParmInfo_GetFloatValueCount = FHoudiniApi::ParmInfo_GetFloatValueCount;
+	FHoudiniApi::ParmInfo_GetFloatValueCount = &FHoudiniApiRecorderHooks::ParmInfo_GetFloatValueCount;
+	Original::ParmInfo_GetIntValueCount = FHoudiniApi::ParmInfo_GetIntValueCount;
+	FHoudiniApi::ParmInfo_GetIntValueCount = &FHoudiniApiRecorderHooks::ParmInfo_GetIntValueCount;
+	Original::ParmInfo_GetStringValueCount = FHoudiniApi::ParmInfo_GetStringValueCount;
+	FHoudiniApi::ParmInfo_GetStringValueCount = &FHoudiniApiRecorderHooks::ParmInfo_GetStringValueCount;
+	Original::ParmInfo_Init = FHoudiniApi::ParmInfo_Init;
+	FHoudiniApi::ParmInfo_Init = &FHoudiniApiRecorderHooks::ParmInfo_Init;
+	Original::ParmInfo_IsFloat = FHoudiniApi::ParmInfo_IsFloat;
+	FHoudiniApi::ParmInfo_IsFloat = &FHoudiniApiRecorderHooks::ParmInfo_IsFloat;
+	Original::ParmInfo_IsInt = FHoudiniApi::ParmInfo_IsInt;
+	FHoudiniApi::ParmInfo_IsInt = &FHoudiniApiRecorderHooks::ParmInfo_IsInt;
+	Original::ParmInfo_IsNode = FHoudiniApi::ParmInfo_IsNode;
+	FHoudiniApi::ParmInfo_IsNode = &FHoudiniApiRecorderHooks::ParmInfo_IsNode;
+	Original::ParmInfo_IsNonValue = FHoudiniApi::ParmInfo_IsNonValue;
+	FHoudiniApi::ParmInfo_IsNonValue = &FHoudiniApiRecorderHooks::ParmInfo_IsNonValue;
+	Original::ParmInfo_IsPath = FHoudiniApi::ParmInfo_IsPath;
+	FHoudiniApi::ParmInfo_IsPath = &FHoudiniApiRecorderHooks::ParmInfo_IsPath;
+	Original::ParmInfo_IsString = FHoudiniApi::ParmInfo_IsString;
+	FHoudiniApi::ParmInfo_IsString = &FHoudiniApiRecorderHooks::ParmInfo_IsString;
+	Original::PartInfo_Create = FHoudiniApi::PartInfo_Create;
+	FHoudiniApi::PartInfo_Create = &FHoudiniApiRecorderHooks::PartInfo_Create;
+	Original::PartInfo_GetAttributeCountByOwner = FHoudiniApi::PartInfo_GetAttributeCountByOwner;
+	FHoudiniApi::PartInfo_GetAttributeCountByOwner = &FHoudiniApiRecorderHooks::PartInfo_GetAttributeCountByOwner;
+	Original::PartInfo_GetElementCountByAttributeOwner = FHoudiniApi::PartInfo_GetElementCountByAttributeOwner;
+	FHoudiniApi::PartInfo_GetElementCountByAttributeOwner = &FHoudiniApiRecorderHooks::PartInfo_GetElementCountByAttributeOwner;
+	Original::PartInfo_GetElementCountByGroupType = FHoudiniApi::PartInfo_GetElementCountByGroupType;
+	FHoudiniApi::PartInfo_GetElementCountByGroupType = &FHoudiniApiRecorderHooks::PartInfo_GetElementCountByGroupType;
+	Original::PartInfo_Init = FHoudiniApi::PartInfo_Init;
+	FHoudiniApi::PartInfo_Init = &FHoudiniApiRecorderHooks::PartInfo_Init;
+	Original::PausePDGCook = FHoudiniApi::PausePDGCook;
+	FHoudiniApi::PausePDGCook = &FHoudiniApiRecorderHooks::PausePDGCook;
+	Original::PythonThreadInterpreterLock = FHoudiniApi::PythonThreadInterpreterLock;
+	FHoudiniApi::PythonThreadInterpreterLock = &FHoudiniApiRecorderHooks::PythonThreadInterpreterLock;
+	Original::QueryNodeInput = FHoudiniApi::QueryNodeInput;
+	FHoudiniApi::QueryNodeInput = &FHoudiniApiRecorderHooks::QueryNodeInput;
+	Original::QueryNodeOutputConnectedCount = FHoudiniApi::QueryNodeOutputConnectedCount;
+	FHoudiniApi::QueryNodeOutputConnectedCount = &FHoudiniApiRecorderHooks::QueryNodeOutputConnectedCount;
+	Original::QueryNodeOutputConnectedNodes = FHoudiniApi::QueryNodeOutputConnectedNodes;
+	FHoudiniApi::QueryNodeOutputConnectedNodes = &FHoudiniApiRecorderHooks::QueryNodeOutputConnectedNodes;
+	Original::RemoveCustomString = FHoudiniApi::RemoveCustomString;
+	FHoudiniApi::RemoveCustomString = &FHoudiniApiRecorderHooks::RemoveCustomString;
+	Original::RemoveMultiparmInstance = FHoudiniApi::RemoveMultiparmInstance;
+	FHoudiniApi::RemoveMultiparmInstance = &FHoudiniApiRecorderHooks::RemoveMultiparmInstance;
+	Original::RemoveParmExpression = FHoudiniApi::RemoveParmExpression;
+	FHoudiniApi::RemoveParmExpression = &FHoudiniApiRecorderHooks::RemoveParmExpression;
+	Original::RenameNode = FHoudiniApi::RenameNode;
+	FHoudiniApi::RenameNode = &FHoudiniApiRecorderHooks::RenameNode;
+	Original::RenderCOPToImage = FHoudiniApi::RenderCOPToImage;
+	FHoudiniApi::RenderCOPToImage = &FHoudiniApiRecorderHooks::RenderCOPToImage;
+	Original::RenderTextureToImage = FHoudiniApi::RenderTextureToImage;
+	FHoudiniApi::RenderTextureToImage = &FHoudiniApiRecorderHooks::RenderTextureToImage;
+	Original::ResetSimulation = FHoudiniApi::ResetSimulation;
+	FHoudiniApi::ResetSimulation = &FHoudiniApiRecorderHooks::ResetSimulation;
+	Original::RevertGeo = FHoudiniApi::RevertGeo;
+	FHoudiniApi::RevertGeo = &FHoudiniApiRecorderHooks::RevertGeo;
+	Original::RevertParmToDefault = FHoudiniApi::RevertParmToDefault;
+	FHoudiniApi::RevertParmToDefault = &FHoudiniApiRecorderHooks::RevertParmToDefault;
+	Original::RevertParmToDefaults = FHoudiniApi::RevertParmToDefaults;
+	FHoudiniApi::RevertParmToDefaults = &FHoudiniApiRecorderHooks::RevertParmToDefaults;
+	Original::SaveGeoToFile = FHoudiniApi::SaveGeoToFile;
+	FHoudiniApi::SaveGeoToFile = &FHoudiniApiRecorderHooks::SaveGeoToFile;
+	Original::SaveGeoToMemory = FHoudiniApi::SaveGeoToMemory;
+	FHoudiniApi::SaveGeoToMemory = &FHoudiniApiRecorderHooks::SaveGeoToMemory;
+	Original::SaveHIPFile = FHoudiniApi::SaveHIPFile;
+	FHoudiniApi::SaveHIPFile = &FHoudiniApiRecorderHooks::SaveHIPFile;
+	Original::SaveNodeToFile = FHoudiniApi::SaveNodeToFile;
+	FHoudiniApi::SaveNodeToFile = &FHoudiniApiRecorderHooks::SaveNodeToFile;
+	Original::SessionSyncInfo_Create = FHoudiniApi::SessionSyncInfo_Create;
+	FHoudiniApi::SessionSyncInfo_Create = &FHoudiniApiRecorderHooks::SessionSyncInfo_Create;
+	Original::SetAnimCurve = FHoudiniApi::SetAnimCurve;
+	FHoudiniApi::SetAnimCurve = &FHoudiniApiRecorderHooks::SetAnimCurve;
+	Original::SetAttributeFloat64Data = FHoudiniApi::SetAttributeFloat64Data;
+	FHoudiniApi::SetAttributeFloat64Data = &FHoudiniApiRecorderHooks::SetAttributeFloat64Data;
+	Original::SetAttributeFloatData = FHoudiniApi::SetAttributeFloatData;
+	FHoudiniApi::SetAttributeFloatData = &FHoudiniApiRecorderHooks::SetAttributeFloatData;
+	Original::SetAttributeInt16Data = FHoudiniApi::SetAttributeInt16Data;
+	FHoudiniApi::SetAttributeInt16Data = &FHoudiniApiRecorderHooks::SetAttributeInt16Data;
+	Original::SetAttributeInt64Data = FHoudiniApi::SetAttributeInt64Data;
+	FHoudiniApi::SetAttributeInt64Data = &FHoudiniApiRecorderHooks::SetAttributeInt64Data;
+	Original::SetAttributeInt8Data = FHoudiniApi::SetAttributeInt8Data;
+	FHoudiniApi::SetAttributeInt8Data = &FHoudiniApiRecorderHooks::SetAttributeInt8Data;
+	Original::SetAttributeIntData = FHoudiniApi::SetAttributeIntData;
+	FHoudiniApi::SetAttributeIntData = &FHoudiniApiRecorderHooks::SetAttributeIntData;
+	Original::SetAttributeStringData = FHoudiniApi::SetAttributeStringData;
+	FHoudiniApi::SetAttributeStringData = &FHoudiniApiRecorderHooks::SetAttributeStringData;
+	Original::SetAttributeUInt8Data = FHoudiniApi::SetAttributeUInt8Data;
+	FHoudiniApi::SetAttributeUInt8Data = &FHoudiniApiRecorderHooks::SetAttributeUInt8Data;
+	Original::SetCacheProperty = FHoudiniApi::SetCacheProperty;
+	FHoudiniApi::SetCacheProperty = &FHoudiniApiRecorderHooks::SetCacheProperty;
+	Original::SetCurveCounts = FHoudiniApi::SetCurveCounts;
+	FHoudiniApi::SetCurveCounts = &FHoudiniApiRecorderHooks::SetCurveCounts;
+	Original::SetCurveInfo = FHoudiniApi::SetCurveInfo;
+	FHoudiniApi::SetCurveInfo = &FHoudiniApiRecorderHooks::SetCurveInfo;
+	Original::SetCurveKnots = FHoudiniApi::SetCurveKnots;
+	FHoudiniApi::SetCurveKnots = &FHoudiniApiRecorderHooks::SetCurveKnots;
+	Original::SetCurveOrders = FHoudiniApi::SetCurveOrders;
+	FHoudiniApi::SetCurveOrders = &FHoudiniApiRecorderHooks::SetCurveOrders;
+	Original::SetCustomString = FHoudiniApi::SetCustomString;
+	FHoudiniApi::SetCustomString = &FHoudiniApiRecorderHooks::SetCustomString;
+	Original::SetFaceCounts = FHoudiniApi::SetFaceCounts;
+	FHoudiniApi::SetFaceCounts = &FHoudiniApiRecorderHooks::SetFaceCounts;
+	Original::SetGroupMembership = FHoudiniApi::SetGroupMembership;
+	FHoudiniApi::SetGroupMembership = &FHoudiniApiRecorderHooks::SetGroupMembership;
+	Original::SetHeightFieldData = FHoudiniApi::SetHeightFieldData;
+	FHoudiniApi::SetHeightFieldData = &FHoudiniApiRecorderHooks::SetHeightFieldData;
+	Original::SetImageInfo = FHoudiniApi::SetImageInfo;
+	FHoudiniApi::SetImageInfo = &FHoudiniApiRecorderHooks::SetImageInfo;
+	Original::SetNodeDisplay = FHoudiniApi::SetNodeDisplay;
+	FHoudiniApi::SetNodeDisplay = &FHoudiniApiRecorderHooks::SetNodeDisplay;
+	Original::SetObjectTransform = FHoudiniApi::SetObjectTransform;
+	FHoudiniApi::SetObjectTransform = &FHoudiniApiRecorderHooks::SetObjectTransform;
+	Original::SetParmExpression = FHoudiniApi::SetParmExpression;
+	FHoudiniApi::SetParmExpression = &FHoudiniApiRecorderHooks::SetParmExpression;
+	Original::SetParmFloatValue = FHoudiniApi::SetParmFloatValue;
+	FHoudiniApi::SetParmFloatValue = &FHoudiniApiRecorderHooks::SetParmFloatValue;
+	Original::SetParmFloatValues = FHoudiniApi::SetParmFloatValues;
+	FHoudiniApi::SetParmFloatValues = &FHoudiniApiRecorderHooks::SetParmFloatValues;
+	Original::SetParmIntValue = FHoudiniApi::SetParmIntValue;
+	FHoudiniApi::SetParmIntValue = &FHoudiniApiRecorderHooks::SetParmIntValue;
+	Original::SetParmIntValues = FHoudiniApi::SetParmIntValues;
+	FHoudiniApi::SetParmIntValues = &FHoudiniApiRecorderHooks::SetParmIntValues;
+	Original::SetParmNodeValue = FHoudiniApi::SetParmNodeValue;
+	FHoudiniApi::SetParmNodeValue = &FHoudiniApiRecorderHooks::SetParmNodeValue;
+	Original::SetParmStringValue = FHoudiniApi::SetParmStringValue;
+	FHoudiniApi::SetParmStringValue = &FHoudiniApiRecorderHooks::SetParmStringValue;
+	Original::SetPartInfo = FHoudiniApi::SetPartInfo;
+	FHoudiniApi::SetPartInfo = &FHoudiniApiRecorderHooks::SetPartInfo;
+	Original::SetPreset = FHoudiniApi::SetPreset;
+	FHoudiniApi::SetPreset = &FHoudiniApiRecorderHooks::SetPreset;
+	Original::SetServerEnvInt = FHoudiniApi::SetServerEnvInt;
+	FHoudiniApi::SetServerEnvInt = &FHoudiniApiRecorderHooks::SetServerEnvInt;
+	Original::SetServerEnvString = FHoudiniApi::SetServerEnvString;
+	FHoudiniApi::SetServerEnvString = &FHoudiniApiRecorderHooks::SetServerEnvString;
+	Original::SetSessionSync = FHoudiniApi::SetSessionSync;
+	FHoudiniApi::SetSessionSync = &FHoudiniApiRecorderHooks::SetSessionSync;
+	Original::SetSessionSyncInfo = FHoudiniApi::SetSessionSyncInfo;
+	FHoudiniApi::SetSessionSyncInfo = &FHoudiniApiRecorderHooks::SetSessionSyncInfo;
+	Original::SetTime = FHoudiniApi::SetTime;
+	FHoudiniApi::SetTime = &FHoudiniApiRecorderHooks::SetTime;
+	Original::SetTimelineOptions = FHoudiniApi::SetTimelineOptions;
+	FHoudiniApi::SetTimelineOptions = &FHoudiniApiRecorderHooks::SetTimelineOptions;
+	Original::SetTransformAnimCurve = FHoudiniApi::SetTransformAnimCurve;
+	FHoudiniApi::SetTransformAnimCurve = &FHoudiniApiRecorderHooks::SetTransformAnimCurve;
+	Original::SetUseHoudiniTime = FHoudiniApi::SetUseHoudiniTime;
+	FHoudiniApi::SetUseHoudiniTime = &FHoudiniApiRecorderHooks::SetUseHoudiniTime;
+	Original::SetVertexList = FHoudiniApi::SetVertexList;
+	FHoudiniApi::SetVertexList = &FHoudiniApiRecorderHooks::SetVertexList;
+	Original::SetViewport = FHoudiniApi::SetViewport;
+	FHoudiniApi::SetViewport = &FHoudiniApiRecorderHooks::SetViewport;
+	Original::SetVolumeInfo = FHoudiniApi::SetVolumeInfo;
+	FHoudiniApi::SetVolumeInfo = &FHoudiniApiRecorderHooks::SetVolumeInfo;
+	Original::SetVolumeTileFloatData = FHoudiniApi::SetVolumeTileFloatData;
+	FHoudiniApi::SetVolumeTileFloatData = &FHoudiniApiRecorderHooks::SetVolumeTileFloatData;
+	Original::SetVolumeTileIntData = FHoudiniApi::SetVolumeTileIntData;
+	FHoudiniApi::SetVolumeTileIntData = &FHoudiniApiRecorderHooks::SetVolumeTileIntData;
+	Original::SetVolumeVoxelFloatData = FHoudiniApi::SetVolumeVoxelFloatData;
+	FHoudiniApi::SetVolumeVoxelFloatData = &FHoudiniApiRecorderHooks::SetVolumeVoxelFloatData;
+	Original::SetVolumeVoxelIntData = FHoudiniApi::SetVolumeVoxelIntData;
+	FHoudiniApi::SetVolumeVoxelIntData = &FHoudiniApiRecorderHooks::SetVolumeVoxelIntData;
+	Original::SetWorkitemFloatData = FHoudiniApi::SetWorkitemFloatData;
+	FHoudiniApi::SetWorkitemFloatData = &FHoudiniApiRecorderHooks::SetWorkitemFloatData;
+	Original::SetWorkitemIntData = FHoudiniApi::SetWorkitemIntData;
+	FHoudiniApi::SetWorkitemIntData = &FHoudiniApiRecorderHooks::SetWorkitemIntData;
+	Original::SetWorkitemStringData = FHoudiniApi::SetWorkitemStringData;
+	FHoudiniApi::SetWorkitemStringData = &FHoudiniApiRecorderHooks::SetWorkitemStringData;
+	Original::StartThriftNamedPipeServer = FHoudiniApi::StartThriftNamedPipeServer;
+	FHoudiniApi::StartThriftNamedPipeServer = &FHoudiniApiRecorderHooks::StartThriftNamedPipeServer;
+	Original::StartThriftSocketServer = FHoudiniApi::StartThriftSocketServer;
+	FHoudiniApi::StartThriftSocketServer = &FHoudiniApiRecorderHooks::StartThriftSocketServer;
+	Original::ThriftServerOptions_Create = FHoudiniApi::ThriftServerOptions_Create;
+	FHoudiniApi::ThriftServerOptions_Create = &FHoudiniApiRecorderHooks::ThriftServerOptions_Create;
+	Original::ThriftServerOptions_Init = FHoudiniApi::ThriftServerOptions_Init;
+	FHoudiniApi::ThriftServerOptions_Init = &FHoudiniApiRecorderHooks::ThriftServerOptions_Init;
+	Original::TimelineOptions_Create = FHoudiniApi::TimelineOptions_Create;
+	FHoudiniApi::TimelineOptions_Create = &FHoudiniApiRecorderHooks::TimelineOptions_Create;
+	Original::TimelineOptions_Init = FHoudiniApi::TimelineOptions_Init;
+	FHoudiniApi::TimelineOptions_Init = &FHoudiniApiRecorderHooks::TimelineOptions_Init;
+	Original::TransformEuler_Create = FHoudiniApi::TransformEuler_Create;
+	FHoudiniApi::TransformEuler_Create = &FHoudiniApiRecorderHooks::TransformEuler_Create;
+	Original::TransformEuler_Init = FHoudiniApi::TransformEuler_Init;
+	FHoudiniApi::TransformEuler_Init = &FHoudiniApiRecorderHooks::TransformEuler_Init;
+	Original::Transform_Create = FHoudiniApi::Transform_Create;
+	FHoudiniApi::Transform_Create = &FHoudiniApiRecorderHooks::Transform_Create;
+	Original::Transform_Init = FHoudiniApi::Transform_Init;
+	FHoudiniApi::Transform_Init = &FHoudiniApiRecorderHooks::Transform_Init;
+	Original::Viewport_Create = FHoudiniApi::Viewport_Create;
+	FHoudiniApi::Viewport_Create = &FHoudiniApiRecorderHooks::Viewport_Create;
+	Original::VolumeInfo_Create = FHoudiniApi::VolumeInfo_Create;
+	FHoudiniApi::VolumeInfo_Create = &FHoudiniApiRecorderHooks::VolumeInfo_Create;
+	Original::VolumeInfo_Init = FHoudiniApi::VolumeInfo_Init;
+	FHoudiniApi::VolumeInfo_Init = &FHoudiniApiRecorderHooks::VolumeInfo_Init;
+	Original::VolumeTileInfo_Create = FHoudiniApi::VolumeTileInfo_Create;
+	FHoudiniApi::VolumeTileInfo_Create = &FHoudiniApiRecorderHooks::VolumeTileInfo_Create;
+	Original::VolumeTileInfo_Init = FHoudiniApi::VolumeTileInfo_Init;
+	FHoudiniApi::VolumeTileInfo_Init = &FHoudiniApiRecorderHooks::VolumeTileInfo_Init;
+}
+
+void
+FHoudiniApiRecorderHooks::Uninstall()
+{
+	FHoudiniApi::AddAttribute = Original::AddAttribute;
+	FHoudiniApi::AddGroup = Original::AddGroup;
+	FHoudiniApi::AssetInfo_Create = Original::AssetInfo_Create;
+	FHoudiniApi::AssetInfo_Init = Original::AssetInfo_Init;
+	FHoudiniApi::AttributeInfo_Create = Original::AttributeInfo_Create;
+	FHoudiniApi::AttributeInfo_Init = Original::AttributeInfo_Init;
+	FHoudiniApi::BindCustomImplementation = Original::BindCustomImplementation;
+	FHoudiniApi::CancelPDGCook = Original::CancelPDGCook;
+	FHoudiniApi::CheckForSpecificErrors = Original::CheckForSpecificErrors;
+	FHoudiniApi::Cleanup = Original::Cleanup;
+	FHoudiniApi::ClearConnectionError = Original::ClearConnectionError;
+	FHoudiniApi::CloseSession = Original::CloseSession;
+	FHoudiniApi::CommitGeo = Original::CommitGeo;
+	FHoudiniApi::CommitWorkitems = Original::CommitWorkitems;
+	FHoudiniApi::ComposeChildNodeList = Original::ComposeChildNodeList;
+	FHoudiniApi::ComposeNodeCookResult = Original::ComposeNodeCookResult;
+	FHoudiniApi::ComposeObjectList = Original::ComposeObjectList;
+	FHoudiniApi::ConnectNodeInput = Original::ConnectNodeInput;
+	FHoudiniApi::ConvertMatrixToEuler = Original::ConvertMatrixToEuler;
+	FHoudiniApi::ConvertMatrixToQuat = Original::ConvertMatrixToQuat;
+	FHoudiniApi::ConvertTransform = Original::ConvertTransform;
+	FHoudiniApi::ConvertTransformEulerToMatrix = Original::ConvertTransformEulerToMatrix;
+	FHoudiniApi::ConvertTransformQuatToMatrix = Original::ConvertTransformQuatToMatrix;
+	FHoudiniApi::CookNode = Original::CookNode;
+	FHoudiniApi::CookOptions_AreEqual = Original::CookOptions_AreEqual;
+	FHoudiniApi::CookOptions_Create = Original::CookOptions_Create;
+	FHoudiniApi::CookOptions_Init = Original::CookOptions_Init;
+	FHoudiniApi::CookPDG = Original::CookPDG;
+	FHoudiniApi::CreateCustomSession = Original::CreateCustomSession;
+	FHoudiniApi::CreateHeightFieldInput = Original::CreateHeightFieldInput;
+	FHoudiniApi::CreateHeightfieldInputVolumeNode = Original::CreateHeightfieldInputVolumeNode;
+	FHoudiniApi::CreateInProcessSession = Original::CreateInProcessSession;
+	FHoudiniApi::CreateInputNode = Original::CreateInputNode;
+	FHoudiniApi::CreateNode = Original::CreateNode;
+	FHoudiniApi::CreateThriftNamedPipeSession = Original::CreateThriftNamedPipeSession;
+	FHoudiniApi::CreateThriftSocketSession = Original::CreateThriftSocketSession;
+	FHoudiniApi::CreateWorkitem = Original::CreateWorkitem;
+	FHoudiniApi::CurveInfo_Create = Original::CurveInfo_Create;
+	FHoudiniApi::CurveInfo_Init = Original::CurveInfo_Init;
+	FHoudiniApi::DeleteAttribute = Original::DeleteAttribute;
+	FHoudiniApi::DeleteGroup = Original::DeleteGroup;
+	FHoudiniApi::DeleteNode = Original::DeleteNode;
+	FHoudiniApi::DirtyPDGNode = Original::DirtyPDGNode;
+	FHoudiniApi::DisconnectNodeInput = Original::DisconnectNodeInput;
+	FHoudiniApi::DisconnectNodeOutputsAt = Original::DisconnectNodeOutputsAt;
+	FHoudiniApi::ExtractImageToFile = Original::ExtractImageToFile;
+	FHoudiniApi::ExtractImageToMemory = Original::ExtractImageToMemory;
+	FHoudiniApi::GeoInfo_Create = Original::GeoInfo_Create;
+	FHoudiniApi::GeoInfo_GetGroupCountByType = Original::GeoInfo_GetGroupCountByType;
+	FHoudiniApi::GeoInfo_Init = Original::GeoInfo_Init;
+	FHoudiniApi::GetActiveCacheCount = Original::GetActiveCacheCount;
+	FHoudiniApi::GetActiveCacheNames = Original::GetActiveCacheNames;
+	FHoudiniApi::GetAssetDefinitionParmCounts = Original::GetAssetDefinitionParmCounts;
+	FHoudiniApi::GetAssetDefinitionParmInfos = Original::GetAssetDefinitionParmInfos;
+	FHoudiniApi::GetAssetDefinitionParmValues = Original::GetAssetDefinitionParmValues;
+	FHoudiniApi::GetAssetInfo = Original::GetAssetInfo;
+	FHoudiniApi::GetAttributeFloat64ArrayData = Original::GetAttributeFloat64ArrayData;
+	FHoudiniApi::GetAttributeFloat64Data = Original::GetAttributeFloat64Data;
+	FHoudiniApi::GetAttributeFloatArrayData = Original::GetAttributeFloatArrayData;
+	FHoudiniApi::GetAttributeFloatData = Original::GetAttributeFloatData;
+	FHoudiniApi::GetAttributeInfo = Original::GetAttributeInfo;
+	FHoudiniApi::GetAttributeInt16ArrayData = Original::GetAttributeInt16ArrayData;
+	FHoudiniApi::GetAttributeInt16Data = Original::GetAttributeInt16Data;
+	FHoudiniApi::GetAttributeInt64ArrayData = Original::GetAttributeInt64ArrayData;
+	FHoudiniApi::GetAttributeInt64Data = Original::GetAttributeInt64Data;
+	FHoudiniApi::GetAttributeInt8ArrayData = Original::GetAttributeInt8ArrayData;
+	FHoudiniApi::GetAttributeInt8Data = Original::GetAttributeInt8Data;
+	FHoudiniApi::GetAttributeIntArrayData = Original::GetAttributeIntArrayData;
+	FHoudiniApi::GetAttributeIntData = Original::GetAttributeIntData;
+	FHoudiniApi::GetAttributeNames = Original::GetAttributeNames;
+	FHoudiniApi::GetAttributeStringArrayData = Original::GetAttributeStringArrayData;
+	FHoudiniApi::GetAttributeStringData = Original::GetAttributeStringData;
+	FHoudiniApi::GetAttributeUInt8ArrayData = Original::GetAttributeUInt8ArrayData;
+	FHoudiniApi::GetAttributeUInt8Data = Original::GetAttributeUInt8Data;
+	FHoudiniApi::GetAvailableAssetCount = Original::GetAvailableAssetCount;
+	FHoudiniApi::GetAvailableAssets = Original::GetAvailableAssets;
+	FHoudiniApi::GetBoxInfo = Original::GetBoxInfo;
+	FHoudiniApi::GetCacheProperty = Original::GetCacheProperty;
+	FHoudiniApi::GetComposedChildNodeList = Original::GetComposedChildNodeList;
+	FHoudiniApi::GetComposedNodeCookResult = Original::GetComposedNodeCookResult;
+	FHoudiniApi::GetComposedObjectList = Original::GetComposedObjectList;
+	FHoudiniApi::GetComposedObjectTransforms = Original::GetComposedObjectTransforms;
+	FHoudiniApi::GetConnectionError = Original::GetConnectionError;
+	FHoudiniApi::GetConnectionErrorLength = Original::GetConnectionErrorLength;
+	FHoudiniApi::GetCookingCurrentCount = Original::GetCookingCurrentCount;
+	FHoudiniApi::GetCookingTotalCount = Original::GetCookingTotalCount;
+	FHoudiniApi::GetCurveCounts = Original::GetCurveCounts;
+	FHoudiniApi::GetCurveInfo = Original::GetCurveInfo;
+	FHoudiniApi::GetCurveKnots = Original::GetCurveKnots;
+	FHoudiniApi::GetCurveOrders = Original::GetCurveOrders;
+	FHoudiniApi::GetDisplayGeoInfo = Original::GetDisplayGeoInfo;
+	FHoudiniApi::GetEnvInt = Original::GetEnvInt;
+	FHoudiniApi::GetFaceCounts = Original::GetFaceCounts;
+	FHoudiniApi::GetFirstVolumeTile = Original::GetFirstVolumeTile;
+	FHoudiniApi::GetGeoInfo = Original::GetGeoInfo;
+	FHoudiniApi::GetGeoSize = Original::GetGeoSize;
+	FHoudiniApi::GetGroupCountOnPackedInstancePart = Original::GetGroupCountOnPackedInstancePart;
+	FHoudiniApi::GetGroupMembership = Original::GetGroupMembership;
+	FHoudiniApi::GetGroupMembershipOnPackedInstancePart = Original::GetGroupMembershipOnPackedInstancePart;
+	FHoudiniApi::GetGroupNames = Original::GetGroupNames;
+	FHoudiniApi::GetGroupNamesOnPackedInstancePart = Original::GetGroupNamesOnPackedInstancePart;
+	FHoudiniApi::GetHIPFileNodeCount = Original::GetHIPFileNodeCount;
+	FHoudiniApi::GetHIPFileNodeIds = Original::GetHIPFileNodeIds;
+	FHoudiniApi::GetHandleBindingInfo = Original::GetHandleBindingInfo;
+	FHoudiniApi::GetHandleInfo = Original::GetHandleInfo;
+	FHoudiniApi::GetHeightFieldData = Original::GetHeightFieldData;
+	FHoudiniApi::GetImageFilePath = Original::GetImageFilePath;
+	FHoudiniApi::GetImageInfo = Original::GetImageInfo;
+	FHoudiniApi::GetImageMemoryBuffer = Original::GetImageMemoryBuffer;
+	FHoudiniApi::GetImagePlaneCount = Original::GetImagePlaneCount;
+	FHoudiniApi::GetImagePlanes = Original::GetImagePlanes;
+	FHoudiniApi::GetInstanceTransformsOnPart = Original::GetInstanceTransformsOnPart;
+	FHoudiniApi::GetInstancedObjectIds = Original::GetInstancedObjectIds;
+	FHoudiniApi::GetInstancedPartIds = Original::GetInstancedPartIds;
+	FHoudiniApi::GetInstancerPartTransforms = Original::GetInstancerPartTransforms;
+	FHoudiniApi::GetManagerNodeId = Original::GetManagerNodeId;
+	FHoudiniApi::GetMaterialInfo = Original::GetMaterialInfo;
+	FHoudiniApi::GetMaterialNodeIdsOnFaces = Original::GetMaterialNodeIdsOnFaces;
+	FHoudiniApi::GetNextVolumeTile = Original::GetNextVolumeTile;
+	FHoudiniApi::GetNodeInfo = Original::GetNodeInfo;
+	FHoudiniApi::GetNodeInputName = Original::GetNodeInputName;
+	FHoudiniApi::GetNodeOutputName = Original::GetNodeOutputName;
+	FHoudiniApi::GetNodePath = Original::GetNodePath;
+	FHoudiniApi::GetNumWorkitems = Original::GetNumWorkitems;
+	FHoudiniApi::GetObjectInfo = Original::GetObjectInfo;
+	FHoudiniApi::GetObjectTransform = Original::GetObjectTransform;
+	FHoudiniApi::GetOutputNodeId = Original::GetOutputNodeId;
+	FHoudiniApi::GetPDGEvents = Original::GetPDGEvents;
+	FHoudiniApi::GetPDGGraphContextId = Original::GetPDGGraphContextId;
+	FHoudiniApi::GetPDGGraphContexts = Original::GetPDGGraphContexts;
+	FHoudiniApi::GetPDGState = Original::GetPDGState;
+	FHoudiniApi::GetParameters = Original::GetParameters;
+	FHoudiniApi::GetParmChoiceLists = Original::GetParmChoiceLists;
+	FHoudiniApi::GetParmExpression = Original::GetParmExpression;
+	FHoudiniApi::GetParmFile = Original::GetParmFile;
+	FHoudiniApi::GetParmFloatValue = Original::GetParmFloatValue;
+	FHoudiniApi::GetParmFloatValues = Original::GetParmFloatValues;
+	FHoudiniApi::GetParmIdFromName = Original::GetParmIdFromName;
+	FHoudiniApi::GetParmInfo = Original::GetParmInfo;
+	FHoudiniApi::GetParmInfoFromName = Original::GetParmInfoFromName;
+	FHoudiniApi::GetParmIntValue = Original::GetParmIntValue;
+	FHoudiniApi::GetParmIntValues = Original::GetParmIntValues;
+	FHoudiniApi::GetParmNodeValue = Original::GetParmNodeValue;
+	FHoudiniApi::GetParmStringValue = Original::GetParmStringValue;
+	FHoudiniApi::GetParmStringValues = Original::GetParmStringValues;
+	FHoudiniApi::GetParmTagName = Original::GetParmTagName;
+	FHoudiniApi::GetParmTagValue = Original::GetParmTagValue;
+	FHoudiniApi::GetParmWithTag = Original::GetParmWithTag;
+	FHoudiniApi::GetPartInfo = Original::GetPartInfo;
+	FHoudiniApi::GetPreset = Original::GetPreset;
+	FHoudiniApi::GetPresetBufLength = Original::GetPresetBufLength;
+	FHoudiniApi::GetServerEnvInt = Original::GetServerEnvInt;
+	FHoudiniApi::GetServerEnvString = Original::GetServerEnvString;
+	FHoudiniApi::GetServerEnvVarCount = Original::GetServerEnvVarCount;
+	FHoudiniApi::GetServerEnvVarList = Original::GetServerEnvVarList;
+	FHoudiniApi::GetSessionEnvInt = Original::GetSessionEnvInt;
+	FHoudiniApi::GetSessionSyncInfo = Original::GetSessionSyncInfo;
+	FHoudiniApi::GetSphereInfo = Original::GetSphereInfo;
+	FHoudiniApi::GetStatus = Original::GetStatus;
+	FHoudiniApi::GetStatusString = Original::GetStatusString;
+	FHoudiniApi::GetStatusStringBufLength = Original::GetStatusStringBufLength;
+	FHoudiniApi::GetString = Original::GetString;
+	FHoudiniApi::GetStringBatch = Original::GetStringBatch;
+	FHoudiniApi::GetStringBatchSize = Original::GetStringBatchSize;
+	FHoudiniApi::GetStringBufLength = Original::GetStringBufLength;
+	FHoudiniApi::GetSupportedImageFileFormatCount = Original::GetSupportedImageFileFormatCount;
+	FHoudiniApi::GetSupportedImageFileFormats = Original::GetSupportedImageFileFormats;
+	FHoudiniApi::GetTime = Original::GetTime;
+	FHoudiniApi::GetTimelineOptions = Original::GetTimelineOptions;
+	FHoudiniApi::GetTotalCookCount = Original::GetTotalCookCount;
+	FHoudiniApi::GetUseHoudiniTime = Original::GetUseHoudiniTime;
+	FHoudiniApi::GetVertexList = Original::GetVertexList;
+	FHoudiniApi::GetViewport = Original::GetViewport;
+	FHoudiniApi::GetVolumeBounds = Original::GetVolumeBounds;
+	FHoudiniApi::GetVolumeInfo = Original::GetVolumeInfo;
+	FHoudiniApi::GetVolumeTileFloatData = Original::GetVolumeTileFloatData;
+	FHoudiniApi::GetVolumeTileIntData = Original::GetVolumeTileIntData;
+	FHoudiniApi::GetVolumeVisualInfo = Original::GetVolumeVisualInfo;
+	FHoudiniApi::GetVolumeVoxelFloatData = Original::GetVolumeVoxelFloatData;
+	FHoudiniApi::GetVolumeVoxelIntData = Original::GetVolumeVoxelIntData;
+	FHoudiniApi::GetWorkitemDataLength = Original::GetWorkitemDataLength;
+	FHoudiniApi::GetWorkitemFloatData = Original::GetWorkitemFloatData;
+	FHoudiniApi::GetWorkitemInfo = Original::GetWorkitemInfo;
+	FHoudiniApi::GetWorkitemIntData = Original::GetWorkitemIntData;
+	FHoudiniApi::GetWorkitemResultInfo = Original::GetWorkitemResultInfo;
+	FHoudiniApi::GetWorkitemStringData = Original::GetWorkitemStringData;
+	FHoudiniApi::GetWorkitems = Original::GetWorkitems;
+	FHoudiniApi::HandleBindingInfo_Create = Original::HandleBindingInfo_Create;
+	FHoudiniApi::HandleBindingInfo_Init = Original::HandleBindingInfo_Init;
+	FHoudiniApi::HandleInfo_Create = Original::HandleInfo_Create;
+	FHoudiniApi::HandleInfo_Init = Original::HandleInfo_Init;
+	FHoudiniApi::ImageFileFormat_Create = Original::ImageFileFormat_Create;
+	FHoudiniApi::ImageFileFormat_Init = Original::ImageFileFormat_Init;
+	FHoudiniApi::ImageInfo_Create = Original::ImageInfo_Create;
+	FHoudiniApi::ImageInfo_Init = Original::ImageInfo_Init;
+	FHoudiniApi::Initialize = Original::Initialize;
+	FHoudiniApi::InsertMultiparmInstance = Original::InsertMultiparmInstance;
+	FHoudiniApi::Interrupt = Original::Interrupt;
+	FHoudiniApi::IsInitialized = Original::IsInitialized;
+	FHoudiniApi::IsNodeValid = Original::IsNodeValid;
+	FHoudiniApi::IsSessionValid = Original::IsSessionValid;
+	FHoudiniApi::Keyframe_Create = Original::Keyframe_Create;
+	FHoudiniApi::Keyframe_Init = Original::Keyframe_Init;
+	FHoudiniApi::LoadAssetLibraryFromFile = Original::LoadAssetLibraryFromFile;
+	FHoudiniApi::LoadAssetLibraryFromMemory = Original::LoadAssetLibraryFromMemory;
+	FHoudiniApi::LoadGeoFromFile = Original::LoadGeoFromFile;
+	FHoudiniApi::LoadGeoFromMemory = Original::LoadGeoFromMemory;
+	FHoudiniApi::LoadHIPFile = Original::LoadHIPFile;
+	FHoudiniApi::LoadNodeFromFile = Original::LoadNodeFromFile;
+	FHoudiniApi::MaterialInfo_Create = Original::MaterialInfo_Create;
+	FHoudiniApi::MaterialInfo_Init = Original::MaterialInfo_Init;
+	FHoudiniApi::MergeHIPFile = Original::MergeHIPFile;
+	FHoudiniApi::NodeInfo_Create = Original::NodeInfo_Create;
+	FHoudiniApi::NodeInfo_Init = Original::NodeInfo_Init;
+	FHoudiniApi::ObjectInfo_Create = Original::ObjectInfo_Create;
+	FHoudiniApi::ObjectInfo_Init = Original::ObjectInfo_Init;
+	FHoudiniApi::ParmChoiceInfo_Create = Original::ParmChoiceInfo_Create;
+	FHoudiniApi::ParmChoiceInfo_Init = Original::ParmChoiceInfo_Init;
+	FHoudiniApi::ParmHasExpression = Original::ParmHasExpression;
+	FHoudiniApi::ParmHasTag = Original::ParmHasTag;
+	FHoudiniApi::ParmInfo_Create = Original::ParmInfo_Create;
+	FHoudiniApi::ParmInfo_GetFloatValueCount = Original::ParmInfo_GetFloatValueCount;
+	FHoudiniApi::ParmInfo_GetIntValueCount = Original::ParmInfo_GetIntValueCount;
+	FHoudiniApi::ParmInfo_GetStringValueCount = Original::ParmInfo_GetStringValueCount;
+	FHoudiniApi::ParmInfo_Init = Original::ParmInfo_Init;
+	FHoudiniApi::ParmInfo_IsFloat = Original::ParmInfo_IsFloat;
+	FHoudiniApi::ParmInfo_IsInt = Original::ParmInfo_IsInt;
+	FHoudiniApi::ParmInfo_IsNode = Original::ParmInfo_IsNode;
+	FHoudiniApi::ParmInfo_IsNonValue = Original::ParmInfo_IsNonValue;
+	FHoudiniApi::ParmInfo_IsPath = Original::ParmInfo_IsPath;
+	FHoudiniApi::ParmInfo_IsString = Original::ParmInfo_IsString;
+	FHoudiniApi::PartInfo_Create = Original::PartInfo_Create;
+	FHoudiniApi::PartInfo_GetAttributeCountByOwner = Original::PartInfo_GetAttributeCountByOwner;
+	FHoudiniApi::PartInfo_GetElementCountByAttributeOwner = Original::PartInfo_GetElementCountByAttributeOwner;
+	FHoudiniApi::PartInfo_GetElementCountByGroupType = Original::PartInfo_GetElementCountByGroupType;
+	FHoudiniApi::PartInfo_Init = Original::PartInfo_Init;
+	FHoudiniApi::PausePDGCook = Original::PausePDGCook;
+	FHoudiniApi::PythonThreadInterpreterLock = Original::PythonThreadInterpreterLock;
+	FHoudiniApi::QueryNodeInput = Original::QueryNodeInput;
+	FHoudiniApi::QueryNodeOutputConnectedCount = Original::QueryNodeOutputConnectedCount;
+	FHoudiniApi::QueryNodeOutputConnectedNodes = Original::QueryNodeOutputConnectedNodes;
+	FHoudiniApi::RemoveCustomString = Original::RemoveCustomString;
+	FHoudiniApi::RemoveMultiparmInstance = Original::RemoveMultiparmInstance;
+	FHoudiniApi::RemoveParmExpression = Original::RemoveParmExpression;
+	FHoudiniApi::RenameNode = Original::RenameNode;
+	FHoudiniApi::RenderCOPToImage = Original::RenderCOPToImage;
+	FHoudiniApi::RenderTextureToImage = Original::RenderTextureToImage;
+	FHoudiniApi::ResetSimulation = Original::ResetSimulation;
+	FHoudiniApi::RevertGeo = Original::RevertGeo;
+	FHoudiniApi::RevertParmToDefault = Original::RevertParmToDefault;
+	FHoudiniApi::RevertParmToDefaults = Original::RevertParmToDefaults;
+	FHoudiniApi::SaveGeoToFile = Original::SaveGeoToFile;
+	FHoudiniApi::SaveGeoToMemory = Original::SaveGeoToMemory;
+	FHoudiniApi::SaveHIPFile = Original::SaveHIPFile;
+	FHoudiniApi::SaveNodeToFile = Original::SaveNodeToFile;
+	FHoudiniApi::SessionSyncInfo_Create = Original::SessionSyncInfo_Create;
+	FHoudiniApi::SetAnimCurve = Original::SetAnimCurve;
+	FHoudiniApi::SetAttributeFloat64Data = Original::SetAttributeFloat64Data;
+	FHoudiniApi::SetAttributeFloatData = Original::SetAttributeFloatData;
+	FHoudiniApi::SetAttributeInt16Data = Original::SetAttributeInt16Data;
+	FHoudiniApi::SetAttributeInt64Data = Original::SetAttributeInt64Data;
+	FHoudiniApi::SetAttributeInt8Data = Original::SetAttributeInt8Data;
+	FHoudiniApi::SetAttributeIntData = Original::SetAttributeIntData;
+	FHoudiniApi::SetAttributeStringData = Original::SetAttributeStringData;
+	FHoudiniApi::SetAttributeUInt8Data = Original::SetAttributeUInt8Data;
+	FHoudiniApi::SetCacheProperty = Original::SetCacheProperty;
+	FHoudiniApi::SetCurveCounts = Original::SetCurveCounts;
+	FHoudiniApi::SetCurveInfo = Original::SetCurveInfo;
+	FHoudiniApi::SetCurveKnots = Original::SetCurveKnots;
+	FHoudiniApi::SetCurveOrders = Original::SetCurveOrders;
+	FHoudiniApi::SetCustomString = Original::SetCustomString;
+	FHoudiniApi::SetFaceCounts = Original::SetFaceCounts;
+	FHoudiniApi::SetGroupMembership = Original::SetGroupMembership;
+	FHoudiniApi::SetHeightFieldData = Original::SetHeightFieldData;
+	FHoudiniApi::SetImageInfo = Original::SetImageInfo;
+	FHoudiniApi::SetNodeDisplay = Original::SetNodeDisplay;
+	FHoudiniApi::SetObjectTransform = Original::SetObjectTransform;
+	FHoudiniApi::SetParmExpression = Original::SetParmExpression;
+	FHoudiniApi::SetParmFloatValue = Original::SetParmFloatValue;
+	FHoudiniApi::SetParmFloatValues = Original::SetParmFloatValues;
+	FHoudiniApi::SetParmIntValue = Original::SetParmIntValue;
+	FHoudiniApi::SetParmIntValues = Original::SetParmIntValues;
+	FHoudiniApi::SetParmNodeValue = Original::SetParmNodeValue;
+	FHoudiniApi::SetParmStringValue = Original::SetParmStringValue;
+	FHoudiniApi::SetPartInfo = Original::SetPartInfo;
+	FHoudiniApi::SetPreset = Original::SetPreset;
+	FHoudiniApi::SetServerEnvInt = Original::SetServerEnvInt;
+	FHoudiniApi::SetServerEnvString = Original::SetServerEnvString;
+	FHoudiniApi::SetSessionSync = Original::SetSessionSync;
+	FHoudiniApi::SetSessionSyncInfo = Original::SetSessionSyncInfo;
+	FHoudiniApi::SetTime = Original::SetTime;
+	FHoudiniApi::SetTimelineOptions = Original::SetTimelineOptions;
+	FHoudiniApi::SetTransformAnimCurve = Original::SetTransformAnimCurve;
+	FHoudiniApi::SetUseHoudiniTime = Original::SetUseHoudiniTime;
+	FHoudiniApi::SetVertexList = Original::SetVertexList;
+	FHoudiniApi::SetViewport = Original::SetViewport;
+	FHoudiniApi::SetVolumeInfo = Original::SetVolumeInfo;
+	FHoudiniApi::SetVolumeTileFloatData = Original::SetVolumeTileFloatData;
+	FHoudiniApi::SetVolumeTileIntData = Original::SetVolumeTileIntData;
+	FHoudiniApi::SetVolumeVoxelFloatData = Original::SetVolumeVoxelFloatData;
+	FHoudiniApi::SetVolumeVoxelIntData = Original::SetVolumeVoxelIntData;
+	FHoudiniApi::SetWorkitemFloatData = Original::SetWorkitemFloatData;
+	FHoudiniApi::SetWorkitemIntData = Original::SetWorkitemIntData;
+	FHoudiniApi::SetWorkitemStringData = Original::SetWorkitemStringData;
+	FHoudiniApi::StartThriftNamedPipeServer = Original::StartThriftNamedPipeServer;
+	FHoudiniApi::StartThriftSocketServer = Original::StartThriftSocketServer;
+	FHoudiniApi::ThriftServerOptions_Create = Original::ThriftServerOptions_Create;
+	FHoudiniApi::ThriftServerOptions_Init = Original::ThriftServerOptions_Init;
+	FHoudiniApi::TimelineOptions_Create = Original::TimelineOptions_Create;
+	FHoudiniApi::TimelineOptions_Init = Original::TimelineOptions_Init;
+	FHoudiniApi::TransformEuler_Create = Original::TransformEuler_Create;
+	FHoudiniApi::TransformEuler_Init = Original::TransformEuler_Init;
+	FHoudiniApi::Transform_Create = Original::Transform_Create;
+	FHoudiniApi::Transform_Init = Original::Transform_Init;
+	FHoudiniApi::Viewport_Create = Original::Viewport_Create;
+	FHoudiniApi::VolumeInfo_Create = Original::VolumeInfo_Create;
+	FHoudiniApi::VolumeInfo_Init = Original::VolumeInfo_Init;
+	FHoudiniApi::VolumeTileInfo_Create = Original::VolumeTileInfo_Create;
+	FHoudiniApi::VolumeTileInfo_Init = Original::VolumeTileInfo_Init;
+}
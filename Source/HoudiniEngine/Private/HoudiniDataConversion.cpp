@@ -0,0 +1,411 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniDataConversion.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "Async/ParallelFor.h"
+
+static_assert(sizeof(FVector) == 3 * sizeof(float), "FHoudiniDataConversion expects FVector to be 3 floats.");
+static_assert(sizeof(FVector2D) == 2 * sizeof(float), "FHoudiniDataConversion expects FVector2D to be 2 floats.");
+
+void
+FHoudiniDataConversion::SwizzleAndScaleFloat3(const float* InData, float* OutData, const int32& InCount, const float& InScale)
+{
+	int32 Idx = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	// Process 4 float3 (3 registers) at a time:
+	// A = x0 y0 z0 x1 | B = y1 z1 x2 y2 | C = z2 x3 y3 z3
+	const VectorRegister Scale = VectorSetFloat1(InScale);
+	for (; Idx + 4 <= InCount; Idx += 4)
+	{
+		const float* In = InData + Idx * 3;
+		const VectorRegister A = VectorLoad(In);
+		const VectorRegister B = VectorLoad(In + 4);
+		const VectorRegister C = VectorLoad(In + 8);
+
+		// x0 z0 y0 x1
+		const VectorRegister OutA = VectorSwizzle(A, 0, 2, 1, 3);
+		// z1 y1 x2 z2
+		const VectorRegister B2B3C0C1 = VectorShuffle(B, C, 2, 3, 0, 1);
+		const VectorRegister OutB = VectorShuffle(B, B2B3C0C1, 1, 0, 0, 2);
+		// y2 x3 z3 y3
+		const VectorRegister B3B3C1C1 = VectorShuffle(B, C, 3, 3, 1, 1);
+		const VectorRegister OutC = VectorShuffle(B3B3C1C1, C, 0, 2, 3, 2);
+
+		float* Out = OutData + Idx * 3;
+		VectorStore(VectorMultiply(OutA, Scale), Out);
+		VectorStore(VectorMultiply(OutB, Scale), Out + 4);
+		VectorStore(VectorMultiply(OutC, Scale), Out + 8);
+	}
+#endif
+
+	SwizzleAndScaleFloat3Scalar(InData + Idx * 3, OutData + Idx * 3, InCount - Idx, InScale);
+}
+
+void
+FHoudiniDataConversion::SwizzleAndScaleFloat3Scalar(const float* InData, float* OutData, const int32& InCount, const float& InScale)
+{
+	for (int32 Idx = 0; Idx < InCount; ++Idx)
+	{
+		const float X = InData[Idx * 3 + 0];
+		const float Y = InData[Idx * 3 + 1];
+		const float Z = InData[Idx * 3 + 2];
+		OutData[Idx * 3 + 0] = X * InScale;
+		OutData[Idx * 3 + 1] = Z * InScale;
+		OutData[Idx * 3 + 2] = Y * InScale;
+	}
+}
+
+int32
+FHoudiniDataConversion::GatherSwizzleAndScaleFloat3(
+	const float* InData, const int32& InDataNum, const int32* InIndices, float* OutData, const int32& InCount, const float& InScale)
+{
+	int32 NumInvalid = 0;
+	for (int32 Idx = 0; Idx < InCount; ++Idx)
+	{
+		const int32 Index = InIndices[Idx];
+		float* Out = OutData + Idx * 3;
+		if (Index < 0 || Index * 3 + 2 >= InDataNum)
+		{
+			Out[0] = Out[1] = Out[2] = 0.0f;
+			NumInvalid++;
+			continue;
+		}
+
+		const float* In = InData + Index * 3;
+		Out[0] = In[0];
+		Out[1] = In[1];
+		Out[2] = In[2];
+	}
+
+	// The gathered values are contiguous, convert them in place
+	SwizzleAndScaleFloat3(OutData, OutData, InCount, InScale);
+	return NumInvalid;
+}
+
+void
+FHoudiniDataConversion::FlipUVs(const float* InData, float* OutData, const int32& InCount)
+{
+	int32 Idx = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	// Process 2 UVs at a time: (U, V) => (U * 1 + 0, V * -1 + 1)
+	const VectorRegister Sign = MakeVectorRegister(1.0f, -1.0f, 1.0f, -1.0f);
+	const VectorRegister Offset = MakeVectorRegister(0.0f, 1.0f, 0.0f, 1.0f);
+	for (; Idx + 2 <= InCount; Idx += 2)
+	{
+		const VectorRegister UVs = VectorLoad(InData + Idx * 2);
+		VectorStore(VectorMultiplyAdd(UVs, Sign, Offset), OutData + Idx * 2);
+	}
+#endif
+
+	FlipUVsScalar(InData + Idx * 2, OutData + Idx * 2, InCount - Idx);
+}
+
+void
+FHoudiniDataConversion::FlipUVsScalar(const float* InData, float* OutData, const int32& InCount)
+{
+	for (int32 Idx = 0; Idx < InCount; ++Idx)
+	{
+		OutData[Idx * 2 + 0] = InData[Idx * 2 + 0];
+		OutData[Idx * 2 + 1] = 1.0f - InData[Idx * 2 + 1];
+	}
+}
+
+void
+FHoudiniDataConversion::ConvertColors(
+	const float* InColors, const int32& InTupleSize, const float* InAlphas, FColor* OutColors, const int32& InCount)
+{
+	if (InTupleSize < 3)
+		return;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	// Same as FLinearColor::ToFColor(false): clamp to [0, 1] and floor(C * 255.999)
+	const VectorRegister Zero = VectorZero();
+	const VectorRegister One = VectorOne();
+	const VectorRegister Quantize = VectorSetFloat1(255.999f);
+	for (int32 Idx = 0; Idx < InCount; ++Idx)
+	{
+		const float* In = InColors + Idx * InTupleSize;
+		VectorRegister Color;
+		if (InAlphas)
+			Color = MakeVectorRegister(In[0], In[1], In[2], InAlphas[Idx]);
+		else if (InTupleSize >= 4)
+			Color = VectorLoad(In);
+		else
+			Color = VectorLoadFloat3_W1(In);
+
+		Color = VectorMultiply(VectorMin(VectorMax(Color, Zero), One), Quantize);
+
+		// FColor is stored as BGRA
+		VectorStoreByte4(VectorSwizzle(Color, 2, 1, 0, 3), &OutColors[Idx]);
+	}
+#else
+	ConvertColorsScalar(InColors, InTupleSize, InAlphas, OutColors, InCount);
+#endif
+}
+
+void
+FHoudiniDataConversion::ConvertColorsScalar(
+	const float* InColors, const int32& InTupleSize, const float* InAlphas, FColor* OutColors, const int32& InCount)
+{
+	if (InTupleSize < 3)
+		return;
+
+	for (int32 Idx = 0; Idx < InCount; ++Idx)
+	{
+		const float* In = InColors + Idx * InTupleSize;
+		FLinearColor LinearColor(In[0], In[1], In[2], 1.0f);
+		if (InAlphas)
+			LinearColor.A = InAlphas[Idx];
+		else if (InTupleSize >= 4)
+			LinearColor.A = In[3];
+
+		OutColors[Idx] = LinearColor.ToFColor(false);
+	}
+}
+
+void
+FHoudiniDataConversion::ConvertHapiTransforms(const HAPI_Transform* InTransforms, FTransform* OutTransforms, const int32& InCount)
+{
+#if PLATFORM_ENABLE_VECTORINTRINSICS && HAPI_UNREAL_CONVERT_COORDINATE_SYSTEM
+	// Swap Y/Z for all components, invert W and scale the translation
+	const VectorRegister RotationSign = MakeVectorRegister(1.0f, 1.0f, 1.0f, -1.0f);
+	const VectorRegister TranslationScale = VectorSetFloat1(HAPI_UNREAL_SCALE_FACTOR_TRANSLATION);
+	for (int32 Idx = 0; Idx < InCount; ++Idx)
+	{
+		const HAPI_Transform& HapiTransform = InTransforms[Idx];
+		const VectorRegister Rotation = VectorMultiply(
+			VectorSwizzle(VectorLoad(HapiTransform.rotationQuaternion), 0, 2, 1, 3), RotationSign);
+		const VectorRegister Translation = VectorMultiply(
+			VectorSwizzle(VectorLoadFloat3_W0(HapiTransform.position), 0, 2, 1, 3), TranslationScale);
+		const VectorRegister Scale3D = VectorSwizzle(VectorLoadFloat3_W0(HapiTransform.scale), 0, 2, 1, 3);
+
+		FQuat ObjectRotation;
+		FVector ObjectTranslation, ObjectScale3D;
+		VectorStore(Rotation, &ObjectRotation);
+		VectorStoreFloat3(Translation, &ObjectTranslation);
+		VectorStoreFloat3(Scale3D, &ObjectScale3D);
+		OutTransforms[Idx].SetComponents(ObjectRotation, ObjectTranslation, ObjectScale3D);
+	}
+#else
+	ConvertHapiTransformsScalar(InTransforms, OutTransforms, InCount);
+#endif
+}
+
+void
+FHoudiniDataConversion::ConvertHapiTransformsScalar(const HAPI_Transform* InTransforms, FTransform* OutTransforms, const int32& InCount)
+{
+	for (int32 Idx = 0; Idx < InCount; ++Idx)
+	{
+		const HAPI_Transform& HapiTransform = InTransforms[Idx];
+		if (HAPI_UNREAL_CONVERT_COORDINATE_SYSTEM)
+		{
+			// Swap Y/Z, invert W
+			FQuat ObjectRotation(
+				HapiTransform.rotationQuaternion[0], HapiTransform.rotationQuaternion[2],
+				HapiTransform.rotationQuaternion[1], -HapiTransform.rotationQuaternion[3]);
+
+			// Swap Y/Z and scale
+			FVector ObjectTranslation(HapiTransform.position[0], HapiTransform.position[2], HapiTransform.position[1]);
+			ObjectTranslation *= HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
+
+			// Swap Y/Z
+			FVector ObjectScale3D(HapiTransform.scale[0], HapiTransform.scale[2], HapiTransform.scale[1]);
+
+			OutTransforms[Idx].SetComponents(ObjectRotation, ObjectTranslation, ObjectScale3D);
+		}
+		else
+		{
+			FQuat ObjectRotation(
+				HapiTransform.rotationQuaternion[0], HapiTransform.rotationQuaternion[1],
+				HapiTransform.rotationQuaternion[2], HapiTransform.rotationQuaternion[3]);
+
+			FVector ObjectTranslation(
+				HapiTransform.position[0], HapiTransform.position[1], HapiTransform.position[2]);
+			ObjectTranslation *= HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
+
+			FVector ObjectScale3D(HapiTransform.scale[0], HapiTransform.scale[1], HapiTransform.scale[2]);
+
+			OutTransforms[Idx].SetComponents(ObjectRotation, ObjectTranslation, ObjectScale3D);
+		}
+	}
+}
+
+// Transposes and converts a grid, see the landscape kernels in the header.
+// The grid is split in tiles of input columns (output rows) so each task writes its own range of the output,
+// and each tile is walked in square blocks so both the strided reads and the writes stay in cache.
+template<typename TIn, typename TOut, typename TConvert>
+static void
+TransposeAndConvertBlocked(
+	const TIn* InData, const int32& InNumRows, const int32& InRowSize, TOut* OutData, const int32& InOutRowStride,
+	const TConvert& InConvert)
+{
+	const int32 BlockSize = 64;
+	const int32 NumTiles = FMath::DivideAndRoundUp(InRowSize, BlockSize);
+
+	// Not worth going wide on small grids
+	const bool bSingleThreaded = (int64)InNumRows * InRowSize < 256 * 256;
+
+	ParallelFor(NumTiles, [&](int32 TileIdx)
+	{
+		const int32 StartCol = TileIdx * BlockSize;
+		const int32 EndCol = FMath::Min(StartCol + BlockSize, InRowSize);
+		for (int32 StartRow = 0; StartRow < InNumRows; StartRow += BlockSize)
+		{
+			const int32 EndRow = FMath::Min(StartRow + BlockSize, InNumRows);
+			for (int32 Col = StartCol; Col < EndCol; ++Col)
+			{
+				TOut* Out = OutData + (int64)Col * InOutRowStride;
+				const TIn* In = InData + Col;
+				for (int32 Row = StartRow; Row < EndRow; ++Row)
+					Out[Row] = InConvert(In[(int64)Row * InRowSize]);
+			}
+		}
+	}, bSingleThreaded);
+}
+
+template<typename TIn, typename TOut, typename TConvert>
+static void
+TransposeAndConvertScalar(
+	const TIn* InData, const int32& InNumRows, const int32& InRowSize, TOut* OutData, const int32& InOutRowStride,
+	const TConvert& InConvert)
+{
+	for (int32 Col = 0; Col < InRowSize; ++Col)
+	{
+		for (int32 Row = 0; Row < InNumRows; ++Row)
+			OutData[(int64)Col * InOutRowStride + Row] = InConvert(InData[(int64)Row * InRowSize + Col]);
+	}
+}
+
+void
+FHoudiniDataConversion::ConvertHeightfieldToLandscapeHeights(
+	const float* InData, const int32& InNumRows, const int32& InRowSize, uint16* OutData, const int32& InOutRowStride,
+	const float& InMin, const double& InScale, const double& InOffset)
+{
+	auto Convert = [&](const float& InValue) -> uint16
+	{
+		const double DoubleValue = ((double)InValue - (double)InMin) * InScale + InOffset;
+		return FMath::RoundToInt(DoubleValue);
+	};
+
+	TransposeAndConvertBlocked(InData, InNumRows, InRowSize, OutData, InOutRowStride, Convert);
+}
+
+void
+FHoudiniDataConversion::ConvertHeightfieldToLandscapeHeightsScalar(
+	const float* InData, const int32& InNumRows, const int32& InRowSize, uint16* OutData, const int32& InOutRowStride,
+	const float& InMin, const double& InScale, const double& InOffset)
+{
+	auto Convert = [&](const float& InValue) -> uint16
+	{
+		const double DoubleValue = ((double)InValue - (double)InMin) * InScale + InOffset;
+		return FMath::RoundToInt(DoubleValue);
+	};
+
+	TransposeAndConvertScalar(InData, InNumRows, InRowSize, OutData, InOutRowStride, Convert);
+}
+
+void
+FHoudiniDataConversion::ConvertHeightfieldToLandscapeLayer(
+	const float* InData, const int32& InNumRows, const int32& InRowSize, uint8* OutData, const int32& InOutRowStride,
+	const float& InMin, const float& InMax, const double& InScale)
+{
+	auto Convert = [&](const float& InValue) -> uint8
+	{
+		const double DoubleValue = ((double)FMath::Clamp(InValue, InMin, InMax) - (double)InMin) * InScale;
+		return FMath::RoundToInt(DoubleValue);
+	};
+
+	TransposeAndConvertBlocked(InData, InNumRows, InRowSize, OutData, InOutRowStride, Convert);
+}
+
+void
+FHoudiniDataConversion::ConvertHeightfieldToLandscapeLayerScalar(
+	const float* InData, const int32& InNumRows, const int32& InRowSize, uint8* OutData, const int32& InOutRowStride,
+	const float& InMin, const float& InMax, const double& InScale)
+{
+	auto Convert = [&](const float& InValue) -> uint8
+	{
+		const double DoubleValue = ((double)FMath::Clamp(InValue, InMin, InMax) - (double)InMin) * InScale;
+		return FMath::RoundToInt(DoubleValue);
+	};
+
+	TransposeAndConvertScalar(InData, InNumRows, InRowSize, OutData, InOutRowStride, Convert);
+}
+
+void
+FHoudiniDataConversion::ConvertLandscapeHeightsToHeightfield(
+	const uint16* InData, const int32& InNumRows, const int32& InRowSize, float* OutData, const int32& InOutRowStride,
+	const double& InCenter, const double& InScale, const double& InOffset)
+{
+	auto Convert = [&](const uint16& InValue) -> float
+	{
+		return (float)(((double)InValue - InCenter) * InScale + InOffset);
+	};
+
+	TransposeAndConvertBlocked(InData, InNumRows, InRowSize, OutData, InOutRowStride, Convert);
+}
+
+void
+FHoudiniDataConversion::ConvertLandscapeHeightsToHeightfieldScalar(
+	const uint16* InData, const int32& InNumRows, const int32& InRowSize, float* OutData, const int32& InOutRowStride,
+	const double& InCenter, const double& InScale, const double& InOffset)
+{
+	auto Convert = [&](const uint16& InValue) -> float
+	{
+		return (float)(((double)InValue - InCenter) * InScale + InOffset);
+	};
+
+	TransposeAndConvertScalar(InData, InNumRows, InRowSize, OutData, InOutRowStride, Convert);
+}
+
+void
+FHoudiniDataConversion::ConvertLandscapeLayerToHeightfield(
+	const uint8* InData, const int32& InNumRows, const int32& InRowSize, float* OutData, const int32& InOutRowStride,
+	const uint8& InIntMin, const float& InScale, const float& InMin)
+{
+	auto Convert = [&](const uint8& InValue) -> float
+	{
+		return (float)(((double)InValue - (double)InIntMin) * InScale + InMin);
+	};
+
+	TransposeAndConvertBlocked(InData, InNumRows, InRowSize, OutData, InOutRowStride, Convert);
+}
+
+void
+FHoudiniDataConversion::ConvertLandscapeLayerToHeightfieldScalar(
+	const uint8* InData, const int32& InNumRows, const int32& InRowSize, float* OutData, const int32& InOutRowStride,
+	const uint8& InIntMin, const float& InScale, const float& InMin)
+{
+	auto Convert = [&](const uint8& InValue) -> float
+	{
+		return (float)(((double)InValue - (double)InIntMin) * InScale + InMin);
+	};
+
+	TransposeAndConvertScalar(InData, InNumRows, InRowSize, OutData, InOutRowStride, Convert);
+}
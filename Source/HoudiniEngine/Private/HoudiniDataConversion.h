@@ -0,0 +1,108 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+// Bulk conversion kernels from Houdini's to Unreal's conventions, shared by the translators.
+// They use Unreal's vector intrinsics (SSE on x64, NEON on ARM) when available, the *Scalar variants
+// are the reference implementations and produce exactly the same results.
+// Unless specified, the output can be the same buffer as the input.
+struct HOUDINIENGINE_API FHoudiniDataConversion
+{
+	// Converts InCount float3 from Houdini's to Unreal's coordinate system: swaps Y and Z, and multiplies by InScale.
+	// OutData can be an array of FVector.
+	static void SwizzleAndScaleFloat3(const float* InData, float* OutData, const int32& InCount, const float& InScale);
+	static void SwizzleAndScaleFloat3Scalar(const float* InData, float* OutData, const int32& InCount, const float& InScale);
+
+	// Gathers the float3 at InIndices (InData[Index * 3]) into OutData, then converts them like SwizzleAndScaleFloat3.
+	// Indices outside of InData (InDataNum floats) produce a zero vector. Returns the number of invalid indices.
+	// OutData can be an array of FVector, but can't be the same buffer as the input.
+	static int32 GatherSwizzleAndScaleFloat3(
+		const float* InData, const int32& InDataNum, const int32* InIndices, float* OutData, const int32& InCount, const float& InScale);
+
+	// Flips the V coordinate (V = 1 - V) of InCount float2 UVs. OutData can be an array of FVector2D.
+	static void FlipUVs(const float* InData, float* OutData, const int32& InCount);
+	static void FlipUVsScalar(const float* InData, float* OutData, const int32& InCount);
+
+	// Quantizes InCount colors (InTupleSize >= 3 floats per color) to FColor, like FLinearColor::ToFColor(false).
+	// If InAlphas isn't null, it is used for the alpha, otherwise the 4th component is used or 1 if InTupleSize is 3.
+	static void ConvertColors(const float* InColors, const int32& InTupleSize, const float* InAlphas, FColor* OutColors, const int32& InCount);
+	static void ConvertColorsScalar(const float* InColors, const int32& InTupleSize, const float* InAlphas, FColor* OutColors, const int32& InCount);
+
+	// Converts HAPI transforms to Unreal's coordinate system, like FHoudiniEngineUtils::TranslateHapiTransform.
+	static void ConvertHapiTransforms(const HAPI_Transform* InTransforms, FTransform* OutTransforms, const int32& InCount);
+	static void ConvertHapiTransformsScalar(const HAPI_Transform* InTransforms, FTransform* OutTransforms, const int32& InCount);
+
+	// Landscape conversion kernels.
+	// They transpose a InNumRows x InRowSize grid (InData[Row * InRowSize + Col]) while converting its values,
+	// writing OutData[Col * InOutRowStride + Row], as heightfields and landscapes have swapped X/Y.
+	// The values use the same double precision math as the *Scalar variants, so the output is identical, 
+	// but the grid is processed in cache sized blocks on multiple threads.
+
+	// Converts Houdini heightfield values to Unreal landscape heights: round((Value - InMin) * InScale + InOffset).
+	static void ConvertHeightfieldToLandscapeHeights(
+		const float* InData, const int32& InNumRows, const int32& InRowSize, uint16* OutData, const int32& InOutRowStride,
+		const float& InMin, const double& InScale, const double& InOffset);
+	static void ConvertHeightfieldToLandscapeHeightsScalar(
+		const float* InData, const int32& InNumRows, const int32& InRowSize, uint16* OutData, const int32& InOutRowStride,
+		const float& InMin, const double& InScale, const double& InOffset);
+
+	// Converts Houdini heightfield mask values to Unreal landscape layer weights: round((Clamp(Value, InMin, InMax) - InMin) * InScale).
+	static void ConvertHeightfieldToLandscapeLayer(
+		const float* InData, const int32& InNumRows, const int32& InRowSize, uint8* OutData, const int32& InOutRowStride,
+		const float& InMin, const float& InMax, const double& InScale);
+	static void ConvertHeightfieldToLandscapeLayerScalar(
+		const float* InData, const int32& InNumRows, const int32& InRowSize, uint8* OutData, const int32& InOutRowStride,
+		const float& InMin, const float& InMax, const double& InScale);
+
+	// Converts Unreal landscape heights to Houdini heightfield values: (Value - InCenter) * InScale + InOffset.
+	static void ConvertLandscapeHeightsToHeightfield(
+		const uint16* InData, const int32& InNumRows, const int32& InRowSize, float* OutData, const int32& InOutRowStride,
+		const double& InCenter, const double& InScale, const double& InOffset);
+	static void ConvertLandscapeHeightsToHeightfieldScalar(
+		const uint16* InData, const int32& InNumRows, const int32& InRowSize, float* OutData, const int32& InOutRowStride,
+		const double& InCenter, const double& InScale, const double& InOffset);
+
+	// Converts Unreal landscape layer weights to Houdini heightfield mask values: (Value - InIntMin) * InScale + InMin.
+	static void ConvertLandscapeLayerToHeightfield(
+		const uint8* InData, const int32& InNumRows, const int32& InRowSize, float* OutData, const int32& InOutRowStride,
+		const uint8& InIntMin, const float& InScale, const float& InMin);
+	static void ConvertLandscapeLayerToHeightfieldScalar(
+		const uint8* InData, const int32& InNumRows, const int32& InRowSize, float* OutData, const int32& InOutRowStride,
+		const uint8& InIntMin, const float& InScale, const float& InMin);
+
+	// Fixes the winding order of InNumTriangles triangles, by swapping their 2nd and 3rd elements ({0, 2, 1}).
+	// Works on indices as well as per triangle vertex attributes.
+	template<typename TYPE>
+	static void RewindTriangles(TYPE* InOutData, const int32& InNumTriangles)
+	{
+		for (int32 TriIdx = 0; TriIdx < InNumTriangles; ++TriIdx)
+			Swap(InOutData[TriIdx * 3 + 1], InOutData[TriIdx * 3 + 2]);
+	}
+};
@@ -28,11 +28,14 @@
 #include "HoudiniEnginePrivatePCH.h"
 
 #include "HoudiniApi.h"
+#include "HoudiniApiRecorder.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineScheduler.h"
 #include "HoudiniEngineManager.h"
+#include "HoudiniSharedInputNodeRegistry.h"
+#include "HoudiniMaterialTranslator.h"
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
@@ -323,6 +326,9 @@ FHoudiniEngine::ShutdownModule()
 		HoudiniEngineManager = nullptr;
 	}
 
+	// Restore the HAPI function pointers if a recording or replay is still active
+	FHoudiniApiRecorder::Reset();
+
 	// Perform HAPI finalization.
 	if ( FHoudiniApi::IsHAPIInitialized() )
 	{
@@ -350,6 +356,13 @@ FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
 }
 
+void
+FHoudiniEngine::InterruptTask(const FGuid& InHapiGUID)
+{
+	if (HoudiniEngineScheduler)
+		HoudiniEngineScheduler->InterruptTask(InHapiGUID);
+}
+
 void
 FHoudiniEngine::AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo)
 {
@@ -778,6 +791,9 @@ FHoudiniEngine::InitializeHAPISession()
 	// Let HAPI know we are running inside UE4
 	FHoudiniApi::SetServerEnvString(&Session, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
 
+	// Images cached for a previous session's node ids can't be reused
+	FHoudiniMaterialTranslator::ClearTextureExtractionCache();
+
 	if (bEnableSessionSync)
 	{
 		// Set the session sync infos if needed
@@ -801,6 +817,10 @@ FHoudiniEngine::OnSessionLost()
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Lost);
 
+	// The shared input nodes and cached texture images were lost with the session
+	FHoudiniSharedInputNodeRegistry::Reset();
+	FHoudiniMaterialTranslator::ClearTextureExtractionCache();
+
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
 
@@ -835,6 +855,10 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
+
+	// The shared input nodes and cached texture images belonged to the stopped session
+	FHoudiniSharedInputNodeRegistry::Reset();
+	FHoudiniMaterialTranslator::ClearTextureExtractionCache();
 	bEnableSessionSync = false;
 
 	HoudiniEngineManager->StopHoudiniTicking();
@@ -1266,6 +1290,16 @@ FHoudiniEngine::GetPDGCommandletStatus()
 	return EHoudiniBGEOCommandletStatus::NotStarted;
 }
 
+bool
+FHoudiniEngine::GetPDGEventStats(FHoudiniPDGEventStats& OutStats)
+{
+	if (!HoudiniEngineManager)
+		return false;
+
+	OutStats = HoudiniEngineManager->GetPDGEventStats();
+	return true;
+}
+
 void
 FHoudiniEngine::UnregisterPostEngineInitCallback()
 {
@@ -31,6 +31,8 @@
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniRuntimeSettings.h"
 
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Modules/ModuleInterface.h"
 
 class FRunnableThread;
@@ -43,6 +45,7 @@ class UMaterial;
 struct FSlateDynamicImageBrush;
 
 enum class EHoudiniBGEOCommandletStatus : uint8;
+struct FHoudiniPDGEventStats;
 
 UENUM()
 enum class EHoudiniSessionStatus : int8
@@ -148,6 +151,14 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		// Register task for execution.
 		virtual void AddTask(const FHoudiniEngineTask & InTask);
+		// Request a queued or running cook task to be interrupted.
+		virtual void InterruptTask(const FGuid& InHapiGUID);
+		// Track the cooks made outside of the scheduler (synchronous game thread cooks and PDG cooks).
+		// HAPI_Interrupt cancels every cook of the session, so the scheduler doesn't interrupt its cooks while one of these runs.
+		void BeginForegroundCook() { ForegroundCookCount.Increment(); };
+		void EndForegroundCook() { ForegroundCookCount.Decrement(); };
+		void SetPDGCooking(const bool& bInPDGCooking) { bPDGCooking = bInPDGCooking; };
+		bool IsCookingOutsideScheduler() const { return ForegroundCookCount.GetValue() > 0 || bPDGCooking; };
 		// Register task info.
 		virtual void AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo);
 		// Remove task info.
@@ -236,6 +247,9 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		EHoudiniBGEOCommandletStatus GetPDGCommandletStatus();
 
+		// Get the PDG event backlog / drain rate statistics, returns false if the manager is not running
+		bool GetPDGEventStats(FHoudiniPDGEventStats& OutStats);
+
 		FHoudiniEngineManager* GetHoudiniEngineManager() { return HoudiniEngineManager; }
 
 		const FHoudiniEngineManager* GetHoudiniEngineManager() const { return HoudiniEngineManager; }
@@ -265,6 +279,12 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Map of task statuses.
 		TMap<FGuid, FHoudiniEngineTaskInfo> TaskInfos;
 
+		// Number of synchronous cooks currently waited on by the game thread.
+		FThreadSafeCounter ForegroundCookCount;
+
+		// Indicates that a PDG graph of the session is cooking.
+		FThreadSafeBool bPDGCooking;
+
 		// Thread used to execute the scheduler.
 		FRunnableThread * HoudiniEngineSchedulerThread;
 		// Scheduler used to schedule HAPI instantiation and cook tasks. 
@@ -0,0 +1,150 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineCookWaiter.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineCookWaitSpinTime(
+	TEXT("HoudiniEngine.CookWaitSpinTime"),
+	0.002f,
+	TEXT("Time (in seconds) spent polling the cook state without sleeping when waiting for a cook to finish.\n")
+	TEXT("0.002: Default\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineCookWaitMinSleep(
+	TEXT("HoudiniEngine.CookWaitMinSleep"),
+	0.001f,
+	TEXT("Minimum time (in seconds) to sleep between two polls of the cook state, once the spin time has elapsed.\n")
+	TEXT("The sleep time then doubles after each poll, up to HoudiniEngine.CookWaitMaxSleep.\n")
+	TEXT("0.001: Default\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineCookWaitMaxSleep(
+	TEXT("HoudiniEngine.CookWaitMaxSleep"),
+	0.1f,
+	TEXT("Maximum time (in seconds) to sleep between two polls of the cook state.\n")
+	TEXT("0.1: Default\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLogCookTimes(
+	TEXT("HoudiniEngine.LogCookTimes"),
+	0,
+	TEXT("If enabled, the cook time and wait overhead of every blocking node cook will be logged.\n")
+	TEXT("0: Disabled (Default)\n")
+	TEXT("1: Enabled\n")
+);
+
+FHoudiniEngineCookWaiter::FHoudiniEngineCookWaiter()
+	: StartTime(FPlatformTime::Seconds())
+	, FinishTime(0.0)
+	, SleepTime(0.0)
+	, LastSleepTime(0.0)
+	, PollCount(0)
+{}
+
+bool
+FHoudiniEngineCookWaiter::PollCookState(int32& OutStatus, HAPI_Result& OutResult)
+{
+	PollCount++;
+
+	OutStatus = HAPI_STATE_STARTING_COOK;
+	HOUDINI_CHECK_ERROR_GET(&OutResult, FHoudiniApi::GetStatus(
+		FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &OutStatus));
+
+	if (OutStatus > HAPI_STATE_MAX_READY_STATE)
+		return false;
+
+	FinishTime = FPlatformTime::Seconds();
+	return true;
+}
+
+void
+FHoudiniEngineCookWaiter::Wait()
+{
+	// Spin for a short while, most small cooks are finished by then
+	if (FPlatformTime::Seconds() - StartTime < CVarHoudiniEngineCookWaitSpinTime.GetValueOnAnyThread())
+	{
+		FPlatformProcess::SleepNoStats(0.0f);
+		return;
+	}
+
+	// Then back off exponentially
+	const float MinSleep = FMath::Max(CVarHoudiniEngineCookWaitMinSleep.GetValueOnAnyThread(), 0.0f);
+	const float MaxSleep = FMath::Max(CVarHoudiniEngineCookWaitMaxSleep.GetValueOnAnyThread(), MinSleep);
+	LastSleepTime = LastSleepTime <= 0.0 ? MinSleep : FMath::Min(LastSleepTime * 2.0, (double)MaxSleep);
+
+	FPlatformProcess::SleepNoStats(LastSleepTime);
+	SleepTime += LastSleepTime;
+}
+
+bool
+FHoudiniEngineCookWaiter::GetCookProgress(int32& OutCurrentCount, int32& OutTotalCount)
+{
+	OutCurrentCount = 0;
+	OutTotalCount = 0;
+
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetCookingCurrentCount(FHoudiniEngine::Get().GetSession(), &OutCurrentCount))
+		return false;
+
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetCookingTotalCount(FHoudiniEngine::Get().GetSession(), &OutTotalCount))
+		return false;
+
+	return OutTotalCount > 0;
+}
+
+FString
+FHoudiniEngineCookWaiter::GetCookStateWithProgress()
+{
+	const FString CookState = FHoudiniEngineUtils::GetCookState();
+
+	int32 CurrentCount = 0;
+	int32 TotalCount = 0;
+	if (!GetCookProgress(CurrentCount, TotalCount))
+		return CookState;
+
+	return FString::Printf(TEXT("(%d/%d) %s"), CurrentCount, TotalCount, *CookState);
+}
+
+FString
+FHoudiniEngineCookWaiter::GetTimingSummary() const
+{
+	const double EndTime = FinishTime > 0.0 ? FinishTime : FPlatformTime::Seconds();
+	return FString::Printf(
+		TEXT("cooked in %.3fs - %d polls, %.3fs asleep, wait overhead <= %.3fs"),
+		EndTime - StartTime, PollCount, SleepTime, LastSleepTime);
+}
+
+bool
+FHoudiniEngineCookWaiter::ShouldLogCookTimes()
+{
+	return CVarHoudiniEngineLogCookTimes.GetValueOnAnyThread() != 0;
+}
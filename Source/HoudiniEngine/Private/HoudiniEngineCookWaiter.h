@@ -0,0 +1,73 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+// Helper used to wait for the completion of a HAPI cook.
+// Instead of sleeping a fixed amount of time between each poll of the session's cook state,
+// it spins for a short while, then sleeps with an exponential backoff between a minimum
+// (floor) and a maximum sleep time. It also measures the cook time and the time spent waiting.
+struct HOUDINIENGINE_API FHoudiniEngineCookWaiter
+{
+	FHoudiniEngineCookWaiter();
+
+	// Polls the session's cook state once.
+	// Returns true when the cook is finished, OutStatus then contains the final HAPI_State.
+	bool PollCookState(int32& OutStatus, HAPI_Result& OutResult);
+
+	// Waits before the next poll.
+	void Wait();
+
+	// Gets the progress of the current cook from HAPI's cooking counts.
+	static bool GetCookProgress(int32& OutCurrentCount, int32& OutTotalCount);
+
+	// Returns the cook state string, prefixed by the cook progress if available.
+	static FString GetCookStateWithProgress();
+
+	// Returns a short summary of the measured cook time and wait overhead.
+	FString GetTimingSummary() const;
+
+	// Returns true if cook timings should be logged.
+	static bool ShouldLogCookTimes();
+
+	// Time at which we started waiting.
+	double StartTime;
+
+	// Time at which the cook was detected as finished.
+	double FinishTime;
+
+	// Total time spent sleeping between polls.
+	double SleepTime;
+
+	// Duration of the last sleep, the cook could have finished at any point during it.
+	double LastSleepTime;
+
+	// Number of times the cook state was polled.
+	int32 PollCount;
+};
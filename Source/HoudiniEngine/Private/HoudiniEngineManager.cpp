@@ -38,6 +38,8 @@
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
 #include "HoudiniSplineTranslator.h"
+#include "HoudiniMaterialTranslator.h"
+#include "HoudiniSharedInputNodeRegistry.h"
 
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
@@ -63,6 +65,27 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineTickTimeLimit(
 	TEXT("1.0: Default\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInterruptStaleCooks(
+	TEXT("HoudiniEngine.InterruptStaleCooks"),
+	1,
+	TEXT("When an HDA is modified while it is cooking, interrupt the stale cook and immediately cook the newest state.\n")
+	TEXT("Interrupts apply to the whole session, so they are deferred while a synchronous or PDG cook is running.\n")
+	TEXT("0: Disabled, the stale cook finishes and its results are processed before recooking\n")
+	TEXT("1: Enabled (default)\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineInterruptStaleCooksDebounce(
+	TEXT("HoudiniEngine.InterruptStaleCooksDebounce"),
+	0.1f,
+	TEXT("Time (in seconds) a change must have been pending on a cooking HDA before its cook is interrupted.\n")
+	TEXT("<= 0.0: Interrupt as soon as a change is detected\n")
+	TEXT("0.1: Default\n")
+);
+
+// Maximum number of cooks interrupted in a row for a given HDA,
+// so continuously changing inputs still regularly produce results
+static const int32 HoudiniMaxConsecutiveCookInterrupts = 10;
+
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
@@ -75,6 +98,8 @@ FHoudiniEngineManager::FHoudiniEngineManager()
 	, SyncedUnrealViewportLookatPosition(FVector::ZeroVector)
 	, ZeroOffsetValue(0.f)
 	, bOffsetZeroed(false)
+	, NumInterruptedCooks(0)
+	, NumCompletedCooks(0)
 {
 
 }
@@ -335,6 +360,9 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		}
 	}
 
+	// Forget the cook interrupts of destroyed HACs
+	PruneCookInterrupts();
+
 	// Handle Asset delete
 	if (FHoudiniEngineRuntime::IsInitialized())
 	{
@@ -346,6 +374,9 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete);
 			if (StartTaskAssetDelete(NodeIdToDelete, HapiDeletionGUID, bShouldDeleteParent))
 			{
+				// Input proxies release their shared input node when deleted
+				FHoudiniSharedInputNodeRegistry::ReleaseProxy(NodeIdToDelete);
+
 				FHoudiniEngineRuntime::Get().RemoveNodeIdPendingDeleteAt(DeleteIdx);
 				if (bShouldDeleteParent)
 					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete);
@@ -502,7 +533,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 			FGuid TaskGuid;
 			UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
-			if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), TaskGuid))
+			if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), GetTaskPriority(HAC), TaskGuid))
 			{
 				// Update the HAC's state
 				HAC->AssetState = EHoudiniAssetState::Instantiating;
@@ -552,7 +583,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if (IsCookingEnabledForHoudiniAsset(HAC))
 			{
 				FGuid TaskGUID = HAC->GetHapiGUID();
-				if ( StartTaskAssetCooking(HAC->GetAssetId(), HAC->GetDisplayName(), TaskGUID) )
+				if ( StartTaskAssetCooking(HAC->GetAssetId(), HAC->GetDisplayName(), GetTaskPriority(HAC), TaskGUID) )
 				{
 					// Updates the HAC's state
 					HAC->AssetState = EHoudiniAssetState::Cooking;
@@ -574,6 +605,10 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 		case EHoudiniAssetState::Cooking:
 		{
+			// Latest state wins: don't wait for a cook whose results are already outdated
+			if (HAC->NeedUpdate())
+				InterruptStaleCook(HAC);
+
 			EHoudiniAssetState NewState = EHoudiniAssetState::Cooking;
 			bool state = UpdateCooking(HAC, NewState);
 			if (state)
@@ -694,7 +729,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 
 bool 
-FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, FGuid& OutTaskGUID)
+FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, const EHoudiniEngineTaskPriority& Priority, FGuid& OutTaskGUID)
 {
 	// Make sure we have a valid session before attempting anything
 	if (!FHoudiniEngine::Get().GetSession())
@@ -753,6 +788,7 @@ FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset,
 	//Task.bLoadedComponent = bLocalLoadedComponent;
 	Task.AssetLibraryId = AssetLibraryId;
 	Task.AssetHapiName = PickedAssetName;
+	Task.Priority = Priority;
 
 	// Add the task to the stack
 	FHoudiniEngine::Get().AddTask(Task);
@@ -921,7 +957,7 @@ FHoudiniEngineManager::UpdateInstantiating(UHoudiniAssetComponent* HAC, EHoudini
 }
 
 bool
-FHoudiniEngineManager::StartTaskAssetCooking(const HAPI_NodeId& AssetId, const FString& DisplayName, FGuid& OutTaskGUID)
+FHoudiniEngineManager::StartTaskAssetCooking(const HAPI_NodeId& AssetId, const FString& DisplayName, const EHoudiniEngineTaskPriority& Priority, FGuid& OutTaskGUID)
 {
 	// Make sure we have a valid session before attempting anything
 	if (!FHoudiniEngine::Get().GetSession())
@@ -942,11 +978,83 @@ FHoudiniEngineManager::StartTaskAssetCooking(const HAPI_NodeId& AssetId, const F
 	FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, OutTaskGUID);
 	Task.ActorName = DisplayName;
 	Task.AssetId = AssetId;
+	Task.Priority = Priority;
 	FHoudiniEngine::Get().AddTask(Task);
 
 	return true;
 }
 
+void
+FHoudiniEngineManager::InterruptStaleCook(UHoudiniAssetComponent* HAC)
+{
+	check(HAC);
+
+	if (CVarHoudiniEngineInterruptStaleCooks.GetValueOnGameThread() <= 0)
+		return;
+
+	const FGuid& TaskGUID = HAC->HapiGUID;
+	if (!TaskGUID.IsValid() || InterruptedCookTasks.Contains(TaskGUID))
+		return;
+
+	// Let a cook complete once in a while if the HAC keeps being modified
+	const int32* ConsecutiveInterrupts = ConsecutiveCookInterrupts.Find(HAC);
+	if (ConsecutiveInterrupts && *ConsecutiveInterrupts >= HoudiniMaxConsecutiveCookInterrupts)
+		return;
+
+	// Wait for the debounce window to gather further changes before interrupting
+	const double Now = FPlatformTime::Seconds();
+	const double FirstChangeTime = StaleCookTimes.FindOrAdd(TaskGUID, Now);
+	if (Now - FirstChangeTime < CVarHoudiniEngineInterruptStaleCooksDebounce.GetValueOnGameThread())
+		return;
+
+	StaleCookTimes.Remove(TaskGUID);
+	InterruptedCookTasks.Add(TaskGUID);
+	FHoudiniEngine::Get().InterruptTask(TaskGUID);
+
+	HOUDINI_LOG_MESSAGE(TEXT("   %s was modified while cooking - interrupting the stale cook."), *HAC->GetDisplayName());
+}
+
+void
+FHoudiniEngineManager::PruneCookInterrupts()
+{
+	for (auto It = ConsecutiveCookInterrupts.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	if (StaleCookTimes.Num() <= 0 && InterruptedCookTasks.Num() <= 0)
+		return;
+
+	// Only keep the entries of the tasks still owned by a registered HAC
+	TSet<FGuid> LiveTaskGUIDs;
+	if (FHoudiniEngineRuntime::IsInitialized())
+	{
+		const int32 RegisteredCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+		for (int32 nIdx = 0; nIdx < RegisteredCount; nIdx++)
+		{
+			UHoudiniAssetComponent* CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(nIdx);
+			if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast() || CurrentComponent->IsPendingKill())
+				continue;
+
+			if (CurrentComponent->HapiGUID.IsValid())
+				LiveTaskGUIDs.Add(CurrentComponent->HapiGUID);
+		}
+	}
+
+	for (auto It = StaleCookTimes.CreateIterator(); It; ++It)
+	{
+		if (!LiveTaskGUIDs.Contains(It.Key()))
+			It.RemoveCurrent();
+	}
+
+	for (auto It = InterruptedCookTasks.CreateIterator(); It; ++It)
+	{
+		if (!LiveTaskGUIDs.Contains(*It))
+			It.RemoveCurrent();
+	}
+}
+
 bool
 FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetState& NewState)
 {
@@ -960,10 +1068,15 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 	FString DisplayName = HAC->GetDisplayName();
 
 	// Get the current task's progress
+	// The HAC's task GUID is invalidated once the task has finished
+	const FGuid TaskGUID = HAC->HapiGUID;
 	FHoudiniEngineTaskInfo TaskInfo;
 	if (!UpdateTaskStatus(HAC->HapiGUID, TaskInfo)
 		|| TaskInfo.TaskType != EHoudiniEngineTaskType::AssetCooking)
 	{
+		StaleCookTimes.Remove(TaskGUID);
+		InterruptedCookTasks.Remove(TaskGUID);
+
 		// Couldnt get a valid task info
 		HOUDINI_LOG_ERROR(TEXT("    %s Failed to cook - invalid task"), *DisplayName);
 		NewState = EHoudiniAssetState::None;
@@ -1013,6 +1126,24 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 	// If the task is still in progress, return now
 	if (!bUpdateState)
 		return false;
+
+	StaleCookTimes.Remove(TaskGUID);
+	if (InterruptedCookTasks.Remove(TaskGUID) > 0
+		&& TaskInfo.TaskState == EHoudiniEngineTaskState::Aborted)
+	{
+		// The cook was interrupted because the HAC changed while cooking:
+		// discard the stale results and go straight back to PreCook to cook the newest state.
+		NumInterruptedCooks++;
+		ConsecutiveCookInterrupts.FindOrAdd(HAC)++;
+		HOUDINI_LOG_MESSAGE(TEXT("   %s Cook interrupted - recooking with the latest changes (%d interrupted / %d completed cooks)."),
+			*DisplayName, NumInterruptedCooks, NumCompletedCooks);
+
+		NewState = EHoudiniAssetState::PreCook;
+		return true;
+	}
+
+	NumCompletedCooks++;
+	ConsecutiveCookInterrupts.Remove(HAC);
 	   
 	// Handle PostCook
 	NewState = EHoudiniAssetState::PostCook;
@@ -1275,6 +1406,9 @@ FHoudiniEngineManager::StartTaskAssetDelete(const HAPI_NodeId& InNodeId, FGuid&
 	if (InNodeId < 0)
 		return false;
 
+	// The asset's material nodes are deleted with it, their ids may be reused by new nodes
+	FHoudiniMaterialTranslator::RemoveTextureExtractionCacheEntries(InNodeId);
+
 	// Get the Asset's NodeInfo
 	HAPI_NodeInfo AssetNodeInfo;
 	FHoudiniApi::NodeInfo_Init(&AssetNodeInfo);
@@ -1386,6 +1520,24 @@ FHoudiniEngineManager::IsCookingEnabledForHoudiniAsset(UHoudiniAssetComponent* H
 	return false;
 }
 
+EHoudiniEngineTaskPriority
+FHoudiniEngineManager::GetTaskPriority(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return EHoudiniEngineTaskPriority::Normal;
+
+#if WITH_EDITOR
+	if (HAC->IsOwnerSelected())
+		return EHoudiniEngineTaskPriority::High;
+#endif
+
+	AActor* Owner = HAC->GetOwner();
+	if (Owner && Owner->WasRecentlyRendered())
+		return EHoudiniEngineTaskPriority::Normal;
+
+	return EHoudiniEngineTaskPriority::Low;
+}
+
 void 
 FHoudiniEngineManager::BuildStaticMeshesForAllHoudiniStaticMeshes(UHoudiniAssetComponent* HAC)
 {
@@ -42,6 +42,7 @@ struct FHoudiniEngineTaskInfo;
 struct FGuid;
 
 enum class EHoudiniAssetState : uint8;
+enum class EHoudiniEngineTaskPriority : uint8;
 
 class FHoudiniEngineManager
 {
@@ -80,6 +81,12 @@ public:
 	}
 
 	EHoudiniBGEOCommandletStatus GetPDGCommandletStatus() { return PDGManager.UpdateAndGetBGEOCommandletStatus(); }
+
+	const FHoudiniPDGEventStats& GetPDGEventStats() const { return PDGManager.GetPDGEventStats(); }
+
+	// Number of cooks that have been interrupted / have completed since the manager was created
+	int32 GetNumInterruptedCooks() const { return NumInterruptedCooks; }
+	int32 GetNumCompletedCooks() const { return NumCompletedCooks; }
 	
 	
 protected:
@@ -90,7 +97,7 @@ protected:
 
 	// Start a task to instantiate the given HoudiniAsset
 	// Return true if the task was successfully created
-	bool StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, FGuid& OutTaskGUID);
+	bool StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, const EHoudiniEngineTaskPriority& Priority, FGuid& OutTaskGUID);
 
 	// Updates progress of the instantiation task
 	// Returns true if a state change should be made
@@ -98,12 +105,19 @@ protected:
 
 	// Start a task to instantiate the Houdini Asset with the given node Id
 	// Returns true if the task was successfully created
-	bool StartTaskAssetCooking(const HAPI_NodeId& AssetId, const FString& DisplayName, FGuid& OutTaskGUID);
+	bool StartTaskAssetCooking(const HAPI_NodeId& AssetId, const FString& DisplayName, const EHoudiniEngineTaskPriority& Priority, FGuid& OutTaskGUID);
 
 	// Updates progress of the cooking task
 	// Returns true if a state change should be made
 	bool UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetState& NewState);
 
+	// Interrupts the HAC's current cook if it has been modified since the cook started,
+	// once the changes are older than the debounce window.
+	void InterruptStaleCook(UHoudiniAssetComponent* HAC);
+
+	// Removes the cook interruption bookkeeping of HACs that have been destroyed or unregistered.
+	void PruneCookInterrupts();
+
 	// Called to update template components. 
 	bool PreCookTemplate(UHoudiniAssetComponent* HAC);
 
@@ -127,6 +141,10 @@ protected:
 
 	bool IsCookingEnabledForHoudiniAsset(UHoudiniAssetComponent* HAC);
 
+	// Returns the scheduling priority for the HAC's tasks:
+	// selected actors first, then visible actors, then the others.
+	static EHoudiniEngineTaskPriority GetTaskPriority(UHoudiniAssetComponent* HAC);
+
 	// Syncs the houdini viewport to Unreal's viewport
 	// Returns true if the Houdini viewport has been modified
 	bool SyncHoudiniViewportToUnreal();
@@ -179,4 +197,17 @@ private:
 
 	// Indicates which HACs disable auto-saving
 	TSet<const UHoudiniAssetComponent*> DisableAutoSavingHACs;
+
+	// Time at which a change was first detected on a HAC while its cook task was running
+	TMap<FGuid, double> StaleCookTimes;
+
+	// Cook tasks for which an interrupt has been requested
+	TSet<FGuid> InterruptedCookTasks;
+
+	// Number of consecutive interrupted cooks per HAC
+	TMap<TWeakObjectPtr<UHoudiniAssetComponent>, int32> ConsecutiveCookInterrupts;
+
+	// Cook interruption metrics
+	int32 NumInterruptedCooks;
+	int32 NumCompletedCooks;
 };
\ No newline at end of file
@@ -30,41 +30,36 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
+#include "HoudiniEngineCookWaiter.h"
 
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+#include "HAL/Event.h"
+#include "Misc/ScopeLock.h"
 
 const float
 FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
 
+FHoudiniEngineTaskStats::FHoudiniEngineTaskStats()
+	: Count(0)
+	, TotalQueueTime(0.0)
+	, MaxQueueTime(0.0)
+	, TotalRunTime(0.0)
+	, MaxRunTime(0.0)
+{}
+
 FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-	: Tasks(nullptr)
-	, PositionWrite(0u)
-	, PositionRead(0u)
+	: WakeUpEvent(nullptr)
 	, bStopping(false)
 {
-	//  Make sure size is power of two.
-	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
-
-	if (TaskCount)
-	{
-		// Allocate buffer to store all tasks.
-		Tasks = static_cast<FHoudiniEngineTask *>(FMemory::Malloc(TaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (Tasks)
-		{
-			// Zero memory.
-			FMemory::Memset(Tasks, 0x0, TaskCount * sizeof(FHoudiniEngineTask));
-		}
-	}
+	// Auto-reset event: a task added while we are busy keeps the event signaled.
+	WakeUpEvent = FPlatformProcess::GetSynchEventFromPool(false);
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-	if (TaskCount)
+	if (WakeUpEvent)
 	{
-		FMemory::Free(Tasks);
-		Tasks = nullptr;
+		FPlatformProcess::ReturnSynchEventToPool(WakeUpEvent);
+		WakeUpEvent = nullptr;
 	}
 }
 
@@ -190,11 +185,14 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	FHoudiniEngine::Get().AddTaskInfo(Task.HapiGUID, TaskInfo);
 
 	// We need to spin until instantiation is finished.
+	FHoudiniEngineCookWaiter CookWaiter;
 	while (true)
 	{
-		int Status = HAPI_STATE_STARTING_COOK;
-		HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
-			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
+		int32 Status = HAPI_STATE_STARTING_COOK;
+		if (CookWaiter.PollCookState(Status, Result))
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("HAPI Asynchronous Instantiation Finished for %s: %s."), *Task.ActorName, *CookWaiter.GetTimingSummary());
+		}
 
 		if (Status == HAPI_STATE_READY)
 		{
@@ -233,7 +231,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		{
 			// Reset update time.
 			LastUpdateTime = FPlatformTime::Seconds();
-			const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState();
+			const FString& CookStateMessage = FHoudiniEngineCookWaiter::GetCookStateWithProgress();
 
 			AddResponseMessageTaskInfo(
 				HAPI_RESULT_SUCCESS,
@@ -243,7 +241,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		}
 
 		// We want to yield.
-		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		CookWaiter.Wait();
 	}
 }
 
@@ -288,6 +286,18 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		return;
 	}
 
+	// The cook was interrupted before it could start
+	if (ConsumeInterruptRequest(Task.HapiGUID))
+	{
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_SUCCESS,
+			EHoudiniEngineTaskType::AssetCooking,
+			EHoudiniEngineTaskState::Aborted,
+			AssetId, Task, TEXT("Cook Interrupted"));
+
+		return;
+	}
+
 	// Default CookOptions
 	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
 	Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), AssetId, &CookOptions);
@@ -312,13 +322,53 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	double LastUpdateTime = FPlatformTime::Seconds();
 
 	// We need to spin until cooking is finished.
+	FHoudiniEngineCookWaiter CookWaiter;
+	bool bInterrupted = false;
+	bool bInterruptDeferred = false;
 	while (true)
 	{
+		// Interrupt the cook if its results are no longer needed,
+		// we still need to wait for the session to be ready afterwards.
+		// HAPI_Interrupt cancels every cook of the session: while a synchronous or a PDG cook
+		// is running, keep the request pending and let our cook finish instead.
+		if (!bInterrupted && HasInterruptRequest(Task.HapiGUID))
+		{
+			if (FHoudiniEngine::Get().IsCookingOutsideScheduler())
+			{
+				if (!bInterruptDeferred)
+				{
+					HOUDINI_LOG_MESSAGE(
+						TEXT("HAPI Asynchronous Cooking of %s (AssetId %d): interrupt deferred, another cook is running in the session."),
+						*Task.ActorName, Task.AssetId);
+					bInterruptDeferred = true;
+				}
+			}
+			else if (ConsumeInterruptRequest(Task.HapiGUID))
+			{
+				HOUDINI_LOG_MESSAGE(TEXT("HAPI Asynchronous Cooking Interrupted for %s (AssetId %d)."), *Task.ActorName, Task.AssetId);
+				FHoudiniApi::Interrupt(FHoudiniEngine::Get().GetSession());
+				bInterrupted = true;
+			}
+		}
+
 		int32 Status = HAPI_STATE_STARTING_COOK;
-		HOUDINI_CHECK_ERROR_GET( &Result, FHoudiniApi::GetStatus(
-			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
+		if (CookWaiter.PollCookState(Status, Result))
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("HAPI Asynchronous Cooking Finished for %s: %s."), *Task.ActorName, *CookWaiter.GetTimingSummary());
+		}
 
-		if (Status == HAPI_STATE_READY)
+		if (bInterrupted && Status <= HAPI_STATE_MAX_READY_STATE)
+		{
+			// The cook's results are stale, whatever its state
+			AddResponseMessageTaskInfo(
+				HAPI_RESULT_SUCCESS,
+				EHoudiniEngineTaskType::AssetCooking,
+				EHoudiniEngineTaskState::Aborted,
+				AssetId, Task, TEXT("Cook Interrupted"));
+
+			break;
+		}
+		else if (Status == HAPI_STATE_READY)
 		{
 			// Cooking has been successful.
 			AddResponseMessageTaskInfo(
@@ -353,7 +403,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 			LastUpdateTime = FPlatformTime::Seconds();
 
 			// Retrieve status string.
-			const FString & CookStateMessage = FHoudiniEngineUtils::GetCookState();
+			const FString & CookStateMessage = FHoudiniEngineCookWaiter::GetCookStateWithProgress();
 
 			AddResponseMessageTaskInfo(
 				HAPI_RESULT_SUCCESS,
@@ -363,7 +413,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		}
 
 		// We want to yield.
-		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		CookWaiter.Wait();
 	}
 }
 
@@ -410,79 +460,150 @@ FHoudiniEngineScheduler::AddResponseMessageTaskInfo(
 }
 
 void
-FHoudiniEngineScheduler::ProcessQueuedTasks()
+FHoudiniEngineScheduler::TaskDeleteQueuedAssets()
 {
-	while (!bStopping)
+	// Gather all the pending deletions, a node can be queued for deletion more than once.
+	TSet<HAPI_NodeId> NodesToDelete;
+	FHoudiniEngineTask Task;
+	while (DeletionQueue.Dequeue(Task))
 	{
-		while (true)
-		{
-			FHoudiniEngineTask Task;
+		PendingTaskCount.Decrement();
+		if (NodesToDelete.Contains(Task.AssetId))
+			continue;
 
-			{
-				FScopeLock ScopeLock(&CriticalSection);
+		NodesToDelete.Add(Task.AssetId);
+		RunTask(Task);
+	}
+}
 
-				// We have no tasks left.
-				if (PositionWrite == PositionRead)
-					break;
+bool
+FHoudiniEngineScheduler::DiscardTaskOnDeletedNode(const FHoudiniEngineTask & Task)
+{
+	if (Task.AssetId < 0)
+		return false;
 
-				// Retrieve task.
-				Task = Tasks[PositionRead];
-				PositionRead++;
+	{
+		FScopeLock ScopeLock(&DeletionCriticalSection);
+		const int64* DeletionSequence = QueuedDeletions.Find(Task.AssetId);
+		if (!DeletionSequence || *DeletionSequence < Task.Sequence)
+			return false;
+	}
 
-				// Wrap around if required.
-				PositionRead &= (TaskCount - 1);
-			}
+	// The node has been, or is about to be, deleted: running the task would target a node that no longer exists.
+	HOUDINI_LOG_MESSAGE(
+		TEXT("HAPI Asynchronous Task discarded for %s: AssetId %d has been deleted."),
+		*Task.ActorName, Task.AssetId);
 
-			bool bTaskProcessed = true;
+	AddResponseMessageTaskInfo(
+		HAPI_RESULT_FAILURE,
+		Task.TaskType,
+		EHoudiniEngineTaskState::FinishedWithFatalError,
+		Task.AssetId, Task, TEXT("Asset has been deleted."));
 
-			switch (Task.TaskType)
-			{
-				case EHoudiniEngineTaskType::AssetInstantiation:
-				{
-					TaskInstantiateAsset(Task);
-					break;
-				}
+	if (Task.TaskType == EHoudiniEngineTaskType::AssetCooking)
+		FinishInterruptibleTask(Task.HapiGUID);
 
-				case EHoudiniEngineTaskType::AssetCooking:
-				{
-					TaskCookAsset(Task);
-					break;
-				}
+	return true;
+}
 
-				case EHoudiniEngineTaskType::AssetDeletion:
-				{
-					TaskDeleteAsset(Task);
-					break;
-				}
+bool
+FHoudiniEngineScheduler::DequeueTask(FHoudiniEngineTask& OutTask)
+{
+	// Tasks for selected and visible actors are processed first.
+	// Tasks queued before a deletion of their node are discarded, wherever they are queued.
+	for (int32 Priority = 0; Priority < (int32)EHoudiniEngineTaskPriority::Low; Priority++)
+	{
+		while (TaskQueues[Priority].Dequeue(OutTask))
+		{
+			PendingTaskCount.Decrement();
+			if (!DiscardTaskOnDeletedNode(OutTask))
+				return true;
+		}
+	}
 
-				case EHoudiniEngineTaskType::AssetProcess:
-				{
-					TaskProccessAsset(Task);
-					break;
-				}
+	// Then delete all the pending nodes at once
+	if (!DeletionQueue.IsEmpty())
+		TaskDeleteQueuedAssets();
 
-				default:
-				{
-					bTaskProcessed = false;
-					break;
-				}
-			}
+	// And finally, the tasks for the other actors
+	while (TaskQueues[(int32)EHoudiniEngineTaskPriority::Low].Dequeue(OutTask))
+	{
+		PendingTaskCount.Decrement();
+		if (!DiscardTaskOnDeletedNode(OutTask))
+			return true;
+	}
+
+	return false;
+}
+
+void
+FHoudiniEngineScheduler::RunTask(const FHoudiniEngineTask & Task)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	switch (Task.TaskType)
+	{
+		case EHoudiniEngineTaskType::AssetInstantiation:
+		{
+			TaskInstantiateAsset(Task);
+			break;
+		}
 
-			if (!bTaskProcessed)
-				break;
+		case EHoudiniEngineTaskType::AssetCooking:
+		{
+			TaskCookAsset(Task);
+			FinishInterruptibleTask(Task.HapiGUID);
+			break;
 		}
 
-		if (FPlatformProcess::SupportsMultithreading())
+		case EHoudiniEngineTaskType::AssetDeletion:
 		{
-			// We want to yield for a bit.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			TaskDeleteAsset(Task);
+			break;
 		}
-		else
+
+		case EHoudiniEngineTaskType::AssetProcess:
+		{
+			TaskProccessAsset(Task);
+			break;
+		}
+
+		default:
 		{
-			// If we are running in single threaded mode, return so we don't block everything else.
 			return;
 		}
 	}
+
+	// Record the task's latency
+	const double FinishTime = FPlatformTime::Seconds();
+	const double QueueTime = Task.EnqueueTime > 0.0 ? StartTime - Task.EnqueueTime : 0.0;
+	const double RunTime = FinishTime - StartTime;
+	{
+		FScopeLock ScopeLock(&StatsCriticalSection);
+		FHoudiniEngineTaskStats& Stats = TaskStats[(int32)Task.TaskType];
+		Stats.Count++;
+		Stats.TotalQueueTime += QueueTime;
+		Stats.MaxQueueTime = FMath::Max(Stats.MaxQueueTime, QueueTime);
+		Stats.TotalRunTime += RunTime;
+		Stats.MaxRunTime = FMath::Max(Stats.MaxRunTime, RunTime);
+	}
+}
+
+void
+FHoudiniEngineScheduler::ProcessQueuedTasks()
+{
+	FHoudiniEngineTask Task;
+	while (!bStopping && DequeueTask(Task))
+	{
+		RunTask(Task);
+	}
+
+	// Once the queues are empty, no task can have been queued before the deletions
+	if (PendingTaskCount.GetValue() <= 0)
+	{
+		FScopeLock ScopeLock(&DeletionCriticalSection);
+		QueuedDeletions.Empty();
+	}
 }
 
 void
@@ -537,72 +658,128 @@ FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 	// TODO: Process results!
 }
 
-bool FHoudiniEngineScheduler::HasPendingTasks()
+void
+FHoudiniEngineScheduler::InterruptTask(const FGuid& InTaskGUID)
 {
-	FScopeLock ScopeLock(&CriticalSection);
-	return (PositionWrite != PositionRead);
+	FScopeLock ScopeLock(&InterruptCriticalSection);
+
+	// Ignore requests for tasks that have already finished, they would never be consumed
+	if (ActiveCookTasks.Contains(InTaskGUID))
+		InterruptedTasks.Add(InTaskGUID);
+}
+
+bool
+FHoudiniEngineScheduler::HasInterruptRequest(const FGuid& InTaskGUID)
+{
+	FScopeLock ScopeLock(&InterruptCriticalSection);
+	return InterruptedTasks.Contains(InTaskGUID);
+}
+
+bool
+FHoudiniEngineScheduler::ConsumeInterruptRequest(const FGuid& InTaskGUID)
+{
+	FScopeLock ScopeLock(&InterruptCriticalSection);
+	return InterruptedTasks.Remove(InTaskGUID) > 0;
 }
 
 void
-FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
+FHoudiniEngineScheduler::FinishInterruptibleTask(const FGuid& InTaskGUID)
 {
-	FScopeLock ScopeLock(&CriticalSection);
+	FScopeLock ScopeLock(&InterruptCriticalSection);
+	ActiveCookTasks.Remove(InTaskGUID);
+	InterruptedTasks.Remove(InTaskGUID);
+}
 
-	// Check if we need to grow our circular buffer.
-	if (PositionWrite + 1 == PositionRead)
-	{
-		// Calculate next size (next power of two).
-		uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo(TaskCount + 1);
+bool FHoudiniEngineScheduler::HasPendingTasks()
+{
+	return PendingTaskCount.GetValue() > 0;
+}
 
-		// Allocate new buffer.
-		FHoudiniEngineTask * Buffer = static_cast<FHoudiniEngineTask *>(
-			FMemory::Malloc(NextTaskCount * sizeof(FHoudiniEngineTask)));
+bool
+FHoudiniEngineScheduler::GetTaskStats(const EHoudiniEngineTaskType& TaskType, FHoudiniEngineTaskStats& OutStats)
+{
+	const int32 TypeIndex = (int32)TaskType;
+	if (TypeIndex < 0 || TypeIndex >= TaskTypeCount)
+		return false;
 
-		if (!Buffer)
-			return;
+	FScopeLock ScopeLock(&StatsCriticalSection);
+	OutStats = TaskStats[TypeIndex];
+	return true;
+}
 
-		// Zero memory.
-		FMemory::Memset(Buffer, 0x0, NextTaskCount * sizeof(FHoudiniEngineTask));
+void
+FHoudiniEngineScheduler::LogTaskStats()
+{
+	static const TCHAR* TaskTypeNames[TaskTypeCount] = 
+	{
+		TEXT("None"), TEXT("Instantiation"), TEXT("Cooking"), TEXT("Deletion"), TEXT("Process")
+	};
 
-		// Copy elements from old buffer to new one.
-		if (PositionRead < PositionWrite)
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (PositionWrite - PositionRead));
+	FScopeLock ScopeLock(&StatsCriticalSection);
+	for (int32 TypeIndex = 0; TypeIndex < TaskTypeCount; TypeIndex++)
+	{
+		const FHoudiniEngineTaskStats& Stats = TaskStats[TypeIndex];
+		if (Stats.Count <= 0)
+			continue;
+
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Houdini Engine Scheduler: %d %s tasks - queued avg %.3fs (max %.3fs), processed avg %.3fs (max %.3fs)."),
+			Stats.Count, TaskTypeNames[TypeIndex],
+			Stats.TotalQueueTime / Stats.Count, Stats.MaxQueueTime,
+			Stats.TotalRunTime / Stats.Count, Stats.MaxRunTime);
+	}
+}
 
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = PositionWrite - PositionRead;
-		}
-		else
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (TaskCount - PositionRead));
-			FMemory::Memcpy(Buffer + TaskCount - PositionRead, Tasks, sizeof(FHoudiniEngineTask) * PositionWrite);
+void
+FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
+{
+	FHoudiniEngineTask QueuedTask = Task;
+	QueuedTask.EnqueueTime = FPlatformTime::Seconds();
+	QueuedTask.Sequence = TaskSequence.Increment();
 
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = TaskCount - PositionRead + PositionWrite;
-		}
+	if (QueuedTask.TaskType == EHoudiniEngineTaskType::AssetCooking)
+	{
+		FScopeLock ScopeLock(&InterruptCriticalSection);
+		ActiveCookTasks.Add(QueuedTask.HapiGUID);
+	}
 
-		// Deallocate old buffer.
-		FMemory::Free(Tasks);
+	if (QueuedTask.TaskType == EHoudiniEngineTaskType::AssetDeletion)
+	{
+		{
+			FScopeLock ScopeLock(&DeletionCriticalSection);
+			int64& DeletionSequence = QueuedDeletions.FindOrAdd(QueuedTask.AssetId, 0);
+			DeletionSequence = FMath::Max(DeletionSequence, QueuedTask.Sequence);
+		}
 
-		// Bookkeeping.
-		Tasks = Buffer;
-		TaskCount = NextTaskCount;
+		DeletionQueue.Enqueue(QueuedTask);
+	}
+	else
+	{
+		int32 Priority = FMath::Clamp((int32)QueuedTask.Priority, 0, (int32)EHoudiniEngineTaskPriority::MAX - 1);
+		TaskQueues[Priority].Enqueue(QueuedTask);
 	}
 
-	// Store task.
-	Tasks[PositionWrite] = Task;
-	PositionWrite++;
+	PendingTaskCount.Increment();
 
-	// Wrap around if required.
-	PositionWrite &= (TaskCount - 1);
+	// Wake up the scheduler thread
+	if (WakeUpEvent)
+		WakeUpEvent->Trigger();
 }
 
 uint32
 FHoudiniEngineScheduler::Run()
 {
-	ProcessQueuedTasks();
+	while (!bStopping)
+	{
+		ProcessQueuedTasks();
+
+		// Sleep until a new task is added, or we're asked to stop
+		if (WakeUpEvent)
+			WakeUpEvent->Wait();
+		else
+			FPlatformProcess::SleepNoStats(UpdateFrequency);
+	}
+
 	return 0;
 }
 
@@ -610,11 +787,17 @@ void
 FHoudiniEngineScheduler::Stop()
 {
 	bStopping = true;
+
+	if (WakeUpEvent)
+		WakeUpEvent->Trigger();
+
+	LogTaskStats();
 }
 
 void
 FHoudiniEngineScheduler::Tick()
 {
+	// Single threaded mode: process what's queued and return so we don't block everything else.
 	ProcessQueuedTasks();
 }
 
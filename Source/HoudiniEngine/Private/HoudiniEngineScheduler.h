@@ -30,7 +30,30 @@
 #include "HoudiniEngineTaskInfo.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
 #include "Misc/SingleThreadRunnable.h"
+#include "Containers/Queue.h"
+
+class FEvent;
+
+// Latency statistics gathered for one type of task.
+struct HOUDINIENGINE_API FHoudiniEngineTaskStats
+{
+	FHoudiniEngineTaskStats();
+
+	// Number of finished tasks.
+	int32 Count;
+
+	// Time spent waiting in the queue (enqueue -> start), in seconds.
+	double TotalQueueTime;
+	double MaxQueueTime;
+
+	// Time spent processing the task (start -> finish), in seconds.
+	double TotalRunTime;
+	double MaxRunTime;
+};
 
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
@@ -50,8 +73,17 @@ public:
 	// Adds a task.
 	void AddTask(const FHoudiniEngineTask & Task);
 
+	// Requests a queued or running cook task to be interrupted, the task will finish as Aborted.
+	void InterruptTask(const FGuid& InTaskGUID);
+
 	bool HasPendingTasks();
 
+	// Returns the latency statistics recorded for a given task type.
+	bool GetTaskStats(const EHoudiniEngineTaskType& TaskType, FHoudiniEngineTaskStats& OutStats);
+
+	// Logs the latency statistics recorded for each task type.
+	void LogTaskStats();
+
 	// Adds instantiation response task info.
 	void AddResponseTaskInfo(
 		HAPI_Result Result, 
@@ -70,9 +102,21 @@ public:
 
 protected:
 
-	// Process queued tasks. 
+	// Process queued tasks until all queues are empty.
 	void ProcessQueuedTasks();
 
+	// Dequeue the next task to process, highest priority first.
+	bool DequeueTask(FHoudiniEngineTask& OutTask);
+
+	// Deletes all the queued nodes at once, skipping duplicates.
+	void TaskDeleteQueuedAssets();
+
+	// Discards a task that was queued before a deletion of its node, returns true if it was discarded.
+	bool DiscardTaskOnDeletedNode(const FHoudiniEngineTask & Task);
+
+	// Runs a task and records its latency.
+	void RunTask(const FHoudiniEngineTask & Task);
+
 	// Task : instantiate an asset. 
 	void TaskInstantiateAsset(const FHoudiniEngineTask & Task);
 
@@ -91,29 +135,60 @@ protected:
 	// Process the result of a sucesfull cook
 	void TaskProccessAsset(const FHoudiniEngineTask & Task);
 
-private:
+	// Returns true if the task has been requested to be interrupted, without clearing the request.
+	bool HasInterruptRequest(const FGuid& InTaskGUID);
 
-	// Initial number of tasks in our circular queue. 
-	static const uint32 InitialTaskSize;
+	// Returns true, and clears the request, if the task has been requested to be interrupted.
+	bool ConsumeInterruptRequest(const FGuid& InTaskGUID);
+
+	// Forgets a finished cook task, and any interrupt request it did not consume.
+	void FinishInterruptibleTask(const FGuid& InTaskGUID);
+
+private:
 
 	// Frequency update (sleep time between each update)
 	static const float UpdateFrequency;
 
-	// Synchronization primitive. 
-	FCriticalSection CriticalSection;
+	// Number of task types we keep statistics for.
+	static const int32 TaskTypeCount = (int32)EHoudiniEngineTaskType::AssetProcess + 1;
+
+	// Lock-free queues of scheduled tasks, one per priority.
+	// Tasks are added from any thread, but only consumed by the scheduler thread.
+	TQueue<FHoudiniEngineTask, EQueueMode::Mpsc> TaskQueues[(int32)EHoudiniEngineTaskPriority::MAX];
+
+	// Queue of scheduled deletion tasks, processed in batches.
+	TQueue<FHoudiniEngineTask, EQueueMode::Mpsc> DeletionQueue;
+
+	// Number of tasks currently queued.
+	FThreadSafeCounter PendingTaskCount;
+
+	// Sequence number of the last added task.
+	FThreadSafeCounter64 TaskSequence;
+
+	// Synchronization primitive for the queued deletions.
+	FCriticalSection DeletionCriticalSection;
+
+	// Sequence number of the last deletion queued for each node, the tasks queued before it are discarded.
+	TMap<HAPI_NodeId, int64> QueuedDeletions;
+
+	// Event used to wake the scheduler thread when a task is added.
+	FEvent* WakeUpEvent;
+
+	// Synchronization primitive for the statistics.
+	FCriticalSection StatsCriticalSection;
 
-	// List of scheduled tasks. 
-	FHoudiniEngineTask* Tasks;
+	// Latency statistics, indexed by task type.
+	FHoudiniEngineTaskStats TaskStats[TaskTypeCount];
 
-	// Head of the circular queue. 
-	uint32 PositionWrite;
+	// Synchronization primitive for the interrupt requests.
+	FCriticalSection InterruptCriticalSection;
 
-	// Tail of the circular queue. 
-	uint32 PositionRead;
+	// Cook tasks that are queued or running, only those can be interrupted.
+	TSet<FGuid> ActiveCookTasks;
 
-	// Size of the circular queue. 
-	uint32 TaskCount;
+	// Tasks that have been requested to be interrupted.
+	TSet<FGuid> InterruptedTasks;
 
 	// Stopping flag. 
-	bool bStopping;
+	FThreadSafeBool bStopping;
 };
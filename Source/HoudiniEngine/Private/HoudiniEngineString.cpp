@@ -32,6 +32,9 @@
 
 #include <vector>
 
+TMap<int32, FString> FHoudiniEngineString::StringCache;
+int32 FHoudiniEngineString::StringCacheScopeCount = 0;
+
 FHoudiniEngineString::FHoudiniEngineString()
 	: StringId(-1)
 {}
@@ -188,28 +191,142 @@ bool
 FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
 {
 	bool bReturn = true;
-	OutStringArray.SetNumZeroed(InStringIdArray.Num());
+	OutStringArray.SetNum(InStringIdArray.Num());
+
+	const bool bUseCache = IsStringCacheActive();
 
 	// Avoid calling HAPI to resolve the same strings again and again
-	TMap<HAPI_StringHandle, int32> ResolvedStrings;
-	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	TMap<HAPI_StringHandle, FString> ResolvedStrings;
+	TArray<HAPI_StringHandle> UniqueHandles;
+	for (const HAPI_StringHandle& CurrentHandle : InStringIdArray)
 	{
-		const int32* ResolvedString = ResolvedStrings.Find(InStringIdArray[IdxSH]);
-		if (ResolvedString)
+		// Null string ID / zero should be considered invalid
+		if (CurrentHandle <= 0)
 		{
-			// Already resolved earlier, copy the string instead of calling HAPI.
-			OutStringArray[IdxSH] = OutStringArray[*ResolvedString];
+			bReturn = false;
+			continue;
 		}
-		else
+
+		if (ResolvedStrings.Contains(CurrentHandle))
+			continue;
+
+		const FString* CachedString = bUseCache ? StringCache.Find(CurrentHandle) : nullptr;
+		if (CachedString)
 		{
-			FString CurrentString = FString();
-			if(!FHoudiniEngineString::ToFString(InStringIdArray[IdxSH], CurrentString))
-				bReturn = false;
+			ResolvedStrings.Add(CurrentHandle, *CachedString);
+			continue;
+		}
+
+		ResolvedStrings.Add(CurrentHandle, FString());
+		UniqueHandles.Add(CurrentHandle);
+	}
 
-			OutStringArray[IdxSH] = CurrentString;
-			ResolvedStrings.Add(InStringIdArray[IdxSH], IdxSH);
+	if (UniqueHandles.Num() > 0)
+	{
+		// Resolve all the unique strings at once
+		TArray<FString> UniqueStrings;
+		if (!SHArrayToFStringArrayBatch(UniqueHandles, UniqueStrings))
+		{
+			// The batch failed, resolve the strings one by one
+			UniqueStrings.SetNum(UniqueHandles.Num());
+			for (int32 IdxSH = 0; IdxSH < UniqueHandles.Num(); IdxSH++)
+			{
+				if (!FHoudiniEngineString::ToFString(UniqueHandles[IdxSH], UniqueStrings[IdxSH]))
+					bReturn = false;
+			}
+		}
+
+		for (int32 IdxSH = 0; IdxSH < UniqueHandles.Num(); IdxSH++)
+		{
+			ResolvedStrings[UniqueHandles[IdxSH]] = UniqueStrings[IdxSH];
+			if (bUseCache)
+				StringCache.Add(UniqueHandles[IdxSH], UniqueStrings[IdxSH]);
 		}
 	}
 
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	{
+		const FString* ResolvedString = ResolvedStrings.Find(InStringIdArray[IdxSH]);
+		OutStringArray[IdxSH] = ResolvedString ? *ResolvedString : FString();
+	}
+
 	return bReturn;
-}
\ No newline at end of file
+}
+
+bool
+FHoudiniEngineString::SHArrayToFStringArrayBatch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
+{
+	OutStringArray.SetNum(0);
+	if (InStringIdArray.Num() <= 0)
+		return true;
+
+	int32 BufferSize = 0;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatchSize(
+		FHoudiniEngine::Get().GetSession(), InStringIdArray.GetData(), InStringIdArray.Num(), &BufferSize))
+	{
+		return false;
+	}
+
+	if (BufferSize <= 0)
+		return false;
+
+	// Add an extra null character so the last string is always terminated
+	TArray<char> Buffer;
+	Buffer.SetNumZeroed(BufferSize + 1);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(
+		FHoudiniEngine::Get().GetSession(), Buffer.GetData(), BufferSize))
+	{
+		return false;
+	}
+
+	// The buffer contains all the values null-separated
+	OutStringArray.SetNum(InStringIdArray.Num());
+	int32 Offset = 0;
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	{
+		if (Offset >= BufferSize)
+		{
+			OutStringArray.SetNum(0);
+			return false;
+		}
+
+		const char* CurrentString = &Buffer[Offset];
+		OutStringArray[IdxSH] = UTF8_TO_TCHAR(CurrentString);
+		Offset += FCStringAnsi::Strlen(CurrentString) + 1;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniEngineString::IsStringCacheActive()
+{
+	// The cache is only used on the game thread
+	return StringCacheScopeCount > 0 && IsInGameThread();
+}
+
+void
+FHoudiniEngineString::InvalidateStringCache()
+{
+	if (IsInGameThread())
+		StringCache.Empty();
+}
+
+FHoudiniScopedStringCache::FHoudiniScopedStringCache()
+{
+	if (IsInGameThread())
+		FHoudiniEngineString::StringCacheScopeCount++;
+}
+
+FHoudiniScopedStringCache::~FHoudiniScopedStringCache()
+{
+	if (!IsInGameThread())
+		return;
+
+	FHoudiniEngineString::StringCacheScopeCount--;
+	if (FHoudiniEngineString::StringCacheScopeCount <= 0)
+	{
+		FHoudiniEngineString::StringCacheScopeCount = 0;
+		FHoudiniEngineString::StringCache.Empty();
+	}
+}
@@ -59,8 +59,15 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		static bool ToFText(const int32& InStringId, FText & Text);
 
 		// Array converter, uses a map to avoid redudant calls to HAPI
+		// and resolves all the unique strings with a single batch call.
 		static bool SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
 
+		// Resolves the given string handles using HAPI_GetStringBatch.
+		static bool SHArrayToFStringArrayBatch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
+
+		// Empties the string cache, string handles are invalidated by a cook.
+		static void InvalidateStringCache();
+
 		// Return id of this string.
 		int32 GetId() const;
 
@@ -71,4 +78,28 @@ class HOUDINIENGINE_API FHoudiniEngineString
 
 		// Id of the underlying Houdini Engine string.
 		int32 StringId;
+
+	private:
+
+		friend class FHoudiniScopedStringCache;
+
+		// Returns true if string handles should be looked up in / added to the cache.
+		static bool IsStringCacheActive();
+
+		// Strings resolved while a FHoudiniScopedStringCache is alive.
+		static TMap<int32, FString> StringCache;
+
+		// Number of FHoudiniScopedStringCache currently alive.
+		static int32 StringCacheScopeCount;
+};
+
+// While an instance of this class is alive, the string handles resolved on the game thread 
+// are cached, and shared by all the attribute reads (ie. for all the parts of a cook's outputs).
+// String handles are only valid until the next cook, so the cache is cleared when the outermost scope ends.
+class HOUDINIENGINE_API FHoudiniScopedStringCache
+{
+	public:
+
+		FHoudiniScopedStringCache();
+		~FHoudiniScopedStringCache();
 };
@@ -34,6 +34,9 @@ FHoudiniEngineTask::FHoudiniEngineTask()
 	, AssetId(-1)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, Priority(EHoudiniEngineTaskPriority::Normal)
+	, EnqueueTime(0.0)
+	, Sequence(0)
 {
 	HapiGUID.Invalidate();
 }
@@ -45,4 +48,7 @@ FHoudiniEngineTask::FHoudiniEngineTask(EHoudiniEngineTaskType InTaskType, FGuid
 	, AssetId(-1)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, Priority(EHoudiniEngineTaskPriority::Normal)
+	, EnqueueTime(0.0)
+	, Sequence(0)
 {}
@@ -68,6 +68,21 @@ enum class EHoudiniEngineTaskType : uint8
 	AssetProcess,
 };
 
+UENUM()
+enum class EHoudiniEngineTaskPriority : uint8
+{
+	// Tasks for selected actors.
+	High,
+
+	// Tasks for visible actors, and the default priority.
+	Normal,
+
+	// Tasks for actors that are neither selected nor visible.
+	Low,
+
+	MAX
+};
+
 struct HOUDINIENGINE_API FHoudiniEngineTask
 {
 	// Constructors.
@@ -95,6 +110,15 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// HAPI name of the asset.
 	int32 AssetHapiName;
 
+	// Scheduling priority of this task.
+	EHoudiniEngineTaskPriority Priority;
+
+	// Time at which this task was added to the scheduler.
+	double EnqueueTime;
+
+	// Order in which this task was added to the scheduler.
+	int64 Sequence;
+
 	// Is set to true if component has been loaded.
 	//bool bLoadedComponent;
 };
@@ -45,7 +45,7 @@ enum class EHoudiniEngineTaskState : uint8
 	// Indicates the task has finished with fatal errors and should be terminated
 	FinishedWithFatalError,
 
-	// Indicates the task has been aborted (unused)
+	// Indicates the task has been aborted (ie, an interrupted cook)
 	Aborted
 };
 
@@ -45,6 +45,8 @@
 #include "HoudiniAsset.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineCookWaiter.h"
+#include "HoudiniPartAttributeCache.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniInput.h"
@@ -2818,28 +2820,13 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 
 	int32 OriginalTupleSize = InTupleSize;
 
-	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
+	// Reuse a buffer that has already been fetched while processing this cook's outputs
+	if (FHoudiniPartAttributeCache::FindData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData))
+		return true;
 
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(), 
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	HAPI_AttributeInfo AttributeInfo;
+	if (!FHoudiniPartAttributeCache::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -2861,6 +2848,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 			InGeoId, InPartId, InAttribName,
 			&AttributeInfo, -1, &OutData[0], 0, AttributeInfo.count), false);
 
+		FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
 		return true;
 	}
 	else if (AttributeInfo.storage == HAPI_STORAGETYPE_INT)
@@ -2884,6 +2872,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 			}
 
 			HOUDINI_LOG_MESSAGE(TEXT("Attribute %s was expected to be a float attribute, its value had to be converted from integer."), *FString(InAttribName));
+			FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
 			return true;
 		}
 	}
@@ -2907,6 +2896,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 			if (!bConversionError)
 			{
 				HOUDINI_LOG_MESSAGE(TEXT("Attribute %s was expected to be a float attribute, its value had to be converted from string."), *FString(InAttribName));
+				FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
 				return true;
 			}
 		}
@@ -2933,28 +2923,13 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 
 	int32 OriginalTupleSize = InTupleSize;
 
-	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
+	// Reuse a buffer that has already been fetched while processing this cook's outputs
+	if (FHoudiniPartAttributeCache::FindData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData))
+		return true;
 
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	HAPI_AttributeInfo AttributeInfo;
+	if (!FHoudiniPartAttributeCache::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -2976,6 +2951,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 			InGeoId, InPartId, InAttribName,
 			&AttributeInfo, -1, &OutData[0], 0, AttributeInfo.count), false);
 
+		FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
 		return true;
 	}
 	else if (AttributeInfo.storage == HAPI_STORAGETYPE_FLOAT)
@@ -3000,6 +2976,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 
 			HOUDINI_LOG_MESSAGE(TEXT("Attribute %s was expected to be an integer attribute, its value had to be converted from float."), *FString(InAttribName));
 
+			FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
 			return true;
 		}
 	}
@@ -3022,6 +2999,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 			if (!bConversionError)
 			{
 				HOUDINI_LOG_MESSAGE(TEXT("Attribute %s was expected to be an integer attribute, its value had to be converted from string."), *FString(InAttribName));
+				FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
 				return true;
 			}
 		}
@@ -3049,28 +3027,13 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 
 	int32 OriginalTupleSize = InTupleSize;
 
-	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
+	// Reuse a buffer that has already been fetched while processing this cook's outputs
+	if (FHoudiniPartAttributeCache::FindData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData))
+		return true;
 
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	HAPI_AttributeInfo AttributeInfo;
+	if (!FHoudiniPartAttributeCache::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -3083,7 +3046,11 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 
 	if (AttributeInfo.storage == HAPI_STORAGETYPE_STRING)
 	{
-		return FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(InGeoId, InPartId, InAttribName, AttributeInfo, OutData);
+		if (!FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(InGeoId, InPartId, InAttribName, AttributeInfo, OutData))
+			return false;
+
+		FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
+		return true;
 	}
 	else if (AttributeInfo.storage == HAPI_STORAGETYPE_FLOAT)
 	{
@@ -3106,6 +3073,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 			}
 
 			HOUDINI_LOG_MESSAGE(TEXT("Attribute %s was expected to be a string attribute, its value had to be converted from float."), *FString(InAttribName));
+			FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
 			return true;
 		}
 	}
@@ -3130,6 +3098,7 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 			}
 
 			HOUDINI_LOG_MESSAGE(TEXT("Attribute %s was expected to be a string attribute, its value had to be converted from integer."), *FString(InAttribName));
+			FHoudiniPartAttributeCache::AddData(InGeoId, InPartId, InAttribName, InTupleSize, InOwner, OutAttributeInfo, OutData);
 			return true;
 		}
 	}
@@ -3186,11 +3155,8 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 	else
 	{
 		HAPI_AttributeInfo AttribInfo;
-		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
-
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			GeoId, PartId, AttribName, Owner, &AttribInfo), false);
+		if (!FHoudiniPartAttributeCache::HapiGetAttributeInfo(GeoId, PartId, AttribName, Owner, AttribInfo))
+			return false;
 
 		return AttribInfo.exists;
 	}
@@ -5222,6 +5188,26 @@ FHoudiniEngineUtils::MoveActorToLevel(AActor* InActor, ULevel* InDesiredLevel)
 	return true;
 }
 
+// Flags a synchronous cook to the scheduler for the lifetime of the scope,
+// so it doesn't interrupt the session while we are waiting on our cook.
+struct FHoudiniScopedForegroundCook
+{
+	FHoudiniScopedForegroundCook(const bool& bInEnabled)
+		: bEnabled(bInEnabled)
+	{
+		if (bEnabled)
+			FHoudiniEngine::Get().BeginForegroundCook();
+	}
+
+	~FHoudiniScopedForegroundCook()
+	{
+		if (bEnabled)
+			FHoudiniEngine::Get().EndForegroundCook();
+	}
+
+	bool bEnabled;
+};
+
 bool
 FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions* InCookOptions, const bool& bWaitForCompletion)
 {
@@ -5229,6 +5215,9 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 	if (InNodeId < 0)
 		return false;
 
+	// Cooks we wait on must not be cancelled by the scheduler interrupting one of its own cooks
+	FHoudiniScopedForegroundCook ForegroundCook(bWaitForCompletion);
+
 	// No Cook Options were specified, use the default one
 	if (InCookOptions == nullptr)
 	{
@@ -5244,34 +5233,34 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 			FHoudiniEngine::Get().GetSession(), InNodeId, InCookOptions), false);
 	}
 
+	// The cooked node's parts may have changed, discard any cached attribute or string
+	FHoudiniPartAttributeCache::Invalidate();
+	FHoudiniEngineString::InvalidateStringCache();
+
 	// If we don't need to wait for completion, return now
 	if (!bWaitForCompletion)
 		return true;
 
 	// Wait for the cook to finish
+	FHoudiniEngineCookWaiter CookWaiter;
 	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 	while (true)
 	{
 		// Get the current cook status
-		int Status = HAPI_STATE_STARTING_COOK;
-		HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
-			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
-
-		if (Status == HAPI_STATE_READY)
-		{
-			// The cook has been successful.
-			return true;
-		}
-		else if (Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
+		int32 Status = HAPI_STATE_STARTING_COOK;
+		if (CookWaiter.PollCookState(Status, Result))
 		{
-			// There was an error while cooking the node.
+			if (FHoudiniEngineCookWaiter::ShouldLogCookTimes())
+				HOUDINI_LOG_MESSAGE(TEXT("Node %d %s."), InNodeId, *CookWaiter.GetTimingSummary());
+
+			// The cook has been successful if we're ready without errors
 			//FString CookResultString = FHoudiniEngineUtils::GetCookResult();
 			//HOUDINI_LOG_ERROR();
-			return false;
+			return (Status == HAPI_STATE_READY);
 		}
 
 		// We want to yield a bit.
-		FPlatformProcess::Sleep(0.1f);
+		CookWaiter.Wait();
 	}
 }
 
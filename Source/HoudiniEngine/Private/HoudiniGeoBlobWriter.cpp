@@ -0,0 +1,454 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniGeoBlobWriter.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+
+// Token ids of Houdini's binary JSON format
+enum EHoudiniJID : uint8
+{
+	JID_MAP_BEGIN = 0x7b,
+	JID_MAP_END = 0x7d,
+	JID_ARRAY_BEGIN = 0x5b,
+	JID_ARRAY_END = 0x5d,
+	JID_INT8 = 0x11,
+	JID_INT16 = 0x12,
+	JID_INT32 = 0x13,
+	JID_INT64 = 0x14,
+	JID_REAL32 = 0x19,
+	JID_REAL64 = 0x1a,
+	JID_STRING = 0x27,
+	JID_FALSE = 0x30,
+	JID_TRUE = 0x31,
+	JID_UNIFORM_ARRAY = 0x40,
+	JID_MAGIC = 0x7f
+};
+
+// "NSJb", written in native (little endian) order
+static const uint32 HoudiniJSONBinaryMagic = 0x624a534e;
+
+FHoudiniGeoBlobWriter::FHoudiniGeoBlobWriter(const int32& InNumPoints, const int32& InNumTriangles)
+	: NumPoints(FMath::Max(InNumPoints, 0))
+	, NumTriangles(FMath::Max(InNumTriangles, 0))
+	, VertexPointIndicesOffset(-1)
+{
+	AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_POSITION), HAPI_ATTROWNER_POINT, 3);
+}
+
+int32
+FHoudiniGeoBlobWriter::AddAttribute(
+	const FString& InName, const HAPI_AttributeOwner& InOwner, const HAPI_StorageType& InStorage, const int32& InTupleSize)
+{
+	check(VertexPointIndicesOffset < 0);
+
+	FAttribute& Attribute = Attributes.AddDefaulted_GetRef();
+	Attribute.Name = InName;
+	Attribute.Owner = InOwner;
+	Attribute.Storage = InStorage;
+	Attribute.TupleSize = FMath::Max(InTupleSize, 1);
+
+	return Attributes.Num() - 1;
+}
+
+int32
+FHoudiniGeoBlobWriter::AddFloatAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize)
+{
+	return AddAttribute(InName, InOwner, HAPI_STORAGETYPE_FLOAT, InTupleSize);
+}
+
+int32
+FHoudiniGeoBlobWriter::AddIntAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize)
+{
+	return AddAttribute(InName, InOwner, HAPI_STORAGETYPE_INT, InTupleSize);
+}
+
+int32
+FHoudiniGeoBlobWriter::AddStringAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner, const TArray<FString>& InStrings)
+{
+	const int32 AttributeIdx = AddAttribute(InName, InOwner, HAPI_STORAGETYPE_STRING, 1);
+	Attributes[AttributeIdx].Strings = InStrings;
+	return AttributeIdx;
+}
+
+int32
+FHoudiniGeoBlobWriter::GetElementCount(const HAPI_AttributeOwner& InOwner) const
+{
+	switch (InOwner)
+	{
+		case HAPI_ATTROWNER_VERTEX:
+			return NumTriangles * 3;
+		case HAPI_ATTROWNER_POINT:
+			return NumPoints;
+		case HAPI_ATTROWNER_PRIM:
+			return NumTriangles;
+		case HAPI_ATTROWNER_DETAIL:
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+int32
+FHoudiniGeoBlobWriter::FindAttribute(const FString& InName) const
+{
+	return Attributes.IndexOfByPredicate([&InName](const FAttribute& InAttribute)
+	{
+		return InAttribute.Name.Equals(InName, ESearchCase::CaseSensitive);
+	});
+}
+
+void
+FHoudiniGeoBlobWriter::WriteByte(const uint8& InByte)
+{
+	Buffer.Add(InByte);
+}
+
+void
+FHoudiniGeoBlobWriter::WriteRaw(const void* InData, const int64& InSize)
+{
+	const int32 Offset = Buffer.AddUninitialized(static_cast<int32>(InSize));
+	FMemory::Memcpy(Buffer.GetData() + Offset, InData, InSize);
+}
+
+void
+FHoudiniGeoBlobWriter::WriteLength(const int64& InLength)
+{
+	if (InLength < 0xf1)
+	{
+		WriteByte((uint8)InLength);
+	}
+	else if (InLength < 0xffff)
+	{
+		const uint16 Length = (uint16)InLength;
+		WriteByte(0xf2);
+		WriteRaw(&Length, sizeof(Length));
+	}
+	else if (InLength < 0xffffffff)
+	{
+		const uint32 Length = (uint32)InLength;
+		WriteByte(0xf4);
+		WriteRaw(&Length, sizeof(Length));
+	}
+	else
+	{
+		WriteByte(0xf8);
+		WriteRaw(&InLength, sizeof(InLength));
+	}
+}
+
+void
+FHoudiniGeoBlobWriter::WriteString(const FString& InString)
+{
+	FTCHARToUTF8 UTF8String(*InString);
+	WriteByte(JID_STRING);
+	WriteLength(UTF8String.Length());
+	WriteRaw(UTF8String.Get(), UTF8String.Length());
+}
+
+void
+FHoudiniGeoBlobWriter::WriteInt(const int64& InValue)
+{
+	if (InValue >= MIN_int8 && InValue <= MAX_int8)
+	{
+		WriteByte(JID_INT8);
+		WriteByte((uint8)(int8)InValue);
+	}
+	else if (InValue >= MIN_int16 && InValue <= MAX_int16)
+	{
+		const int16 Value = (int16)InValue;
+		WriteByte(JID_INT16);
+		WriteRaw(&Value, sizeof(Value));
+	}
+	else if (InValue >= MIN_int32 && InValue <= MAX_int32)
+	{
+		const int32 Value = (int32)InValue;
+		WriteByte(JID_INT32);
+		WriteRaw(&Value, sizeof(Value));
+	}
+	else
+	{
+		WriteByte(JID_INT64);
+		WriteRaw(&InValue, sizeof(InValue));
+	}
+}
+
+void
+FHoudiniGeoBlobWriter::WriteReal(const double& InValue)
+{
+	WriteByte(JID_REAL64);
+	WriteRaw(&InValue, sizeof(InValue));
+}
+
+void
+FHoudiniGeoBlobWriter::WriteBool(const bool& bInValue)
+{
+	WriteByte(bInValue ? JID_TRUE : JID_FALSE);
+}
+
+void FHoudiniGeoBlobWriter::BeginArray() { WriteByte(JID_ARRAY_BEGIN); }
+void FHoudiniGeoBlobWriter::EndArray() { WriteByte(JID_ARRAY_END); }
+void FHoudiniGeoBlobWriter::BeginMap() { WriteByte(JID_MAP_BEGIN); }
+void FHoudiniGeoBlobWriter::EndMap() { WriteByte(JID_MAP_END); }
+
+int64
+FHoudiniGeoBlobWriter::ReserveUniformArray(const uint8& InType, const int32& InCount, const int32& InElementSize)
+{
+	WriteByte(JID_UNIFORM_ARRAY);
+	WriteByte(InType);
+	WriteLength(InCount);
+
+	// The values are filled by the caller
+	return Buffer.AddUninitialized(InCount * InElementSize);
+}
+
+void
+FHoudiniGeoBlobWriter::WriteAttribute(FAttribute& InAttribute)
+{
+	const bool bIsString = InAttribute.Storage == HAPI_STORAGETYPE_STRING;
+	const bool bIsFloat = InAttribute.Storage == HAPI_STORAGETYPE_FLOAT;
+	const int32 Count = GetElementCount(InAttribute.Owner);
+
+	BeginArray();
+	{
+		// Definition
+		BeginArray();
+		WriteString(TEXT("scope"));
+		WriteString(TEXT("public"));
+		WriteString(TEXT("type"));
+		WriteString(bIsString ? TEXT("string") : TEXT("numeric"));
+		WriteString(TEXT("name"));
+		WriteString(InAttribute.Name);
+		WriteString(TEXT("options"));
+		BeginMap();
+		EndMap();
+		EndArray();
+
+		// Values
+		BeginArray();
+		WriteString(TEXT("size"));
+		WriteInt(InAttribute.TupleSize);
+		WriteString(TEXT("storage"));
+		WriteString(bIsFloat ? TEXT("fpreal32") : TEXT("int32"));
+
+		if (bIsString)
+		{
+			WriteString(TEXT("strings"));
+			BeginArray();
+			for (const FString& CurString : InAttribute.Strings)
+				WriteString(CurString);
+			EndArray();
+
+			WriteString(TEXT("indices"));
+			BeginArray();
+			WriteString(TEXT("size"));
+			WriteInt(1);
+			WriteString(TEXT("storage"));
+			WriteString(TEXT("int32"));
+		}
+		else
+		{
+			WriteString(TEXT("defaults"));
+			BeginArray();
+			WriteString(TEXT("size"));
+			WriteInt(1);
+			WriteString(TEXT("storage"));
+			WriteString(TEXT("fpreal64"));
+			WriteString(TEXT("values"));
+			BeginArray();
+			WriteReal(0.0);
+			EndArray();
+			EndArray();
+
+			WriteString(TEXT("values"));
+			BeginArray();
+			WriteString(TEXT("size"));
+			WriteInt(InAttribute.TupleSize);
+			WriteString(TEXT("storage"));
+			WriteString(bIsFloat ? TEXT("fpreal32") : TEXT("int32"));
+		}
+
+		// One uniform array per tuple component
+		WriteString(TEXT("arrays"));
+		BeginArray();
+		InAttribute.ComponentOffsets.SetNum(InAttribute.TupleSize);
+		for (int32 Component = 0; Component < InAttribute.TupleSize; Component++)
+			InAttribute.ComponentOffsets[Component] = ReserveUniformArray(bIsFloat ? JID_REAL32 : JID_INT32, Count, 4);
+		EndArray();
+
+		// values / indices
+		EndArray();
+
+		EndArray();
+	}
+	EndArray();
+}
+
+void
+FHoudiniGeoBlobWriter::Allocate()
+{
+	check(VertexPointIndicesOffset < 0);
+
+	const int32 NumVertices = NumTriangles * 3;
+
+	// Reserve the whole buffer at once: the values, plus some room for the tokens and strings
+	int64 Capacity = 1024 + (int64)NumVertices * sizeof(int32);
+	for (const FAttribute& CurAttribute : Attributes)
+	{
+		Capacity += 256 + (int64)GetElementCount(CurAttribute.Owner) * CurAttribute.TupleSize * 4;
+		for (const FString& CurString : CurAttribute.Strings)
+			Capacity += 8 + CurString.Len() * 2;
+	}
+	Buffer.Empty(static_cast<int32>(FMath::Min<int64>(Capacity, MAX_int32)));
+
+	WriteByte(JID_MAGIC);
+	WriteRaw(&HoudiniJSONBinaryMagic, sizeof(HoudiniJSONBinaryMagic));
+
+	BeginArray();
+
+	WriteString(TEXT("fileversion"));
+	WriteString(TEXT("18.5.0"));
+	WriteString(TEXT("hasindex"));
+	WriteBool(false);
+	WriteString(TEXT("pointcount"));
+	WriteInt(NumPoints);
+	WriteString(TEXT("vertexcount"));
+	WriteInt(NumVertices);
+	WriteString(TEXT("primitivecount"));
+	WriteInt(NumTriangles);
+	WriteString(TEXT("info"));
+	BeginMap();
+	EndMap();
+
+	// Topology: the point of each vertex
+	WriteString(TEXT("topology"));
+	BeginArray();
+	WriteString(TEXT("pointref"));
+	BeginArray();
+	WriteString(TEXT("indices"));
+	VertexPointIndicesOffset = ReserveUniformArray(JID_INT32, NumVertices, sizeof(int32));
+	EndArray();
+	EndArray();
+
+	// Attributes, per owner
+	WriteString(TEXT("attributes"));
+	BeginArray();
+	{
+		const HAPI_AttributeOwner Owners[] = { HAPI_ATTROWNER_VERTEX, HAPI_ATTROWNER_POINT, HAPI_ATTROWNER_PRIM, HAPI_ATTROWNER_DETAIL };
+		const TCHAR* SectionNames[] = { TEXT("vertexattributes"), TEXT("pointattributes"), TEXT("primitiveattributes"), TEXT("globalattributes") };
+		for (int32 OwnerIdx = 0; OwnerIdx < UE_ARRAY_COUNT(Owners); OwnerIdx++)
+		{
+			if (!Attributes.ContainsByPredicate([&](const FAttribute& InAttribute) { return InAttribute.Owner == Owners[OwnerIdx]; }))
+				continue;
+
+			WriteString(SectionNames[OwnerIdx]);
+			BeginArray();
+			for (FAttribute& CurAttribute : Attributes)
+			{
+				if (CurAttribute.Owner == Owners[OwnerIdx])
+					WriteAttribute(CurAttribute);
+			}
+			EndArray();
+		}
+	}
+	EndArray();
+
+	// Primitives: a single run of triangles
+	WriteString(TEXT("primitives"));
+	BeginArray();
+	{
+		BeginArray();
+		BeginArray();
+		WriteString(TEXT("type"));
+		WriteString(TEXT("Polygon_run"));
+		EndArray();
+		BeginArray();
+		WriteString(TEXT("startvertex"));
+		WriteInt(0);
+		WriteString(TEXT("nprimitives"));
+		WriteInt(NumTriangles);
+		WriteString(TEXT("nvertices_rle"));
+		BeginArray();
+		WriteInt(3);
+		WriteInt(NumTriangles);
+		EndArray();
+		EndArray();
+		EndArray();
+	}
+	EndArray();
+
+	EndArray();
+}
+
+float*
+FHoudiniGeoBlobWriter::GetFloatValues(const int32& InAttribute, const int32& InComponent)
+{
+	if (!Attributes.IsValidIndex(InAttribute) || Attributes[InAttribute].Storage != HAPI_STORAGETYPE_FLOAT)
+		return nullptr;
+
+	const FAttribute& Attribute = Attributes[InAttribute];
+	if (!Attribute.ComponentOffsets.IsValidIndex(InComponent))
+		return nullptr;
+
+	return reinterpret_cast<float*>(Buffer.GetData() + Attribute.ComponentOffsets[InComponent]);
+}
+
+int32*
+FHoudiniGeoBlobWriter::GetIntValues(const int32& InAttribute, const int32& InComponent)
+{
+	if (!Attributes.IsValidIndex(InAttribute) || Attributes[InAttribute].Storage == HAPI_STORAGETYPE_FLOAT)
+		return nullptr;
+
+	const FAttribute& Attribute = Attributes[InAttribute];
+	if (!Attribute.ComponentOffsets.IsValidIndex(InComponent))
+		return nullptr;
+
+	return reinterpret_cast<int32*>(Buffer.GetData() + Attribute.ComponentOffsets[InComponent]);
+}
+
+int32*
+FHoudiniGeoBlobWriter::GetVertexPointIndices()
+{
+	if (VertexPointIndicesOffset < 0)
+		return nullptr;
+
+	return reinterpret_cast<int32*>(Buffer.GetData() + VertexPointIndicesOffset);
+}
+
+bool
+FHoudiniGeoBlobWriter::HapiLoadIntoNode(const HAPI_NodeId& InNodeId) const
+{
+	if (VertexPointIndicesOffset < 0 || Buffer.Num() <= 0)
+		return false;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::LoadGeoFromMemory(
+		FHoudiniEngine::Get().GetSession(), InNodeId, "bgeo",
+		reinterpret_cast<const char*>(Buffer.GetData()), Buffer.Num()), false);
+
+	return true;
+}
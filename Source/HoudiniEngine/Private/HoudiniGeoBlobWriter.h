@@ -0,0 +1,116 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+// Serializes a triangle mesh to a bgeo (binary JSON geometry) blob, that can be sent to a SOP node
+// with a single HAPI_LoadGeoFromMemory call instead of one HAPI call per attribute.
+// The attributes are declared first, Allocate() then lays out the whole blob in a single preallocated
+// buffer, and the values are written in place through the pointers returned by Get*Values().
+// Numeric attributes are stored as one uniform array per tuple component, string attributes as a
+// table of unique strings and one index per element. P is always the first (point) attribute.
+class HOUDINIENGINE_API FHoudiniGeoBlobWriter
+{
+	public:
+
+		FHoudiniGeoBlobWriter(const int32& InNumPoints, const int32& InNumTriangles);
+
+		// Handle of the P attribute
+		static const int32 PositionAttribute = 0;
+
+		// Declare the attributes, return the attribute's handle. Must be called before Allocate().
+		int32 AddFloatAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize);
+		int32 AddIntAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize);
+		// The values of string attributes are indices in InStrings, and are accessed with GetIntValues()
+		int32 AddStringAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner, const TArray<FString>& InStrings);
+
+		// Write the blob's structure. The values are left uninitialized and must all be filled.
+		void Allocate();
+
+		// The values of a component of an attribute's tuples, GetElementCount(Owner) values.
+		// Only valid after Allocate(), and until the writer is destroyed.
+		float* GetFloatValues(const int32& InAttribute, const int32& InComponent);
+		int32* GetIntValues(const int32& InAttribute, const int32& InComponent);
+
+		// The point index of each vertex, 3 consecutive vertices per triangle
+		int32* GetVertexPointIndices();
+
+		int32 GetElementCount(const HAPI_AttributeOwner& InOwner) const;
+
+		// Returns the handle of the attribute with the given name, INDEX_NONE if it wasn't declared.
+		int32 FindAttribute(const FString& InName) const;
+
+		const TArray<uint8>& GetBuffer() const { return Buffer; };
+
+		// Load the blob in an editable SOP node (ie an input node)
+		bool HapiLoadIntoNode(const HAPI_NodeId& InNodeId) const;
+
+	private:
+
+		struct FAttribute
+		{
+			FString Name;
+			HAPI_AttributeOwner Owner;
+			HAPI_StorageType Storage;
+			int32 TupleSize;
+			// Unique values of string attributes
+			TArray<FString> Strings;
+			// Offset in the buffer of each component's values
+			TArray<int64, TInlineAllocator<4>> ComponentOffsets;
+		};
+
+		int32 AddAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner, const HAPI_StorageType& InStorage, const int32& InTupleSize);
+
+		// Binary JSON tokens
+		void WriteByte(const uint8& InByte);
+		void WriteRaw(const void* InData, const int64& InSize);
+		void WriteLength(const int64& InLength);
+		void WriteString(const FString& InString);
+		void WriteInt(const int64& InValue);
+		void WriteReal(const double& InValue);
+		void WriteBool(const bool& bInValue);
+		void BeginArray();
+		void EndArray();
+		void BeginMap();
+		void EndMap();
+
+		// Write the header of a uniform array and reserve room for its values, returns the values' offset
+		int64 ReserveUniformArray(const uint8& InType, const int32& InCount, const int32& InElementSize);
+
+		void WriteAttribute(FAttribute& InAttribute);
+
+		int32 NumPoints;
+		int32 NumTriangles;
+
+		TArray<FAttribute> Attributes;
+
+		int64 VertexPointIndicesOffset;
+
+		TArray<uint8> Buffer;
+};
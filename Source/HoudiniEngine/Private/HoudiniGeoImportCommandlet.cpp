@@ -370,6 +370,8 @@ void UHoudiniGeoImportCommandlet::HandleImportBGEOMessage(
 	{
 		HOUDINI_LOG_WARNING(TEXT("BGEO import failed."));
 		FHoudiniPDGImportBGEOResultMessage* Reply = new FHoudiniPDGImportBGEOResultMessage();
+		// Identify the request so that the manager can release the work result
+		(*Reply) = InMessage;
 		Reply->ImportResult = EHoudiniPDGImportBGEOResult::HPIBR_Failed;
 		PDGEndpoint->Send(Reply, InContext->GetSender());
 	}
@@ -41,6 +41,7 @@
 #include "HoudiniSplineTranslator.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniOutputTranslator.h"
+#include "HoudiniSharedInputNodeRegistry.h"
 #include "UnrealBrushTranslator.h"
 #include "UnrealSplineTranslator.h"
 #include "UnrealMeshTranslator.h"
@@ -74,6 +75,14 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInputUploadCache(
+	TEXT("HoudiniEngine.InputUploadCache"),
+	1,
+	TEXT("Reuse a static mesh input's existing node when the hash of its marshalled data hasn't changed.\n")
+	TEXT("0: Always upload changed inputs\n")
+	TEXT("1: Skip the upload of inputs whose data is identical to the last upload (default)\n")
+);
+
 #if WITH_EDITOR
 // Allows checking of objects currently being dragged around
 struct FHoudiniMoveTracker
@@ -409,6 +418,7 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 
 			if(CurInputObject->InputObjectNodeId >= 0)
 			{
+				FHoudiniSharedInputNodeRegistry::ReleaseProxy(CurInputObject->InputObjectNodeId);
 				FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), CurInputObject->InputObjectNodeId);
 				CurInputObject->InputObjectNodeId = -1;
 
@@ -1209,7 +1219,7 @@ FHoudiniInputTranslator::UploadHoudiniInputObject(
 			UHoudiniInputStaticMesh* InputSM = Cast<UHoudiniInputStaticMesh>(InInputObject);
 			bSuccess = FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 				ObjBaseName, InputSM, InInput->GetExportLODs(), InInput->GetExportSockets(),
-				InInput->GetExportColliders(), InInput->GetImportAsReference());
+				InInput->GetExportColliders(), InInput->GetImportAsReference(), InInput->GetUploadAsGeometryBlob());
 
 			if (bSuccess)
 			{
@@ -1254,7 +1264,8 @@ FHoudiniInputTranslator::UploadHoudiniInputObject(
 		{
 			UHoudiniInputMeshComponent* InputSMC = Cast<UHoudiniInputMeshComponent>(InInputObject);
 			bSuccess = FHoudiniInputTranslator::HapiCreateInputNodeForStaticMeshComponent(
-				ObjBaseName, InputSMC, InInput->GetExportLODs(), InInput->GetExportSockets(), InInput->GetExportColliders(), InInput->GetImportAsReference());
+				ObjBaseName, InputSMC, InInput->GetExportLODs(), InInput->GetExportSockets(), InInput->GetExportColliders(), InInput->GetImportAsReference(),
+				InInput->GetUploadAsGeometryBlob());
 
 			if (bSuccess)
 				OutCreatedNodeIds.Add(InInputObject->InputObjectNodeId);
@@ -1728,7 +1739,8 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 	const bool& bExportLODs,
 	const bool& bExportSockets,
 	const bool& bExportColliders,
-	const bool& bImportAsReference)
+	const bool& bImportAsReference,
+	const bool& bUseGeoBlob)
 {
 	if (!InObject || InObject->IsPendingKill())
 		return false;
@@ -1784,6 +1796,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 
 		bSuccess = FHoudiniInputTranslator::CreateInputNodeForReference(
 			InObject->InputNodeId, AssetReference, SMName, InObject->Transform);
+		InObject->InputDataHash = 0;
 	}
 	else 
 	{
@@ -1835,7 +1848,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 					continue;
 
 				bSuccess &= FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
-					CurSMC->GetStaticMesh(), SMObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders);
+					CurSMC->GetStaticMesh(), SMObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders, bUseGeoBlob);
 
 				InObject->SetImportAsReference(false);
 
@@ -1862,10 +1875,16 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 			return true;
 		}
 		// This is a normal static mesh input, process it normally as a static mesh Input Object
+		else if (FHoudiniSharedInputNodeRegistry::IsEnabled())
+		{
+			// Reference the session's shared node for this mesh instead of uploading our own copy
+			bSuccess = FHoudiniSharedInputNodeRegistry::HapiCreateProxyForStaticMesh(
+				InObject, SM, SMName, bExportLODs, bExportSockets, bExportColliders, bUseGeoBlob);
+		}
 		else 
 		{
-			bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
-				SM, InObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders);
+			bSuccess = FHoudiniInputTranslator::HapiUploadStaticMeshIfChanged(
+				InObject, SM, nullptr, SMName, bExportLODs, bExportSockets, bExportColliders, bUseGeoBlob);
 		}
 	}
 
@@ -1891,6 +1910,53 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 	return bSuccess;
 }
 
+bool
+FHoudiniInputTranslator::HapiUploadStaticMeshIfChanged(
+	UHoudiniInputObject* InObject,
+	UStaticMesh* InStaticMesh,
+	UStaticMeshComponent* InStaticMeshComponent,
+	const FString& InNodeName,
+	const bool& bExportLODs,
+	const bool& bExportSockets,
+	const bool& bExportColliders,
+	const bool& bUseGeoBlob)
+{
+	if (!InObject || InObject->IsPendingKill())
+		return false;
+
+	// Hash the data we would upload, 0 means we can't tell and have to upload
+	uint32 DataHash = 0;
+	if (CVarHoudiniEngineInputUploadCache.GetValueOnAnyThread() != 0)
+	{
+		DataHash = FUnrealMeshTranslator::ComputeStaticMeshInputHash(
+			InStaticMesh, InStaticMeshComponent, bExportLODs, bExportSockets, bExportColliders);
+	}
+
+	if (DataHash != 0
+		&& DataHash == InObject->InputDataHash
+		&& InObject->InputNodeId >= 0
+		&& FHoudiniEngineUtils::IsHoudiniNodeValid(InObject->InputNodeId))
+	{
+		// The node already holds this exact data, keep it
+		HOUDINI_LOG_MESSAGE(TEXT("Input %s is unchanged, reusing its existing input node."), *InNodeName);
+		return true;
+	}
+
+	// Reset the hash first so a failed upload never gets reused
+	InObject->InputDataHash = 0;
+
+	// If the object was referencing a shared input node, its proxy is about to be replaced
+	FHoudiniSharedInputNodeRegistry::ReleaseProxy(InObject->InputObjectNodeId);
+
+	bool bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
+		InStaticMesh, InObject->InputNodeId, InNodeName, InStaticMeshComponent, bExportLODs, bExportSockets, bExportColliders, bUseGeoBlob);
+
+	if (bSuccess)
+		InObject->InputDataHash = DataHash;
+
+	return bSuccess;
+}
+
 bool
 FHoudiniInputTranslator::HapiCreateInputNodeForSkeletalMesh(const FString& InObjNodeName, UHoudiniInputSkeletalMesh* InObject)
 {
@@ -1942,7 +2008,8 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMeshComponent(
 	const bool& bExportLODs,
 	const bool& bExportSockets,
 	const bool& bExportColliders,
-	const bool& bImportAsReference)
+	const bool& bImportAsReference,
+	const bool& bUseGeoBlob)
 {
 	if (!InObject || InObject->IsPendingKill())
 		return false;
@@ -1979,12 +2046,13 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMeshComponent(
 		AssetReference += FString("'");
 
 		bSuccess = FHoudiniInputTranslator::CreateInputNodeForReference(InObject->InputNodeId, AssetReference, SMCName, InObject->Transform);
+		InObject->InputDataHash = 0;
 
 	}
 	else 
 	{
-		bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
-			SM, InObject->InputNodeId, SMCName, SMC, bExportLODs, bExportSockets, bExportColliders);
+		bSuccess = FHoudiniInputTranslator::HapiUploadStaticMeshIfChanged(
+			InObject, SM, SMC, SMCName, bExportLODs, bExportSockets, bExportColliders, bUseGeoBlob);
 	}
 
 	InObject->SetImportAsReference(bImportAsReference);
@@ -2360,7 +2428,12 @@ FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 	bool bSucess = false;
 	if (ExportType == EHoudiniLandscapeExportType::Heightfield)
 	{
-		bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
+		// Try to only send the components that changed to the heightfield we've previously created
+		bSucess = InObject->InputNodeId >= 0
+			&& FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(Landscape, InObject->InputNodeId);
+
+		if (!bSucess)
+			bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
 	}
 	else
 	{
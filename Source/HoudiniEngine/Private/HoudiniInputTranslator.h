@@ -138,7 +138,20 @@ struct HOUDINIENGINE_API FHoudiniInputTranslator
 		const bool& bExportLODs,
 		const bool& bExportSockets,
 		const bool& bExportColliders,
-		const bool& bImportAsReference = false);
+		const bool& bImportAsReference = false,
+		const bool& bUseGeoBlob = false);
+
+	// Marshal a static mesh into InObject's input node, or keep the existing node
+	// if the hash of the mesh data matches the one from the last upload.
+	static bool HapiUploadStaticMeshIfChanged(
+		UHoudiniInputObject* InObject,
+		class UStaticMesh* InStaticMesh,
+		class UStaticMeshComponent* InStaticMeshComponent,
+		const FString& InNodeName,
+		const bool& bExportLODs,
+		const bool& bExportSockets,
+		const bool& bExportColliders,
+		const bool& bUseGeoBlob = false);
 
 	static bool	HapiCreateInputNodeForHoudiniSplineComponent(
 		const FString& InObjNodeName,
@@ -162,7 +175,8 @@ struct HOUDINIENGINE_API FHoudiniInputTranslator
 		const bool& bExportLODs,
 		const bool& bExportSockets,
 		const bool& bExportColliders,
-		const bool& bImportAsReference);
+		const bool& bImportAsReference,
+		const bool& bUseGeoBlob = false);
 
 	static bool	HapiCreateInputNodeForInstancedStaticMeshComponent(
 		const FString& InObjNodeName,
@@ -28,6 +28,7 @@
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniDataConversion.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniInstancedActorComponent.h"
@@ -52,6 +53,97 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInstancerDeltaUpdate(
+	TEXT("HoudiniEngine.InstancerDeltaUpdate"),
+	1,
+	TEXT("Controls how instanced static mesh components are updated when an instancer is cooked again.\n")
+	TEXT("0: Clear all the instances and add them again\n")
+	TEXT("1: Only update the instances whose transform changed, and add / remove the instances at the end (default)\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineFoliageBatchUpdate(
+	TEXT("HoudiniEngine.FoliageBatchUpdate"),
+	1,
+	TEXT("Controls how foliage instancers are updated after a cook.\n")
+	TEXT("0: Add instances one by one and rebuild the foliage tree after each instancer\n")
+	TEXT("1: Add the instances of each instancer in one pass and rebuild the foliage trees once per cook (default)\n")
+);
+
+// State of the currently open foliage batch (see FHoudiniFoliageBatchScope)
+struct FHoudiniFoliageBatch
+{
+	// Number of open batch scopes
+	int32 NumOpenScopes = 0;
+	// Instanced foliage actors already looked up, by level
+	TMap<TWeakObjectPtr<ULevel>, TWeakObjectPtr<AInstancedFoliageActor>> FoliageActors;
+	// Parent component / foliage type pairs whose instances were cleared or added in this batch
+	TSet<TPair<const USceneComponent*, const UFoliageType*>> UpdatedFoliageTypes;
+	// Foliage components that need their tree rebuilt when the batch closes
+	TSet<TWeakObjectPtr<UHierarchicalInstancedStaticMeshComponent>> ComponentsToRebuild;
+};
+
+static FHoudiniFoliageBatch FoliageBatch;
+
+FHoudiniFoliageBatchScope::FHoudiniFoliageBatchScope()
+	: bIsBatching(CVarHoudiniEngineFoliageBatchUpdate.GetValueOnGameThread() != 0)
+{
+	if (bIsBatching)
+		FoliageBatch.NumOpenScopes++;
+}
+
+FHoudiniFoliageBatchScope::~FHoudiniFoliageBatchScope()
+{
+	if (!bIsBatching || --FoliageBatch.NumOpenScopes > 0)
+		return;
+
+	// Rebuild the trees of all the foliage components that were modified during the batch
+	for (const TWeakObjectPtr<UHierarchicalInstancedStaticMeshComponent>& Component : FoliageBatch.ComponentsToRebuild)
+	{
+		if (Component.IsValid())
+			Component->BuildTreeIfOutdated(true, true);
+	}
+
+	FoliageBatch = FHoudiniFoliageBatch();
+}
+
+bool
+FHoudiniFoliageBatchScope::IsBatching()
+{
+	return FoliageBatch.NumOpenScopes > 0;
+}
+
+// Returns the instanced foliage actor for the level, looked up once per batch
+static AInstancedFoliageActor*
+GetInstancedFoliageActorForLevel(ULevel* InLevel)
+{
+	if (!FHoudiniFoliageBatchScope::IsBatching())
+		return AInstancedFoliageActor::GetInstancedFoliageActorForLevel(InLevel, true);
+
+	TWeakObjectPtr<AInstancedFoliageActor>& FoliageActor = FoliageBatch.FoliageActors.FindOrAdd(InLevel);
+	if (!FoliageActor.IsValid())
+		FoliageActor = AInstancedFoliageActor::GetInstancedFoliageActorForLevel(InLevel, true);
+
+	return FoliageActor.Get();
+}
+
+// Delete the foliage instances of InFoliageType based on InParentComponent, unless they have already been
+// cleared or updated in the current batch. Returns false if the instances were left untouched.
+static bool
+DeleteFoliageInstancesForComponent(
+	AInstancedFoliageActor* InFoliageActor, USceneComponent* InParentComponent, UFoliageType* InFoliageType)
+{
+	if (FHoudiniFoliageBatchScope::IsBatching())
+	{
+		bool bAlreadyUpdated = false;
+		FoliageBatch.UpdatedFoliageTypes.Add(MakeTuple(InParentComponent, InFoliageType), &bAlreadyUpdated);
+		if (bAlreadyUpdated)
+			return false;
+	}
+
+	InFoliageActor->DeleteInstancesForComponent(InParentComponent, InFoliageType);
+	return true;
+}
+
 // Fastrand is a faster alternative to std::rand()
 // and doesn't oscillate when looking for 2 values like Unreal's.
 inline int fastrand(int& nSeed)
@@ -167,6 +259,12 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	if (!ParentComponent)
 		return false;
 
+	FHoudiniInstancerUpdateStats& UpdateStats = GetInstancerUpdateStats();
+	UpdateStats = FHoudiniInstancerUpdateStats();
+
+	// Batch the foliage updates of all the instancers of this output
+	FHoudiniFoliageBatchScope FoliageBatchScope;
+
 	// Keep track of if we remove, create or update any foliage, so that we can repopulate the foliage type list in
 	// the UI (foliage mode) at the end
 	bool bHaveAnyFoliageInstancers = false;
@@ -502,6 +600,15 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	if (bHaveAnyFoliageInstancers)
 		FHoudiniEngineUtils::RepopulateFoliageTypeListInUI();
 
+	if (UpdateStats.NumComponentsRebuilt > 0 || UpdateStats.NumComponentsUpdated > 0)
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Instancers: %d rebuilt, %d updated, %d unchanged. Instances: %d updated, %d added, %d removed, %d retained."),
+			UpdateStats.NumComponentsRebuilt, UpdateStats.NumComponentsUpdated, UpdateStats.NumComponentsSkipped,
+			UpdateStats.NumInstancesUpdated, UpdateStats.NumInstancesAdded, UpdateStats.NumInstancesRemoved,
+			UpdateStats.NumInstancesRetained);
+	}
+
 	return true;
 }
 
@@ -1919,25 +2026,28 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	if (!InstancedStaticMeshComponent)
 		return false;
 
+	// A reused component keeps its instances if it still instances the same mesh
+	const bool bRebuildInstances = bCreatedNewComponent || InstancedStaticMeshComponent->GetStaticMesh() != InstancedStaticMesh;
+
 	InstancedStaticMeshComponent->SetStaticMesh(InstancedStaticMesh);
 	InstancedStaticMeshComponent->GetBodyInstance()->bAutoWeld = false;
 
-	InstancedStaticMeshComponent->OverrideMaterials.Empty();
-	if (InstancerMaterial)
+	// Only reset the override materials if they changed, to avoid dirtying the render state of unchanged instancers
+	const int32 MeshMaterialCount = InstancerMaterial ? InstancedStaticMesh->StaticMaterials.Num() : 0;
+	bool bMaterialsChanged = InstancedStaticMeshComponent->OverrideMaterials.Num() != MeshMaterialCount;
+	for (int32 Idx = 0; Idx < MeshMaterialCount && !bMaterialsChanged; ++Idx)
+		bMaterialsChanged = InstancedStaticMeshComponent->OverrideMaterials[Idx] != InstancerMaterial;
+
+	if (bMaterialsChanged)
 	{
-		int32 MeshMaterialCount = InstancedStaticMesh->StaticMaterials.Num();
+		InstancedStaticMeshComponent->OverrideMaterials.Empty();
 		for (int32 Idx = 0; Idx < MeshMaterialCount; ++Idx)
 			InstancedStaticMeshComponent->SetMaterial(Idx, InstancerMaterial);
 	}
 
 	// Now add the instances themselves
 	// TODO: We should be calling  UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances( ... )
-	InstancedStaticMeshComponent->ClearInstances();
-	InstancedStaticMeshComponent->PreAllocateInstancesMemory(InstancedObjectTransforms.Num());
-	for (const FTransform& Transform : InstancedObjectTransforms)
-	{
-		InstancedStaticMeshComponent->AddInstance(Transform);
-	}
+	UpdateInstancedStaticMeshComponentInstances(InstancedStaticMeshComponent, InstancedObjectTransforms, bRebuildInstances);
 
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
@@ -1954,6 +2064,112 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	return true;
 }
 
+bool
+FHoudiniInstanceTranslator::UpdateInstancedStaticMeshComponentInstances(
+	UInstancedStaticMeshComponent* InISMC,
+	const TArray<FTransform>& InInstancedObjectTransforms,
+	const bool& bInRebuild)
+{
+	if (!IsValid(InISMC))
+		return false;
+
+	FHoudiniInstancerUpdateStats& UpdateStats = GetInstancerUpdateStats();
+	const int32 NumOldInstances = InISMC->GetInstanceCount();
+	const int32 NumNewInstances = InInstancedObjectTransforms.Num();
+
+	if (bInRebuild || CVarHoudiniEngineInstancerDeltaUpdate.GetValueOnAnyThread() == 0)
+	{
+		InISMC->ClearInstances();
+		InISMC->PreAllocateInstancesMemory(NumNewInstances);
+		for (const FTransform& Transform : InInstancedObjectTransforms)
+		{
+			InISMC->AddInstance(Transform);
+		}
+
+		UpdateStats.NumComponentsRebuilt++;
+		UpdateStats.NumInstancesRemoved += NumOldInstances;
+		UpdateStats.NumInstancesAdded += NumNewInstances;
+		return true;
+	}
+
+	// Update the transforms of the instances that changed, one contiguous run at a time
+	const int32 NumCommonInstances = FMath::Min(NumOldInstances, NumNewInstances);
+	int32 NumUpdatedInstances = 0;
+	int32 RunStart = INDEX_NONE;
+	TArray<FTransform> RunTransforms;
+	for (int32 Idx = 0; Idx <= NumCommonInstances; ++Idx)
+	{
+		const bool bChanged = Idx < NumCommonInstances
+			&& !InISMC->PerInstanceSMData[Idx].Transform.Equals(InInstancedObjectTransforms[Idx].ToMatrixWithScale(), 0.0f);
+		if (bChanged)
+		{
+			if (RunStart == INDEX_NONE)
+				RunStart = Idx;
+			continue;
+		}
+
+		if (RunStart == INDEX_NONE)
+			continue;
+
+		RunTransforms.Reset();
+		RunTransforms.Append(&InInstancedObjectTransforms[RunStart], Idx - RunStart);
+		InISMC->BatchUpdateInstancesTransforms(RunStart, RunTransforms, false, false, false);
+		NumUpdatedInstances += Idx - RunStart;
+		RunStart = INDEX_NONE;
+	}
+
+	// Add the appended instances
+	if (NumNewInstances > NumOldInstances)
+	{
+		TArray<FTransform> AddedTransforms(&InInstancedObjectTransforms[NumOldInstances], NumNewInstances - NumOldInstances);
+		InISMC->AddInstances(AddedTransforms, false);
+	}
+	// Remove the dropped instances, from the end so the remaining indices are not affected
+	else if (NumNewInstances < NumOldInstances)
+	{
+		UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(InISMC);
+		if (HISMC)
+		{
+			TArray<int32> RemovedIndices;
+			RemovedIndices.Reserve(NumOldInstances - NumNewInstances);
+			for (int32 Idx = NumOldInstances - 1; Idx >= NumNewInstances; --Idx)
+				RemovedIndices.Add(Idx);
+
+			HISMC->RemoveInstances(RemovedIndices);
+		}
+		else
+		{
+			for (int32 Idx = NumOldInstances - 1; Idx >= NumNewInstances; --Idx)
+				InISMC->RemoveInstance(Idx);
+		}
+	}
+
+	UpdateStats.NumInstancesRetained += NumCommonInstances - NumUpdatedInstances;
+	UpdateStats.NumInstancesUpdated += NumUpdatedInstances;
+	UpdateStats.NumInstancesAdded += FMath::Max(NumNewInstances - NumOldInstances, 0);
+	UpdateStats.NumInstancesRemoved += FMath::Max(NumOldInstances - NumNewInstances, 0);
+
+	if (NumUpdatedInstances <= 0 && NumNewInstances == NumOldInstances)
+	{
+		UpdateStats.NumComponentsSkipped++;
+		return false;
+	}
+
+	// The batch updates don't dirty the render state
+	if (NumUpdatedInstances > 0)
+		InISMC->MarkRenderStateDirty();
+
+	UpdateStats.NumComponentsUpdated++;
+	return true;
+}
+
+FHoudiniInstancerUpdateStats&
+FHoudiniInstanceTranslator::GetInstancerUpdateStats()
+{
+	static FHoudiniInstancerUpdateStats InstancerUpdateStats;
+	return InstancerUpdateStats;
+}
+
 bool
 FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	UObject* InstancedObject,
@@ -2390,7 +2606,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 
 	ULevel* DesiredLevel = GWorld->GetCurrentLevel();
 
-	AInstancedFoliageActor* InstancedFoliageActor = AInstancedFoliageActor::GetInstancedFoliageActorForLevel(DesiredLevel, true);
+	AInstancedFoliageActor* InstancedFoliageActor = GetInstancedFoliageActorForLevel(DesiredLevel);
 	if (!InstancedFoliageActor || InstancedFoliageActor->IsPendingKill())
 		return false;
 
@@ -2429,7 +2645,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 	{
 		// TODO: Shouldnt be needed anymore
 		// Clean up the instances previously generated for that component
-		InstancedFoliageActor->DeleteInstancesForComponent(ParentComponent, FoliageType);
+		DeleteFoliageInstancesForComponent(InstancedFoliageActor, ParentComponent, FoliageType);
 	}
 
  	// Get the FoliageMeshInfo for this Foliage type so we can add the instance to it
@@ -2437,7 +2653,15 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 	if (!FoliageInfo)
 		return false;
 
+	const bool bIsBatching = FHoudiniFoliageBatchScope::IsBatching();
+	if (bIsBatching)
+		FoliageBatch.UpdatedFoliageTypes.Add(MakeTuple(ParentComponent, FoliageType));
+
 	FTransform HoudiniAssetTransform = ParentComponent->GetComponentTransform();
+	TArray<FFoliageInstance> FoliageInstances;
+	if (bIsBatching)
+		FoliageInstances.Reserve(InstancedObjectTransforms.Num());
+
 	FFoliageInstance FoliageInstance;
 	int32 CurrentInstanceCount = 0;
 	for (auto CurrentTransform : InstancedObjectTransforms)
@@ -2462,15 +2686,33 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 			FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D() * HoudiniAssetTransform.GetScale3D();
 		}
 
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
+		if (bIsBatching)
+			FoliageInstances.Add(FoliageInstance);
+		else
+			FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
 		CurrentInstanceCount++;
 	}
 
+	if (bIsBatching && FoliageInstances.Num() > 0)
+	{
+		// Add all the instances in one pass
+		TArray<const FFoliageInstance*> NewInstances;
+		NewInstances.Reserve(FoliageInstances.Num());
+		for (const FFoliageInstance& NewInstance : FoliageInstances)
+			NewInstances.Add(&NewInstance);
+
+		FoliageInfo->AddInstances(InstancedFoliageActor, FoliageType, NewInstances);
+	}
+
 	UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = FoliageInfo->GetComponent();	
 	if (IsValid(FoliageHISMC))
 	{
 		// TODO: This was due to a bug in UE4.22-20, check if still needed! 
-		FoliageHISMC->BuildTreeIfOutdated(true, true);
+		// When batching, the tree is rebuilt once all instancers have been updated
+		if (bIsBatching)
+			FoliageBatch.ComponentsToRebuild.Add(FoliageHISMC);
+		else
+			FoliageHISMC->BuildTreeIfOutdated(true, true);
 
 		if (InstancerMaterial)
 		{
@@ -2525,11 +2767,8 @@ FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 
 	// Convert the transform to Unreal's coordinate system
 	OutInstancerUnrealTransforms.SetNumZeroed(InstanceTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstanceTransforms.Num(); InstanceIdx++)
-	{
-		const auto& InstanceTransform = InstanceTransforms[InstanceIdx];
-		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, OutInstancerUnrealTransforms[InstanceIdx]);
-	}
+	FHoudiniDataConversion::ConvertHapiTransforms(
+		InstanceTransforms.GetData(), OutInstancerUnrealTransforms.GetData(), InstanceTransforms.Num());
 
 	return true;
 }
@@ -2930,7 +3169,8 @@ FHoudiniInstanceTranslator::CleanupFoliageInstances(
 	}
 
 	// Clean up the instances previously generated for that component
-	InstancedFoliageActor->DeleteInstancesForComponent(InParentComponent, FoliageType);
+	if (!DeleteFoliageInstancesForComponent(InstancedFoliageActor, InParentComponent, FoliageType))
+		return;
 
 	// Remove the foliage type if it doesn't have any more instances
 	if(InFoliageHISMC->GetInstanceCount() == 0)
@@ -3241,12 +3481,21 @@ FHoudiniInstanceTranslator::UpdateChangedPerInstanceCustomData(
 	if (ISMC->NumCustomDataFloats == 0 && InNumCustomFloats == 0)
 		return false;
 
+	int32 InstanceCount = ISMC->GetInstanceCount();
+
+	// Leave the component untouched if the custom data did not change
+	if (ISMC->NumCustomDataFloats == InNumCustomFloats
+		&& ISMC->PerInstanceSMCustomData.Num() == InstanceCount * InNumCustomFloats
+		&& InPerInstanceCustomData.Num() == ISMC->PerInstanceSMCustomData.Num()
+		&& FMemory::Memcmp(ISMC->PerInstanceSMCustomData.GetData(), InPerInstanceCustomData.GetData(), InPerInstanceCustomData.Num() * InPerInstanceCustomData.GetTypeSize()) == 0)
+	{
+		return false;
+	}
+
 	// We can copy the per instance custom data if we have any
 	// TODO: Properly extract only needed values!
 	ISMC->NumCustomDataFloats = InNumCustomFloats;
 
-	int32 InstanceCount = ISMC->GetInstanceCount();
-
 	// Clear out and reinit to 0 the PerInstanceCustomData array
 	ISMC->PerInstanceSMCustomData.Empty(InstanceCount * InNumCustomFloats);
 	ISMC->PerInstanceSMCustomData.SetNumZeroed(InstanceCount * InNumCustomFloats);
@@ -148,6 +148,47 @@ public:
 	void BuildOriginalInstancedTransformsAndObjectArrays();
 };
 
+// Counts of the instanced static mesh component updates done by the instance translator.
+// Reset at the start of each CreateAllInstancersFromHoudiniOutput call.
+struct HOUDINIENGINE_API FHoudiniInstancerUpdateStats
+{
+	// Components whose instances were all cleared and added again
+	int32 NumComponentsRebuilt = 0;
+	// Components whose instances were updated in place
+	int32 NumComponentsUpdated = 0;
+	// Components whose instances did not change
+	int32 NumComponentsSkipped = 0;
+
+	// Instances left untouched
+	int32 NumInstancesRetained = 0;
+	// Instances whose transform was updated
+	int32 NumInstancesUpdated = 0;
+	// Instances added
+	int32 NumInstancesAdded = 0;
+	// Instances removed
+	int32 NumInstancesRemoved = 0;
+};
+
+// Batches the foliage updates done by the instance translator while it is in scope (scopes can be nested).
+// While a batch is open, instanced foliage actors are looked up once per level, the instances of a parent
+// component / foliage type pair are only cleared once, instances are added in one pass per instancer, and
+// the foliage trees are rebuilt once when the outermost scope closes.
+struct HOUDINIENGINE_API FHoudiniFoliageBatchScope
+{
+	public:
+
+		FHoudiniFoliageBatchScope();
+		~FHoudiniFoliageBatchScope();
+
+		// Returns true if a foliage batch is currently open
+		static bool IsBatching();
+
+	private:
+
+		// Did this scope open (or join) a batch
+		bool bIsBatching;
+};
+
 struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 {
 	public:
@@ -254,6 +295,18 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			UMaterialInterface * InstancerMaterial = nullptr,
 			const bool& bForceHISM = false);
 
+		// Update the instances of an ISMC / HISMC to match InInstancedObjectTransforms.
+		// Unless bInRebuild is true, only the instances whose transform changed are updated, and only the
+		// appended / dropped instances at the end of the array are added / removed.
+		// Returns true if any instance was modified.
+		static bool UpdateInstancedStaticMeshComponentInstances(
+			class UInstancedStaticMeshComponent* InISMC,
+			const TArray<FTransform>& InInstancedObjectTransforms,
+			const bool& bInRebuild);
+
+		// Instance update stats of the last CreateAllInstancersFromHoudiniOutput call
+		static FHoudiniInstancerUpdateStats& GetInstancerUpdateStats();
+
 		// Create or update an IAC
 		static bool CreateOrUpdateInstancedActorComponent(
 			UObject* InstancedObject,
@@ -32,6 +32,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniDataConversion.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEnginePrivatePCH.h"
@@ -64,6 +65,7 @@
 #include "HAL/IConsoleManager.h"
 #include "Engine/AssetManager.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_EDITOR
 	#include "EditorLevelUtils.h"
@@ -79,12 +81,160 @@ static TAutoConsoleVariable<int32> CVarHoudiniEngineExportLandscapeTextures(
 	TEXT("1: Enabled\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeFetchBandSize(
+	TEXT("HoudiniEngine.LandscapeFetchBandSize"),
+	256,
+	TEXT("Number of heightfield rows fetched from Houdini per call when converting a Heightfield to a Landscape.\n")
+	TEXT("Bounds the float data held in memory during the conversion to one band instead of the whole heightfield.\n")
+	TEXT("0: Fetch the whole heightfield at once\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeIncrementalUpdate(
+	TEXT("HoudiniEngine.LandscapeIncrementalUpdate"),
+	1,
+	TEXT("When updating an existing landscape tile, only rewrite the landscape components whose height or layer data changed since the last update.\n")
+	TEXT("0: Always rewrite the whole tile\n")
+	TEXT("1: Only rewrite the changed components\n")
+);
+
 typedef FHoudiniEngineUtils FHUtils;
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
 HOUDINI_LANDSCAPE_DEFINE_LOG_CATEGORY();
 
+// Per landscape component hashes of the height and layer data last written to a landscape tile.
+struct FHoudiniLandscapeTileHashes
+{
+	FIntPoint TileLoc = FIntPoint::ZeroValue;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	int32 ComponentSizeQuads = 0;
+
+	TArray<uint32> HeightHashes;
+	TMap<FName, TArray<uint32>> LayerHashes;
+
+	bool HasSameLayout(const FHoudiniLandscapeTileHashes& InOther) const
+	{
+		return TileLoc == InOther.TileLoc && SizeX == InOther.SizeX && SizeY == InOther.SizeY && ComponentSizeQuads == InOther.ComponentSizeQuads;
+	}
+};
+
+// Hashes of the data last written to each landscape tile during this session.
+// Tiles without an entry (new session, CVar toggled...) are fully rewritten on their next update.
+static TMap<TWeakObjectPtr<ALandscapeProxy>, FHoudiniLandscapeTileHashes> LandscapeTileHashes;
+
+// Hashes each (ComponentSizeQuads + 1)^2 component region of a SizeX x SizeY tile, edges included
+// as they are shared with the neighbouring components.
+template<typename TYPE>
+static void
+ComputeLandscapeComponentHashes(
+	const TArray<TYPE>& InData, const int32& InSizeX, const int32& InSizeY, const int32& InComponentSizeQuads,
+	TArray<uint32>& OutHashes)
+{
+	OutHashes.Empty();
+	if (InComponentSizeQuads <= 0 || InData.Num() != InSizeX * InSizeY)
+		return;
+
+	const int32 NumComponentsX = (InSizeX - 1) / InComponentSizeQuads;
+	const int32 NumComponentsY = (InSizeY - 1) / InComponentSizeQuads;
+	OutHashes.SetNumZeroed(NumComponentsX * NumComponentsY);
+
+	ParallelFor(NumComponentsY, [&](int32 ComponentY)
+	{
+		for (int32 ComponentX = 0; ComponentX < NumComponentsX; ComponentX++)
+		{
+			uint32 Hash = 0;
+			for (int32 Y = ComponentY * InComponentSizeQuads; Y <= (ComponentY + 1) * InComponentSizeQuads; Y++)
+			{
+				const TYPE* Row = InData.GetData() + Y * InSizeX + ComponentX * InComponentSizeQuads;
+				Hash = FCrc::MemCrc32(Row, (InComponentSizeQuads + 1) * sizeof(TYPE), Hash);
+			}
+			OutHashes[ComponentY * NumComponentsX + ComponentX] = Hash;
+		}
+	});
+}
+
+// Flags the components whose hash differs from InPreviousHashes.
+// Returns false if there are no previous hashes to compare with.
+static bool
+GetChangedLandscapeComponents(const TArray<uint32>& InHashes, const TArray<uint32>* InPreviousHashes, TArray<bool>& OutChangedComponents)
+{
+	OutChangedComponents.Empty();
+	if (!InPreviousHashes || InPreviousHashes->Num() != InHashes.Num())
+		return false;
+
+	OutChangedComponents.SetNumUninitialized(InHashes.Num());
+	for (int32 Idx = 0; Idx < InHashes.Num(); Idx++)
+		OutChangedComponents[Idx] = InHashes[Idx] != (*InPreviousHashes)[Idx];
+
+	return true;
+}
+
+// Writes the changed components of InData with InWriteRegion(X1, Y1, X2, Y2, Data).
+// Horizontal runs of changed components are written together. Without valid changed flags, the whole tile is written.
+// Returns the number of landscape components that were written.
+template<typename TYPE>
+static int32
+WriteChangedLandscapeComponents(
+	const TArray<TYPE>& InData, const FHoudiniLandscapeTileHashes& InTile,
+	const TArray<bool>* InChangedComponents,
+	TFunctionRef<void(int32, int32, int32, int32, const TYPE*)> InWriteRegion)
+{
+	const int32 NumComponentsX = InTile.ComponentSizeQuads > 0 ? (InTile.SizeX - 1) / InTile.ComponentSizeQuads : 0;
+	const int32 NumComponentsY = InTile.ComponentSizeQuads > 0 ? (InTile.SizeY - 1) / InTile.ComponentSizeQuads : 0;
+	if (!InChangedComponents || InChangedComponents->Num() != NumComponentsX * NumComponentsY)
+	{
+		InWriteRegion(
+			InTile.TileLoc.X, InTile.TileLoc.Y,
+			InTile.TileLoc.X + InTile.SizeX - 1, InTile.TileLoc.Y + InTile.SizeY - 1,
+			InData.GetData());
+		return NumComponentsX * NumComponentsY;
+	}
+
+	const int32 Quads = InTile.ComponentSizeQuads;
+	int32 NumWritten = 0;
+	TArray<TYPE> RegionData;
+	for (int32 ComponentY = 0; ComponentY < NumComponentsY; ComponentY++)
+	{
+		int32 ComponentX = 0;
+		while (ComponentX < NumComponentsX)
+		{
+			const int32 ComponentIdx = ComponentY * NumComponentsX + ComponentX;
+			if (!(*InChangedComponents)[ComponentIdx])
+			{
+				ComponentX++;
+				continue;
+			}
+
+			// Extend the run over the following changed components
+			int32 EndComponentX = ComponentX + 1;
+			while (EndComponentX < NumComponentsX && (*InChangedComponents)[ComponentIdx + EndComponentX - ComponentX])
+				EndComponentX++;
+
+			const int32 X1 = ComponentX * Quads;
+			const int32 X2 = EndComponentX * Quads;
+			const int32 Y1 = ComponentY * Quads;
+			const int32 Y2 = Y1 + Quads;
+			const int32 RegionSizeX = X2 - X1 + 1;
+
+			RegionData.SetNumUninitialized(RegionSizeX * (Y2 - Y1 + 1), false);
+			for (int32 Y = Y1; Y <= Y2; Y++)
+				FMemory::Memcpy(&RegionData[(Y - Y1) * RegionSizeX], &InData[Y * InTile.SizeX + X1], RegionSizeX * sizeof(TYPE));
+
+			InWriteRegion(
+				InTile.TileLoc.X + X1, InTile.TileLoc.Y + Y1,
+				InTile.TileLoc.X + X2, InTile.TileLoc.Y + Y2,
+				RegionData.GetData());
+
+			NumWritten += EndComponentX - ComponentX;
+			ComponentX = EndComponentX;
+		}
+	}
+
+	return NumWritten;
+}
+
 bool
 FHoudiniLandscapeTranslator::CreateLandscape(
 	UHoudiniOutput* InOutput,
@@ -323,17 +473,20 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	UPhysicalMaterial* LandscapePhysicalMaterial = nullptr;
 	FHoudiniLandscapeTranslator::GetLandscapeMaterials(*Heightfield, LandscapeMaterial, LandscapeHoleMaterial, LandscapePhysicalMaterial);
 
-	// Extract the float data from the Heightfield.
+	// Make sure the Heightfield's data can be fetched.
+	// The float values themselves are streamed from HAPI during the conversion to landscape data.
 	const FHoudiniVolumeInfo &VolumeInfo = Heightfield->VolumeInfo;
-	TArray<float> FloatValues;
-	float FloatMin, FloatMax;
-	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
+	HAPI_VolumeInfo HeightfieldHapiVolumeInfo;
+	if (!GetHoudiniHeightfieldVolumeInfo(Heightfield, HeightfieldHapiVolumeInfo))
+		return false;
+
+	if (HeightfieldHapiVolumeInfo.xLength != VolumeInfo.XLength || HeightfieldHapiVolumeInfo.yLength != VolumeInfo.YLength)
 		return false;
 
 	// Heightfield conversions should always use the global float min/max
 	// since they need to be calculated externally, potentially across multiple tiles.
-	FloatMin = fGlobalMin;
-	FloatMax = fGlobalMax;
+	const float FloatMin = fGlobalMin;
+	const float FloatMax = fGlobalMax;
 
 	// Get the Unreal landscape size 
 	const int32 HoudiniHeightfieldXSize = VolumeInfo.YLength;
@@ -372,15 +525,21 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	if (bExportTexture)
 	{
 		// Export raw height data to texture
-		FString TextureName = TilePackageParams.ObjectName + TEXT("_height_raw");
-		FHoudiniLandscapeTranslator::CreateUnrealTexture(
-			TilePackageParams,
-			TextureName,
-			HoudiniHeightfieldXSize,
-			HoudiniHeightfieldYSize,
-			FloatValues,
-			FloatMin,
-			FloatMax);
+		// This needs the whole float heightfield, so fetch it separately
+		TArray<float> FloatValues;
+		float RawFloatMin, RawFloatMax;
+		if (GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, RawFloatMin, RawFloatMax))
+		{
+			FString TextureName = TilePackageParams.ObjectName + TEXT("_height_raw");
+			FHoudiniLandscapeTranslator::CreateUnrealTexture(
+				TilePackageParams,
+				TextureName,
+				HoudiniHeightfieldXSize,
+				HoudiniHeightfieldYSize,
+				FloatValues,
+				FloatMin,
+				FloatMax);
+		}
 	}
 
 	// Look for all the layers/masks corresponding to the current heightfield.
@@ -401,7 +560,7 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	TArray<uint16> IntHeightData;
 	FTransform TileTransform;
 	if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
-		FloatValues, VolumeInfo,
+		Heightfield, VolumeInfo,
 		UnrealTileSizeX, UnrealTileSizeY,
 		FloatMin, FloatMax,
 		IntHeightData, TileTransform))
@@ -811,6 +970,28 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	ALandscape* CachedLandscapeActor = nullptr;
 	ULandscapeInfo *LandscapeInfo;
 
+	// Hash the landscape components of the new data, to only rewrite the ones that changed on the next updates
+	const bool bUseIncrementalUpdate = CVarHoudiniEngineLandscapeIncrementalUpdate.GetValueOnAnyThread() != 0;
+	FHoudiniLandscapeTileHashes TileHashes;
+	if (bUseIncrementalUpdate)
+	{
+		TileHashes.TileLoc = TileLoc;
+		TileHashes.SizeX = UnrealTileSizeX;
+		TileHashes.SizeY = UnrealTileSizeY;
+		TileHashes.ComponentSizeQuads = NumSectionPerLandscapeComponent * NumQuadsPerLandscapeSection;
+		ComputeLandscapeComponentHashes(IntHeightData, UnrealTileSizeX, UnrealTileSizeY, TileHashes.ComponentSizeQuads, TileHashes.HeightHashes);
+		for (const FLandscapeImportLayerInfo& CurrentLayerInfo : LayerInfos)
+		{
+			ComputeLandscapeComponentHashes(
+				CurrentLayerInfo.LayerData, UnrealTileSizeX, UnrealTileSizeY, TileHashes.ComponentSizeQuads,
+				TileHashes.LayerHashes.Add(CurrentLayerInfo.LayerName));
+		}
+	}
+
+	// Set when only the changed components of an existing tile were rewritten,
+	// in which case normals, collisions and grass have been updated for those components only.
+	bool bIncrementalUpdate = false;
+
 #if defined(HOUDINI_ENGINE_DEBUG_LANDSCAPE)
 	HOUDINI_LANDSCAPE_MESSAGE(TEXT("[HoudiniLandscapeTranslator::CreateLandscape] Tile Loc: %d, %d"), TileLoc.X, TileLoc.Y);
 	HOUDINI_LANDSCAPE_MESSAGE(TEXT("[HoudiniLandscapeTranslator::CreateLandscape] Tile Size: %d, %d"), UnrealTileSizeX, UnrealTileSizeY);
@@ -915,6 +1096,13 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		const int32 MinY = TileLoc.Y;
 		const int32 MaxY = TileLoc.Y + UnrealTileSizeY - 1;
 
+		// Previous hashes are only usable if the tile hasn't moved or been resized since they were computed
+		const FHoudiniLandscapeTileHashes* PreviousTileHashes = bUseIncrementalUpdate ? LandscapeTileHashes.Find(TileActor) : nullptr;
+		if (PreviousTileHashes && (bUpdateTransform || !PreviousTileHashes->HasSameLayout(TileHashes)))
+			PreviousTileHashes = nullptr;
+
+		bIncrementalUpdate = PreviousTileHashes != nullptr;
+
 		// NOTE: Use HeightmapAccessor / AlphamapAccessor instead of FLandscapeEditDataInterface.
 		// FLandscapeEditDataInterface is a more low level data interface, used internally by the *Accessor tools
 		// though the *Accessors do additional things like update normals and foliage.
@@ -925,30 +1113,143 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 			// It is important to update the heightmap through the this since it will properly
 			// update normals and foliage.
 			FHeightmapAccessor<false> HeightmapAccessor(LandscapeInfo);
-			HeightmapAccessor.SetData(MinX, MinY, MaxX, MaxY, IntHeightData.GetData());
+			if (bUseIncrementalUpdate)
+			{
+				TArray<bool> ChangedComponents;
+				const bool bHasChangedComponents = PreviousTileHashes
+					&& GetChangedLandscapeComponents(TileHashes.HeightHashes, &PreviousTileHashes->HeightHashes, ChangedComponents);
+				const int32 NumWritten = WriteChangedLandscapeComponents<uint16>(
+					IntHeightData, TileHashes, bHasChangedComponents ? &ChangedComponents : nullptr,
+					[&](int32 X1, int32 Y1, int32 X2, int32 Y2, const uint16* Data) { HeightmapAccessor.SetData(X1, Y1, X2, Y2, Data); });
+
+				HOUDINI_LANDSCAPE_MESSAGE(TEXT("[HoudiniLandscapeTranslator::CreateLandscape] Updated the height of %d / %d components"), NumWritten, TileHashes.HeightHashes.Num());
+				bHeightLayerDataChanged = NumWritten > 0;
+			}
+			else
+			{
+				HeightmapAccessor.SetData(MinX, MinY, MaxX, MaxY, IntHeightData.GetData());
+				bHeightLayerDataChanged = true;
+			}
+		}
+
+		// Flags the components of a layer that changed since its last update
+		auto GetChangedLayerComponents = [&](const FLandscapeImportLayerInfo& InLayerInfo, TArray<bool>& OutChangedComponents)
+		{
+			const TArray<uint32>* LayerHashes = TileHashes.LayerHashes.Find(InLayerInfo.LayerName);
+			const TArray<uint32>* PreviousLayerHashes = PreviousTileHashes ? PreviousTileHashes->LayerHashes.Find(InLayerInfo.LayerName) : nullptr;
+			return LayerHashes && GetChangedLandscapeComponents(*LayerHashes, PreviousLayerHashes, OutChangedComponents);
+		};
+
+		auto IsWeightBlendedLayer = [](const FLandscapeImportLayerInfo& InLayerInfo)
+		{
+			return InLayerInfo.LayerInfo && !InLayerInfo.LayerInfo->bNoWeightBlend
+				&& !InLayerInfo.LayerName.ToString().Equals(TEXT("Visibility"), ESearchCase::IgnoreCase);
+		};
+
+		// Weight blended layers are normalized against each other when written, so if any of them changed
+		// in a component, all of them have to be rewritten in that component.
+		TArray<bool> BlendedChangedComponents;
+		bool bHasBlendedChangedComponents = bUseIncrementalUpdate;
+		for (const FLandscapeImportLayerInfo& LayerInfo : LayerInfos)
+		{
+			if (!bHasBlendedChangedComponents)
+				break;
 
-			bHeightLayerDataChanged = true;
+			if (!IsWeightBlendedLayer(LayerInfo))
+				continue;
+
+			TArray<bool> LayerChangedComponents;
+			if (!GetChangedLayerComponents(LayerInfo, LayerChangedComponents))
+			{
+				bHasBlendedChangedComponents = false;
+			}
+			else if (BlendedChangedComponents.Num() == 0)
+			{
+				BlendedChangedComponents = MoveTemp(LayerChangedComponents);
+			}
+			else if (BlendedChangedComponents.Num() != LayerChangedComponents.Num())
+			{
+				bHasBlendedChangedComponents = false;
+			}
+			else
+			{
+				for (int32 Idx = 0; Idx < LayerChangedComponents.Num(); Idx++)
+					BlendedChangedComponents[Idx] |= LayerChangedComponents[Idx];
+			}
 		}
 
 		// Update the layers on the landscape.
 		for (FLandscapeImportLayerInfo &NextUpdatedLayerInfo : LayerInfos)
 		{
+			// Non weight blended layers only rewrite their own changed components
+			TArray<bool> LayerChangedComponents;
+			const TArray<bool>* ChangedComponents = nullptr;
+			if (IsWeightBlendedLayer(NextUpdatedLayerInfo))
+				ChangedComponents = bHasBlendedChangedComponents ? &BlendedChangedComponents : nullptr;
+			else if (GetChangedLayerComponents(NextUpdatedLayerInfo, LayerChangedComponents))
+				ChangedComponents = &LayerChangedComponents;
+
+			auto SetLayerData = [&](auto& AlphaAccessor)
+			{
+				if (bUseIncrementalUpdate)
+				{
+					return WriteChangedLandscapeComponents<uint8>(
+						NextUpdatedLayerInfo.LayerData, TileHashes, ChangedComponents,
+						[&](int32 X1, int32 Y1, int32 X2, int32 Y2, const uint8* Data)
+						{
+							AlphaAccessor.SetData(X1, Y1, X2, Y2, Data, ELandscapeLayerPaintingRestriction::None);
+						});
+				}
+
+				AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+				return 1;
+			};
+
+			int32 NumWritten = 0;
 			if (NextUpdatedLayerInfo.LayerInfo && NextUpdatedLayerInfo.LayerName.ToString().Equals(TEXT("Visibility"), ESearchCase::IgnoreCase))
 			{
 				// NOTE: AProxyLandscape::VisibilityLayer is a STATIC property (Info objects is being shared by ALL landscapes). Don't try to update / replace it.
 				FAlphamapAccessor<false, false> AlphaAccessor(LandscapeInfo, ALandscapeProxy::VisibilityLayer);
-				AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+				NumWritten = SetLayerData(AlphaAccessor);
 			}
 			else
 			{
 				FAlphamapAccessor<false, true> AlphaAccessor(LandscapeInfo, NextUpdatedLayerInfo.LayerInfo);
-				AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+				NumWritten = SetLayerData(AlphaAccessor);
 			}
 
-			bCustomLayerDataChanged = true;
+			if (NumWritten > 0)
+				bCustomLayerDataChanged = true;
+		}
+
+		if (!bIncrementalUpdate || bHeightLayerDataChanged || bCustomLayerDataChanged)
+			bModifiedLandscapeActor = true;
+	}
+
+	if (bUseIncrementalUpdate)
+	{
+		// Remove the entries of deleted tiles while we're at it
+		for (auto It = LandscapeTileHashes.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+				It.RemoveCurrent();
+		}
+
+		// The height data is only written if the geo has changed, so keep the previous hashes if it wasn't
+		if (!bCreatedTileActor && !Heightfield->bHasGeoChanged)
+		{
+			const FHoudiniLandscapeTileHashes* PreviousTileHashes = LandscapeTileHashes.Find(TileActor);
+			if (PreviousTileHashes && PreviousTileHashes->HasSameLayout(TileHashes))
+				TileHashes.HeightHashes = PreviousTileHashes->HeightHashes;
+			else
+				TileHashes.HeightHashes.Empty();
 		}
 
-		bModifiedLandscapeActor = true;
+		LandscapeTileHashes.Add(TileActor, MoveTemp(TileHashes));
+	}
+	else
+	{
+		LandscapeTileHashes.Remove(TileActor);
 	}
 
 	// ----------------------------------------------------
@@ -1029,6 +1330,8 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		TileActor->PostEditChange();
 	}
 
+	// The accessors have already updated the normals and collisions of the components they have written to
+	if (!bIncrementalUpdate)
 	{
 		FLandscapeEditDataInterface LandscapeEdit(TileActor->GetLandscapeInfo());
 		LandscapeEdit.RecalculateNormals();
@@ -1037,7 +1340,8 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	if (LandscapeInfo)
 	{
 		LandscapeInfo->RecreateLandscapeInfo(InWorld, true);
-		LandscapeInfo->RecreateCollisionComponents();
+		if (!bIncrementalUpdate)
+			LandscapeInfo->RecreateCollisionComponents();
 	}
 
 	{
@@ -1521,6 +1825,90 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	TArray< uint16 >& IntHeightData,
 	FTransform& LandscapeTransform,
 	const bool& NoResize)
+{
+	const int32 HoudiniRowSize = HeightfieldVolumeInfo.XLength;
+	if (HeightfieldFloatValues.Num() < HoudiniRowSize * HeightfieldVolumeInfo.YLength)
+		return false;
+
+	// The values are already in memory, convert them in a single band
+	auto GetHoudiniRows = [&](const int32& InStartRow, const int32& InNumRows) -> const float*
+	{
+		return HeightfieldFloatValues.GetData() + InStartRow * HoudiniRowSize;
+	};
+
+	return ConvertHeightfieldRowsToLandscapeData(
+		GetHoudiniRows, HeightfieldVolumeInfo.YLength, HeightfieldVolumeInfo,
+		FinalXSize, FinalYSize, FloatMin, FloatMax,
+		IntHeightData, LandscapeTransform, NoResize);
+}
+
+// The number of rows fetched per HAPI call for a heightfield of InNumRows rows
+static int32
+GetLandscapeFetchRowsPerBand(const int32& InNumRows)
+{
+	int32 RowsPerBand = CVarHoudiniEngineLandscapeFetchBandSize.GetValueOnAnyThread();
+	if (RowsPerBand <= 0 || RowsPerBand > InNumRows)
+		RowsPerBand = InNumRows;
+
+	return RowsPerBand;
+}
+
+// Fetches InNumRows rows (of InRowSize values) of a heightfield or mask, starting at InStartRow
+static const float*
+FetchHoudiniHeightfieldRows(
+	const FHoudiniGeoPartObject* InHGPO, const int32& InRowSize,
+	const int32& InStartRow, const int32& InNumRows, TArray<float>& OutValues)
+{
+	const int32 BandSizeInPoints = InNumRows * InRowSize;
+	OutValues.SetNumUninitialized(BandSizeInPoints, false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetHeightFieldData(
+		FHoudiniEngine::Get().GetSession(),
+		InHGPO->GeoId, InHGPO->PartId,
+		OutValues.GetData(),
+		InStartRow * InRowSize, BandSizeInPoints), nullptr);
+
+	return OutValues.GetData();
+}
+
+bool
+FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+	const FHoudiniGeoPartObject* HeightfieldHGPO,
+	const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+	const int32& FinalXSize, const int32& FinalYSize,
+	float FloatMin, float FloatMax,
+	TArray< uint16 >& IntHeightData,
+	FTransform& LandscapeTransform,
+	const bool& NoResize)
+{
+	if (!HeightfieldHGPO)
+		return false;
+
+	const int32 HoudiniRowSize = HeightfieldVolumeInfo.XLength;
+	const int32 HoudiniNumRows = HeightfieldVolumeInfo.YLength;
+
+	// Only one band worth of float values is alive at any time
+	TArray<float> BandValues;
+	auto GetHoudiniRows = [&](const int32& InStartRow, const int32& InNumRows) -> const float*
+	{
+		return FetchHoudiniHeightfieldRows(HeightfieldHGPO, HoudiniRowSize, InStartRow, InNumRows, BandValues);
+	};
+
+	return ConvertHeightfieldRowsToLandscapeData(
+		GetHoudiniRows, GetLandscapeFetchRowsPerBand(HoudiniNumRows), HeightfieldVolumeInfo,
+		FinalXSize, FinalYSize, FloatMin, FloatMax,
+		IntHeightData, LandscapeTransform, NoResize);
+}
+
+bool
+FHoudiniLandscapeTranslator::ConvertHeightfieldRowsToLandscapeData(
+	TFunctionRef<const float*(const int32&, const int32&)> GetHoudiniRows,
+	const int32& RowsPerBand,
+	const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+	const int32& FinalXSize, const int32& FinalYSize,
+	float FloatMin, float FloatMax,
+	TArray< uint16 >& IntHeightData,
+	FTransform& LandscapeTransform,
+	const bool& NoResize)
 {
 	IntHeightData.Empty();
 	LandscapeTransform.SetIdentity();
@@ -1598,21 +1986,24 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	// For correct orientation in unreal, the point matrix has to be transposed.
 	IntHeightData.SetNumUninitialized(SizeInPoints);
 
-	int32 nUnreal = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
+	// Each Houdini row (fixed nX) becomes an Unreal column, so a band of Houdini rows fills a band of Unreal columns.
+	const int32 BandSize = FMath::Clamp(RowsPerBand, 1, HoudiniXSize);
+	for (int32 BandStartX = 0; BandStartX < HoudiniXSize; BandStartX += BandSize)
 	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
+		const int32 BandNumX = FMath::Min(BandSize, HoudiniXSize - BandStartX);
+		const float* BandValues = GetHoudiniRows(BandStartX, BandNumX);
+		if (!BandValues)
 		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
-
-			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)HeightfieldFloatValues[nHoudini] - (double)FloatMin;
-
-			// Then convert it to [0 - DesiredRange] and center it 
-			DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
-			IntHeightData[nUnreal++] = FMath::RoundToInt(DoubleValue);
+			IntHeightData.Empty();
+			return false;
 		}
+
+		// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
+		// Values are offset to [0 - ZRange], then converted to [0 - DesiredRange] and centered
+		FHoudiniDataConversion::ConvertHeightfieldToLandscapeHeights(
+			BandValues, BandNumX, HoudiniYSize,
+			IntHeightData.GetData() + BandStartX, HoudiniXSize,
+			FloatMin, ZSpacing, DigitCenterOffset);
 	}
 
 	//--------------------------------------------------------------------------------------------------
@@ -1860,8 +2251,6 @@ FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
 	if (!bResample)
 	{
 		// Expanding the data by padding
-		NewData.SetNumUninitialized(NewSizeX * NewSizeY);
-
 		const int32 OffsetX = (int32)(NewSizeX - SizeX) / 2;
 		const int32 OffsetY = (int32)(NewSizeY - SizeY) / 2;
 
@@ -1887,7 +2276,6 @@ FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
 	else
 	{
 		// Resampling the data
-		NewData.SetNumUninitialized(NewSizeX * NewSizeY);
 		NewData = ResampleData(HeightData, SizeX, SizeY, NewSizeX, NewSizeY);
 
 		// The landscape has been resized, we'll need to take that into account when sizing it
@@ -1902,7 +2290,7 @@ FHoudiniLandscapeTranslator::ResizeHeightDataForLandscape(
 	}
 
 	// Replaces Old data with the new one
-	HeightData = NewData;
+	HeightData = MoveTemp(NewData);
 
 	return true;
 }
@@ -2226,6 +2614,43 @@ FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPar
 	return true;
 }
 
+bool
+FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatRange(const FHoudiniGeoPartObject* HGPO, float &OutFloatMin, float &OutFloatMax)
+{
+	OutFloatMin = 0.f;
+	OutFloatMax = 0.f;
+
+	HAPI_VolumeInfo VolumeInfo;
+	if (!GetHoudiniHeightfieldVolumeInfo(HGPO, VolumeInfo))
+		return false;
+
+	const int32 HoudiniRowSize = VolumeInfo.xLength;
+	const int32 HoudiniNumRows = VolumeInfo.yLength;
+	const int32 RowsPerBand = GetLandscapeFetchRowsPerBand(HoudiniNumRows);
+
+	TArray<float> BandValues;
+	for (int32 BandStartRow = 0; BandStartRow < HoudiniNumRows; BandStartRow += RowsPerBand)
+	{
+		const int32 BandNumRows = FMath::Min(RowsPerBand, HoudiniNumRows - BandStartRow);
+		if (!FetchHoudiniHeightfieldRows(HGPO, HoudiniRowSize, BandStartRow, BandNumRows, BandValues))
+			return false;
+
+		if (BandStartRow == 0)
+		{
+			OutFloatMin = BandValues[0];
+			OutFloatMax = OutFloatMin;
+		}
+
+		for (const float& NextFloatVal : BandValues)
+		{
+			OutFloatMin = FMath::Min(OutFloatMin, NextFloatVal);
+			OutFloatMax = FMath::Max(OutFloatMax, NextFloatVal);
+		}
+	}
+
+	return true;
+}
+
 bool
 FHoudiniLandscapeTranslator::GetNonWeightBlendedLayerNames(const FHoudiniGeoPartObject& InHGPO, TArray<FString>& NonWeightBlendedLayerNames)
 {
@@ -2333,14 +2758,8 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 			continue;
 		}
 
-		TArray<float> FloatLayerData;
-		float LayerMin = 0;
-		float LayerMax = 0;
-		if (!FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(LayerGeoPartObject, FloatLayerData, LayerMin, LayerMax))
-			continue;
-
-		// No need to create flat layers as Unreal will remove them afterwards..
-		if (LayerMin == LayerMax)
+		HAPI_VolumeInfo HapiLayerVolumeInfo;
+		if (!FHoudiniLandscapeTranslator::GetHoudiniHeightfieldVolumeInfo(LayerGeoPartObject, HapiLayerVolumeInfo))
 			continue;
 
 		const FHoudiniVolumeInfo& LayerVolumeInfo = LayerGeoPartObject->VolumeInfo;
@@ -2352,34 +2771,65 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 		TilePackageParams.ObjectName = InTilePackageParams.ObjectName + TEXT("_layer_") + SanitizedLayerName;
 		LayerPackageParams.ObjectName = InLayerPackageParams.ObjectName + TEXT("_layer_") + SanitizedLayerName;
 
-		if (bExportTexture)
-		{
-			// Create a raw texture export of the layer on this tile
-			FString TextureName = TilePackageParams.ObjectName + "_raw";
-			FHoudiniLandscapeTranslator::CreateUnrealTexture(
-				TilePackageParams,
-				TextureName,
-				LayerVolumeInfo.YLength,  // Y and X inverted?? why?
-				LayerVolumeInfo.XLength,
-				FloatLayerData,
-				LayerMin,
-				LayerMax);
-		}
-
 		// Check if that landscape layer has been marked as unit (range in [0-1]
-		if (IsUnitLandscapeLayer(*LayerGeoPartObject))
+		// If not, we want to convert the layer using the global Min/Max
+		float LayerMin = 0.0f;
+		float LayerMax = 1.0f;
+		if (!IsUnitLandscapeLayer(*LayerGeoPartObject))
 		{
-			LayerMin = 0.0f;
-			LayerMax = 1.0f;
+			const float* GlobalMin = GlobalMinimums.Find(LayerName);
+			const float* GlobalMax = GlobalMaximums.Find(LayerName);
+			if (!GlobalMin || !GlobalMax)
+			{
+				// Without a global Min/Max, the layer's own range is needed before converting it
+				if (!FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatRange(LayerGeoPartObject, LayerMin, LayerMax))
+					continue;
+			}
+
+			if (GlobalMin)
+				LayerMin = *GlobalMin;
+
+			if (GlobalMax)
+				LayerMax = *GlobalMax;
 		}
-		else
-		{
-			// We want to convert the layer using the global Min/Max
-			if (GlobalMaximums.Contains(LayerName))
-				LayerMax = GlobalMaximums[LayerName];
 
-			if (GlobalMinimums.Contains(LayerName))
-				LayerMin = GlobalMinimums[LayerName];
+		// Creating the ImportLayerInfo and LayerInfo objects
+		FLandscapeImportLayerInfo ImportLayerInfo(*LayerName);
+
+		// Convert the float data to uint8, fetching it in bands
+		// HF masks need their X/Y sizes swapped
+		float RawLayerMin = 0.0f;
+		float RawLayerMax = 0.0f;
+		if (!FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
+			LayerGeoPartObject, LayerVolumeInfo.YLength, LayerVolumeInfo.XLength,
+			LayerMin, LayerMax,
+			LandscapeXSize, LandscapeYSize,
+			ImportLayerInfo.LayerData,
+			RawLayerMin, RawLayerMax))
+			continue;
+
+		// No need to create flat layers as Unreal will remove them afterwards..
+		if (RawLayerMin == RawLayerMax)
+			continue;
+
+		if (bExportTexture)
+		{
+			// Create a raw texture export of the layer on this tile
+			// This needs the whole float layer, so fetch it separately
+			TArray<float> FloatLayerData;
+			float RawFloatMin, RawFloatMax;
+			if (FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(LayerGeoPartObject, FloatLayerData, RawFloatMin, RawFloatMax))
+			{
+				FString TextureName = TilePackageParams.ObjectName + "_raw";
+				FHoudiniLandscapeTranslator::CreateUnrealTexture(
+					TilePackageParams,
+					TextureName,
+					LayerVolumeInfo.YLength,  // Y and X inverted?? why?
+					LayerVolumeInfo.XLength,
+					FloatLayerData,
+					RawFloatMin,
+					RawFloatMax);
+			}
 		}
 			
 		// Get the layer package path
@@ -2389,9 +2839,6 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 		// Build an object name for the current layer
 		LayerPackageParams.SplitStr = SanitizedLayerName;
 
-		// Creating the ImportLayerInfo and LayerInfo objects
-		FLandscapeImportLayerInfo ImportLayerInfo(*LayerName);
-
 		// See if the user has assigned a layer info object via attribute
 		UPackage * Package = nullptr;
 		ULandscapeLayerInfoObject* LayerInfo = GetLandscapeLayerInfoForLayer(*LayerGeoPartObject, *LayerName);
@@ -2405,15 +2852,6 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 		{
 			continue;
 		}
-
-		// Convert the float data to uint8
-		// HF masks need their X/Y sizes swapped
-		if (!FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
-			FloatLayerData, LayerVolumeInfo.YLength, LayerVolumeInfo.XLength,
-			LayerMin, LayerMax,
-			LandscapeXSize, LandscapeYSize,
-			ImportLayerInfo.LayerData))
-			continue;
 		
 		// We will store the data used to convert from Houdini values to int in the DebugColor
 		// This is the only way we'll be able to reconvert those values back to their houdini equivalent afterwards...
@@ -2701,6 +3139,77 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
 	const float& LayerMin, const float& LayerMax,
 	const int32& LandscapeXSize, const int32& LandscapeYSize,
 	TArray<uint8>& LayerData, const bool& NoResize)
+{
+	if (FloatLayerData.Num() < HoudiniXSize * HoudiniYSize)
+		return false;
+
+	// The values are already in memory, convert them in a single band
+	auto GetHoudiniRows = [&](const int32& InStartRow, const int32& InNumRows) -> const float*
+	{
+		return FloatLayerData.GetData() + InStartRow * HoudiniYSize;
+	};
+
+	return ConvertHeightfieldRowsToLandscapeLayer(
+		GetHoudiniRows, HoudiniXSize, HoudiniXSize, HoudiniYSize,
+		LayerMin, LayerMax, LandscapeXSize, LandscapeYSize,
+		LayerData, NoResize);
+}
+
+bool 
+FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
+	const FHoudiniGeoPartObject* LayerHGPO,
+	const int32& HoudiniXSize, const int32& HoudiniYSize,
+	const float& LayerMin, const float& LayerMax,
+	const int32& LandscapeXSize, const int32& LandscapeYSize,
+	TArray<uint8>& LayerData,
+	float& OutRawLayerMin, float& OutRawLayerMax,
+	const bool& NoResize)
+{
+	OutRawLayerMin = 0.f;
+	OutRawLayerMax = 0.f;
+
+	if (!LayerHGPO)
+		return false;
+
+	// Only one band worth of float values is alive at any time.
+	// The layer's own min/max are gathered while the bands go through.
+	TArray<float> BandValues;
+	bool bHasValues = false;
+	auto GetHoudiniRows = [&](const int32& InStartRow, const int32& InNumRows) -> const float*
+	{
+		if (!FetchHoudiniHeightfieldRows(LayerHGPO, HoudiniYSize, InStartRow, InNumRows, BandValues))
+			return nullptr;
+
+		if (!bHasValues && BandValues.Num() > 0)
+		{
+			OutRawLayerMin = BandValues[0];
+			OutRawLayerMax = OutRawLayerMin;
+			bHasValues = true;
+		}
+
+		for (const float& NextFloatVal : BandValues)
+		{
+			OutRawLayerMin = FMath::Min(OutRawLayerMin, NextFloatVal);
+			OutRawLayerMax = FMath::Max(OutRawLayerMax, NextFloatVal);
+		}
+
+		return BandValues.GetData();
+	};
+
+	return ConvertHeightfieldRowsToLandscapeLayer(
+		GetHoudiniRows, GetLandscapeFetchRowsPerBand(HoudiniXSize), HoudiniXSize, HoudiniYSize,
+		LayerMin, LayerMax, LandscapeXSize, LandscapeYSize,
+		LayerData, NoResize);
+}
+
+bool 
+FHoudiniLandscapeTranslator::ConvertHeightfieldRowsToLandscapeLayer(
+	TFunctionRef<const float*(const int32&, const int32&)> GetHoudiniRows,
+	const int32& RowsPerBand,
+	const int32& HoudiniXSize, const int32& HoudiniYSize,
+	const float& LayerMin, const float& LayerMax,
+	const int32& LandscapeXSize, const int32& LandscapeYSize,
+	TArray<uint8>& LayerData, const bool& NoResize)
 {
 	// Convert the float data to uint8
 	LayerData.SetNumUninitialized(HoudiniXSize * HoudiniYSize);
@@ -2709,22 +3218,24 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
 	double LayerZRange = (LayerMax - LayerMin);
 	double LayerZSpacing = (LayerZRange != 0.0) ? (255.0 / (double)(LayerZRange)) : 0.0;
 
-	int32 nUnrealIndex = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
+	// Each Houdini row becomes an Unreal column, so a band of Houdini rows fills a band of Unreal columns.
+	const int32 BandSize = FMath::Clamp(RowsPerBand, 1, FMath::Max(HoudiniXSize, 1));
+	for (int32 BandStartX = 0; BandStartX < HoudiniXSize; BandStartX += BandSize)
 	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
+		const int32 BandNumX = FMath::Min(BandSize, HoudiniXSize - BandStartX);
+		const float* BandValues = GetHoudiniRows(BandStartX, BandNumX);
+		if (!BandValues)
 		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
-
-			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)FMath::Clamp(FloatLayerData[nHoudini], LayerMin, LayerMax) - (double)LayerMin;
-
-			// Then convert it to [0 - 255]
-			DoubleValue *= LayerZSpacing;
-
-			LayerData[nUnrealIndex++] = FMath::RoundToInt(DoubleValue);
+			LayerData.Empty();
+			return false;
 		}
+
+		// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
+		// Values are clamped and offset to [0 - ZRange], then converted to [0 - 255]
+		FHoudiniDataConversion::ConvertHeightfieldToLandscapeLayer(
+			BandValues, BandNumX, HoudiniYSize,
+			LayerData.GetData() + BandStartX, HoudiniXSize,
+			LayerMin, LayerMax, LayerZSpacing);
 	}
 
 	// Finally, resize the data to fit with the new landscape size if needed
@@ -2751,8 +3262,6 @@ FHoudiniLandscapeTranslator::ResizeLayerDataForLandscape(
 	TArray<uint8> NewData;
 	if (!bResample)
 	{
-		NewData.SetNumUninitialized(NewSizeX * NewSizeY);
-
 		const int32 OffsetX = (int32)(NewSizeX - SizeX) / 2;
 		const int32 OffsetY = (int32)(NewSizeY - SizeY) / 2;
 
@@ -2765,11 +3274,10 @@ FHoudiniLandscapeTranslator::ResizeLayerDataForLandscape(
 	else
 	{
 		// Resampling the data
-		NewData.SetNumUninitialized(NewSizeX * NewSizeY);
 		NewData = ResampleData(LayerData, SizeX, SizeY, NewSizeX, NewSizeY);
 	}
 
-	LayerData = NewData;
+	LayerData = MoveTemp(NewData);
 
 	return true;
 }
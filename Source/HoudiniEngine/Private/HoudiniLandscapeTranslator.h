@@ -210,6 +210,12 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			float &OutFloatMin,
 			float &OutFloatMax);
 
+		// Returns the min/max values of a heightfield, fetched from HAPI in bands of rows.
+		static bool GetHoudiniHeightfieldFloatRange(
+			const FHoudiniGeoPartObject* HGPO,
+			float &OutFloatMin,
+			float &OutFloatMax);
+
 		static bool CalcLandscapeSizeFromHeightfieldSize(
 			const int32& HoudiniSizeX,
 			const int32& HoudiniSizeY,
@@ -229,6 +235,34 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			FTransform& LandscapeTransform,
 			const bool& NoResize = false);
 
+		// Same as above, but streams the heightfield's float values from HAPI in bands of rows
+		// so the full float heightfield never has to be held in memory.
+		static bool ConvertHeightfieldDataToLandscapeData(
+			const FHoudiniGeoPartObject* HeightfieldHGPO,
+			const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+			const int32& FinalXSize,
+			const int32& FinalYSize,
+			float FloatMin,
+			float FloatMax,
+			TArray< uint16 >& IntHeightData,
+			FTransform& LandscapeTransform,
+			const bool& NoResize = false);
+
+		// Converts the heightfield to landscape data, pulling the Houdini values through GetHoudiniRows.
+		// GetHoudiniRows(StartRow, NumRows) must return NumRows consecutive rows of the Houdini heightfield
+		// (HeightfieldVolumeInfo.XLength values each), or nullptr on failure.
+		static bool ConvertHeightfieldRowsToLandscapeData(
+			TFunctionRef<const float*(const int32&, const int32&)> GetHoudiniRows,
+			const int32& RowsPerBand,
+			const FHoudiniVolumeInfo& HeightfieldVolumeInfo,
+			const int32& FinalXSize,
+			const int32& FinalYSize,
+			float FloatMin,
+			float FloatMax,
+			TArray< uint16 >& IntHeightData,
+			FTransform& LandscapeTransform,
+			const bool& NoResize = false);
+
 		static bool ResizeHeightDataForLandscape(
 			TArray<uint16>& HeightData,
 			const int32& SizeX,
@@ -289,6 +323,36 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			TArray<uint8>& LayerData,
 			const bool& NoResize = false);
 
+		// Same as above, but streams the layer's float values from HAPI in bands of rows,
+		// and also returns the layer's own min/max values.
+		static bool ConvertHeightfieldLayerToLandscapeLayer(
+			const FHoudiniGeoPartObject* LayerHGPO,
+			const int32& HoudiniXSize,
+			const int32& HoudiniYSize,
+			const float& LayerMin,
+			const float& LayerMax,
+			const int32& LandscapeXSize,
+			const int32& LandscapeYSize,
+			TArray<uint8>& LayerData,
+			float& OutRawLayerMin,
+			float& OutRawLayerMax,
+			const bool& NoResize = false);
+
+		// Converts the layer to landscape layer data, pulling the Houdini values through GetHoudiniRows.
+		// GetHoudiniRows(StartRow, NumRows) must return NumRows consecutive rows of the Houdini layer
+		// (HoudiniYSize values each), or nullptr on failure.
+		static bool ConvertHeightfieldRowsToLandscapeLayer(
+			TFunctionRef<const float*(const int32&, const int32&)> GetHoudiniRows,
+			const int32& RowsPerBand,
+			const int32& HoudiniXSize,
+			const int32& HoudiniYSize,
+			const float& LayerMin,
+			const float& LayerMax,
+			const int32& LandscapeXSize,
+			const int32& LandscapeYSize,
+			TArray<uint8>& LayerData,
+			const bool& NoResize = false);
+
 		static bool ResizeLayerDataForLandscape(
 			TArray< uint8 >& LayerData,
 			const int32& SizeX,
@@ -52,6 +52,8 @@
 #include "PackageTools.h"
 #include "AssetRegistryModule.h"
 #include "UObject/MetaData.h"
+#include "Hash/CityHash.h"
+#include "HAL/IConsoleManager.h"
 
 #if WITH_EDITOR
 	#include "Factories/MaterialFactoryNew.h"
@@ -63,6 +65,231 @@ const int32 FHoudiniMaterialTranslator::MaterialExpressionNodeY = -150;
 const int32 FHoudiniMaterialTranslator::MaterialExpressionNodeStepX = 220;
 const int32 FHoudiniMaterialTranslator::MaterialExpressionNodeStepY = 220;
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineTextureExtractionCacheSize(
+	TEXT("HoudiniEngine.TextureExtractionCacheSize"),
+	256,
+	TEXT("Maximum size (in MB) of the image data kept by the texture extraction cache.\n")
+	TEXT("Only file textures are cached, and reused until their material node recooks, their texture parameter\n")
+	TEXT("or their file changes. COP (op:) textures are always extracted.\n")
+	TEXT("0: Disabled\n")
+	TEXT("256: Default\n")
+);
+
+// State of a material node's texture parameter, used to validate the cached images and planes
+struct FHoudiniTextureStamp
+{
+	// Total cook count of the material node
+	int32 CookCount = -1;
+	// Evaluated value of the texture parameter
+	FString ParmValue;
+	// Modification time and size of the file referenced by the parameter
+	FDateTime SourceTimeStamp;
+	int64 SourceSize = -1;
+
+	bool operator==(const FHoudiniTextureStamp& InOther) const
+	{
+		return CookCount == InOther.CookCount
+			&& SourceTimeStamp == InOther.SourceTimeStamp
+			&& SourceSize == InOther.SourceSize
+			&& ParmValue.Equals(InOther.ParmValue, ESearchCase::CaseSensitive);
+	}
+};
+
+struct FHoudiniCachedImagePlanes
+{
+	FHoudiniTextureStamp Stamp;
+	TArray<FString> ImagePlanes;
+};
+
+struct FHoudiniCachedImage
+{
+	HAPI_NodeId NodeId = -1;
+	FHoudiniTextureStamp Stamp;
+	HAPI_ImageInfo ImageInfo;
+	TArray<char> ImageBuffer;
+	uint64 LastUse = 0;
+};
+
+struct FHoudiniTextureExtractionCache
+{
+	// Image planes, per material node / texture parameter
+	TMap<TPair<HAPI_NodeId, HAPI_ParmId>, FHoudiniCachedImagePlanes> ImagePlanes;
+	// Extracted images, per material node / texture parameter / plane / format / packing
+	TMap<FString, FHoudiniCachedImage> Images;
+	int64 ImagesSize = 0;
+	uint64 UseCounter = 0;
+
+	// Material nodes whose images were cached, per asset, to drop them when the asset is deleted
+	TMap<HAPI_NodeId, TSet<HAPI_NodeId>> AssetMaterialNodes;
+
+	// Texture parameter whose image is currently rendered on the material node
+	TPair<HAPI_NodeId, HAPI_ParmId> RenderedTexture = TPair<HAPI_NodeId, HAPI_ParmId>(-1, -1);
+
+	// Stats, reset for each material creation
+	int32 NumHits = 0;
+	int32 NumMisses = 0;
+	int32 NumUnchangedTextures = 0;
+
+	void Empty()
+	{
+		ImagePlanes.Empty();
+		Images.Empty();
+		ImagesSize = 0;
+		AssetMaterialNodes.Empty();
+		RenderedTexture = TPair<HAPI_NodeId, HAPI_ParmId>(-1, -1);
+	}
+
+	// Removes the image planes and images of the given material nodes
+	void RemoveNodes(const TSet<HAPI_NodeId>& InNodeIds)
+	{
+		for (auto It = ImagePlanes.CreateIterator(); It; ++It)
+		{
+			if (InNodeIds.Contains(It.Key().Key))
+				It.RemoveCurrent();
+		}
+
+		for (auto It = Images.CreateIterator(); It; ++It)
+		{
+			if (!InNodeIds.Contains(It.Value().NodeId))
+				continue;
+
+			ImagesSize -= It.Value().ImageBuffer.Num();
+			It.RemoveCurrent();
+		}
+
+		if (InNodeIds.Contains(RenderedTexture.Key))
+			RenderedTexture = TPair<HAPI_NodeId, HAPI_ParmId>(-1, -1);
+	}
+
+	// Adds an image to the cache, evicting the least recently used images to stay under the size limit
+	void AddImage(const FString& InKey, const HAPI_NodeId& InNodeId, const FHoudiniTextureStamp& InStamp, const HAPI_ImageInfo& InImageInfo, const TArray<char>& InImageBuffer, const int64& InMaxSize)
+	{
+		if (FHoudiniCachedImage* Previous = Images.Find(InKey))
+		{
+			ImagesSize -= Previous->ImageBuffer.Num();
+			Images.Remove(InKey);
+		}
+
+		if (InImageBuffer.Num() > InMaxSize)
+			return;
+
+		while (ImagesSize + InImageBuffer.Num() > InMaxSize && Images.Num() > 0)
+		{
+			const FString* OldestKey = nullptr;
+			uint64 OldestUse = MAX_uint64;
+			for (const TPair<FString, FHoudiniCachedImage>& Image : Images)
+			{
+				if (Image.Value.LastUse < OldestUse)
+				{
+					OldestKey = &Image.Key;
+					OldestUse = Image.Value.LastUse;
+				}
+			}
+
+			const FString KeyToRemove = *OldestKey;
+			ImagesSize -= Images[KeyToRemove].ImageBuffer.Num();
+			Images.Remove(KeyToRemove);
+		}
+
+		FHoudiniCachedImage& CachedImage = Images.Add(InKey);
+		CachedImage.NodeId = InNodeId;
+		CachedImage.Stamp = InStamp;
+		CachedImage.ImageInfo = InImageInfo;
+		CachedImage.ImageBuffer = InImageBuffer;
+		CachedImage.LastUse = ++UseCounter;
+		ImagesSize += InImageBuffer.Num();
+	}
+};
+
+static FHoudiniTextureExtractionCache TextureExtractionCache;
+
+static int64
+GetTextureExtractionCacheMaxSize()
+{
+	return (int64)FMath::Max(CVarHoudiniEngineTextureExtractionCacheSize.GetValueOnAnyThread(), 0) * 1024 * 1024;
+}
+
+// Fetches the material node's cook count, the texture parameter's value and the state of the file
+// it references. Returns false if the texture's source can't be checked for changes, in which case
+// the texture must not be cached.
+static bool
+GetTextureStamp(const HAPI_NodeId& InNodeId, const HAPI_ParmId& InParmId, FHoudiniTextureStamp& OutStamp)
+{
+	HAPI_NodeInfo NodeInfo;
+	FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeInfo(
+		FHoudiniEngine::Get().GetSession(), InNodeId, &NodeInfo))
+		return false;
+
+	HAPI_ParmInfo ParmInfo;
+	FHoudiniApi::ParmInfo_Init(&ParmInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmInfo(
+		FHoudiniEngine::Get().GetSession(), InNodeId, InParmId, &ParmInfo))
+		return false;
+
+	OutStamp.CookCount = NodeInfo.totalCookCount;
+	OutStamp.ParmValue.Empty();
+	if (ParmInfo.stringValuesIndex >= 0 && ParmInfo.size > 0)
+	{
+		HAPI_StringHandle StringHandle = -1;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmStringValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId, true, &StringHandle, ParmInfo.stringValuesIndex, 1))
+			return false;
+
+		FHoudiniEngineString::ToFString(StringHandle, OutStamp.ParmValue);
+	}
+
+	// COP textures (op:) can change without the material node recooking, and the referenced COP node
+	// can't be looked up by path with this version of HAPI: always extract them.
+	if (OutStamp.ParmValue.IsEmpty() || OutStamp.ParmValue.StartsWith(TEXT("op:"), ESearchCase::CaseSensitive))
+		return false;
+
+	// File textures can only be checked if the file is visible from here (not with a remote session)
+	if (!FPaths::FileExists(OutStamp.ParmValue))
+		return false;
+
+	OutStamp.SourceTimeStamp = IFileManager::Get().GetTimeStamp(*OutStamp.ParmValue);
+	OutStamp.SourceSize = IFileManager::Get().FileSize(*OutStamp.ParmValue);
+	return true;
+}
+
+static bool
+HapiRenderTextureToImage(const HAPI_NodeId& InNodeId, const HAPI_ParmId& InParmId)
+{
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::RenderTextureToImage(
+		FHoudiniEngine::Get().GetSession(),
+		InNodeId, InParmId), false);
+
+	TextureExtractionCache.RenderedTexture = TPair<HAPI_NodeId, HAPI_ParmId>(InNodeId, InParmId);
+	return true;
+}
+
+// Identifies a texture's source data by its content
+static FGuid
+ComputeTextureSourceId(const HAPI_ImageInfo& InImageInfo, const TArray<char>& InImageBuffer, const FCreateTexture2DParameters& InTextureParameters)
+{
+	const uint64 DataHash = CityHash64(InImageBuffer.GetData(), InImageBuffer.Num());
+	return FGuid(
+		(uint32)DataHash,
+		(uint32)(DataHash >> 32),
+		HashCombine(GetTypeHash(InImageInfo.xRes), GetTypeHash(InImageInfo.yRes)),
+		InTextureParameters.bUseAlpha ? 1 : 0);
+}
+
+void
+FHoudiniMaterialTranslator::ClearTextureExtractionCache()
+{
+	TextureExtractionCache.Empty();
+}
+
+void
+FHoudiniMaterialTranslator::RemoveTextureExtractionCacheEntries(const HAPI_NodeId& InAssetId)
+{
+	TSet<HAPI_NodeId> MaterialNodeIds;
+	if (TextureExtractionCache.AssetMaterialNodes.RemoveAndCopyValue(InAssetId, MaterialNodeIds))
+		TextureExtractionCache.RemoveNodes(MaterialNodeIds);
+}
+
 bool FHoudiniMaterialTranslator::CreateHoudiniMaterials(
 	const HAPI_NodeId& InAssetId,
 	const FHoudiniPackageParams& InPackageParams,
@@ -96,6 +323,16 @@ bool FHoudiniMaterialTranslator::CreateHoudiniMaterials(
 	UMaterialFactoryNew * MaterialFactory = NewObject<UMaterialFactoryNew>();
 	MaterialFactory->AddToRoot();
 
+	// Don't reuse any previously extracted image when forcing a full recook
+	if (bForceRecookAll || GetTextureExtractionCacheMaxSize() <= 0)
+		TextureExtractionCache.Empty();
+
+	// Images may have been rendered by other cooks since then
+	TextureExtractionCache.RenderedTexture = TPair<HAPI_NodeId, HAPI_ParmId>(-1, -1);
+	TextureExtractionCache.NumHits = 0;
+	TextureExtractionCache.NumMisses = 0;
+	TextureExtractionCache.NumUnchangedTextures = 0;
+
 	for (int32 MaterialIdx = 0; MaterialIdx < InUniqueMaterialIds.Num(); MaterialIdx++)
 	{
 		HAPI_NodeId MaterialId = (HAPI_NodeId)InUniqueMaterialIds[MaterialIdx];		
@@ -118,6 +355,10 @@ bool FHoudiniMaterialTranslator::CreateHoudiniMaterials(
 			continue;
 		}
 
+		// Remember which asset the material node belongs to, so its cached images can be dropped with it
+		if (GetTextureExtractionCacheMaxSize() > 0)
+			TextureExtractionCache.AssetMaterialNodes.FindOrAdd(InAssetId).Add(MaterialInfo.nodeId);
+
 		FString MaterialName = TEXT("");
 		if (!FHoudiniEngineString::ToFString(NodeInfo.nameSH, MaterialName))
 		{
@@ -251,6 +492,13 @@ bool FHoudiniMaterialTranslator::CreateHoudiniMaterials(
 
 	MaterialFactory->RemoveFromRoot();
 
+	if (TextureExtractionCache.NumHits + TextureExtractionCache.NumMisses > 0)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Texture extraction cache: %d hits, %d misses, %d unchanged textures (%.1f MB cached)."),
+			TextureExtractionCache.NumHits, TextureExtractionCache.NumMisses, TextureExtractionCache.NumUnchangedTextures,
+			TextureExtractionCache.ImagesSize / (1024.0 * 1024.0));
+	}
+
 	return true;
 }
 
@@ -543,11 +791,20 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	const FCreateTexture2DParameters& TextureParameters,
 	const TextureGroup& LODGroup, 
 	const FString& TextureType,
-	const FString& NodePath)
+	const FString& NodePath,
+	bool& bOutTextureChanged)
 {
+	bOutTextureChanged = true;
 	if (!Package || Package->IsPendingKill())
 		return nullptr;
 
+	const FGuid SourceId = ComputeTextureSourceId(ImageInfo, ImageBuffer, TextureParameters);
+	const bool bSourceUnchanged = ExistingTexture && !ExistingTexture->IsPendingKill()
+		&& ExistingTexture->Source.IsValid()
+		&& ExistingTexture->Source.GetId() == SourceId
+		&& ExistingTexture->SRGB == TextureParameters.bSRGB
+		&& ExistingTexture->CompressionSettings == TextureParameters.CompressionSettings;
+
 	UTexture2D * Texture = nullptr;
 	if (ExistingTexture)
 	{
@@ -574,6 +831,14 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
 		Package, Texture, HAPI_UNREAL_PACKAGE_META_NODE_PATH, *NodePath);
 
+	// Don't rebuild (and recompress) the existing texture if its source data hasn't changed
+	if (bSourceUnchanged)
+	{
+		TextureExtractionCache.NumUnchangedTextures++;
+		bOutTextureChanged = false;
+		return Texture;
+	}
+
 	// Initialize texture source.
 	Texture->Source.Init(ImageInfo.xRes, ImageInfo.yRes, 1, 1, TSF_BGRA8);
 
@@ -643,6 +908,9 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	}
 	*/
 
+	// Identify the source by its content so unchanged images can be detected on the next cook.
+	Texture->Source.SetId(SourceId, true);
+
 	Texture->PostEditChange();
 
 	return Texture;
@@ -658,13 +926,35 @@ FHoudiniMaterialTranslator::HapiExtractImage(
 	const HAPI_ImageDataFormat& ImageDataFormat,
 	HAPI_ImagePacking ImagePacking,
 	bool bRenderToImage,
-	TArray<char>& OutImageBuffer )
+	TArray<char>& OutImageBuffer,
+	HAPI_ImageInfo& OutImageInfo)
 {
-	if (bRenderToImage)
+	// Reuse the previously extracted image if the material node and texture parameter haven't changed
+	const int64 CacheMaxSize = GetTextureExtractionCacheMaxSize();
+	const FString CacheKey = FString::Printf(TEXT("%d_%d_%s_%d_%d"),
+		MaterialInfo.nodeId, NodeParmId, ANSI_TO_TCHAR(PlaneType), (int32)ImageDataFormat, (int32)ImagePacking);
+	FHoudiniTextureStamp Stamp;
+	const bool bHasStamp = CacheMaxSize > 0 && GetTextureStamp(MaterialInfo.nodeId, NodeParmId, Stamp);
+	if (bHasStamp)
+	{
+		FHoudiniCachedImage* CachedImage = TextureExtractionCache.Images.Find(CacheKey);
+		if (CachedImage && CachedImage->Stamp == Stamp)
+		{
+			TextureExtractionCache.NumHits++;
+			CachedImage->LastUse = ++TextureExtractionCache.UseCounter;
+			OutImageInfo = CachedImage->ImageInfo;
+			OutImageBuffer = CachedImage->ImageBuffer;
+			return true;
+		}
+
+		TextureExtractionCache.NumMisses++;
+	}
+
+	// The image planes may have been fetched from the cache without rendering the texture
+	if (bRenderToImage || TextureExtractionCache.RenderedTexture != TPair<HAPI_NodeId, HAPI_ParmId>(MaterialInfo.nodeId, NodeParmId))
 	{
-		HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::RenderTextureToImage(
-			FHoudiniEngine::Get().GetSession(),
-			MaterialInfo.nodeId, NodeParmId), false);
+		if (!HapiRenderTextureToImage(MaterialInfo.nodeId, NodeParmId))
+			return false;
 	}
 
 	HAPI_ImageInfo ImageInfo;
@@ -697,6 +987,12 @@ FHoudiniMaterialTranslator::HapiExtractImage(
 		MaterialInfo.nodeId, &OutImageBuffer[0],
 		ImageBufferSize), false);
 
+	OutImageInfo = ImageInfo;
+
+	// Rendering the texture might have cooked the material node, so refresh its stamp
+	if (bHasStamp && GetTextureStamp(MaterialInfo.nodeId, NodeParmId, Stamp))
+		TextureExtractionCache.AddImage(CacheKey, MaterialInfo.nodeId, Stamp, OutImageInfo, OutImageBuffer, CacheMaxSize);
+
 	return true;
 }
 
@@ -705,27 +1001,48 @@ FHoudiniMaterialTranslator::HapiGetImagePlanes(
 	const HAPI_ParmId& NodeParmId, const HAPI_MaterialInfo& MaterialInfo, TArray<FString>& OutImagePlanes)
 {
 	OutImagePlanes.Empty();
-		
-	HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::RenderTextureToImage(
-		FHoudiniEngine::Get().GetSession(),
-		MaterialInfo.nodeId, NodeParmId), false);
+
+	// Reuse the previous image planes if the material node and texture parameter haven't changed,
+	// this avoids rendering the texture when its extracted images are cached as well.
+	const TPair<HAPI_NodeId, HAPI_ParmId> CacheKey(MaterialInfo.nodeId, NodeParmId);
+	FHoudiniTextureStamp Stamp;
+	const bool bHasStamp = GetTextureExtractionCacheMaxSize() > 0 && GetTextureStamp(MaterialInfo.nodeId, NodeParmId, Stamp);
+	if (bHasStamp)
+	{
+		const FHoudiniCachedImagePlanes* CachedPlanes = TextureExtractionCache.ImagePlanes.Find(CacheKey);
+		if (CachedPlanes && CachedPlanes->Stamp == Stamp)
+		{
+			OutImagePlanes = CachedPlanes->ImagePlanes;
+			return true;
+		}
+	}
+
+	if (!HapiRenderTextureToImage(MaterialInfo.nodeId, NodeParmId))
+		return false;
 
 	int32 ImagePlaneCount = 0;
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetImagePlaneCount(
 		FHoudiniEngine::Get().GetSession(),
 		MaterialInfo.nodeId, &ImagePlaneCount), false);
 
-	if (ImagePlaneCount <= 0)
-		return true;
+	if (ImagePlaneCount > 0)
+	{
+		TArray<HAPI_StringHandle> ImagePlaneStringHandles;
+		ImagePlaneStringHandles.SetNumZeroed(ImagePlaneCount);
 
-	TArray<HAPI_StringHandle> ImagePlaneStringHandles;
-	ImagePlaneStringHandles.SetNumZeroed(ImagePlaneCount);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetImagePlanes(
+			FHoudiniEngine::Get().GetSession(),
+			MaterialInfo.nodeId, &ImagePlaneStringHandles[0], ImagePlaneCount), false);
 
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetImagePlanes(
-		FHoudiniEngine::Get().GetSession(),
-		MaterialInfo.nodeId, &ImagePlaneStringHandles[0], ImagePlaneCount), false);
-	
-	FHoudiniEngineString::SHArrayToFStringArray(ImagePlaneStringHandles, OutImagePlanes);
+		FHoudiniEngineString::SHArrayToFStringArray(ImagePlaneStringHandles, OutImagePlanes);
+	}
+
+	if (bHasStamp && GetTextureStamp(MaterialInfo.nodeId, NodeParmId, Stamp))
+	{
+		FHoudiniCachedImagePlanes& CachedPlanes = TextureExtractionCache.ImagePlanes.FindOrAdd(CacheKey);
+		CachedPlanes.Stamp = Stamp;
+		CachedPlanes.ImagePlanes = OutImagePlanes;
+	}
 
 	return true;
 }
@@ -793,8 +1110,6 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 	if (!Material || Material->IsPendingKill())
 		return false;
 
-	HAPI_Result Result = HAPI_RESULT_SUCCESS;
-
 	EObjectFlags ObjectFlag = (InPackageParams.PackageMode == EPackageMode::Bake) ? RF_Standalone : RF_NoFlags;
 
 	// Names of generating Houdini parameters.
@@ -939,21 +1254,17 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 		}
 
 		// Retrieve color plane.
+		HAPI_ImageInfo ImageInfo;
+		FHoudiniApi::ImageInfo_Init(&ImageInfo);
 		if (bFoundImagePlanes && FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmDiffuseTextureId, InMaterialInfo, PlaneType,
-			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer, ImageInfo))
 		{
 			UPackage * TextureDiffusePackage = nullptr;
 			if (TextureDiffuse && !TextureDiffuse->IsPendingKill())
 				TextureDiffusePackage = Cast<UPackage>(TextureDiffuse->GetOuter());
 
-			HAPI_ImageInfo ImageInfo;
-			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
-
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
 			{
 				// Create texture.
 				FString TextureDiffuseName;
@@ -985,6 +1296,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				FString NodePath;
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
+				bool bTextureDiffuseChanged = true;
 				// Reuse existing diffuse texture, or create new one.
 				TextureDiffuse = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureDiffuse,
@@ -995,7 +1307,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-					NodePath);
+					NodePath,
+					bTextureDiffuseChanged);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureDiffuse->SetFlags(RF_Public | RF_Standalone);
@@ -1020,9 +1333,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				if (bCreatedNewTextureDiffuse)
 					FAssetRegistryModule::AssetCreated(TextureDiffuse);
 
-				TextureDiffuse->PreEditChange(nullptr);
-				TextureDiffuse->PostEditChange();
-				TextureDiffuse->MarkPackageDirty();
+				if (bTextureDiffuseChanged)
+				{
+					TextureDiffuse->PreEditChange(nullptr);
+					TextureDiffuse->PostEditChange();
+					TextureDiffuse->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -1166,7 +1482,6 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 		return false;
 
 	bool bExpressionCreated = false;
-	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 
 	// Name of generating Houdini parameters.
 	FString GeneratingParameterNameTexture = TEXT("");
@@ -1244,9 +1559,11 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 			bFoundImagePlanes = false;
 		}
 
+		HAPI_ImageInfo ImageInfo;
+		FHoudiniApi::ImageInfo_Init(&ImageInfo);
 		if (bFoundImagePlanes && FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmOpacityTextureId, InMaterialInfo, PlaneType,
-			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, ImagePacking, false, ImageBuffer, ImageInfo))
 		{
 			// Locate sampling expression.
 			ExpressionTextureOpacitySample = Cast< UMaterialExpressionTextureSampleParameter2D >(
@@ -1261,12 +1578,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 			if (TextureOpacity)
 				TextureOpacityPackage = Cast< UPackage >(TextureOpacity->GetOuter());
 
-			HAPI_ImageInfo ImageInfo;
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
-
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
 			{
 				// Create texture.
 				FString TextureOpacityName;
@@ -1298,6 +1610,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				FString NodePath;
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
+				bool bTextureOpacityChanged = true;
 				// Reuse existing opacity texture, or create new one.
 				TextureOpacity = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureOpacity,
@@ -1308,7 +1621,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
-					NodePath);
+					NodePath,
+					bTextureOpacityChanged);
 
  				// if (BakeMode == EBakeMode::CookToTemp)
 				TextureOpacity->SetFlags(RF_Public | RF_Standalone);
@@ -1352,9 +1666,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				if (bCreatedNewTextureOpacity)
 					FAssetRegistryModule::AssetCreated(TextureOpacity);
 
-				TextureOpacity->PreEditChange(nullptr);
-				TextureOpacity->PostEditChange();
-				TextureOpacity->MarkPackageDirty();
+				if (bTextureOpacityChanged)
+				{
+					TextureOpacity->PreEditChange(nullptr);
+					TextureOpacity->PostEditChange();
+					TextureOpacity->MarkPackageDirty();
+				}
 
 				bExpressionCreated = true;
 			}
@@ -1570,7 +1887,6 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 
 	bool bExpressionCreated = false;
 	bool bTangentSpaceNormal = true;
-	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 
 	EObjectFlags ObjectFlag = (InPackageParams.PackageMode == EPackageMode::Bake) ? RF_Standalone : RF_NoFlags;
 
@@ -1649,9 +1965,11 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 			
 		// Retrieve color plane.
 		TArray<char> ImageBuffer;
+		HAPI_ImageInfo ImageInfo;
+		FHoudiniApi::ImageInfo_Init(&ImageInfo);
 		if (FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmNormalTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
-			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer, ImageInfo))
 		{
 			UMaterialExpressionTextureSampleParameter2D * ExpressionNormal =
 				Cast< UMaterialExpressionTextureSampleParameter2D >(Material->Normal.Expression);
@@ -1675,13 +1993,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 			if (TextureNormal)
 				TextureNormalPackage = Cast< UPackage >(TextureNormal->GetOuter());
 
-			HAPI_ImageInfo ImageInfo;
-			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
-
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
 			{
 				// Create texture.
 				FString TextureNormalName;
@@ -1713,6 +2025,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				FString NodePath;
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
+				bool bTextureNormalChanged = true;
 				// Reuse existing normal texture, or create new one.
 				TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureNormal,
@@ -1723,7 +2036,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_WorldNormalMap,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-					NodePath);
+					NodePath,
+					bTextureNormalChanged);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -1758,9 +2072,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				if (bCreatedNewTextureNormal)
 					FAssetRegistryModule::AssetCreated(TextureNormal);
 
-				TextureNormal->PreEditChange(nullptr);
-				TextureNormal->PostEditChange();
-				TextureNormal->MarkPackageDirty();
+				if (bTextureNormalChanged)
+				{
+					TextureNormal->PreEditChange(nullptr);
+					TextureNormal->PostEditChange();
+					TextureNormal->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -1808,9 +2125,11 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 			TArray<char> ImageBuffer;
 
 			// Retrieve color plane - this will contain normal data.
+			HAPI_ImageInfo ImageInfo;
+			FHoudiniApi::ImageInfo_Init(&ImageInfo);
 			if (FHoudiniMaterialTranslator::HapiExtractImage(
 				ParmDiffuseTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_NORMAL,
-				HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGB, true, ImageBuffer))
+				HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGB, true, ImageBuffer, ImageInfo))
 			{
 				UMaterialExpressionTextureSampleParameter2D * ExpressionNormal =
 					Cast<UMaterialExpressionTextureSampleParameter2D>(Material->Normal.Expression);
@@ -1834,12 +2153,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				if (TextureNormal)
 					TextureNormalPackage = Cast<UPackage>(TextureNormal->GetOuter());
 
-				HAPI_ImageInfo ImageInfo;
-				FHoudiniApi::ImageInfo_Init(&ImageInfo);
-				Result = FHoudiniApi::GetImageInfo(
-					FHoudiniEngine::Get().GetSession(),	InMaterialInfo.nodeId, &ImageInfo);
-
-				if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+				if (ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
 				{
 					// Create texture.
 					FString TextureNormalName;
@@ -1871,6 +2185,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					FString NodePath;
 					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
+					bool bTextureNormalChanged = true;
 					// Reuse existing normal texture, or create new one.
 					TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
 						TextureNormal, 
@@ -1881,7 +2196,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 						CreateTexture2DParameters,
 						TEXTUREGROUP_WorldNormalMap,
 						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-						NodePath);
+						NodePath,
+						bTextureNormalChanged);
 
 					//if (BakeMode == EBakeMode::CookToTemp)
 					TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -1914,9 +2230,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					if (bCreatedNewTextureNormal)
 						FAssetRegistryModule::AssetCreated(TextureNormal);
 
-					TextureNormal->PreEditChange(nullptr);
-					TextureNormal->PostEditChange();
-					TextureNormal->MarkPackageDirty();
+					if (bTextureNormalChanged)
+					{
+						TextureNormal->PreEditChange(nullptr);
+						TextureNormal->PostEditChange();
+						TextureNormal->MarkPackageDirty();
+					}
 
 					bExpressionCreated = true;
 				}
@@ -1944,7 +2263,6 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 		return false;
 
 	bool bExpressionCreated = false;
-	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 
 	EObjectFlags ObjectFlag = (InPackageParams.PackageMode == EPackageMode::Bake) ? RF_Standalone : RF_NoFlags;
 
@@ -1995,9 +2313,11 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 		TArray<char> ImageBuffer;
 
 		// Retrieve color plane.
+		HAPI_ImageInfo ImageInfo;
+		FHoudiniApi::ImageInfo_Init(&ImageInfo);
 		if (FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmSpecularTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
-			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer, ImageInfo))
 		{
 			UMaterialExpressionTextureSampleParameter2D * ExpressionSpecular =
 				Cast< UMaterialExpressionTextureSampleParameter2D >(Material->Specular.Expression);
@@ -2021,13 +2341,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 			if (TextureSpecular)
 				TextureSpecularPackage = Cast< UPackage >(TextureSpecular->GetOuter());
 
-			HAPI_ImageInfo ImageInfo;
-			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
-
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
 			{
 				// Create texture.
 				FString TextureSpecularName;
@@ -2059,6 +2373,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				FString NodePath;
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
+				bool bTextureSpecularChanged = true;
 				// Reuse existing specular texture, or create new one.
 				TextureSpecular = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureSpecular,
@@ -2069,7 +2384,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
-					NodePath);
+					NodePath,
+					bTextureSpecularChanged);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureSpecular->SetFlags(RF_Public | RF_Standalone);
@@ -2103,9 +2419,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				if (bCreatedNewTextureSpecular)
 					FAssetRegistryModule::AssetCreated(TextureSpecular);
 
-				TextureSpecular->PreEditChange(nullptr);
-				TextureSpecular->PostEditChange();
-				TextureSpecular->MarkPackageDirty();
+				if (bTextureSpecularChanged)
+				{
+					TextureSpecular->PreEditChange(nullptr);
+					TextureSpecular->PostEditChange();
+					TextureSpecular->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2195,7 +2514,6 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 		return false;
 
 	bool bExpressionCreated = false;
-	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 
 	EObjectFlags ObjectFlag = (InPackageParams.PackageMode == EPackageMode::Bake) ? RF_Standalone : RF_NoFlags;
 
@@ -2245,9 +2563,11 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 	{
 		TArray<char> ImageBuffer;
 		// Retrieve color plane.
+		HAPI_ImageInfo ImageInfo;
+		FHoudiniApi::ImageInfo_Init(&ImageInfo);
 		if (FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmRoughnessTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
-			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer ) )
+			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer, ImageInfo))
 		{
 			UMaterialExpressionTextureSampleParameter2D* ExpressionRoughness =
 				Cast< UMaterialExpressionTextureSampleParameter2D >(Material->Roughness.Expression);
@@ -2271,13 +2591,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 			if (TextureRoughness)
 				TextureRoughnessPackage = Cast< UPackage >(TextureRoughness->GetOuter());
 
-			HAPI_ImageInfo ImageInfo;
-			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
-
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
 			{
 				// Create texture.
 				FString TextureRoughnessName;
@@ -2309,6 +2623,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				FString NodePath;
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
+				bool bTextureRoughnessChanged = true;
 				// Reuse existing roughness texture, or create new one.
 				TextureRoughness = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureRoughness,
@@ -2319,7 +2634,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
-					NodePath);
+					NodePath,
+					bTextureRoughnessChanged);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureRoughness->SetFlags(RF_Public | RF_Standalone);
@@ -2351,9 +2667,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				if (bCreatedNewTextureRoughness)
 					FAssetRegistryModule::AssetCreated(TextureRoughness);
 
-				TextureRoughness->PreEditChange(nullptr);
-				TextureRoughness->PostEditChange();
-				TextureRoughness->MarkPackageDirty();
+				if (bTextureRoughnessChanged)
+				{
+					TextureRoughness->PreEditChange(nullptr);
+					TextureRoughness->PostEditChange();
+					TextureRoughness->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2447,7 +2766,6 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 		return false;
 
 	bool bExpressionCreated = false;
-	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 
 	EObjectFlags ObjectFlag = (InPackageParams.PackageMode == EPackageMode::Bake) ? RF_Standalone : RF_NoFlags;
 
@@ -2498,9 +2816,11 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 		TArray<char> ImageBuffer;
 
 		// Retrieve color plane.
+		HAPI_ImageInfo ImageInfo;
+		FHoudiniApi::ImageInfo_Init(&ImageInfo);
 		if (FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmMetallicTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
-			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer, ImageInfo))
 		{
 			UMaterialExpressionTextureSampleParameter2D * ExpressionMetallic =
 				Cast< UMaterialExpressionTextureSampleParameter2D >(Material->Metallic.Expression);
@@ -2524,13 +2844,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 			if (TextureMetallic)
 				TextureMetallicPackage = Cast< UPackage >(TextureMetallic->GetOuter());
 
-			HAPI_ImageInfo ImageInfo;
-			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
-
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
 			{
 				// Create texture.
 				FString TextureMetallicName;
@@ -2563,6 +2877,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				FString NodePath;
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
+				bool bTextureMetallicChanged = true;
 				// Reuse existing metallic texture, or create new one.
 				TextureMetallic = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureMetallic, 
@@ -2573,7 +2888,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
-					NodePath);
+					NodePath,
+					bTextureMetallicChanged);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureMetallic->SetFlags(RF_Public | RF_Standalone);
@@ -2605,9 +2921,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				if (bCreatedNewTextureMetallic)
 					FAssetRegistryModule::AssetCreated(TextureMetallic);
 
-				TextureMetallic->PreEditChange(nullptr);
-				TextureMetallic->PostEditChange();
-				TextureMetallic->MarkPackageDirty();
+				if (bTextureMetallicChanged)
+				{
+					TextureMetallic->PreEditChange(nullptr);
+					TextureMetallic->PostEditChange();
+					TextureMetallic->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2700,7 +3019,6 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 		return false;
 
 	bool bExpressionCreated = false;
-	HAPI_Result Result = HAPI_RESULT_SUCCESS;
 
 	EObjectFlags ObjectFlag = (InPackageParams.PackageMode == EPackageMode::Bake) ? RF_Standalone : RF_NoFlags;
 
@@ -2751,9 +3069,11 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 		TArray< char > ImageBuffer;
 
 		// Retrieve color plane.
+		HAPI_ImageInfo ImageInfo;
+		FHoudiniApi::ImageInfo_Init(&ImageInfo);
 		if (FHoudiniMaterialTranslator::HapiExtractImage(
 			ParmEmissiveTextureId, InMaterialInfo, HAPI_UNREAL_MATERIAL_TEXTURE_COLOR,
-			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer))
+			HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true, ImageBuffer, ImageInfo))
 		{
 			UMaterialExpressionTextureSampleParameter2D * ExpressionEmissive =
 				Cast< UMaterialExpressionTextureSampleParameter2D >(Material->EmissiveColor.Expression);
@@ -2777,13 +3097,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 			if (TextureEmissive)
 				TextureEmissivePackage = Cast< UPackage >(TextureEmissive->GetOuter());
 
-			HAPI_ImageInfo ImageInfo;
-			FHoudiniApi::ImageInfo_Init(&ImageInfo);
-			Result = FHoudiniApi::GetImageInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InMaterialInfo.nodeId, &ImageInfo);
-
-			if (Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
+			if (ImageInfo.xRes > 0 && ImageInfo.yRes > 0)
 			{
 				// Create texture.
 				FString TextureEmissiveName;
@@ -2815,6 +3129,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 				FString NodePath;
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
+				bool bTextureEmissiveChanged = true;
 				// Reuse existing emissive texture, or create new one.
 				TextureEmissive = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureEmissive,
@@ -2825,7 +3140,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
-					NodePath);
+					NodePath,
+					bTextureEmissiveChanged);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureEmissive->SetFlags(RF_Public | RF_Standalone);
@@ -2857,9 +3173,12 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 				if (bCreatedNewTextureEmissive)
 					FAssetRegistryModule::AssetCreated(TextureEmissive);
 
-				TextureEmissive->PreEditChange(nullptr);
-				TextureEmissive->PostEditChange();
-				TextureEmissive->MarkPackageDirty();
+				if (bTextureEmissiveChanged)
+				{
+					TextureEmissive->PreEditChange(nullptr);
+					TextureEmissive->PostEditChange();
+					TextureEmissive->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
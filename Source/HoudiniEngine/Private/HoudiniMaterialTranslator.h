@@ -101,6 +101,8 @@ public:
 
 
 	// Create a texture from given information.
+	// The existing texture is left untouched if it was already built from the same image data,
+	// bOutTextureChanged is set to false in that case.
 	static UTexture2D* CreateUnrealTexture(
 		UTexture2D* ExistingTexture,
 		const HAPI_ImageInfo& ImageInfo,
@@ -110,9 +112,17 @@ public:
 		const FCreateTexture2DParameters& TextureParameters,
 		const TextureGroup& LODGroup,
 		const FString& TextureType,
-		const FString& NodePath);
+		const FString& NodePath,
+		bool& bOutTextureChanged);
 
-	// HAPI : Retrieve a list of image planes.
+	// The texture extraction cache is keyed by node ids, so it is only valid for the current session.
+	static void ClearTextureExtractionCache();
+
+	// Drops the cached images of an asset's material nodes, when the asset is deleted.
+	static void RemoveTextureExtractionCacheEntries(const HAPI_NodeId& InAssetId);
+
+	// HAPI : Extract image data.
+	// Extracted images are cached until the material node recooks or the texture parameter changes.
 	static bool HapiExtractImage(
 		const HAPI_ParmId& NodeParmId,
 		const HAPI_MaterialInfo& MaterialInfo,
@@ -120,9 +130,10 @@ public:
 		const HAPI_ImageDataFormat& ImageDataFormat,
 		HAPI_ImagePacking ImagePacking,
 		bool bRenderToImage,
-		TArray<char>& OutImageBuffer);
+		TArray<char>& OutImageBuffer,
+		HAPI_ImageInfo& OutImageInfo);
 
-	// HAPI : Extract image data.
+	// HAPI : Retrieve a list of image planes.
 	static bool HapiGetImagePlanes(
 		const HAPI_ParmId& NodeParmId, const HAPI_MaterialInfo& MaterialInfo, TArray<FString>& OutImagePlanes);
 	
@@ -36,6 +36,7 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniMaterialTranslator.h"
 #include "HoudiniAssetActor.h"
+#include "HoudiniDataConversion.h"
 
 #include "HoudiniStaticMesh.h"
 #include "HoudiniStaticMeshComponent.h"
@@ -60,7 +61,9 @@
 #include "AI/Navigation/NavCollisionBase.h"
 #include "ObjectTools.h"
 
-// #include "Async/ParallelFor.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/App.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 
@@ -81,6 +84,20 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineMeshBuildParallel(
+	TEXT("HoudiniEngine.MeshBuildParallel"),
+	1,
+	TEXT("When enabled, the proxy meshes of a part's splits and their vertices/triangles are built in parallel.\n")
+	TEXT("0: Build serially\n")
+	TEXT("1: Build in parallel (default)\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineMeshBuildParallelBatchSize(
+	TEXT("HoudiniEngine.MeshBuildParallelBatchSize"),
+	4096,
+	TEXT("Number of vertices/triangles processed by each task when building the proxy meshes in parallel.\n")
+);
+
 // 
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
@@ -2004,13 +2021,11 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 				int32 WedgeUVCount = SplitUVs.Num() / 2;
 				if (SplitUVs.Num() > 0 && SplitUVs.IsValidIndex((WedgeUVCount - 1) * 2 + 1))
 				{
-					RawMesh.WedgeTexCoords[TexCoordIdx].SetNumZeroed(WedgeUVCount);
-					for (int32 WedgeUVIdx = 0; WedgeUVIdx < WedgeUVCount; ++WedgeUVIdx)
-					{
-						// We need to flip V coordinate when it's coming from HAPI.
-						RawMesh.WedgeTexCoords[TexCoordIdx][WedgeUVIdx].X = SplitUVs[WedgeUVIdx * 2 + 0];
-						RawMesh.WedgeTexCoords[TexCoordIdx][WedgeUVIdx].Y = 1.0f - SplitUVs[WedgeUVIdx * 2 + 1];
-					}
+					RawMesh.WedgeTexCoords[TexCoordIdx].SetNumUninitialized(WedgeUVCount);
+
+					// We need to flip V coordinate when it's coming from HAPI.
+					FHoudiniDataConversion::FlipUVs(
+						SplitUVs.GetData(), (float*)RawMesh.WedgeTexCoords[TexCoordIdx].GetData(), WedgeUVCount);
 
 					UVChannelCount++;
 					if (UVChannelCount <= 2)
@@ -2174,26 +2189,20 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 			// needed by the current split.
 			//
 			int32 VertexPositionsCount = NeededVertices.Num();
-			RawMesh.VertexPositions.SetNumZeroed(VertexPositionsCount);
-
-			for (int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx)
-			{
-				int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-				if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-				{
-					// Error retrieving positions.
-					HOUDINI_LOG_WARNING(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-						TEXT("- skipping."),
-						HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+			RawMesh.VertexPositions.SetNumUninitialized(VertexPositionsCount);
 
-					continue;
-				}
+			// We need to swap Z and Y coordinate here, and convert from m to cm. 
+			int32 InvalidPositionsCount = FHoudiniDataConversion::GatherSwizzleAndScaleFloat3(
+				PartPositions.GetData(), PartPositions.Num(), NeededVertices.GetData(),
+				(float*)RawMesh.VertexPositions.GetData(), VertexPositionsCount, HAPI_UNREAL_SCALE_FACTOR_POSITION);
 
-				// We need to swap Z and Y coordinate here, and convert from m to cm. 
-				RawMesh.VertexPositions[VertexPositionIdx].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				RawMesh.VertexPositions[VertexPositionIdx].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				RawMesh.VertexPositions[VertexPositionIdx].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			if (InvalidPositionsCount > 0)
+			{
+				// Error retrieving positions.
+				HOUDINI_LOG_WARNING(
+					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
+					TEXT("- skipping."),
+					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
 			}
 
 			/*
@@ -3277,28 +3286,28 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			TVertexAttributesRef<FVector> VertexPositions =
 				MeshDescription->VertexAttributes().GetAttributesRef<FVector>(MeshAttribute::Vertex::Position);
 				
-			MeshDescription->ReserveNewVertices(SplitNeededVertices.Num());
-			for ( const int32& NeededVertexIndex : SplitNeededVertices)
+			// We need to swap Z and Y coordinate here, and convert from m to cm. 
+			TArray<FVector> SplitPositions;
+			SplitPositions.SetNumUninitialized(SplitNeededVertices.Num());
+			int32 InvalidPositionsCount = FHoudiniDataConversion::GatherSwizzleAndScaleFloat3(
+				PartPositions.GetData(), PartPositions.Num(), SplitNeededVertices.GetData(),
+				(float*)SplitPositions.GetData(), SplitPositions.Num(), HAPI_UNREAL_SCALE_FACTOR_POSITION);
+
+			if (InvalidPositionsCount > 0)
+			{
+				// Error when retrieving positions.
+				HOUDINI_LOG_WARNING(
+					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
+					TEXT("- skipping."),
+					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+			}
+
+			MeshDescription->ReserveNewVertices(SplitPositions.Num());
+			for (const FVector& SplitPosition : SplitPositions)
 			{
 				// Create a new Vertex
 				FVertexID VertexID = MeshDescription->CreateVertex();
-				if (PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-				{
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				}
-				else
-				{
-					// Error when retrieving positions.
-					HOUDINI_LOG_WARNING(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-						TEXT("- skipping."),
-						HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-
-					continue;
-				}
+				VertexPositions[VertexID] = SplitPosition;
 			}
 
 			if (bDoTiming)
@@ -3690,6 +3699,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			{
 				FHoudiniMeshTranslator::TransferPartAttributesToSplit<float>(
 					SplitVertexList, AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], SplitUVSets[TexCoordIdx]);
+
+				// We need to flip V coordinate when it's coming from HAPI.
+				TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
+				FHoudiniDataConversion::FlipUVs(SplitUVs.GetData(), SplitUVs.GetData(), SplitUVs.Num() / 2);
 			}
 			TVertexInstanceAttributesRef<FVector2D> VertexInstanceUVs = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector2D>(MeshAttribute::VertexInstance::TextureCoordinate);					
 			VertexInstanceUVs.SetNumIndices(UVSetCount);
@@ -3802,10 +3815,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 					{
 						if (HasUVSets[UVIndex])
 						{
-							// We need to flip V coordinate when it's coming from HAPI.
+							// The V coordinates have already been flipped
 							FVector2D CurrentUV;
 							CurrentUV.X = SplitUVSets[UVIndex][SplitIndex * 2 + 0];
-							CurrentUV.Y = 1.0f - SplitUVSets[UVIndex][SplitIndex * 2 + 1];
+							CurrentUV.Y = SplitUVSets[UVIndex][SplitIndex * 2 + 1];
 
 							VertexInstanceUVs.Set(VertexInstanceID, UVIndex, CurrentUV);
 						}
@@ -4270,6 +4283,20 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 	if(bDoTiming)
 		HOUDINI_LOG_MESSAGE(TEXT("CreateHoudiniStaticMesh() - Pre Split-Loop in %f seconds."), tick - time_start);
 
+	// Splits whose mesh needs to be rebuilt or have its materials updated
+	struct FHoudiniStaticMeshSplitJob
+	{
+		int32 SplitId = -1;
+		FString SplitGroupName;
+		FHoudiniOutputObjectIdentifier OutputObjectIdentifier;
+		UHoudiniStaticMesh* StaticMesh = nullptr;
+		const TArray<int32>* SplitVertexList = nullptr;
+		bool bRebuild = false;
+		// Indicates if the output object was found in InputObjects rather than OutputObjects
+		bool bOutputObjectIsInput = false;
+	};
+	TArray<FHoudiniStaticMeshSplitJob> SplitJobs;
+
 	// Iterate through all detected split groups we care about and split geometry.
 	bool bMainGeoOrFirstLODFound = false;
 	for (int32 SplitId = 0; SplitId < AllSplitGroups.Num(); SplitId++)
@@ -4380,6 +4407,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			bNewStaticMeshCreated = true;
 		}
 
+		const bool bOutputObjectIsInput = FoundOutputObject != nullptr;
 		if (!FoundOutputObject)
 		{
 			// If we couldnt find a previous output object, create a new one
@@ -4394,381 +4422,106 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			tick = FPlatformTime::Seconds();
 		}
 
-		if (bRebuildStaticMesh)
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Build/Rebuild UHoudiniStaticMesh"));
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			//  INDICES
-			//--------------------------------------------------------------------------------------------------------------------- 
-
-			//
-			// Because of the splits, we don't need to declare all the vertices in the Part, 
-			// but only the one that are currently used by the split's faces.
-			// The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
-			// We also keep track of the needed vertices index to declare them easily afterwards.
-			//
-
-			// IndicesMapper:
-			// Maps index values for all vertices in the Part:
-			// - Vertices unused by the split will be set to -1
-			// - Used vertices will have their value set to the "NewIndex"
-			// So that IndicesMapper[ oldIndex ] => newIndex
-			TArray<int32> IndicesMapper;
-			IndicesMapper.Init(-1, SplitVertexList.Num());
-			int32 CurrentMapperIndex = 0;
-
-			// NeededVertices:
-			// Array containing the old index of the needed vertices for the current split
-			// NeededVertices[ newIndex ] => oldIndex
-			TArray< int32 > NeededVertices;
-			NeededVertices.Reserve(SplitVertexList.Num() / 3);
-			TArray< int32 > TriangleIndices;
-			TriangleIndices.Reserve(SplitVertexList.Num());
-
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Build IndicesMapper and NeededVertices"));
-
-				int32 ValidVertexId = 0;
-				for (int32 VertexIdx = 0; VertexIdx < SplitVertexList.Num(); VertexIdx += 3)
-				{
-					int32 WedgeCheck = SplitVertexList[VertexIdx + 0];
-					if (WedgeCheck == -1)
-						continue;
-
-					int32 WedgeIndices[3] =
-					{
-						SplitVertexList[VertexIdx + 0],
-						SplitVertexList[VertexIdx + 1],
-						SplitVertexList[VertexIdx + 2]
-					};
-
-					// Ensure the indices are valid
-					if (!IndicesMapper.IsValidIndex(WedgeIndices[0])
-						|| !IndicesMapper.IsValidIndex(WedgeIndices[1])
-						|| !IndicesMapper.IsValidIndex(WedgeIndices[2]))
-					{
-						// Invalid face index.
-						HOUDINI_LOG_MESSAGE(
-							TEXT("Creating Dynamic Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] has some invalid face indices"),
-							HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-						continue;
-					}
-
-					// Converting Old (Part) Indices to New (Split) Indices:
-					for (int32 i = 0; i < 3; i++)
-					{
-						if (IndicesMapper[WedgeIndices[i]] < 0)
-						{
-							// This old index has not yet been "converted" to a new index
-							NeededVertices.Add(WedgeIndices[i]);
-							IndicesMapper[WedgeIndices[i]] = CurrentMapperIndex;
-							CurrentMapperIndex++;
-						}
-
-						// Replace the old index with the new one
-						WedgeIndices[i] = IndicesMapper[WedgeIndices[i]];
-					}
-
-					// Flip wedge indices to fix the winding order.
-					TriangleIndices.Add(WedgeIndices[0]);
-					TriangleIndices.Add(WedgeIndices[2]);
-					TriangleIndices.Add(WedgeIndices[1]);
-
-					ValidVertexId += 3;
-				}
-			}
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// NORMALS 
-			//--------------------------------------------------------------------------------------------------------------------- 
-
-			// Extract this part's normal if needed
-			UpdatePartNormalsIfNeeded();
-
-			// Get the normals for this split
-			TArray<float> SplitNormals;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoNormals, PartNormals, SplitNormals);
-
-			// Check that the number of normal we retrieved is correct
-			int32 NormalCount = SplitNormals.Num() / 3;
-			if (NormalCount < 0 || NormalCount < NeededVertices.Num())
-			{
-				// Ignore normals
-				NormalCount = 0;
-				HOUDINI_LOG_WARNING(TEXT("Invalid normal count detected - Skipping normals."));
-			}
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// TANGENTS
-			//--------------------------------------------------------------------------------------------------------------------- 
-
-			TArray<float> SplitTangentU;
-			TArray<float> SplitTangentV;
-			int32 TangentUCount = 0;
-			int32 TangentVCount = 0;
-			// No need to read the tangents if we want unreal to recompute them after		
-			const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
-			bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
-
-			bool bGenerateTangents = bReadTangents;
-			if (bReadTangents)
-			{
-				// Extract this part's Tangents if needed
-				UpdatePartTangentsIfNeeded();
-
-				// Get the Tangents for this split
-				FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-					SplitVertexList, AttribInfoTangentU, PartTangentU, SplitTangentU);
-
-				// Get the binormals for this split
-				FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-					SplitVertexList, AttribInfoTangentV, PartTangentV, SplitTangentV);
-
-				// We need to manually generate tangents if:
-				// - we have normals but dont have tangentu or tangentv attributes
-				// - we have not specified that we wanted unreal to generate them
-				bGenerateTangents = (SplitNormals.Num() > 0) && (SplitTangentU.Num() <= 0 || SplitTangentV.Num() <= 0);
-
-				// Check that the number of tangents read matches the number of normals
-				TangentUCount = SplitTangentU.Num() / 3;
-				TangentVCount = SplitTangentV.Num() / 3;
-				if (TangentUCount != NormalCount || TangentVCount != NormalCount)
-				{
-					HOUDINI_LOG_MESSAGE(TEXT("CreateHoudiniStaticMesh: Generate tangents due to count mismatch (# U Tangents = %d; # V Tangents = %d; # Normals = %d)"), TangentUCount, TangentVCount, NormalCount);
-					bGenerateTangents = true;
-				}
-
-				if (bGenerateTangents && (HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always))
-				{
-					// No need to generate tangents if we want unreal to recompute them after
-					bGenerateTangents = false;
-				}
-			}
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			//  VERTEX COLORS AND ALPHAS
-			//---------------------------------------------------------------------------------------------------------------------
-
-			// Extract this part's colors if needed
-			UpdatePartColorsIfNeeded();
-
-			// Get the colors values for this split
-			TArray<float> SplitColors;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoColors, PartColors, SplitColors);
-
-			// Extract this part's alpha values if needed
-			UpdatePartAlphasIfNeeded();
-
-			// Get the colors values for this split
-			TArray<float> SplitAlphas;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoAlpha, PartAlphas, SplitAlphas);
-
-			const int32 ColorsCount = AttribInfoColors.exists ? SplitColors.Num() / AttribInfoColors.tupleSize : 0;
-			const bool bSplitColorValid = AttribInfoColors.exists && (AttribInfoColors.tupleSize >= 3) && ColorsCount > 0;
-			const bool bSplitAlphaValid = AttribInfoAlpha.exists && (SplitAlphas.Num() == ColorsCount);
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			//  UVS
-			//--------------------------------------------------------------------------------------------------------------------- 
-
-			// Extract this part's UV sets if needed
-			UpdatePartUVSetsIfNeeded();
-
-			// See if we need to transfer uv point attributes to vertex attributes.
-			int32 NumUVLayers = 0;
-			TArray<TArray<float>> SplitUVSets;
-			SplitUVSets.SetNum(MAX_STATIC_TEXCOORDS);
-			for (int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx)
-			{
-				FHoudiniMeshTranslator::TransferPartAttributesToSplit<float>(
-					SplitVertexList, AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], SplitUVSets[TexCoordIdx]);
-				if (SplitUVSets[TexCoordIdx].Num() > 0)
-				{
-					NumUVLayers++;
-				}
-			}
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// MATERIAL ATTRIBUTE OVERRIDES
-			//---------------------------------------------------------------------------------------------------------------------
-
-			// TODO: These are actually per faces, not per vertices...
-			// Need to update!!
-			UpdatePartFaceMaterialOverridesIfNeeded();
-
-			//
-			// Initialize mesh
-			// 
-			const int32 NumVertexPositions = NeededVertices.Num();
-			const int32 NumTriangles = TriangleIndices.Num() / 3;
-			const bool bHasPerFaceMaterials = PartFaceMaterialOverrides.Num() > 0 || (PartUniqueMaterialIds.Num() > 0 && !bOnlyOneFaceMaterial);
-
-			FoundStaticMesh->Initialize(
-				NumVertexPositions,
-				NumTriangles,
-				NumUVLayers,					   // NumUVLayers
-				0,								   // InitialNumStaticMaterials
-				NormalCount > 0,				   // HasNormals
-				NormalCount > 0 && bReadTangents,  // HasTangents
-				bSplitColorValid,				   // HasColors
-				bHasPerFaceMaterials			   // HasPerFaceMaterials
-			);
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// POSITIONS
-			//--------------------------------------------------------------------------------------------------------------------- 
-			UpdatePartPositionIfNeeded();
-
-			//
-			// Transfer vertex positions:
-			//
-			// Because of the split, we're only interested in the needed vertices.
-			// Instead of declaring all the Positions, we'll only declare the vertices
-			// needed by the current split.
-			//
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions"));
-
-				for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-				//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
-				{
-					int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-					if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-					{
-						// Error retrieving positions.
-						HOUDINI_LOG_WARNING(
-							TEXT("Creating Dynamic Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-							TEXT("- skipping."),
-							HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-						continue;
-					}
-
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector(
-						PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
-					));
-				}//);
-			}
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// FACES / TRIS
-			// Now set Normals, UVs and Colors on mesh points and AttributeSet
-			//---------------------------------------------------------------------------------------------------------------------
-
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values"));
-
-				// Now add the triangles to the mesh
-				for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-				// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
-				{
-
-					const int32 TriVertIdx0 = TriangleIdx * 3;
-					FoundStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(
-						TriangleIndices[TriVertIdx0 + 0],
-						TriangleIndices[TriVertIdx0 + 1],
-						TriangleIndices[TriVertIdx0 + 2]
-					));
+		// The geometry and the materials are set once all the meshes have been found/created
+		FHoudiniStaticMeshSplitJob& SplitJob = SplitJobs.AddDefaulted_GetRef();
+		SplitJob.SplitId = SplitId;
+		SplitJob.SplitGroupName = SplitGroupName;
+		SplitJob.OutputObjectIdentifier = OutputObjectIdentifier;
+		SplitJob.StaticMesh = FoundStaticMesh;
+		SplitJob.SplitVertexList = &SplitVertexList;
+		SplitJob.bRebuild = bRebuildStaticMesh;
+		SplitJob.bOutputObjectIsInput = bOutputObjectIsInput;
+	}
 
-					const int32 TriWindingIndex[3] = { 0, 2, 1 };
-					if (NormalCount > 0 && SplitNormals.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1))
-					{
-						// Flip Z and Y coordinate for normal, but don't scale
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-						{
-							const FVector Normal(
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 0],
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 2],
-								SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 1]
-							);
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// GEOMETRY
+	//--------------------------------------------------------------------------------------------------------------------- 
 
-							FoundStaticMesh->SetTriangleVertexNormal(TriangleIdx, TriWindingIndex[ElementIdx], Normal);
+	// Fetch all the part attributes needed to rebuild the splits first, as HAPI
+	// can only be called from here and the splits are then built concurrently.
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	FHoudiniStaticMeshSplitBuildData SplitBuildData;
+	SplitBuildData.bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
+	SplitBuildData.bRecomputeTangents = !SplitBuildData.bReadTangents;
 
-							if (bReadTangents)
-							{
-								FVector TangentU, TangentV;
-								if (bGenerateTangents)
-								{
-									// Generate the tangents if needed
-									Normal.FindBestAxisVectors(TangentU, TangentV);
-								}
-								else
-								{
-									// Transfer the tangents from Houdini
-									TangentU.X = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-									TangentU.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-								}
-
-								FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-								FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
-							}
-						}
-					}
+	TArray<int32> SplitJobsToRebuild;
+	for (int32 JobIdx = 0; JobIdx < SplitJobs.Num(); JobIdx++)
+	{
+		if (SplitJobs[JobIdx].bRebuild)
+			SplitJobsToRebuild.Add(JobIdx);
+	}
 
-					if (bSplitColorValid && SplitColors.IsValidIndex(TriVertIdx0 * AttribInfoColors.tupleSize + 3 * AttribInfoColors.tupleSize - 1))
-					{
-						FLinearColor VertexLinearColor;
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-						{
-							VertexLinearColor.R = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 0], 0.0f, 1.0f);
-							VertexLinearColor.G = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 1], 0.0f, 1.0f);
-							VertexLinearColor.B = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 2], 0.0f, 1.0f);
-
-							if (bSplitAlphaValid)
-							{
-								VertexLinearColor.A = FMath::Clamp(SplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
-							}
-							else if (AttribInfoColors.tupleSize >= 4)
-							{
-								VertexLinearColor.A = FMath::Clamp(
-									SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 3], 0.0f, 1.0f);
-							}
-							else
-							{
-								VertexLinearColor.A = 1.0f;
-							}
-							const FColor VertexColor = VertexLinearColor.ToFColor(false);
-							FoundStaticMesh->SetTriangleVertexColor(TriangleIdx, TriWindingIndex[ElementIdx], VertexColor);
-						}
-					}
+	if (SplitJobsToRebuild.Num() > 0)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Build/Rebuild UHoudiniStaticMesh"));
+
+		// Extract this part's attributes if needed
+		UpdatePartNormalsIfNeeded();
+		if (SplitBuildData.bReadTangents)
+			UpdatePartTangentsIfNeeded();
+		UpdatePartColorsIfNeeded();
+		UpdatePartAlphasIfNeeded();
+		UpdatePartUVSetsIfNeeded();
+		// TODO: These are actually per faces, not per vertices...
+		// Need to update!!
+		UpdatePartFaceMaterialOverridesIfNeeded();
+		UpdatePartPositionIfNeeded();
+
+		SplitBuildData.PartPositions = &PartPositions;
+		SplitBuildData.PartNormals = &PartNormals;
+		SplitBuildData.AttribInfoNormals = &AttribInfoNormals;
+		SplitBuildData.PartTangentU = &PartTangentU;
+		SplitBuildData.AttribInfoTangentU = &AttribInfoTangentU;
+		SplitBuildData.PartTangentV = &PartTangentV;
+		SplitBuildData.AttribInfoTangentV = &AttribInfoTangentV;
+		SplitBuildData.PartColors = &PartColors;
+		SplitBuildData.AttribInfoColors = &AttribInfoColors;
+		SplitBuildData.PartAlphas = &PartAlphas;
+		SplitBuildData.AttribInfoAlpha = &AttribInfoAlpha;
+		SplitBuildData.PartUVSets = &PartUVSets;
+		SplitBuildData.AttribInfoUVSets = &AttribInfoUVSets;
+		SplitBuildData.bHasPerFaceMaterials = PartFaceMaterialOverrides.Num() > 0 || (PartUniqueMaterialIds.Num() > 0 && !bOnlyOneFaceMaterial);
+
+		// Each split writes to its own mesh, so they can be built in parallel, 
+		// we can only do this if no mesh is shared by two splits.
+		bool bBuildInParallel = IsParallelMeshBuildEnabled();
+		TSet<UHoudiniStaticMesh*> MeshesToRebuild;
+		for (const int32& JobIdx : SplitJobsToRebuild)
+		{
+			bool bAlreadyInSet = false;
+			MeshesToRebuild.Add(SplitJobs[JobIdx].StaticMesh, &bAlreadyInSet);
+			if (bAlreadyInSet)
+				bBuildInParallel = false;
+		}
+
+		ParallelFor(SplitJobsToRebuild.Num(), [&](int32 Idx)
+		{
+			const FHoudiniStaticMeshSplitJob& SplitJob = SplitJobs[SplitJobsToRebuild[Idx]];
+			const FString SplitDescription = FString::Printf(
+				TEXT("Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s]"),
+				HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitJob.SplitId, *SplitJob.SplitGroupName);
+
+			BuildHoudiniStaticMeshSplit(
+				SplitBuildData, *SplitJob.SplitVertexList, SplitDescription, SplitJob.StaticMesh, bBuildInParallel);
+		}, !bBuildInParallel);
 
-					if (NumUVLayers > 0)
-					{
-						// Dynamic mesh supports only 1 UV layer on the mesh it self. So we set the first layer
-						// on the mesh itself only, and we set all layers on the AttributeSet
-						for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
-						{
-							const TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
-							if (SplitUVs.IsValidIndex(TriVertIdx0 * 2 + 3 * 2 - 1))
-							{
-								for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-								{
-									const int32 UVIdx = TriVertIdx0 * 2 + ElementIdx * 2;
-									// We need to flip V coordinate when it's coming from HAPI.
-									const FVector2D UV(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
-									// Set the UV on the vertex instance in the UVLayer
-									FoundStaticMesh->SetTriangleVertexUV(TriangleIdx, TriWindingIndex[ElementIdx], TexCoordIdx, UV);
-								}
-							}
-						}
-					}
-				}
-			}
+		if (bDoTiming)
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("CreateHoudiniStaticMesh() - Built %d splits (%s) in %f seconds."),
+				SplitJobsToRebuild.Num(), bBuildInParallel ? TEXT("parallel") : TEXT("serial"), FPlatformTime::Seconds() - tick);
+			tick = FPlatformTime::Seconds();
 		}
+	}
+
+	// Update the meshes' materials and outputs, in the split order
+	for (const FHoudiniStaticMeshSplitJob& SplitJob : SplitJobs)
+	{
+		const FString& SplitGroupName = SplitJob.SplitGroupName;
+		const FHoudiniOutputObjectIdentifier& OutputObjectIdentifier = SplitJob.OutputObjectIdentifier;
+		UHoudiniStaticMesh* FoundStaticMesh = SplitJob.StaticMesh;
+		FHoudiniOutputObject* FoundOutputObject = SplitJob.bOutputObjectIsInput
+			? InputObjects.Find(OutputObjectIdentifier)
+			: OutputObjects.Find(OutputObjectIdentifier);
 
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// MATERIALS / FACE MATERIALS
@@ -5064,6 +4817,413 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 	return true;
 }
 
+// Processes [0, InNum) in batches, on the task graph if bInParallel is true.
+// Each batch only writes to its own range of elements so the result doesn't depend on the scheduling.
+static void
+HoudiniMeshBuildParallelFor(const int32& InNum, const bool& bInParallel, TFunctionRef<void(int32, int32)> InBody)
+{
+	const int32 BatchSize = FMath::Max(CVarHoudiniEngineMeshBuildParallelBatchSize.GetValueOnAnyThread(), 1);
+	const int32 NumBatches = FMath::DivideAndRoundUp(InNum, BatchSize);
+	if (!bInParallel || NumBatches <= 1)
+	{
+		InBody(0, InNum);
+		return;
+	}
+
+	ParallelFor(NumBatches, [&](int32 BatchIdx)
+	{
+		const int32 Start = BatchIdx * BatchSize;
+		InBody(Start, FMath::Min(Start + BatchSize, InNum));
+	});
+}
+
+bool
+FHoudiniMeshTranslator::IsParallelMeshBuildEnabled()
+{
+	return CVarHoudiniEngineMeshBuildParallel.GetValueOnAnyThread() != 0 && FApp::ShouldUseThreadingForPerformance();
+}
+
+bool
+FHoudiniMeshTranslator::BuildHoudiniStaticMeshSplit(
+	const FHoudiniStaticMeshSplitBuildData& InPartData,
+	const TArray<int32>& InSplitVertexList,
+	const FString& InSplitDescription,
+	UHoudiniStaticMesh* OutStaticMesh,
+	const bool& bInParallel)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::BuildHoudiniStaticMeshSplit"));
+
+	if (!OutStaticMesh || !InPartData.PartPositions)
+		return false;
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	//  INDICES
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	//
+	// Because of the splits, we don't need to declare all the vertices in the Part, 
+	// but only the one that are currently used by the split's faces.
+	// The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
+	// We also keep track of the needed vertices index to declare them easily afterwards.
+	//
+
+	// IndicesMapper:
+	// Maps index values for all vertices in the Part:
+	// - Vertices unused by the split will be set to -1
+	// - Used vertices will have their value set to the "NewIndex"
+	// So that IndicesMapper[ oldIndex ] => newIndex
+	TArray<int32> IndicesMapper;
+	IndicesMapper.Init(-1, InSplitVertexList.Num());
+	int32 CurrentMapperIndex = 0;
+
+	// NeededVertices:
+	// Array containing the old index of the needed vertices for the current split
+	// NeededVertices[ newIndex ] => oldIndex
+	TArray< int32 > NeededVertices;
+	NeededVertices.Reserve(InSplitVertexList.Num() / 3);
+	TArray< int32 > TriangleIndices;
+	TriangleIndices.Reserve(InSplitVertexList.Num());
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::BuildHoudiniStaticMeshSplit -- Build IndicesMapper and NeededVertices"));
+
+		// The new indices are assigned in the order the vertices are first used, so this stays serial.
+		bool bHasInvalidFaceIndices = false;
+		for (int32 VertexIdx = 0; VertexIdx < InSplitVertexList.Num(); VertexIdx += 3)
+		{
+			int32 WedgeCheck = InSplitVertexList[VertexIdx + 0];
+			if (WedgeCheck == -1)
+				continue;
+
+			int32 WedgeIndices[3] =
+			{
+				InSplitVertexList[VertexIdx + 0],
+				InSplitVertexList[VertexIdx + 1],
+				InSplitVertexList[VertexIdx + 2]
+			};
+
+			// Ensure the indices are valid
+			if (!IndicesMapper.IsValidIndex(WedgeIndices[0])
+				|| !IndicesMapper.IsValidIndex(WedgeIndices[1])
+				|| !IndicesMapper.IsValidIndex(WedgeIndices[2]))
+			{
+				// Invalid face index.
+				bHasInvalidFaceIndices = true;
+				continue;
+			}
+
+			// Converting Old (Part) Indices to New (Split) Indices:
+			for (int32 i = 0; i < 3; i++)
+			{
+				if (IndicesMapper[WedgeIndices[i]] < 0)
+				{
+					// This old index has not yet been "converted" to a new index
+					NeededVertices.Add(WedgeIndices[i]);
+					IndicesMapper[WedgeIndices[i]] = CurrentMapperIndex;
+					CurrentMapperIndex++;
+				}
+
+				// Replace the old index with the new one
+				WedgeIndices[i] = IndicesMapper[WedgeIndices[i]];
+			}
+
+			// Flip wedge indices to fix the winding order.
+			TriangleIndices.Add(WedgeIndices[0]);
+			TriangleIndices.Add(WedgeIndices[2]);
+			TriangleIndices.Add(WedgeIndices[1]);
+		}
+
+		if (bHasInvalidFaceIndices)
+		{
+			HOUDINI_LOG_MESSAGE(
+				TEXT("Creating Dynamic Meshes: %s has some invalid face indices"), *InSplitDescription);
+		}
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// NORMALS 
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	// Get the normals for this split
+	TArray<float> SplitNormals;
+	if (InPartData.PartNormals && InPartData.AttribInfoNormals)
+	{
+		FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+			InSplitVertexList, *InPartData.AttribInfoNormals, *InPartData.PartNormals, SplitNormals);
+	}
+
+	// Check that the number of normal we retrieved is correct
+	int32 NormalCount = SplitNormals.Num() / 3;
+	if (NormalCount < 0 || NormalCount < NeededVertices.Num())
+	{
+		// Ignore normals
+		NormalCount = 0;
+		HOUDINI_LOG_WARNING(TEXT("Invalid normal count detected - Skipping normals."));
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// TANGENTS
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	TArray<float> SplitTangentU;
+	TArray<float> SplitTangentV;
+	int32 TangentUCount = 0;
+	int32 TangentVCount = 0;
+	const bool bReadTangents = InPartData.bReadTangents;
+	bool bGenerateTangents = bReadTangents;
+	if (bReadTangents)
+	{
+		// Get the Tangents for this split
+		if (InPartData.PartTangentU && InPartData.AttribInfoTangentU)
+		{
+			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+				InSplitVertexList, *InPartData.AttribInfoTangentU, *InPartData.PartTangentU, SplitTangentU);
+		}
+
+		// Get the binormals for this split
+		if (InPartData.PartTangentV && InPartData.AttribInfoTangentV)
+		{
+			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+				InSplitVertexList, *InPartData.AttribInfoTangentV, *InPartData.PartTangentV, SplitTangentV);
+		}
+
+		// We need to manually generate tangents if:
+		// - we have normals but dont have tangentu or tangentv attributes
+		// - we have not specified that we wanted unreal to generate them
+		bGenerateTangents = (SplitNormals.Num() > 0) && (SplitTangentU.Num() <= 0 || SplitTangentV.Num() <= 0);
+
+		// Check that the number of tangents read matches the number of normals
+		TangentUCount = SplitTangentU.Num() / 3;
+		TangentVCount = SplitTangentV.Num() / 3;
+		if (TangentUCount != NormalCount || TangentVCount != NormalCount)
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("CreateHoudiniStaticMesh: Generate tangents due to count mismatch (# U Tangents = %d; # V Tangents = %d; # Normals = %d)"), TangentUCount, TangentVCount, NormalCount);
+			bGenerateTangents = true;
+		}
+
+		if (bGenerateTangents && InPartData.bRecomputeTangents)
+		{
+			// No need to generate tangents if we want unreal to recompute them after
+			bGenerateTangents = false;
+		}
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	//  VERTEX COLORS AND ALPHAS
+	//---------------------------------------------------------------------------------------------------------------------
+
+	HAPI_AttributeInfo AttribInfoColors;
+	FMemory::Memzero(AttribInfoColors);
+	if (InPartData.AttribInfoColors)
+		AttribInfoColors = *InPartData.AttribInfoColors;
+
+	// Get the colors values for this split
+	TArray<float> SplitColors;
+	if (InPartData.PartColors)
+	{
+		FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+			InSplitVertexList, AttribInfoColors, *InPartData.PartColors, SplitColors);
+	}
+
+	// Get the colors values for this split
+	TArray<float> SplitAlphas;
+	const bool bAlphaExists = InPartData.AttribInfoAlpha && InPartData.AttribInfoAlpha->exists;
+	if (InPartData.PartAlphas && InPartData.AttribInfoAlpha)
+	{
+		FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+			InSplitVertexList, *InPartData.AttribInfoAlpha, *InPartData.PartAlphas, SplitAlphas);
+	}
+
+	const int32 ColorsCount = AttribInfoColors.exists ? SplitColors.Num() / AttribInfoColors.tupleSize : 0;
+	const bool bSplitColorValid = AttribInfoColors.exists && (AttribInfoColors.tupleSize >= 3) && ColorsCount > 0;
+	const bool bSplitAlphaValid = bAlphaExists && (SplitAlphas.Num() == ColorsCount);
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	//  UVS
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	// See if we need to transfer uv point attributes to vertex attributes.
+	int32 NumUVLayers = 0;
+	TArray<TArray<float>> SplitUVSets;
+	SplitUVSets.SetNum(MAX_STATIC_TEXCOORDS);
+	if (InPartData.PartUVSets && InPartData.AttribInfoUVSets)
+	{
+		for (int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx)
+		{
+			if (!InPartData.PartUVSets->IsValidIndex(TexCoordIdx) || !InPartData.AttribInfoUVSets->IsValidIndex(TexCoordIdx))
+				continue;
+
+			FHoudiniMeshTranslator::TransferPartAttributesToSplit<float>(
+				InSplitVertexList, (*InPartData.AttribInfoUVSets)[TexCoordIdx], (*InPartData.PartUVSets)[TexCoordIdx], SplitUVSets[TexCoordIdx]);
+			if (SplitUVSets[TexCoordIdx].Num() > 0)
+			{
+				NumUVLayers++;
+			}
+		}
+	}
+
+	//
+	// Initialize mesh
+	// 
+	const int32 NumVertexPositions = NeededVertices.Num();
+	const int32 NumTriangles = TriangleIndices.Num() / 3;
+
+	OutStaticMesh->Initialize(
+		NumVertexPositions,
+		NumTriangles,
+		NumUVLayers,					   // NumUVLayers
+		0,								   // InitialNumStaticMaterials
+		NormalCount > 0,				   // HasNormals
+		NormalCount > 0 && bReadTangents,  // HasTangents
+		bSplitColorValid,				   // HasColors
+		InPartData.bHasPerFaceMaterials	   // HasPerFaceMaterials
+	);
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// POSITIONS
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	//
+	// Transfer vertex positions:
+	//
+	// Because of the split, we're only interested in the needed vertices.
+	// Instead of declaring all the Positions, we'll only declare the vertices
+	// needed by the current split.
+	//
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::BuildHoudiniStaticMeshSplit -- Set Vertex Positions"));
+
+		const TArray<float>& PartPositions = *InPartData.PartPositions;
+		FThreadSafeCounter InvalidPositionCount;
+		HoudiniMeshBuildParallelFor(NumVertexPositions, bInParallel, [&](int32 Start, int32 End)
+		{
+			// Gather the needed positions, invalid ones are left at zero
+			TArray<FVector> Positions;
+			Positions.SetNumZeroed(End - Start);
+			for (int32 VertexPositionIdx = Start; VertexPositionIdx < End; ++VertexPositionIdx)
+			{
+				int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
+				if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
+				{
+					// Error retrieving positions.
+					InvalidPositionCount.Increment();
+					continue;
+				}
+
+				FMemory::Memcpy(&Positions[VertexPositionIdx - Start], &PartPositions[NeededVertexIndex * 3], sizeof(FVector));
+			}
+
+			// We need to swap Z and Y coordinate here, and convert from m to cm. 
+			FHoudiniDataConversion::SwizzleAndScaleFloat3(
+				(const float*)Positions.GetData(), (float*)Positions.GetData(), Positions.Num(), HAPI_UNREAL_SCALE_FACTOR_POSITION);
+
+			OutStaticMesh->SetVertexPositions(Start, Positions);
+		});
+
+		if (InvalidPositionCount.GetValue() > 0)
+		{
+			HOUDINI_LOG_WARNING(
+				TEXT("Creating Dynamic Static Meshes: %s invalid position/index data for %d vertices ")
+				TEXT("- skipping."),
+				*InSplitDescription, InvalidPositionCount.GetValue());
+		}
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// FACES / TRIS
+	// Now set Normals, UVs and Colors on mesh points and AttributeSet
+	//---------------------------------------------------------------------------------------------------------------------
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::BuildHoudiniStaticMeshSplit -- Set Triangle Indices & Per Vertex Instance Attribute Values"));
+
+		// The triangle indices have already been rewound
+		OutStaticMesh->SetTriangleIndices(0, TArrayView<const FIntVector>((const FIntVector*)TriangleIndices.GetData(), NumTriangles));
+
+		// Number of triangles that have valid values for each attribute
+		const int32 NumNormalTriangles = NormalCount > 0 ? FMath::Min(NumTriangles, SplitNormals.Num() / 9) : 0;
+		const int32 NumColorTriangles = bSplitColorValid ? FMath::Min(NumTriangles, SplitColors.Num() / (3 * AttribInfoColors.tupleSize)) : 0;
+
+		HoudiniMeshBuildParallelFor(NumTriangles, bInParallel, [&](int32 Start, int32 End)
+		{
+			// Per vertex instance attributes are converted in the split's vertex order, 
+			// then rewound ({ 0, 2, 1 }) to match the triangle indices.
+			const int32 NumNormalTris = FMath::Clamp(NumNormalTriangles - Start, 0, End - Start);
+			if (NumNormalTris > 0)
+			{
+				// Flip Z and Y coordinate for normal, but don't scale
+				TArray<FVector> Normals;
+				Normals.SetNumUninitialized(NumNormalTris * 3);
+				FHoudiniDataConversion::SwizzleAndScaleFloat3(
+					&SplitNormals[Start * 9], (float*)Normals.GetData(), Normals.Num(), 1.0f);
+
+				if (bReadTangents)
+				{
+					TArray<FVector> TangentsU, TangentsV;
+					TangentsU.SetNumUninitialized(Normals.Num());
+					TangentsV.SetNumUninitialized(Normals.Num());
+					if (bGenerateTangents)
+					{
+						// Generate the tangents if needed
+						for (int32 Idx = 0; Idx < Normals.Num(); ++Idx)
+							Normals[Idx].FindBestAxisVectors(TangentsU[Idx], TangentsV[Idx]);
+					}
+					else
+					{
+						// Transfer the tangents from Houdini
+						FHoudiniDataConversion::SwizzleAndScaleFloat3(
+							&SplitTangentU[Start * 9], (float*)TangentsU.GetData(), TangentsU.Num(), 1.0f);
+						FHoudiniDataConversion::SwizzleAndScaleFloat3(
+							&SplitTangentV[Start * 9], (float*)TangentsV.GetData(), TangentsV.Num(), 1.0f);
+					}
+
+					FHoudiniDataConversion::RewindTriangles(TangentsU.GetData(), NumNormalTris);
+					FHoudiniDataConversion::RewindTriangles(TangentsV.GetData(), NumNormalTris);
+					OutStaticMesh->SetVertexInstanceUTangents(Start * 3, TangentsU);
+					OutStaticMesh->SetVertexInstanceVTangents(Start * 3, TangentsV);
+				}
+
+				FHoudiniDataConversion::RewindTriangles(Normals.GetData(), NumNormalTris);
+				OutStaticMesh->SetVertexInstanceNormals(Start * 3, Normals);
+			}
+
+			const int32 NumColorTris = FMath::Clamp(NumColorTriangles - Start, 0, End - Start);
+			if (NumColorTris > 0)
+			{
+				TArray<FColor> Colors;
+				Colors.SetNumUninitialized(NumColorTris * 3);
+				FHoudiniDataConversion::ConvertColors(
+					&SplitColors[Start * 3 * AttribInfoColors.tupleSize], AttribInfoColors.tupleSize,
+					bSplitAlphaValid ? &SplitAlphas[Start * 3] : nullptr,
+					Colors.GetData(), Colors.Num());
+
+				FHoudiniDataConversion::RewindTriangles(Colors.GetData(), NumColorTris);
+				OutStaticMesh->SetVertexInstanceColors(Start * 3, Colors);
+			}
+
+			// Dynamic mesh supports only 1 UV layer on the mesh it self. So we set the first layer
+			// on the mesh itself only, and we set all layers on the AttributeSet
+			for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
+			{
+				const TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
+				const int32 NumUVTris = FMath::Clamp(FMath::Min(NumTriangles, SplitUVs.Num() / 6) - Start, 0, End - Start);
+				if (NumUVTris <= 0)
+					continue;
+
+				// We need to flip V coordinate when it's coming from HAPI.
+				TArray<FVector2D> UVs;
+				UVs.SetNumUninitialized(NumUVTris * 3);
+				FHoudiniDataConversion::FlipUVs(&SplitUVs[Start * 6], (float*)UVs.GetData(), UVs.Num());
+
+				FHoudiniDataConversion::RewindTriangles(UVs.GetData(), NumUVTris);
+				OutStaticMesh->SetVertexInstanceUVs(Start * 3, TexCoordIdx, UVs);
+			}
+		});
+	}
+
+	return true;
+}
+
 void
 FHoudiniMeshTranslator::ApplyComplexColliderHelper(
 	UStaticMesh* TargetStaticMesh,
@@ -5322,17 +5482,10 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 
 	// Extract the collision geo's vertices
 	TArray< FVector > VertexArray;
-	VertexArray.SetNum(UniqueVertexIndexes.Num());
-	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
-	{
-		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
-			continue;
-
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
+	VertexArray.SetNumUninitialized(UniqueVertexIndexes.Num());
+	FHoudiniDataConversion::GatherSwizzleAndScaleFloat3(
+		PartPositions.GetData(), PartPositions.Num(), UniqueVertexIndexes.GetData(),
+		(float*)VertexArray.GetData(), VertexArray.Num(), HAPI_UNREAL_SCALE_FACTOR_POSITION);
 
 #if WITH_EDITOR
 	// Do we want to create multiple convex hulls?
@@ -5366,14 +5519,9 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 
 		// But we need all the positions as vertex
 		TArray< FVector > Vertices;
-		Vertices.SetNum(PartPositions.Num() / 3);
-
-		for (int32 Idx = 0; Idx < Vertices.Num(); Idx++)
-		{
-			Vertices[Idx].X = PartPositions[Idx * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Vertices[Idx].Y = PartPositions[Idx * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Vertices[Idx].Z = PartPositions[Idx * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		}
+		Vertices.SetNumUninitialized(PartPositions.Num() / 3);
+		FHoudiniDataConversion::SwizzleAndScaleFloat3(
+			PartPositions.GetData(), (float*)Vertices.GetData(), Vertices.Num(), HAPI_UNREAL_SCALE_FACTOR_POSITION);
 
 		// We are using Unreal's DecomposeMeshToHulls() 
 		// We need a BodySetup so create a fake/transient one
@@ -5424,17 +5572,10 @@ FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupN
 
 	// Extract the collision geo's vertices
 	TArray< FVector > VertexArray;
-	VertexArray.SetNum(UniqueVertexIndexes.Num());
-	for (int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++)
-	{
-		int32 VertexIndex = UniqueVertexIndexes[Idx];
-		if (!PartPositions.IsValidIndex(VertexIndex * 3 + 2))
-			continue;
-
-		VertexArray[Idx].X = PartPositions[VertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Y = PartPositions[VertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		VertexArray[Idx].Z = PartPositions[VertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
+	VertexArray.SetNumUninitialized(UniqueVertexIndexes.Num());
+	FHoudiniDataConversion::GatherSwizzleAndScaleFloat3(
+		PartPositions.GetData(), PartPositions.Num(), UniqueVertexIndexes.GetData(),
+		(float*)VertexArray.GetData(), VertexArray.Num(), HAPI_UNREAL_SCALE_FACTOR_POSITION);
 
 	int32 NewColliders = 0;
 	if (SplitGroupName.Contains("Box"))
@@ -69,6 +69,38 @@ enum class EHoudiniSplitType : uint8
 	InvisibleSimpleCollider
 };
 
+// Part data used to build the geometry of a split's UHoudiniStaticMesh.
+// The arrays are only read, so the same data can be shared by splits built concurrently.
+struct HOUDINIENGINE_API FHoudiniStaticMeshSplitBuildData
+{
+	const TArray<float>* PartPositions = nullptr;
+
+	const TArray<float>* PartNormals = nullptr;
+	const HAPI_AttributeInfo* AttribInfoNormals = nullptr;
+
+	const TArray<float>* PartTangentU = nullptr;
+	const HAPI_AttributeInfo* AttribInfoTangentU = nullptr;
+
+	const TArray<float>* PartTangentV = nullptr;
+	const HAPI_AttributeInfo* AttribInfoTangentV = nullptr;
+
+	const TArray<float>* PartColors = nullptr;
+	const HAPI_AttributeInfo* AttribInfoColors = nullptr;
+
+	const TArray<float>* PartAlphas = nullptr;
+	const HAPI_AttributeInfo* AttribInfoAlpha = nullptr;
+
+	const TArray<TArray<float>>* PartUVSets = nullptr;
+	const TArray<HAPI_AttributeInfo>* AttribInfoUVSets = nullptr;
+
+	// Read the tangents from Houdini
+	bool bReadTangents = true;
+	// Unreal will recompute the tangents, so we don't need to generate them
+	bool bRecomputeTangents = false;
+
+	bool bHasPerFaceMaterials = false;
+};
+
 struct HOUDINIENGINE_API FHoudiniMeshTranslator
 {
 	public:
@@ -131,6 +163,19 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const TArray<TYPE>& InData,
 			TArray<TYPE>& OutSplitData);
 
+		// Builds the positions, triangles and vertex instance attributes of a split's UHoudiniStaticMesh.
+		// Doesn't call HAPI, and uses the task graph for the vertices/triangles if bInParallel is true.
+		// The result is identical whether it is built in parallel or not.
+		static bool BuildHoudiniStaticMeshSplit(
+			const FHoudiniStaticMeshSplitBuildData& InPartData,
+			const TArray<int32>& InSplitVertexList,
+			const FString& InSplitDescription,
+			UHoudiniStaticMesh* OutStaticMesh,
+			const bool& bInParallel);
+
+		// Returns true if the splits' proxy meshes should be built in parallel (HoudiniEngine.MeshBuildParallel)
+		static bool IsParallelMeshBuildEnabled();
+
 		// Update the MeshBuild Settings using the values from the runtime settings/overrides on the HAC
 		void UpdateMeshBuildSettings(
 			FMeshBuildSettings& OutMeshBuildSettings,
@@ -32,6 +32,7 @@
 
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniPartAttributeCache.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniAsset.h"
@@ -71,6 +72,11 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	// Share the resolved string handles between all the attribute reads of this cook's outputs
+	FHoudiniScopedStringCache StringCacheScope;
+	// Fetch each part's attribute names once, and reuse the attribute buffers already fetched
+	FHoudiniScopedPartAttributeCache AttributeCacheScope;
+
 	// Get the temp folder override
 	FHoudiniOutputTranslator::GetTempFolderFromAttribute(HAC);
 
@@ -445,10 +451,14 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	}
 
 	// Now that all meshes have been created, process the instancers
-	for (auto& CurOutput : InstancerOutputs)
 	{
-		FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
-		NumVisibleOutputs++;
+		// Foliage updates of all the instancers are batched together
+		FHoudiniFoliageBatchScope FoliageBatchScope;
+		for (auto& CurOutput : InstancerOutputs)
+		{
+			FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
+			NumVisibleOutputs++;
+		}
 	}
 
 	if (NumVisibleOutputs > 0)
@@ -637,6 +647,7 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(UHoudiniAss
 	// Rebuild instancers if we built any static meshes from proxies
 	if (bFoundProxies)
 	{
+		FHoudiniFoliageBatchScope FoliageBatchScope;
 		for (auto& CurOutput : InstancerOutputs)
 		{
 			FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
@@ -917,6 +928,11 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 		return false;
 	}
 
+	// Share the resolved string handles between all the attribute reads of the outputs
+	FHoudiniScopedStringCache StringCacheScope;
+	// Fetch each part's attribute names once, and reuse the attribute buffers already fetched
+	FHoudiniScopedPartAttributeCache AttributeCacheScope;
+
 	// Get the AssetInfo
 	HAPI_AssetInfo AssetInfo;
 	FHoudiniApi::AssetInfo_Init(&AssetInfo);
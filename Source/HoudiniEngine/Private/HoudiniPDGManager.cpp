@@ -29,6 +29,7 @@
 #include "Modules/ModuleManager.h"
 #include "MessageEndpointBuilder.h"
 #include "HAL/FileManager.h"
+#include "Algo/StableSort.h"
 
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
@@ -49,6 +50,58 @@
 
 HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
+static TAutoConsoleVariable<float> CVarHoudiniEnginePDGEventTimeBudget(
+	TEXT("HoudiniEngine.PDG.EventTimeBudget"),
+	10.0f,
+	TEXT("Time budget (in ms) for fetching and processing PDG events per tick. Events are fetched in batches until the queues are empty or the budget is spent.\n")
+	TEXT("<= 0.0: Only fetch one batch of events per PDG context per tick\n")
+	TEXT("10.0: Default\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGMaxEventBatchSize(
+	TEXT("HoudiniEngine.PDG.MaxEventBatchSize"),
+	2000,
+	TEXT("Maximum number of PDG events fetched per GetPDGEvents call. The batch size grows up to this value when events are backing up.\n")
+	TEXT("2000: Default\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGCoalesceEvents(
+	TEXT("HoudiniEngine.PDG.CoalesceEvents"),
+	1,
+	TEXT("If enabled, work item state changes (waiting, scheduled, cooking) that are superseded by a later state change in the same batch are dropped.\n")
+	TEXT("0: Dispatch all events\n")
+	TEXT("1: Coalesce redundant state change events (default)\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGNumBGEOCommandlets(
+	TEXT("HoudiniEngine.PDG.NumBGEOCommandlets"),
+	0,
+	TEXT("Number of BGEO import commandlets started when async commandlet import is enabled. Takes effect the next time the commandlets are started.\n")
+	TEXT("0: Automatic, based on the number of cores (default)\n")
+	TEXT("N: Start N commandlets\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGBGEOCommandletMaxInFlight(
+	TEXT("HoudiniEngine.PDG.BGEOCommandletMaxInFlight"),
+	4,
+	TEXT("Maximum number of BGEO import requests waiting for a reply per commandlet. Work results stay queued in the editor until a commandlet has room for them.\n")
+	TEXT("4: Default\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGBGEOCommandletMaxRetries(
+	TEXT("HoudiniEngine.PDG.BGEOCommandletMaxRetries"),
+	2,
+	TEXT("Number of times a BGEO import is resent when the commandlet importing it crashed. After that the work result is imported in the editor.\n")
+	TEXT("2: Default\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGBGEOCommandletMaxRestarts(
+	TEXT("HoudiniEngine.PDG.BGEOCommandletMaxRestarts"),
+	3,
+	TEXT("Number of times a crashed BGEO import commandlet is restarted before it is left in the crashed state.\n")
+	TEXT("3: Default\n")
+);
+
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
 FHoudiniPDGManager::FHoudiniPDGManager()
@@ -439,6 +492,8 @@ FHoudiniPDGManager::PopulateTOPNetworks(UHoudiniPDGAssetLink* PDGAssetLink, bool
 	}
 	//PDGAssetLink->ClearAllTOPData();
 	PDGAssetLink->AllTOPNetworks = AllTOPNetworks;
+	PDGAssetLink->InvalidateTOPNodeIndex();
+	PDGAssetLink->InvalidateWorkItemTally();
 
 	return (AllTOPNetworks.Num() > 0);
 }
@@ -544,6 +599,8 @@ FHoudiniPDGManager::PopulateTOPNodes(
 	}
 
 	InTOPNetwork->AllTOPNodes = AllTOPNodes;
+	InPDGAssetLink->InvalidateTOPNodeIndex();
+	InPDGAssetLink->InvalidateWorkItemTally();
 
 	return (TOPNodeCount > 0);
 }
@@ -596,7 +653,11 @@ FHoudiniPDGManager::CookTOPNode(UTOPNode* InTOPNode)
 		FHoudiniEngine::Get().GetSession(), InTOPNode->NodeId, 0, 0))
 	{
 		HOUDINI_LOG_ERROR(TEXT("PDG Cook TOP Node - Failed to cook %s!"), *(InTOPNode->NodeName));
+		return;
 	}
+
+	// Until the next update polls the graph states, let the scheduler know a PDG cook is running
+	FHoudiniEngine::Get().SetPDGCooking(true);
 }
 
 
@@ -668,7 +729,11 @@ FHoudiniPDGManager::CookOutput(UTOPNetwork* InTOPNet)
 		FHoudiniEngine::Get().GetSession(), InTOPNet->NodeId, 0, 0))
 	{
 		HOUDINI_LOG_ERROR(TEXT("PDG Cook Output - Failed to cook %s's output!"), *(InTOPNet->NodeName));
+		return;
 	}
+
+	// Until the next update polls the graph states, let the scheduler know a PDG cook is running
+	FHoudiniEngine::Get().SetPDGCooking(true);
 }
 
 
@@ -754,7 +819,10 @@ FHoudiniPDGManager::Update()
 
 	// Do nothing if we dont have any valid PDG asset Link
 	if (PDGAssetLinks.Num() <= 0)
+	{
+		FHoudiniEngine::Get().SetPDGCooking(false);
 		return;
+	}
 
 	// Update the PDG contexts and handle all pdg events and work item status updates
 	UpdatePDGContexts();
@@ -772,12 +840,36 @@ FHoudiniPDGManager::UpdatePDGContexts()
 	// Get current PDG graph contexts
 	ReinitializePDGContext();
 
+	// Let the scheduler know if any graph is cooking: interrupting one of its cooks would cancel the PDG cook too
+	bool bAnyContextCooking = false;
+	for (const HAPI_PDG_GraphContextId& CurrentContextID : PDGContextIDs)
+	{
+		int32 PDGStateInt = HAPI_PDG_STATE_READY;
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetPDGState(
+			FHoudiniEngine::Get().GetSession(), CurrentContextID, &PDGStateInt)
+			&& (HAPI_PDG_State)PDGStateInt == HAPI_PDG_STATE_COOKING)
+		{
+			bAnyContextCooking = true;
+			break;
+		}
+	}
+	FHoudiniEngine::Get().SetPDGCooking(bAnyContextCooking);
+
+	const double TickStartTime = FPlatformTime::Seconds();
+	const double TimeBudget = FMath::Max(CVarHoudiniEnginePDGEventTimeBudget.GetValueOnAnyThread(), 0.0f) / 1000.0;
+	const int32 MaxBatchSize = FMath::Max(CVarHoudiniEnginePDGMaxEventBatchSize.GetValueOnAnyThread(), MaxNumberOfPDGEvents);
+	const bool bCoalesceEvents = CVarHoudiniEnginePDGCoalesceEvents.GetValueOnAnyThread() > 0;
+
+	int32 NumFetchedEvents = 0;
+	PDGEventStats.NumProcessedEvents = 0;
+	PDGEventStats.NumCoalescedEvents = 0;
+	PDGEventStats.NumBacklogEvents = 0;
+	PDGEventStats.NumBatches = 0;
+
 	// Process next set of events for each graph context
 	if (PDGContextIDs.Num() > 0)
 	{
-		// Only initialize event array if not valid, or user resized max size
-		if(PDGEventInfos.Num() != MaxNumberOfPDGEvents)
-			PDGEventInfos.SetNum(MaxNumberOfPDGEvents);
+		PDGEventBatchSize = FMath::Clamp(PDGEventBatchSize, MaxNumberOfPDGEvents, MaxBatchSize);
 
 		// TODO: member?
 		//HAPI_PDG_State PDGState;
@@ -801,28 +893,80 @@ FHoudiniPDGManager::UpdatePDGContexts()
 			}
 			*/
 
-			int32 PDGEventCount = 0;
+			// Keep draining the context's events while some remain and the time budget allows it.
+			// Each context gets at least one batch per tick.
+			int32 ContextEventCount = 0;
 			int32 RemainingPDGEventCount = 0;
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPDGEvents(
-				FHoudiniEngine::Get().GetSession(), CurrentContextID, PDGEventInfos.GetData(),
-				MaxNumberOfPDGEvents, &PDGEventCount, &RemainingPDGEventCount))
+			do
 			{
-				HOUDINI_LOG_ERROR(TEXT("Failed to get PDG events"));
-				continue;
+				// Only resize the event array if the batch size changed
+				if (PDGEventInfos.Num() != PDGEventBatchSize)
+					PDGEventInfos.SetNum(PDGEventBatchSize);
+
+				int32 PDGEventCount = 0;
+				RemainingPDGEventCount = 0;
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPDGEvents(
+					FHoudiniEngine::Get().GetSession(), CurrentContextID, PDGEventInfos.GetData(),
+					PDGEventBatchSize, &PDGEventCount, &RemainingPDGEventCount))
+				{
+					HOUDINI_LOG_ERROR(TEXT("Failed to get PDG events"));
+					RemainingPDGEventCount = 0;
+					break;
+				}
+
+				PDGEventStats.NumBatches++;
+				if (PDGEventCount < 1)
+					break;
+
+				NumFetchedEvents += PDGEventCount;
+				ContextEventCount += PDGEventCount;
+
+				const int32 NumEventsToProcess = bCoalesceEvents ? CoalescePDGEvents(PDGEventInfos, PDGEventCount) : PDGEventCount;
+				PDGEventStats.NumCoalescedEvents += PDGEventCount - NumEventsToProcess;
+				for (int32 EventIdx = 0; EventIdx < NumEventsToProcess; EventIdx++)
+				{
+					ProcessPDGEvent(CurrentContextID, PDGEventInfos[EventIdx]);
+				}
+				PDGEventStats.NumProcessedEvents += NumEventsToProcess;
+
+				// Grow the batch size while a backlog builds up, shrink it back when the queue is mostly idle
+				if (RemainingPDGEventCount > PDGEventBatchSize)
+					PDGEventBatchSize = FMath::Min(PDGEventBatchSize * 2, MaxBatchSize);
+				else if (RemainingPDGEventCount == 0 && PDGEventCount < PDGEventBatchSize / 4)
+					PDGEventBatchSize = FMath::Max(PDGEventBatchSize / 2, MaxNumberOfPDGEvents);
 			}
+			while (RemainingPDGEventCount > 0 && TimeBudget > 0.0 && (FPlatformTime::Seconds() - TickStartTime) < TimeBudget);
 
-			if (PDGEventCount < 1)
-				continue;
-			
-			for (int32 EventIdx = 0; EventIdx < PDGEventCount; EventIdx++)
+			PDGEventStats.NumBacklogEvents += RemainingPDGEventCount;
+
+			if (ContextEventCount > 0)
 			{
-				ProcessPDGEvent(CurrentContextID, PDGEventInfos[EventIdx]);
+				HOUDINI_LOG_MESSAGE(
+					TEXT("PDG: Tick processed %d events, %d remaining (batch size %d)."),
+					ContextEventCount, RemainingPDGEventCount, PDGEventBatchSize);
 			}
-
-			HOUDINI_LOG_MESSAGE(TEXT("PDG: Tick processed %d events, %d remaining."), PDGEventCount, RemainingPDGEventCount);
 		}
 	}
 
+	// Update the drain rate (smoothed over a few ticks)
+	const double TickEndTime = FPlatformTime::Seconds();
+	PDGEventStats.ProcessingTime = TickEndTime - TickStartTime;
+	PDGEventStats.BatchSize = PDGEventBatchSize;
+	if (LastPDGEventUpdateTime > 0.0 && TickEndTime > LastPDGEventUpdateTime)
+	{
+		const double CurrentRate = NumFetchedEvents / (TickEndTime - LastPDGEventUpdateTime);
+		PDGEventStats.DrainRate = FMath::Lerp(PDGEventStats.DrainRate, CurrentRate, 0.2);
+	}
+	LastPDGEventUpdateTime = TickEndTime;
+
+	if (PDGEventStats.NumProcessedEvents > 0)
+	{
+		HOUDINI_PDG_MESSAGE(
+			TEXT("PDG: Tick processed %d events (%d coalesced) in %.3fms, %d batches, backlog %d, %.1f events/s."),
+			PDGEventStats.NumProcessedEvents, PDGEventStats.NumCoalescedEvents, PDGEventStats.ProcessingTime * 1000.0,
+			PDGEventStats.NumBatches, PDGEventStats.NumBacklogEvents, PDGEventStats.DrainRate);
+	}
+
 	// Refresh UI if necessary
 	for (auto CurAssetLink : PDGAssetLinks)
 	{
@@ -836,6 +980,7 @@ FHoudiniPDGManager::UpdatePDGContexts()
 			}
 			else
 			{
+				// Only rebuilds the tallys if the TOP nodes changed, work item events update them incrementally
 				AssetLink->UpdateWorkItemTally();
 			}
 		}
@@ -1120,6 +1265,71 @@ FHoudiniPDGManager::ResetPDGEventInfo(HAPI_PDG_EventInfo& InEventInfo)
 }
 
 
+int32
+FHoudiniPDGManager::CoalescePDGEvents(TArray<HAPI_PDG_EventInfo>& InOutEventInfos, const int32& InNumEvents)
+{
+	const int32 NumEvents = FMath::Min(InNumEvents, InOutEventInfos.Num());
+	if (NumEvents < 2)
+		return NumEvents;
+
+	auto IsTransientState = [](const HAPI_PDG_WorkitemState& InState)
+	{
+		return InState == HAPI_PDG_WORKITEM_WAITING
+			|| InState == HAPI_PDG_WORKITEM_SCHEDULED
+			|| InState == HAPI_PDG_WORKITEM_COOKING
+			|| InState == HAPI_PDG_WORKITEM_UNCOOKED;
+	};
+
+	// Walk the events backwards, keeping track of the next state change event for each work item.
+	// Any other event for a work item acts as a barrier: state changes are never moved across it.
+	TMap<uint64, int32> NextStateChangeIndex;
+	TArray<bool> KeepEvent;
+	KeepEvent.Init(true, NumEvents);
+	int32 NumDropped = 0;
+	for (int32 EventIdx = NumEvents - 1; EventIdx >= 0; EventIdx--)
+	{
+		const HAPI_PDG_EventInfo& EventInfo = InOutEventInfos[EventIdx];
+		if (EventInfo.workitemId < 0)
+			continue;
+
+		const uint64 Key = ((uint64)(uint32)EventInfo.nodeId << 32) | (uint64)(uint32)EventInfo.workitemId;
+		if ((HAPI_PDG_EventType)EventInfo.eventType != HAPI_PDG_EVENT_WORKITEM_STATE_CHANGE)
+		{
+			NextStateChangeIndex.Remove(Key);
+			continue;
+		}
+
+		const int32* NextIndex = NextStateChangeIndex.Find(Key);
+		if (NextIndex && EventInfo.msgSH < 0 && IsTransientState((HAPI_PDG_WorkitemState)EventInfo.currentState))
+		{
+			// The later event now transitions from this event's previous state
+			InOutEventInfos[*NextIndex].lastState = EventInfo.lastState;
+			KeepEvent[EventIdx] = false;
+			NumDropped++;
+			continue;
+		}
+
+		NextStateChangeIndex.Add(Key, EventIdx);
+	}
+
+	if (NumDropped == 0)
+		return NumEvents;
+
+	// Compact the kept events, preserving their order
+	int32 NumKept = 0;
+	for (int32 EventIdx = 0; EventIdx < NumEvents; EventIdx++)
+	{
+		if (!KeepEvent[EventIdx])
+			continue;
+
+		if (NumKept != EventIdx)
+			InOutEventInfos[NumKept] = InOutEventInfos[EventIdx];
+		NumKept++;
+	}
+
+	return NumKept;
+}
+
 bool
 FHoudiniPDGManager::GetTOPAssetLinkAndNode(
 	const HAPI_NodeId& InNodeID, UHoudiniPDGAssetLink*& OutAssetLink, UTOPNode*& OutTOPNode)
@@ -1127,6 +1337,25 @@ FHoudiniPDGManager::GetTOPAssetLinkAndNode(
 	// Returns the PDGAssetLink and FTOPNode data associated with this TOP node ID
 	OutAssetLink = nullptr;
 	OutTOPNode = nullptr;
+
+	// Look in the asset link that owned this node the last time first
+	TWeakObjectPtr<UHoudiniPDGAssetLink>* CachedAssetLinkPtr = PDGAssetLinksByTOPNodeId.Find(InNodeID);
+	if (CachedAssetLinkPtr)
+	{
+		UHoudiniPDGAssetLink* CachedAssetLink = CachedAssetLinkPtr->Get();
+		if (CachedAssetLink && !CachedAssetLink->IsPendingKill())
+		{
+			OutTOPNode = CachedAssetLink->GetTOPNode((int32)InNodeID);
+			if (OutTOPNode != nullptr)
+			{
+				OutAssetLink = CachedAssetLink;
+				return true;
+			}
+		}
+
+		PDGAssetLinksByTOPNodeId.Remove(InNodeID);
+	}
+
 	for (TWeakObjectPtr<UHoudiniPDGAssetLink>& CurAssetLinkPtr : PDGAssetLinks)
 	{
 		if (!CurAssetLinkPtr.IsValid() || CurAssetLinkPtr.IsStale())
@@ -1141,6 +1370,7 @@ FHoudiniPDGManager::GetTOPAssetLinkAndNode(
 		if (OutTOPNode != nullptr)
 		{
 			OutAssetLink = CurAssetLink;
+			PDGAssetLinksByTOPNodeId.Add(InNodeID, CurAssetLinkPtr);
 			return true;
 		}
 	}
@@ -1156,6 +1386,9 @@ FHoudiniPDGManager::SetTOPNodePDGState(UHoudiniPDGAssetLink* InPDGAssetLink, UTO
 	
 	InTOPNode->NodeState = InPDGState;
 
+	if (IsValid(InPDGAssetLink))
+		InPDGAssetLink->OnTOPNodeStateChanged(InTOPNode);
+
 	// InPDGAssetLink->bNeedsUIRefresh = true;
 	//FHoudiniPDGManager::RefreshPDGAssetLinkUI(InPDGAssetLink);
 }
@@ -1171,6 +1404,9 @@ FHoudiniPDGManager::NotifyTOPNodePDGStateClear(UHoudiniPDGAssetLink* InPDGAssetL
 	InTOPNode->ZeroWorkItemTally();
 	InTOPNode->OnDirtyNode();
 
+	if (IsValid(InPDGAssetLink))
+		InPDGAssetLink->OnTOPNodeStateChanged(InTOPNode);
+
 	HOUDINI_PDG_MESSAGE(TEXT("PDG: %s: WorkItemTally ZeroAll"), *(InTOPNode->NodePath));
 
 	// InPDGAssetLink->bNeedsUIRefresh = true;
@@ -1395,11 +1631,11 @@ FHoudiniPDGManager::CreateOrRelinkWorkItem(
 			FTOPWorkResult LocalWorkResult;
 			LocalWorkResult.WorkItemID = InWorkItemID;
 			LocalWorkResult.WorkItemIndex = WorkItemInfo.index;
-			Index = InTOPNode->WorkResult.Add(LocalWorkResult);
+			Index = InTOPNode->AddWorkResult(LocalWorkResult);
 		}
 		else
 		{
-			InTOPNode->WorkResult[Index].WorkItemID = InWorkItemID;
+			InTOPNode->SetWorkResultWorkItemID(Index, InWorkItemID);
 		}
 	}
 
@@ -1618,9 +1854,11 @@ FHoudiniPDGManager::SyncAndPruneWorkItems(UTOPNode* InTOPNode)
 			HOUDINI_PDG_WARNING(
 				TEXT("Pruning a FTOPWorkResult entry from TOP Node %d, WorkItemID %d, WorkItemIndex %d, Array Index %d"),
 				InTOPNode->NodeId, WorkResult.WorkItemID, WorkResult.WorkItemIndex, Index);
+			const int32 PrunedWorkItemID = WorkResult.WorkItemID;
 			WorkResult.ClearAndDestroyResultObjects();
-			InTOPNode->WorkResult.RemoveAt(Index);
-			InTOPNode->OnWorkItemRemoved(WorkResult.WorkItemID);
+			// Entries after Index have already been visited, so swapping the last one in is safe
+			InTOPNode->RemoveWorkResultAt(Index);
+			InTOPNode->OnWorkItemRemoved(PrunedWorkItemID);
 			NumRemoved++;
 		}
 	}
@@ -1633,7 +1871,21 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::ProcessWorkItemResults);
 
+	// Work result objects to import with the commandlets. They are sent by priority once all asset links have been
+	// processed, as long as a commandlet has room for them. The others stay in the ToLoad state until the next update.
+	struct FBGEOImportCandidate
+	{
+		FTOPWorkResultObject* WorkResultObject;
+		HAPI_NodeId TOPNodeId;
+		HAPI_PDG_WorkitemId WorkItemId;
+		FHoudiniPackageParams PackageParams;
+		int32 Priority;
+	};
+	TArray<FBGEOImportCandidate> ImportCandidates;
+
+	UpdateBGEOCommandletPool();
 	const EHoudiniBGEOCommandletStatus CommandletStatus = UpdateAndGetBGEOCommandletStatus();
+	const int32 MaxImportRetries = CVarHoudiniEnginePDGBGEOCommandletMaxRetries.GetValueOnGameThread();
 	for (auto& CurrentPDGAssetLink : PDGAssetLinks)
 	{
 		// Iterate through all PDG Asset Link
@@ -1688,6 +1940,9 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 		// UWorld *World = ParentActor ? ParentActor->GetWorld() : AssetLink->GetWorld();
 		UWorld *World = AssetLink->GetWorld();
 
+		// Results of the selected TOP node are imported first, then the results of nodes shown in the level
+		const UTOPNode* SelectedTOPNode = AssetLink->GetSelectedTOPNode();
+
 		// .. All TOP Nets
 		for (UTOPNetwork* CurrentTOPNet : AssetLink->AllTOPNetworks)
 		{
@@ -1699,6 +1954,8 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 			{
 				if (!IsValid(CurrentTOPNode))
 					continue;
+
+				const int32 ImportPriority = (CurrentTOPNode == SelectedTOPNode ? 2 : 0) + (CurrentTOPNode->IsVisibleInLevel() ? 1 : 0);
 				
 				// ... All WorkResult
 				CurrentTOPNode->bCachedHaveNotLoadedWorkResults = false;
@@ -1710,25 +1967,37 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 					{
 						if (CurrentWorkResultObj.State == EPDGWorkResultState::ToLoad)
 						{
-							CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
-
 							// Load this WRObj
 							PackageParams.PDGTOPNetworkName = CurrentTOPNet->NodeName;
 							PackageParams.PDGTOPNodeName = CurrentTOPNode->NodeName;
 							PackageParams.PDGWorkItemIndex = CurrentWorkResult.WorkItemIndex;
 
-							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
+							// Import with the commandlets, unless the commandlets crashed too many times while
+							// importing this result
+							bool bUseCommandlet = CommandletStatus == EHoudiniBGEOCommandletStatus::Connected;
+							if (bUseCommandlet && BGEOImportRetryCounts.Num() > 0)
 							{
-								BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
-									CurrentWorkResultObj.FilePath,
-									CurrentWorkResultObj.Name,
-									PackageParams,
+								FHoudiniBGEOImportRequest Request;
+								Request.TOPNodeId = CurrentTOPNode->NodeId;
+								Request.WorkItemId = CurrentWorkResult.WorkItemID;
+								Request.Name = CurrentWorkResultObj.Name;
+								const int32* NumRetries = BGEOImportRetryCounts.Find(Request.GetKey());
+								bUseCommandlet = !NumRetries || *NumRetries <= MaxImportRetries;
+							}
+
+							if (bUseCommandlet)
+							{
+								ImportCandidates.Add({
+									&CurrentWorkResultObj,
 									CurrentTOPNode->NodeId,
-									CurrentWorkResult.WorkItemID
-								), BGEOCommandletAddress);
+									CurrentWorkResult.WorkItemID,
+									PackageParams,
+									ImportPriority
+								});
 							}
 							else
 							{
+								CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
 								if (FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
 									AssetLink,
 									CurrentTOPNode,
@@ -1788,6 +2057,40 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 			}
 		}
 	}
+
+	if (ImportCandidates.Num() <= 0)
+		return;
+
+	// Send the candidates by priority (keeping the work item order within a priority) to the least busy commandlet.
+	// Idle commandlets pull from the shared candidate list, so a slow import does not hold back the others.
+	Algo::StableSort(ImportCandidates, [](const FBGEOImportCandidate& InA, const FBGEOImportCandidate& InB)
+	{
+		return InA.Priority > InB.Priority;
+	});
+
+	for (const FBGEOImportCandidate& Candidate : ImportCandidates)
+	{
+		const int32 WorkerIndex = FindAvailableBGEOCommandlet();
+		if (WorkerIndex == INDEX_NONE)
+			break;
+
+		FHoudiniBGEOCommandletWorker& Worker = BGEOCommandlets[WorkerIndex];
+		FTOPWorkResultObject& WorkResultObj = *Candidate.WorkResultObject;
+		WorkResultObj.State = EPDGWorkResultState::Loading;
+
+		BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
+			WorkResultObj.FilePath,
+			WorkResultObj.Name,
+			Candidate.PackageParams,
+			Candidate.TOPNodeId,
+			Candidate.WorkItemId
+		), Worker.Address);
+
+		FHoudiniBGEOImportRequest& Request = Worker.InFlightRequests.AddDefaulted_GetRef();
+		Request.TOPNodeId = Candidate.TOPNodeId;
+		Request.WorkItemId = Candidate.WorkItemId;
+		Request.Name = WorkResultObj.Name;
+	}
 }
 
 void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
@@ -1795,14 +2098,19 @@ void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_DISPLAY(TEXT("Received Discover from %s"), *InContext->GetSender().ToString());
-	// Ignore any discover acks received if we already have a valid local address
-	// for the commandlet
-	if (BGEOCommandletAddress.IsValid())
+	if (!InMessage.CommandletGuid.IsValid())
 		return;
 
-	if (BGEOCommandletProcHandle.IsValid() && InMessage.CommandletGuid.IsValid() && BGEOCommandletGuid == InMessage.CommandletGuid)
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandlets)
 	{
-		BGEOCommandletAddress = InContext->GetSender();
+		if (Worker.Guid != InMessage.CommandletGuid)
+			continue;
+
+		// Ignore any discover acks received if we already have a valid local address
+		// for the commandlet
+		if (!Worker.Address.IsValid() && Worker.ProcHandle.IsValid())
+			Worker.Address = InContext->GetSender();
+		return;
 	}
 }
 
@@ -1811,6 +2119,10 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Received BGEO import result message"));
+
+	// Free the request's slot on the commandlet
+	RemoveBGEOInFlightRequest(InContext->GetSender(), InMessage.TOPNodeId, InMessage.WorkItemId, InMessage.Name);
+
 	if (InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success || InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_PartialSuccess)
 	{
 		FHoudiniPackageParams PackageParams;
@@ -2027,6 +2339,14 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 			WorkResultObject->State = EPDGWorkResultState::Loaded;
 			WorkResultObject->SetAutoBakedSinceLastLoad(false);
 			HOUDINI_LOG_MESSAGE(TEXT("Loaded geo for %s"), *InMessage.Name);
+			if (BGEOImportRetryCounts.Num() > 0)
+			{
+				FHoudiniBGEOImportRequest Request;
+				Request.TOPNodeId = InMessage.TOPNodeId;
+				Request.WorkItemId = InMessage.WorkItemId;
+				Request.Name = InMessage.Name;
+				BGEOImportRetryCounts.Remove(Request.GetKey());
+			}
 			// Broadcast that we have loaded the work result object to those interested
 			AssetLink->OnWorkResultObjectLoaded.Broadcast(
 				AssetLink, TOPNode, WorkResult->WorkItemIndex, WorkResultObject->WorkItemResultInfoIndex);
@@ -2040,6 +2360,11 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	else
 	{
 		HOUDINI_LOG_WARNING(TEXT("Commandlet failed to import bgeo for %s"), *InMessage.Name);
+
+		// Release the work result object, it would otherwise stay in the Loading state
+		FTOPWorkResultObject* WorkResultObject = GetWorkResultObject(InMessage.TOPNodeId, InMessage.WorkItemId, InMessage.Name);
+		if (WorkResultObject && WorkResultObject->State == EPDGWorkResultState::Loading)
+			WorkResultObject->State = EPDGWorkResultState::None;
 	}
 }
 
@@ -2047,7 +2372,6 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 {
 	if (!BGEOCommandletEndpoint.IsValid())
 	{
-		BGEOCommandletAddress.Invalidate();
 		BGEOCommandletEndpoint = FMessageEndpoint::Builder(TEXT("Houdini BGEO Commandlet"))
 			.Handling<FHoudiniPDGImportBGEOResultMessage>(this, &FHoudiniPDGManager::HandleImportBGEOResultMessage)
 			.Handling<FHoudiniPDGImportBGEODiscoverMessage>(this, &FHoudiniPDGManager::HandleImportBGEODiscoverMessage)
@@ -2062,102 +2386,288 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 		BGEOCommandletEndpoint->Subscribe<FHoudiniPDGImportBGEODiscoverMessage>();
 	}
 
-	if (!BGEOCommandletProcHandle.IsValid() || !FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	if (BGEOCommandlets.Num() <= 0)
+		BGEOCommandlets.SetNum(GetBGEOCommandletPoolSize());
+
+	bool bSuccess = true;
+	const int32 NumCommandlets = BGEOCommandlets.Num();
+	for (int32 WorkerIndex = 0; WorkerIndex < NumCommandlets; ++WorkerIndex)
 	{
-		// Start the bgeo commandlet
-		static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
-		BGEOCommandletGuid = FGuid::NewGuid();
-		BGEOCommandletAddress.Invalidate();
+		FHoudiniBGEOCommandletWorker& Worker = BGEOCommandlets[WorkerIndex];
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			continue;
+
+		if (!StartBGEOCommandlet(WorkerIndex))
+			bSuccess = false;
+	}
 
-		// Get the absolute path to the project file, if known, otherwise get
-		// the project name. For the path: quote it for the command line.
-		IFileManager& FileManager = IFileManager::Get();
-		FString ProjectPathOrName = FApp::GetProjectName();
-		if (FPaths::IsProjectFilePathSet())
+	return bSuccess;
+}
+
+int32
+FHoudiniPDGManager::GetBGEOCommandletPoolSize()
+{
+	const int32 NumCommandlets = CVarHoudiniEnginePDGNumBGEOCommandlets.GetValueOnGameThread();
+	if (NumCommandlets > 0)
+		return NumCommandlets;
+
+	// Each commandlet is a full editor process: leave cores to the editor and the Houdini session,
+	// and limit the memory used by the pool
+	return FMath::Clamp(FPlatformMisc::NumberOfCores() / 2 - 1, 1, 8);
+}
+
+bool
+FHoudiniPDGManager::StartBGEOCommandlet(const int32& InWorkerIndex)
+{
+	if (!BGEOCommandlets.IsValidIndex(InWorkerIndex) || !BGEOCommandletEndpoint.IsValid())
+		return false;
+
+	FHoudiniBGEOCommandletWorker& Worker = BGEOCommandlets[InWorkerIndex];
+	if (Worker.ProcHandle.IsValid())
+		FPlatformProcess::CloseProc(Worker.ProcHandle);
+
+	// Start the bgeo commandlet
+	static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
+	Worker.Guid = FGuid::NewGuid();
+	Worker.Address.Invalidate();
+	Worker.Status = EHoudiniBGEOCommandletStatus::NotStarted;
+
+	// Get the absolute path to the project file, if known, otherwise get
+	// the project name. For the path: quote it for the command line.
+	IFileManager& FileManager = IFileManager::Get();
+	FString ProjectPathOrName = FApp::GetProjectName();
+	if (FPaths::IsProjectFilePathSet())
+	{
+		const FString ProjectPath = FPaths::GetProjectFilePath();
+		if (!ProjectPath.IsEmpty())
 		{
-			const FString ProjectPath = FPaths::GetProjectFilePath();
-			if (!ProjectPath.IsEmpty())
-			{
-				ProjectPathOrName = FString::Printf(
-                    TEXT("\"%s\""),
-                    *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
-                );
-			}
+			ProjectPathOrName = FString::Printf(
+                TEXT("\"%s\""),
+                *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
+            );
 		}
+	}
 
-		if (ProjectPathOrName.IsEmpty())
-			return false;
+	if (ProjectPathOrName.IsEmpty())
+		return false;
 
-		// Get the executable path for the app/editor
-		FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
-		if (!ExePath.IsEmpty())
-			ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+	// Get the executable path for the app/editor
+	FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
+	if (!ExePath.IsEmpty())
+		ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
 
-		if (ExePath.IsEmpty())
-			return false;
-		
-		const FString CommandLineParameters = FString::Printf(
-			TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
-			*ProjectPathOrName,
-			*BGEOCommandletName,
-			*BGEOCommandletGuid.ToString(),
-			*BGEOCommandletEndpoint->GetAddress().ToString(),
-			FPlatformProcess::GetCurrentProcessId());
-
-		BGEOCommandletProcHandle = FPlatformProcess::CreateProc(
-			*ExePath,
-			*CommandLineParameters,
-			false,
-			true,
-			false,
-			&BGEOCommandletProcessId,
-			0,
-			NULL,
-			NULL);
-		if (!BGEOCommandletProcHandle.IsValid())
+	if (ExePath.IsEmpty())
+		return false;
+	
+	const FString CommandLineParameters = FString::Printf(
+		TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
+		*ProjectPathOrName,
+		*BGEOCommandletName,
+		*Worker.Guid.ToString(),
+		*BGEOCommandletEndpoint->GetAddress().ToString(),
+		FPlatformProcess::GetCurrentProcessId());
+
+	Worker.ProcHandle = FPlatformProcess::CreateProc(
+		*ExePath,
+		*CommandLineParameters,
+		false,
+		true,
+		false,
+		&Worker.ProcessId,
+		0,
+		NULL,
+		NULL);
+	if (!Worker.ProcHandle.IsValid())
+	{
+		return false;
+	}
+
+	return true;
+}
+
+void
+FHoudiniPDGManager::UpdateBGEOCommandletPool()
+{
+	if (!BGEOCommandletEndpoint.IsValid())
+		return;
+
+	const int32 MaxRestarts = CVarHoudiniEnginePDGBGEOCommandletMaxRestarts.GetValueOnGameThread();
+	const int32 NumCommandlets = BGEOCommandlets.Num();
+	for (int32 WorkerIndex = 0; WorkerIndex < NumCommandlets; ++WorkerIndex)
+	{
+		FHoudiniBGEOCommandletWorker& Worker = BGEOCommandlets[WorkerIndex];
+		if (!Worker.ProcHandle.IsValid() || FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			continue;
+
+		// The commandlet stopped running: the results it was importing will be sent again
+		if (Worker.InFlightRequests.Num() > 0)
 		{
-			return false;
+			HOUDINI_LOG_WARNING(
+				TEXT("BGEO commandlet %d (PID %d) stopped with %d import(s) in progress, retrying them."),
+				WorkerIndex, Worker.ProcessId, Worker.InFlightRequests.Num());
+			RequeueBGEOInFlightRequests(Worker, true);
 		}
+
+		if (Worker.NumRestarts >= MaxRestarts)
+			continue;
+
+		Worker.NumRestarts++;
+		HOUDINI_LOG_MESSAGE(TEXT("Restarting BGEO commandlet %d (restart %d of %d)."), WorkerIndex, Worker.NumRestarts, MaxRestarts);
+		StartBGEOCommandlet(WorkerIndex);
 	}
+}
 
-	return true;
+int32
+FHoudiniPDGManager::FindAvailableBGEOCommandlet() const
+{
+	const int32 MaxInFlight = FMath::Max(CVarHoudiniEnginePDGBGEOCommandletMaxInFlight.GetValueOnGameThread(), 1);
+
+	int32 BestWorkerIndex = INDEX_NONE;
+	int32 BestNumInFlight = MaxInFlight;
+	const int32 NumCommandlets = BGEOCommandlets.Num();
+	for (int32 WorkerIndex = 0; WorkerIndex < NumCommandlets; ++WorkerIndex)
+	{
+		const FHoudiniBGEOCommandletWorker& Worker = BGEOCommandlets[WorkerIndex];
+		if (Worker.Status != EHoudiniBGEOCommandletStatus::Connected)
+			continue;
+
+		if (Worker.InFlightRequests.Num() < BestNumInFlight)
+		{
+			BestWorkerIndex = WorkerIndex;
+			BestNumInFlight = Worker.InFlightRequests.Num();
+		}
+	}
+
+	return BestWorkerIndex;
+}
+
+int32
+FHoudiniPDGManager::FindBGEOCommandletByAddress(const FMessageAddress& InAddress) const
+{
+	if (!InAddress.IsValid())
+		return INDEX_NONE;
+
+	return BGEOCommandlets.IndexOfByPredicate([&InAddress](const FHoudiniBGEOCommandletWorker& InWorker)
+	{
+		return InWorker.Address == InAddress;
+	});
+}
+
+void
+FHoudiniPDGManager::RemoveBGEOInFlightRequest(
+	const FMessageAddress& InAddress,
+	const HAPI_NodeId& InTOPNodeId,
+	const HAPI_PDG_WorkitemId& InWorkItemId,
+	const FString& InName)
+{
+	const int32 WorkerIndex = FindBGEOCommandletByAddress(InAddress);
+	if (WorkerIndex == INDEX_NONE)
+		return;
+
+	TArray<FHoudiniBGEOImportRequest>& InFlightRequests = BGEOCommandlets[WorkerIndex].InFlightRequests;
+	const int32 RequestIndex = InFlightRequests.IndexOfByPredicate([&](const FHoudiniBGEOImportRequest& InRequest)
+	{
+		return InRequest.TOPNodeId == InTOPNodeId && InRequest.WorkItemId == InWorkItemId && InRequest.Name == InName;
+	});
+	// Replies carry the ids of the request they answer
+	if (RequestIndex != INDEX_NONE)
+		InFlightRequests.RemoveAt(RequestIndex);
+}
+
+void
+FHoudiniPDGManager::RequeueBGEOInFlightRequests(FHoudiniBGEOCommandletWorker& InWorker, const bool& bInCountRetry)
+{
+	for (const FHoudiniBGEOImportRequest& Request : InWorker.InFlightRequests)
+	{
+		if (bInCountRetry)
+			BGEOImportRetryCounts.FindOrAdd(Request.GetKey())++;
+
+		FTOPWorkResultObject* WorkResultObject = GetWorkResultObject(Request.TOPNodeId, Request.WorkItemId, Request.Name);
+		if (WorkResultObject && WorkResultObject->State == EPDGWorkResultState::Loading)
+			WorkResultObject->State = EPDGWorkResultState::ToLoad;
+	}
+
+	InWorker.InFlightRequests.Empty();
+}
+
+FTOPWorkResultObject*
+FHoudiniPDGManager::GetWorkResultObject(const HAPI_NodeId& InTOPNodeId, const HAPI_PDG_WorkitemId& InWorkItemId, const FString& InName)
+{
+	UHoudiniPDGAssetLink* AssetLink = nullptr;
+	UTOPNode* TOPNode = nullptr;
+	if (!GetTOPAssetLinkAndNode(InTOPNodeId, AssetLink, TOPNode) || !IsValid(AssetLink) || !IsValid(TOPNode))
+		return nullptr;
+
+	FTOPWorkResult* WorkResult = AssetLink->GetWorkResultByID(InWorkItemId, TOPNode);
+	if (!WorkResult)
+		return nullptr;
+
+	return WorkResult->ResultObjects.FindByPredicate([&InName](const FTOPWorkResultObject& InWorkResultObject)
+	{
+		return InWorkResultObject.Name == InName;
+	});
 }
 
 void FHoudiniPDGManager::StopBGEOCommandletAndEndpoint()
 {
 	BGEOCommandletEndpoint.Reset();
-	BGEOCommandletAddress.Invalidate();
-	BGEOCommandletGuid.Invalidate();
 
-	if (BGEOCommandletProcHandle.IsValid() && FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandlets)
 	{
-		FPlatformProcess::TerminateProc(BGEOCommandletProcHandle, true);
-		if (BGEOCommandletProcHandle.IsValid())
+		// Results that were being imported by the commandlet will be loaded in the editor
+		RequeueBGEOInFlightRequests(Worker, false);
+
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
 		{
-			FPlatformProcess::WaitForProc(BGEOCommandletProcHandle);
-			FPlatformProcess::CloseProc(BGEOCommandletProcHandle);
+			FPlatformProcess::TerminateProc(Worker.ProcHandle, true);
+			if (Worker.ProcHandle.IsValid())
+			{
+				FPlatformProcess::WaitForProc(Worker.ProcHandle);
+				FPlatformProcess::CloseProc(Worker.ProcHandle);
+			}
 		}
 	}
+
+	BGEOCommandlets.Empty();
+	BGEOImportRetryCounts.Empty();
 }
 
 EHoudiniBGEOCommandletStatus FHoudiniPDGManager::UpdateAndGetBGEOCommandletStatus()
 {
-	if (BGEOCommandletProcHandle.IsValid())
+	bool bAnyConnected = false;
+	bool bAnyRunning = false;
+	bool bAnyCrashed = false;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandlets)
 	{
-		if (!FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
-		else if (BGEOCommandletAddress.IsValid())
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+		if (Worker.ProcHandle.IsValid())
+		{
+			if (!FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+				Worker.Status = EHoudiniBGEOCommandletStatus::Crashed;
+			else if (Worker.Address.IsValid())
+				Worker.Status = EHoudiniBGEOCommandletStatus::Connected;
+			else
+				Worker.Status = EHoudiniBGEOCommandletStatus::Running;
+		}
 		else
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+			Worker.Status = EHoudiniBGEOCommandletStatus::NotStarted;
+
+		bAnyConnected |= Worker.Status == EHoudiniBGEOCommandletStatus::Connected;
+		bAnyRunning |= Worker.Status == EHoudiniBGEOCommandletStatus::Running;
+		bAnyCrashed |= Worker.Status == EHoudiniBGEOCommandletStatus::Crashed;
 	}
+
+	if (bAnyConnected)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+	else if (bAnyRunning)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+	else if (bAnyCrashed)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
 	else
 		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 
 	return BGEOCommandletStatus;
 }
 
-
 bool
 FHoudiniPDGManager::IsPDGAsset(const HAPI_NodeId& InAssetId)
 {
@@ -37,6 +37,7 @@ class UHoudiniPDGAssetLink;
 class UTOPNetwork;
 class UTOPNode;
 class FSocket;
+struct FTOPWorkResultObject;
 
 enum class EPDGNodeState : uint8;
 
@@ -55,6 +56,54 @@ enum class HOUDINIENGINE_API EHoudiniBGEOCommandletStatus : uint8
 	Crashed
 };
 
+// A BGEO import request sent to a commandlet, kept until the commandlet replies (or crashes)
+struct HOUDINIENGINE_API FHoudiniBGEOImportRequest
+{
+	// TOP node id of the work result
+	HAPI_NodeId TOPNodeId = -1;
+	// Work item id of the work result
+	HAPI_PDG_WorkitemId WorkItemId = -1;
+	// Name of the work result object
+	FString Name;
+
+	// Key used to track retries of this request
+	FString GetKey() const { return FString::Printf(TEXT("%d/%d/%s"), TOPNodeId, WorkItemId, *Name); }
+};
+
+// A BGEO import commandlet of the commandlet pool
+struct HOUDINIENGINE_API FHoudiniBGEOCommandletWorker
+{
+	FMessageAddress Address;
+	FProcHandle ProcHandle;
+	FGuid Guid;
+	uint32 ProcessId = 0;
+	// Keep track of the commandlet status
+	EHoudiniBGEOCommandletStatus Status = EHoudiniBGEOCommandletStatus::NotStarted;
+	// Requests that have been sent to this commandlet and are waiting for a reply
+	TArray<FHoudiniBGEOImportRequest> InFlightRequests;
+	// Number of times this commandlet was restarted after a crash
+	int32 NumRestarts = 0;
+};
+
+// PDG event processing statistics, updated by FHoudiniPDGManager each tick
+struct HOUDINIENGINE_API FHoudiniPDGEventStats
+{
+	// Number of PDG events dispatched during the last tick
+	int32 NumProcessedEvents = 0;
+	// Number of redundant work item state change events dropped during the last tick
+	int32 NumCoalescedEvents = 0;
+	// Number of events still waiting in the PDG contexts' queues after the last tick
+	int32 NumBacklogEvents = 0;
+	// Number of GetPDGEvents calls made during the last tick
+	int32 NumBatches = 0;
+	// Current number of events fetched per GetPDGEvents call
+	int32 BatchSize = 0;
+	// Time spent (in seconds) fetching and dispatching PDG events during the last tick
+	double ProcessingTime = 0.0;
+	// Smoothed number of events fetched from PDG per second
+	double DrainRate = 0.0;
+};
+
 struct HOUDINIENGINE_API FHoudiniPDGManager
 {
 
@@ -153,14 +202,24 @@ public:
 		const struct FHoudiniPDGImportBGEOResultMessage& InMessage, 
 		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
 
-	// Create the bgeo commandlet endpoint and start the commandlet (if not already running).
+	// Create the bgeo commandlet endpoint and start the commandlet pool (commandlets that are not already running).
 	bool CreateBGEOCommandletAndEndpoint();
 
 	void StopBGEOCommandletAndEndpoint();
 
-	// Updates and returns the BGEO commandlet status
+	// Updates and returns the BGEO commandlet status. With a pool of commandlets this is Connected if any commandlet
+	// is connected, otherwise Running if any is running, otherwise Crashed if any has crashed.
 	EHoudiniBGEOCommandletStatus UpdateAndGetBGEOCommandletStatus();
 
+	// Number of PDG events processed during the last update
+	int32 GetLastTickNumPDGEvents() const { return PDGEventStats.NumProcessedEvents; }
+
+	// Time spent (in seconds) fetching and processing PDG events during the last update
+	double GetLastTickPDGEventsTime() const { return PDGEventStats.ProcessingTime; }
+
+	// PDG event backlog / drain rate statistics
+	const FHoudiniPDGEventStats& GetPDGEventStats() const { return PDGEventStats; }
+
 private:
 	
 	void UpdatePDGContexts();
@@ -171,6 +230,37 @@ private:
 
 	static void ResetPDGEventInfo(HAPI_PDG_EventInfo& InEventInfo);
 
+	// Number of commandlets the BGEO commandlet pool should have
+	static int32 GetBGEOCommandletPoolSize();
+
+	// Start (or restart) the commandlet at InWorkerIndex in the pool. The endpoint must be valid.
+	bool StartBGEOCommandlet(const int32& InWorkerIndex);
+
+	// Restart crashed commandlets and put the work result objects they were importing back in the ToLoad state
+	void UpdateBGEOCommandletPool();
+
+	// Find the connected commandlet with the fewest requests in flight that can accept another request.
+	// Returns INDEX_NONE if all commandlets are busy.
+	int32 FindAvailableBGEOCommandlet() const;
+
+	// Returns the index of the pool commandlet with the given address, or INDEX_NONE
+	int32 FindBGEOCommandletByAddress(const FMessageAddress& InAddress) const;
+
+	// Remove the request from the in flight requests of the commandlet with the given address
+	void RemoveBGEOInFlightRequest(const FMessageAddress& InAddress, const HAPI_NodeId& InTOPNodeId, const HAPI_PDG_WorkitemId& InWorkItemId, const FString& InName);
+
+	// Put the work result objects of the in flight requests of InWorker back in the ToLoad state, and clear the
+	// requests. If bInCountRetry is true the retry count of each request is incremented.
+	void RequeueBGEOInFlightRequests(FHoudiniBGEOCommandletWorker& InWorker, const bool& bInCountRetry);
+
+	// Returns the work result object with the given name of the work item InWorkItemId of the TOP node InTOPNodeId
+	FTOPWorkResultObject* GetWorkResultObject(const HAPI_NodeId& InTOPNodeId, const HAPI_PDG_WorkitemId& InWorkItemId, const FString& InName);
+
+	// Drop work item state change events that are superseded by a later state change of the same work item
+	// in the same batch. Only transient states (waiting, scheduled, cooking, uncooked) are dropped.
+	// Returns the number of events left at the start of InOutEventInfos.
+	static int32 CoalescePDGEvents(TArray<HAPI_PDG_EventInfo>& InOutEventInfos, const int32& InNumEvents);
+
 	// Returns the PDGAssetLink and FTOPNode associated with this TOP node ID
 	bool GetTOPAssetLinkAndNode(const HAPI_NodeId& InNodeID, UHoudiniPDGAssetLink*& OutAssetLink, UTOPNode*& OutTOPNode);
 
@@ -202,14 +292,27 @@ private:
 
 	TArray<TWeakObjectPtr<UHoudiniPDGAssetLink>> PDGAssetLinks;
 
+	// Cache of the PDG asset link owning a TOP node, by TOP node id. Used to dispatch PDG events without searching
+	// all asset links. Entries are validated when used.
+	TMap<HAPI_NodeId, TWeakObjectPtr<UHoudiniPDGAssetLink>> PDGAssetLinksByTOPNodeId;
+
+	// PDG event stats for the last update
+	FHoudiniPDGEventStats PDGEventStats;
+	// Time of the previous PDG event update, used for the drain rate
+	double LastPDGEventUpdateTime = 0.0;
+	// Adaptive number of events fetched per GetPDGEvents call (MaxNumberOfPDGEvents is the minimum)
+	int32 PDGEventBatchSize = 0;
+
 	int32 MaxNumberOfPDGEvents = 20;
 	int32 MaxNumberOPDGContexts = 20;
 
+	// Endpoint shared by all the commandlets of the pool
 	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> BGEOCommandletEndpoint;
-	FMessageAddress BGEOCommandletAddress;
-	FProcHandle BGEOCommandletProcHandle;
-	FGuid BGEOCommandletGuid;
-	uint32 BGEOCommandletProcessId;
-	// Keep track of the BGEO commandlet status
-	EHoudiniBGEOCommandletStatus BGEOCommandletStatus;
+	// The BGEO import commandlet pool
+	TArray<FHoudiniBGEOCommandletWorker> BGEOCommandlets;
+	// Number of failed attempts (commandlet crashed while importing) per request key. Requests that exceed
+	// the retry limit are imported in the editor instead.
+	TMap<FString, int32> BGEOImportRetryCounts;
+	// Keep track of the aggregated BGEO commandlet status
+	EHoudiniBGEOCommandletStatus BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 };
\ No newline at end of file
@@ -412,6 +412,7 @@ FHoudiniPDGTranslator::CreateAllResultObjectsFromPDGOutputs(
 	// might depend on meshes etc from other outputs
 	if (InstancerOutputs.Num() > 0)
 	{
+		FHoudiniFoliageBatchScope FoliageBatchScope;
 		for (UHoudiniOutput* CurOutput : InstancerOutputs)
 		{
 			FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
@@ -56,6 +56,15 @@
 #include "HoudiniParameter.h"
 #include "HoudiniAssetComponent.h"
 
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineCoalesceParameterUploads(
+	TEXT("HoudiniEngine.CoalesceParameterUploads"),
+	1,
+	TEXT("Upload the int and float values of the changed parameters together, with one call per contiguous range of values.\n")
+	TEXT("0: Upload each changed parameter separately\n")
+	TEXT("1: Coalesce the uploads of int and float values, and skip the values Houdini already has\n")
+);
 
 // Default values for certain UI min and max parameter values
 #define HAPI_UNREAL_PARAM_INT_UI_MIN				0
@@ -70,6 +79,206 @@
 #define HAPI_UNREAL_PARAM_PIVOT						"p"
 #define HAPI_UNREAL_PARAM_UNIFORMSCALE				"scale"
 
+bool
+FHoudiniParameterValues::Fetch(const HAPI_NodeId& InNodeId, const HAPI_NodeInfo& InNodeInfo)
+{
+	IntValues.SetNumZeroed(FMath::Max(InNodeInfo.parmIntValueCount, 0));
+	if (IntValues.Num() > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId,
+			IntValues.GetData(), 0, IntValues.Num()), false);
+	}
+
+	FloatValues.SetNumZeroed(FMath::Max(InNodeInfo.parmFloatValueCount, 0));
+	if (FloatValues.Num() > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmFloatValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId,
+			FloatValues.GetData(), 0, FloatValues.Num()), false);
+	}
+
+	TArray<HAPI_StringHandle> StringHandles;
+	StringHandles.SetNumZeroed(FMath::Max(InNodeInfo.parmStringValueCount, 0));
+	if (StringHandles.Num() > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmStringValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId, false,
+			StringHandles.GetData(), 0, StringHandles.Num()), false);
+	}
+
+	// Strings that fail to resolve are left empty, like when converting them one by one
+	FHoudiniEngineString::SHArrayToFStringArray(StringHandles, StringValues);
+	StringValues.SetNum(StringHandles.Num());
+
+	return true;
+}
+
+bool
+FHoudiniParameterValues::GetIntValues(int32* OutValues, const int32& InStart, const int32& InCount) const
+{
+	if (InStart < 0 || InCount < 0 || InStart + InCount > IntValues.Num())
+		return false;
+
+	FMemory::Memcpy(OutValues, IntValues.GetData() + InStart, InCount * sizeof(int32));
+	return true;
+}
+
+bool
+FHoudiniParameterValues::GetFloatValues(float* OutValues, const int32& InStart, const int32& InCount) const
+{
+	if (InStart < 0 || InCount < 0 || InStart + InCount > FloatValues.Num())
+		return false;
+
+	FMemory::Memcpy(OutValues, FloatValues.GetData() + InStart, InCount * sizeof(float));
+	return true;
+}
+
+bool
+FHoudiniParameterValues::GetStringValues(TArray<FString>& OutValues, const int32& InStart, const int32& InCount) const
+{
+	if (InStart < 0 || InCount < 0 || InStart + InCount > StringValues.Num())
+		return false;
+
+	OutValues = TArray<FString>(StringValues.GetData() + InStart, InCount);
+	return true;
+}
+
+// Gets a parameter's int values from the prefetched node values if we have them, or from HAPI
+static bool
+GetParmIntValues(
+	const HAPI_NodeId& InNodeId, const FHoudiniParameterValues* InValues,
+	int32* OutValues, const int32& InStart, const int32& InCount)
+{
+	if (InValues)
+		return InValues->GetIntValues(OutValues, InStart, InCount);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
+		FHoudiniEngine::Get().GetSession(), InNodeId, OutValues, InStart, InCount), false);
+
+	return true;
+}
+
+// Gets a parameter's float values from the prefetched node values if we have them, or from HAPI
+static bool
+GetParmFloatValues(
+	const HAPI_NodeId& InNodeId, const FHoudiniParameterValues* InValues,
+	float* OutValues, const int32& InStart, const int32& InCount)
+{
+	if (InValues)
+		return InValues->GetFloatValues(OutValues, InStart, InCount);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmFloatValues(
+		FHoudiniEngine::Get().GetSession(), InNodeId, OutValues, InStart, InCount), false);
+
+	return true;
+}
+
+// Gets a parameter's string values from the prefetched node values if we have them, or from HAPI
+static bool
+GetParmStringValues(
+	const HAPI_NodeId& InNodeId, const FHoudiniParameterValues* InValues,
+	TArray<FString>& OutValues, const int32& InStart, const int32& InCount)
+{
+	if (InValues)
+		return InValues->GetStringValues(OutValues, InStart, InCount);
+
+	TArray<HAPI_StringHandle> StringHandles;
+	StringHandles.SetNumZeroed(InCount);
+	if (InCount > 0)
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmStringValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId, false,
+			StringHandles.GetData(), InStart, InCount), false);
+	}
+
+	// Convert HAPI string handles to Unreal strings.
+	OutValues.SetNum(InCount);
+	for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
+	{
+		OutValues[Idx] = TEXT("");
+		FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
+		HoudiniEngineString.ToFString(OutValues[Idx]);
+	}
+
+	return true;
+}
+
+// The state of the parameters built by the last call to BuildAllParameters for an outer object
+struct FHoudiniParameterBuildState
+{
+	HAPI_NodeId NodeId = -1;
+	uint32 LayoutHash = 0;
+
+	// The built parameters, and the index of their parm info
+	TArray<TWeakObjectPtr<UHoudiniParameter>> Parameters;
+	TArray<int32> ParmInfoIndices;
+
+	FHoudiniParameterValues Values;
+};
+
+// Parameters built for each outer, used to skip rebuilding parameters when their layout hasn't changed after a cook.
+static TMap<TWeakObjectPtr<UObject>, FHoudiniParameterBuildState> ParameterBuildStates;
+
+// Hashes the parts of the parm infos that define the parameters' layout: the parameters, their type, size, 
+// hierarchy, and where their values are. Labels, help and tags are only updated by full updates, so they are not hashed.
+static uint32
+ComputeParameterLayoutHash(const TArray<HAPI_ParmInfo>& InParmInfos)
+{
+	uint32 Hash = GetTypeHash(InParmInfos.Num());
+	for (const HAPI_ParmInfo& ParmInfo : InParmInfos)
+	{
+		const int32 LayoutValues[] =
+		{
+			ParmInfo.id, ParmInfo.parentId, ParmInfo.childIndex,
+			(int32)ParmInfo.type, (int32)ParmInfo.scriptType, ParmInfo.size,
+			ParmInfo.choiceIndex, ParmInfo.choiceCount,
+			ParmInfo.instanceCount, ParmInfo.instanceLength, ParmInfo.instanceStartOffset,
+			ParmInfo.intValuesIndex, ParmInfo.floatValuesIndex, ParmInfo.stringValuesIndex,
+			ParmInfo.tagCount, ParmInfo.invisible, ParmInfo.disabled, ParmInfo.spare,
+			ParmInfo.joinNext, ParmInfo.isChildOfMultiParm
+		};
+		Hash = FCrc::MemCrc32(LayoutValues, sizeof(LayoutValues), Hash);
+	}
+
+	return Hash;
+}
+
+// Reset the states of ramp parameters.
+static void
+ResetRampParameterCaching(UHoudiniParameter* InParameter)
+{
+	switch (InParameter->GetParameterType())
+	{
+
+		case EHoudiniParameterType::FloatRamp:
+		{
+			UHoudiniParameterRampFloat* FloatRampParam = Cast<UHoudiniParameterRampFloat>(InParameter);
+			if (FloatRampParam)
+			{
+				UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(FloatRampParam->GetOuter());
+				if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
+					FloatRampParam->bCaching = false;
+			}
+
+			break;
+		}
+
+		case EHoudiniParameterType::ColorRamp:
+		{
+			UHoudiniParameterRampColor* ColorRampParam = Cast<UHoudiniParameterRampColor>(InParameter);
+			if (ColorRampParam)
+			{
+				UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(ColorRampParam->GetOuter());
+				if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
+					ColorRampParam->bCaching = false;
+			}
+
+			break;
+		}
+	}
+}
+
 // 
 bool 
 FHoudiniParameterTranslator::UpdateParameters(UHoudiniAssetComponent* HAC)
@@ -260,6 +469,64 @@ FHoudiniParameterTranslator::BuildAllParameters(
 	HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParameters(
 			FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &ParmInfos[0], 0,	NodeInfo.parmCount), false);
 
+	// Retrieve all the parameter values at once, instead of fetching them parameter by parameter.
+	// If this fails, UpdateParameterFromInfo will fetch each parameter's values itself.
+	FHoudiniParameterValues ParmValues;
+	const FHoudiniParameterValues* ParmValuesPtr = ParmValues.Fetch(AssetInfo.nodeId, NodeInfo) ? &ParmValues : nullptr;
+
+	// If the parameters' layout hasn't changed since we've built the current parameters,
+	// we can keep them and only need to update their values, if they have changed.
+	const uint32 LayoutHash = ComputeParameterLayoutHash(ParmInfos);
+	if (bUpdateValues && !InForceFullUpdate && ParmValuesPtr)
+	{
+		FHoudiniParameterBuildState* BuildState = ParameterBuildStates.Find(Outer);
+		bool bLayoutUnchanged = BuildState
+			&& BuildState->NodeId == AssetInfo.nodeId
+			&& BuildState->LayoutHash == LayoutHash
+			&& BuildState->Parameters.Num() == CurrentParameters.Num();
+
+		for (int32 Idx = 0; bLayoutUnchanged && Idx < CurrentParameters.Num(); Idx++)
+		{
+			UHoudiniParameter* CurrentParm = CurrentParameters[Idx];
+			if (!IsValid(CurrentParm) || BuildState->Parameters[Idx].Get() != CurrentParm)
+				bLayoutUnchanged = false;
+		}
+
+		if (bLayoutUnchanged)
+		{
+			const bool bValuesChanged = BuildState->Values.IntValues != ParmValues.IntValues
+				|| BuildState->Values.FloatValues != ParmValues.FloatValues
+				|| BuildState->Values.StringValues != ParmValues.StringValues;
+
+			bool bSuccess = true;
+			if (bValuesChanged)
+			{
+				for (int32 Idx = 0; bSuccess && Idx < CurrentParameters.Num(); Idx++)
+				{
+					UHoudiniParameter* CurrentParm = CurrentParameters[Idx];
+					bSuccess = FHoudiniParameterTranslator::UpdateParameterFromInfo(
+						CurrentParm, AssetInfo.nodeId, ParmInfos[BuildState->ParmInfoIndices[Idx]], false, true, ParmValuesPtr);
+
+					ResetRampParameterCaching(CurrentParm);
+				}
+			}
+
+			if (bSuccess)
+			{
+				NewParameters = CurrentParameters;
+				CurrentParameters.Empty();
+
+				if (bValuesChanged)
+				{
+					BuildState->Values = MoveTemp(ParmValues);
+					FHoudiniEngineUtils::UpdateEditorProperties(Outer, false);
+				}
+
+				return true;
+			}
+		}
+	}
+
 
 	// Create a name lookup cache for the current parameters
 	// Use an array has in some cases, multiple parameters can have the same name!
@@ -290,6 +557,7 @@ FHoudiniParameterTranslator::BuildAllParameters(
 
 	// Create properties for parameters.
 	TArray<HAPI_ParmId> NewParmIds;
+	TArray<int32> NewParmInfoIndices;
 	TArray<int32> AllMultiParams;
 	for (int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx)
 	{
@@ -393,39 +661,11 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			CurrentParameters.Remove(HoudiniAssetParameter);
 
 			// Do a fast update of this parameter
-			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(HoudiniAssetParameter, AssetInfo.nodeId, ParmInfo, InForceFullUpdate, bUpdateValues))
+			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(HoudiniAssetParameter, AssetInfo.nodeId, ParmInfo, InForceFullUpdate, bUpdateValues, ParmValuesPtr))
 				continue;
 
 			// Reset the states of ramp parameters.
-			switch (HoudiniAssetParameter->GetParameterType())
-			{
-
-				case EHoudiniParameterType::FloatRamp:
-				{
-					UHoudiniParameterRampFloat* FloatRampParam = Cast<UHoudiniParameterRampFloat>(HoudiniAssetParameter);
-					if (FloatRampParam)
-					{
-						UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(FloatRampParam->GetOuter());
-						if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
-							FloatRampParam->bCaching = false;
-					}
-
-					break;
-				}
-
-				case EHoudiniParameterType::ColorRamp:
-				{
-					UHoudiniParameterRampColor* ColorRampParam = Cast<UHoudiniParameterRampColor>(HoudiniAssetParameter);
-					if (ColorRampParam)
-					{
-						UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(ColorRampParam->GetOuter());
-						if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
-							ColorRampParam->bCaching = false;
-					}
-
-					break;
-				}
-			}
+			ResetRampParameterCaching(HoudiniAssetParameter);
 
 		}
 		else
@@ -433,13 +673,14 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			// Create a new parameter object of the appropriate type
 			HoudiniAssetParameter = CreateTypedParameter(Outer, ParmType, NewParmName);
 			// Fully update this parameter
-			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(HoudiniAssetParameter, AssetInfo.nodeId, ParmInfo, true, true))
+			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(HoudiniAssetParameter, AssetInfo.nodeId, ParmInfo, true, true, ParmValuesPtr))
 				continue;
 		}
 		
 		// Add the new parameters
 		NewParameters.Add(HoudiniAssetParameter);
 		NewParmIds.Add(ParmInfo.id);
+		NewParmInfoIndices.Add(ParamIdx);
 
 		// Check if the parameter is a direct child of a multiparam.
 		if (HoudiniAssetParameter->GetParameterType() == EHoudiniParameterType::MultiParm)
@@ -494,6 +735,29 @@ FHoudiniParameterTranslator::BuildAllParameters(
 		}
 	}
 
+	// Keep track of the layout and values of the parameters we've built
+	for (auto It = ParameterBuildStates.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	if (ParmValuesPtr && bUpdateValues)
+	{
+		FHoudiniParameterBuildState& BuildState = ParameterBuildStates.FindOrAdd(Outer);
+		BuildState.NodeId = AssetInfo.nodeId;
+		BuildState.LayoutHash = LayoutHash;
+		BuildState.Parameters.Empty(NewParameters.Num());
+		for (UHoudiniParameter* NewParm : NewParameters)
+			BuildState.Parameters.Add(NewParm);
+		BuildState.ParmInfoIndices = NewParmInfoIndices;
+		BuildState.Values = MoveTemp(ParmValues);
+	}
+	else
+	{
+		ParameterBuildStates.Remove(Outer);
+	}
+
 	FHoudiniEngineUtils::UpdateEditorProperties(Outer, true);
 
 	return true;
@@ -1101,7 +1365,7 @@ FHoudiniParameterTranslator::CreateTypedParameter(UObject * Outer, const EHoudin
 bool
 FHoudiniParameterTranslator::UpdateParameterFromInfo(
 	UHoudiniParameter * HoudiniParameter, const HAPI_NodeId& InNodeId, const HAPI_ParmInfo& ParmInfo,
-	const bool& bFullUpdate, const bool& bUpdateValue)
+	const bool& bFullUpdate, const bool& bUpdateValue, const FHoudiniParameterValues* InValues)
 {
 	if (!HoudiniParameter || HoudiniParameter->IsPendingKill())
 		return false;
@@ -1288,10 +1552,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					}
 				}
 
-				if (FHoudiniApi::GetParmIntValues(
-					FHoudiniEngine::Get().GetSession(), InNodeId,
+				if (!GetParmIntValues(
+					InNodeId, InValues,
 					HoudiniParameterButtonStrip->GetValuesPtr(),
-					ParmInfo.intValuesIndex, ParmInfo.choiceCount) != HAPI_RESULT_SUCCESS)
+					ParmInfo.intValuesIndex, ParmInfo.choiceCount))
 				{
 					return false;
 				}
@@ -1312,9 +1576,9 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual value for this property.
 					FLinearColor Color = FLinearColor::White;
-					if (FHoudiniApi::GetParmFloatValues(
-						FHoudiniEngine::Get().GetSession(), InNodeId,
-						(float *)&Color.R, ParmInfo.floatValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+					if (!GetParmFloatValues(
+						InNodeId, InValues,
+						(float *)&Color.R, ParmInfo.floatValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
@@ -1392,26 +1656,18 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				if (bUpdateValue)
 				{
 					// Get the actual values for this property.
-					TArray< HAPI_StringHandle > StringHandles;
-					StringHandles.SetNumZeroed(ParmInfo.size);
-					if (FHoudiniApi::GetParmStringValues(
-						FHoudiniEngine::Get().GetSession(), InNodeId, false,
-						&StringHandles[0], ParmInfo.stringValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+					TArray<FString> StringValues;
+					if (!GetParmStringValues(
+						InNodeId, InValues,
+						StringValues, ParmInfo.stringValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
 
-					// Convert HAPI string handles to Unreal strings.
+					// Update the parameter values
 					HoudiniParameterFile->SetNumberOfValues(ParmInfo.size);
-					for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-					{
-						FString ValueString = TEXT("");
-						FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-						HoudiniEngineString.ToFString(ValueString);
-
-						// Update the parameter value
-						HoudiniParameterFile->SetValueAt(ValueString, Idx);
-					}
+					for (int32 Idx = 0; Idx < StringValues.Num(); ++Idx)
+						HoudiniParameterFile->SetValueAt(StringValues[Idx], Idx);
 				}
 
 				if (bFullUpdate) 
@@ -1434,10 +1690,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Update the parameter's value
 					HoudiniParameterFloat->SetNumberOfValues(ParmInfo.size);
-					if (FHoudiniApi::GetParmFloatValues(
-							FHoudiniEngine::Get().GetSession(), InNodeId,
+					if (!GetParmFloatValues(
+							InNodeId, InValues,
 							HoudiniParameterFloat->GetValuesPtr(),
-							ParmInfo.floatValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+							ParmInfo.floatValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
@@ -1635,10 +1891,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual values for this property.
 					HoudiniParameterInt->SetNumberOfValues(ParmInfo.size);
-					if (FHoudiniApi::GetParmIntValues(
-						FHoudiniEngine::Get().GetSession(), InNodeId,
+					if (!GetParmIntValues(
+						InNodeId, InValues,
 						HoudiniParameterInt->GetValuesPtr(),
-						ParmInfo.intValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+						ParmInfo.intValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
@@ -1732,10 +1988,12 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual values for this property.
 					int32 CurrentIntValue = 0;
-					HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIntValues(
-						FHoudiniEngine::Get().GetSession(),
-						InNodeId, &CurrentIntValue,
-						ParmInfo.intValuesIndex, ParmInfo.size), false);
+					if (!GetParmIntValues(
+						InNodeId, InValues, &CurrentIntValue,
+						ParmInfo.intValuesIndex, ParmInfo.size))
+					{
+						return false;
+					}
 
 					// Check the value is valid
 					if (CurrentIntValue >= ParmInfo.choiceCount)
@@ -1807,18 +2065,15 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				if (bUpdateValue)
 				{
 					// Get the actual values for this property.
-					HAPI_StringHandle StringHandle;
-					HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmStringValues(
-						FHoudiniEngine::Get().GetSession(),
-						InNodeId, false, &StringHandle,
-						ParmInfo.stringValuesIndex, ParmInfo.size), false);
-
-					// Get the string value
-					FString StringValue;
-					FHoudiniEngineString HoudiniEngineString(StringHandle);
-					HoudiniEngineString.ToFString(StringValue);
+					TArray<FString> StringValues;
+					if (!GetParmStringValues(
+						InNodeId, InValues, StringValues,
+						ParmInfo.stringValuesIndex, ParmInfo.size))
+					{
+						return false;
+					}
 
-					HoudiniParameterStringChoice->SetStringValue(StringValue);
+					HoudiniParameterStringChoice->SetStringValue(StringValues.Num() > 0 ? StringValues[0] : FString());
 				}
 
 				// Get the choice descriptors
@@ -1891,23 +2146,14 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				HoudiniParameterLabel->SetValueIndex(ParmInfo.stringValuesIndex);
 
 				// Get the actual value for this property.
-				TArray<HAPI_StringHandle> StringHandles;
-				StringHandles.SetNumZeroed(ParmInfo.size);
-				FHoudiniApi::GetParmStringValues(
-					FHoudiniEngine::Get().GetSession(),
-					InNodeId, false, &StringHandles[0],
+				TArray<FString> StringValues;
+				GetParmStringValues(
+					InNodeId, InValues, StringValues,
 					ParmInfo.stringValuesIndex, ParmInfo.size);
 				
 				HoudiniParameterLabel->EmptyLabelString();
-
-				// Convert HAPI string handles to Unreal strings.
-				for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-				{
-					FString ValueString = TEXT("");
-					FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-					HoudiniEngineString.ToFString(ValueString);
+				for (const FString& ValueString : StringValues)
 					HoudiniParameterLabel->AddLabelString(ValueString);
-				}
 			}
 		}
 		break;
@@ -1925,9 +2171,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 
 				// Set the multiparm value
 				int32 MultiParmValue = 0;
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
-					FHoudiniEngine::Get().GetSession(),
-					InNodeId, &MultiParmValue, ParmInfo.intValuesIndex, 1), false);
+				if (!GetParmIntValues(InNodeId, InValues, &MultiParmValue, ParmInfo.intValuesIndex, 1))
+					return false;
 
 				HoudiniParameterMulti->SetValue(MultiParmValue);
 				HoudiniParameterMulti->MultiParmInstanceCount = ParmInfo.instanceCount;
@@ -1974,25 +2219,17 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				if (bUpdateValue)
 				{
 					// Get the actual value for this property.
-					TArray< HAPI_StringHandle > StringHandles;
-					StringHandles.SetNumZeroed(ParmInfo.size);
-					if (FHoudiniApi::GetParmStringValues(
-						FHoudiniEngine::Get().GetSession(),
-						InNodeId, false, &StringHandles[0],
-						ParmInfo.stringValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+					TArray<FString> StringValues;
+					if (!GetParmStringValues(
+						InNodeId, InValues, StringValues,
+						ParmInfo.stringValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
 
-					// Convert HAPI string handles to Unreal strings.
 					HoudiniParameterString->SetNumberOfValues(ParmInfo.size);
-					for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-					{
-						FString ValueString = TEXT("");
-						FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-						HoudiniEngineString.ToFString(ValueString);
-						HoudiniParameterString->SetValueAt(ValueString, Idx);
-					}
+					for (int32 Idx = 0; Idx < StringValues.Num(); ++Idx)
+						HoudiniParameterString->SetValueAt(StringValues[Idx], Idx);
 				}
 
 				if (bFullUpdate)
@@ -2023,10 +2260,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual values for this property.
 					HoudiniParameterToggle->SetNumberOfValues(ParmInfo.size);
-					if (FHoudiniApi::GetParmIntValues(
-						FHoudiniEngine::Get().GetSession(), InNodeId,
+					if (!GetParmIntValues(
+						InNodeId, InValues,
 						HoudiniParameterToggle->GetValuesPtr(),
-						ParmInfo.intValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+						ParmInfo.intValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
@@ -2126,6 +2363,192 @@ FHoudiniParameterTranslator::HapiGetParameterHasTag(const HAPI_NodeId& NodeId, c
 }
 
 
+// Gathers the int and float values of changed parameters, so they can be uploaded with
+// one SetParmIntValues/SetParmFloatValues call per contiguous range of value indices.
+// Values matching the node's last known values can be skipped.
+struct FHoudiniParameterUploadBatch
+{
+	// The last known values of a node's parameters, updated with the uploaded values
+	FHoudiniParameterValues* KnownValues = nullptr;
+	HAPI_NodeId KnownValuesNodeId = -1;
+
+	// The values to upload, by node and value index
+	TMap<HAPI_NodeId, TMap<int32, int32>> IntValues;
+	TMap<HAPI_NodeId, TMap<int32, float>> FloatValues;
+
+	int32 NumSkippedValues = 0;
+	int32 NumCalls = 0;
+
+	void AddIntValues(const HAPI_NodeId& InNodeId, const int32* InValues, const int32& InStart, const int32& InCount)
+	{
+		TMap<int32, int32>& NodeValues = IntValues.FindOrAdd(InNodeId);
+		for (int32 Idx = 0; Idx < InCount; Idx++)
+			NodeValues.Add(InStart + Idx, InValues[Idx]);
+	}
+
+	void AddFloatValues(const HAPI_NodeId& InNodeId, const float* InValues, const int32& InStart, const int32& InCount)
+	{
+		TMap<int32, float>& NodeValues = FloatValues.FindOrAdd(InNodeId);
+		for (int32 Idx = 0; Idx < InCount; Idx++)
+			NodeValues.Add(InStart + Idx, InValues[Idx]);
+	}
+
+	// Uploads the gathered values, bSkipKnownValues should only be used if the known values are still Houdini's
+	bool Upload(const bool& bSkipKnownValues)
+	{
+		bool bSuccess = true;
+		for (auto& NodeValues : IntValues)
+		{
+			bSuccess &= UploadValues(NodeValues.Key, NodeValues.Value, KnownValues ? &KnownValues->IntValues : nullptr, bSkipKnownValues,
+				[](const HAPI_NodeId& InNodeId, const int32* InValues, const int32& InStart, const int32& InCount)
+			{
+				return FHoudiniApi::SetParmIntValues(FHoudiniEngine::Get().GetSession(), InNodeId, InValues, InStart, InCount);
+			});
+		}
+
+		for (auto& NodeValues : FloatValues)
+		{
+			bSuccess &= UploadValues(NodeValues.Key, NodeValues.Value, KnownValues ? &KnownValues->FloatValues : nullptr, bSkipKnownValues,
+				[](const HAPI_NodeId& InNodeId, const float* InValues, const int32& InStart, const int32& InCount)
+			{
+				return FHoudiniApi::SetParmFloatValues(FHoudiniEngine::Get().GetSession(), InNodeId, InValues, InStart, InCount);
+			});
+		}
+
+		return bSuccess;
+	}
+
+private:
+
+	template<typename T, typename FSetValues>
+	bool UploadValues(
+		const HAPI_NodeId& InNodeId, TMap<int32, T>& InValues, TArray<T>* InOutKnownValues,
+		const bool& bSkipKnownValues, FSetValues SetValues)
+	{
+		InValues.KeySort(TLess<int32>());
+
+		TArray<T>* NodeKnownValues = InNodeId == KnownValuesNodeId ? InOutKnownValues : nullptr;
+
+		bool bSuccess = true;
+		TArray<T> RangeValues;
+		int32 RangeStart = INDEX_NONE;
+		auto UploadRange = [&]()
+		{
+			if (RangeValues.Num() <= 0)
+				return;
+
+			NumCalls++;
+			if (HAPI_RESULT_SUCCESS != SetValues(InNodeId, RangeValues.GetData(), RangeStart, RangeValues.Num()))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Failed to upload parameter values %d to %d: %s"),
+					RangeStart, RangeStart + RangeValues.Num() - 1, *FHoudiniEngineUtils::GetErrorDescription());
+				bSuccess = false;
+			}
+			else if (NodeKnownValues)
+			{
+				for (int32 Idx = 0; Idx < RangeValues.Num(); Idx++)
+				{
+					if (NodeKnownValues->IsValidIndex(RangeStart + Idx))
+						(*NodeKnownValues)[RangeStart + Idx] = RangeValues[Idx];
+				}
+			}
+
+			RangeValues.Reset();
+		};
+
+		for (const auto& Value : InValues)
+		{
+			// Houdini already has this value, this ends the current range
+			if (bSkipKnownValues && NodeKnownValues 
+				&& NodeKnownValues->IsValidIndex(Value.Key) && (*NodeKnownValues)[Value.Key] == Value.Value)
+			{
+				NumSkippedValues++;
+				continue;
+			}
+
+			if (RangeValues.Num() > 0 && Value.Key != RangeStart + RangeValues.Num())
+				UploadRange();
+
+			if (RangeValues.Num() <= 0)
+				RangeStart = Value.Key;
+
+			RangeValues.Add(Value.Value);
+		}
+		UploadRange();
+
+		return bSuccess;
+	}
+};
+
+// Adds the values of a changed parameter to the upload batch.
+// Returns false if the parameter's type can't be batched and needs to be uploaded with UploadParameterValue.
+static bool
+AddParameterToUploadBatch(UHoudiniParameter* InParam, FHoudiniParameterUploadBatch& InBatch)
+{
+	switch (InParam->GetParameterType())
+	{
+		case EHoudiniParameterType::Float:
+		{
+			UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(InParam);
+			if (!FloatParam || !FloatParam->GetValuesPtr())
+				return false;
+
+			InBatch.AddFloatValues(FloatParam->GetNodeId(), FloatParam->GetValuesPtr(), FloatParam->GetValueIndex(), FloatParam->GetTupleSize());
+			return true;
+		}
+
+		case EHoudiniParameterType::Int:
+		{
+			UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(InParam);
+			if (!IntParam || !IntParam->GetValuesPtr())
+				return false;
+
+			InBatch.AddIntValues(IntParam->GetNodeId(), IntParam->GetValuesPtr(), IntParam->GetValueIndex(), IntParam->GetTupleSize());
+			return true;
+		}
+
+		case EHoudiniParameterType::Toggle:
+		{
+			UHoudiniParameterToggle* ToggleParam = Cast<UHoudiniParameterToggle>(InParam);
+			if (!ToggleParam || !ToggleParam->GetValuesPtr())
+				return false;
+
+			InBatch.AddIntValues(ToggleParam->GetNodeId(), ToggleParam->GetValuesPtr(), ToggleParam->GetValueIndex(), ToggleParam->GetTupleSize());
+			return true;
+		}
+
+		case EHoudiniParameterType::IntChoice:
+		case EHoudiniParameterType::StringChoice:
+		{
+			// String choices are set by value, not by index
+			UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(InParam);
+			if (!ChoiceParam || ChoiceParam->IsStringChoice())
+				return false;
+
+			const int32 IntValue = ChoiceParam->GetIntValue();
+			InBatch.AddIntValues(ChoiceParam->GetNodeId(), &IntValue, ChoiceParam->GetValueIndex(), 1);
+			return true;
+		}
+
+		case EHoudiniParameterType::Color:
+		{
+			UHoudiniParameterColor* ColorParam = Cast<UHoudiniParameterColor>(InParam);
+			if (!ColorParam)
+				return false;
+
+			const bool bHasAlpha = ColorParam->GetTupleSize() == 4;
+			const FLinearColor Color = ColorParam->GetColorValue();
+			InBatch.AddFloatValues(ColorParam->GetNodeId(), (const float*)(&Color.R), ColorParam->GetValueIndex(), bHasAlpha ? 4 : 3);
+			return true;
+		}
+
+		default:
+			// Buttons always need to be set to trigger their callback,
+			// strings, files, multiparms and ramps have their own uploads.
+			return false;
+	}
+}
+
 bool
 FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * HAC )
 {
@@ -2136,6 +2559,45 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 
 	TMap<FString, UHoudiniParameter*> RampsToRevert;
 
+	// Consecutive changed int and float parameters are gathered and uploaded together.
+	// The batch is uploaded before any other parameter, to keep the upload order.
+	const bool bCoalesceUploads = CVarHoudiniEngineCoalesceParameterUploads.GetValueOnAnyThread() != 0;
+	FHoudiniParameterBuildState* BuildState = ParameterBuildStates.Find(HAC);
+	FHoudiniParameterUploadBatch UploadBatch;
+	if (BuildState)
+	{
+		UploadBatch.KnownValues = &BuildState->Values;
+		UploadBatch.KnownValuesNodeId = BuildState->NodeId;
+	}
+	TArray<UHoudiniParameter*> BatchedParameters;
+	int32 NumBatchedParameters = 0;
+
+	bool bHasUploadedParameters = false;
+	auto UploadBatchedParameters = [&]()
+	{
+		if (BatchedParameters.Num() <= 0)
+			return;
+
+		// Other uploads' callbacks could have modified Houdini's values,
+		// so only skip the values Houdini already has if nothing else was uploaded
+		const bool bSuccess = UploadBatch.Upload(!bHasUploadedParameters);
+		for (UHoudiniParameter* BatchedParm : BatchedParameters)
+		{
+			if (bSuccess)
+				BatchedParm->MarkChanged(false);
+			else
+				BatchedParm->SetNeedsToTriggerUpdate(false);
+		}
+
+		if (!bSuccess)
+			bHasUploadedParameters = true;
+
+		NumBatchedParameters += BatchedParameters.Num();
+		BatchedParameters.Empty();
+		UploadBatch.IntValues.Empty();
+		UploadBatch.FloatValues.Empty();
+	};
+
 	for (int32 ParmIdx = 0; ParmIdx < HAC->GetNumParameters(); ParmIdx++)
 	{
 		UHoudiniParameter*& CurrentParm = HAC->Parameters[ParmIdx];
@@ -2144,6 +2606,15 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 
 		bool bSuccess = false;
 
+		if (bCoalesceUploads && !CurrentParm->IsPendingRevertToDefault() && AddParameterToUploadBatch(CurrentParm, UploadBatch))
+		{
+			BatchedParameters.Add(CurrentParm);
+			continue;
+		}
+
+		UploadBatchedParameters();
+		bHasUploadedParameters = true;
+
 		if (CurrentParm->IsPendingRevertToDefault())
 		{
 			bSuccess = RevertParameterToDefault(CurrentParm);
@@ -2172,8 +2643,24 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 		}
 	}
 
+	UploadBatchedParameters();
+
 	FHoudiniParameterTranslator::RevertRampParameters(RampsToRevert, HAC->GetAssetId());
 
+	if (NumBatchedParameters > 0)
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Uploaded %d changed int/float parameters with %d calls (%d calls saved, %d unchanged values skipped)."),
+			NumBatchedParameters, UploadBatch.NumCalls,
+			NumBatchedParameters - UploadBatch.NumCalls, UploadBatch.NumSkippedValues);
+	}
+
+	// Houdini might not have kept the values uploaded without the batch (strings, ramps, callbacks...)
+	// so make sure the parameters' values are refreshed after the cook, even if Houdini's values look unchanged.
+	// The batch keeps the known values up to date with the values it has uploaded.
+	if (bHasUploadedParameters && BuildState)
+		BuildState->Values = FHoudiniParameterValues();
+
 	return true;
 }
 
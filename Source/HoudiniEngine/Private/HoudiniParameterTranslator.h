@@ -37,6 +37,23 @@ class UHoudiniParameterFile;
 enum class EHoudiniFolderParameterType : uint8;
 enum class EHoudiniParameterType : uint8;
 
+// All the int, float and string values of a node's parameters, fetched with a single HAPI call per value type.
+// The values are indexed by the parm infos' intValuesIndex, floatValuesIndex and stringValuesIndex.
+struct HOUDINIENGINE_API FHoudiniParameterValues
+{
+	// Fetches all the parameter values of the node, and resolves the string values in a batch
+	bool Fetch(const HAPI_NodeId& InNodeId, const HAPI_NodeInfo& InNodeInfo);
+
+	// Copies InCount values starting at InStart, returns false if they are out of range
+	bool GetIntValues(int32* OutValues, const int32& InStart, const int32& InCount) const;
+	bool GetFloatValues(float* OutValues, const int32& InStart, const int32& InCount) const;
+	bool GetStringValues(TArray<FString>& OutValues, const int32& InStart, const int32& InCount) const;
+
+	TArray<int32> IntValues;
+	TArray<float> FloatValues;
+	TArray<FString> StringValues;
+};
+
 struct HOUDINIENGINE_API FHoudiniParameterTranslator
 {
 	// 
@@ -101,12 +118,14 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 	// and set to true when creating a new parameter
 	// bUpdateValue should be set to false when updating loaded parameters
 	// as the internal parameter's value from HAPI
+	// InValues can hold the node's values fetched beforehand, the values are fetched from HAPI if null
 	static bool UpdateParameterFromInfo(
 		UHoudiniParameter * HoudiniParameter,
 		const HAPI_NodeId& InNodeId,
 		const HAPI_ParmInfo& ParmInfo,
 		const bool& bFullUpdate = true,
-		const bool& bUpdateValue = true);
+		const bool& bUpdateValue = true,
+		const FHoudiniParameterValues* InValues = nullptr);
 
 	static UClass* GetDesiredParameterClass(const HAPI_ParmInfo& ParmInfo);
 
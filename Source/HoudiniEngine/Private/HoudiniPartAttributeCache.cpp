@@ -0,0 +1,349 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPartAttributeCache.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineString.h"
+
+TMap<uint64, FHoudiniPartAttributeCache::FPartAttributes> FHoudiniPartAttributeCache::Parts;
+TMap<FHoudiniPartAttributeCache::FBufferKey, FHoudiniPartAttributeCache::TCachedBuffer<float>> FHoudiniPartAttributeCache::FloatBuffers;
+TMap<FHoudiniPartAttributeCache::FBufferKey, FHoudiniPartAttributeCache::TCachedBuffer<int32>> FHoudiniPartAttributeCache::IntBuffers;
+TMap<FHoudiniPartAttributeCache::FBufferKey, FHoudiniPartAttributeCache::TCachedBuffer<FString>> FHoudiniPartAttributeCache::StringBuffers;
+int32 FHoudiniPartAttributeCache::ScopeCount = 0;
+int32 FHoudiniPartAttributeCache::InfoHits = 0;
+int32 FHoudiniPartAttributeCache::InfoMisses = 0;
+int32 FHoudiniPartAttributeCache::BufferHits = 0;
+int32 FHoudiniPartAttributeCache::BufferMisses = 0;
+int32 FHoudiniPartAttributeCache::HapiCallsSaved = 0;
+int32 FHoudiniPartAttributeCache::HapiCallsMade = 0;
+
+bool
+FHoudiniPartAttributeCache::IsActive()
+{
+	// The cache is only used on the game thread
+	return ScopeCount > 0 && IsInGameThread();
+}
+
+void
+FHoudiniPartAttributeCache::Invalidate()
+{
+	if (!IsInGameThread())
+		return;
+
+	Parts.Empty();
+	FloatBuffers.Empty();
+	IntBuffers.Empty();
+	StringBuffers.Empty();
+}
+
+FHoudiniPartAttributeCache::FPartAttributes&
+FHoudiniPartAttributeCache::GetPartAttributes(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId)
+{
+	const uint64 PartKey = ((uint64)(uint32)InGeoId << 32) | (uint64)(uint32)InPartId;
+	FPartAttributes* FoundPart = Parts.Find(PartKey);
+	if (FoundPart)
+		return *FoundPart;
+
+	FPartAttributes& Part = Parts.Add(PartKey);
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HapiCallsMade++;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+		FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, &PartInfo))
+		return Part;
+
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx)
+	{
+		const int32 AttribCount = PartInfo.attributeCounts[OwnerIdx];
+		if (AttribCount <= 0)
+			continue;
+
+		TArray<HAPI_StringHandle> NameHandles;
+		NameHandles.Init(-1, AttribCount);
+		HapiCallsMade++;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(), InGeoId, InPartId,
+			(HAPI_AttributeOwner)OwnerIdx, &NameHandles[0], AttribCount))
+			return Part;
+
+		TArray<FString> AttribNames;
+		AttribNames.SetNum(AttribCount);
+		FHoudiniEngineString::SHArrayToFStringArray(NameHandles, AttribNames);
+		Part.Names[OwnerIdx].Append(AttribNames);
+	}
+
+	Part.bValid = true;
+	return Part;
+}
+
+void
+FHoudiniPartAttributeCache::AddPartAttribute(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId,
+	const FString& InAttribName, const HAPI_AttributeInfo& InAttributeInfo)
+{
+	if (!IsActive())
+		return;
+
+	const int32 OwnerIdx = (int32)InAttributeInfo.owner;
+	if (OwnerIdx < 0 || OwnerIdx >= HAPI_ATTROWNER_MAX)
+		return;
+
+	const uint64 PartKey = ((uint64)(uint32)InGeoId << 32) | (uint64)(uint32)InPartId;
+	FPartAttributes& Part = Parts.FindOrAdd(PartKey);
+	Part.bValid = true;
+	Part.Names[OwnerIdx].Add(InAttribName);
+	Part.Infos[OwnerIdx].Add(InAttribName, InAttributeInfo);
+}
+
+bool
+FHoudiniPartAttributeCache::HapiGetAttributeInfo(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId,
+	const char * InAttribName, const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
+
+	const int32 FirstOwner = (InOwner == HAPI_ATTROWNER_INVALID) ? 0 : (int32)InOwner;
+	const int32 LastOwner = (InOwner == HAPI_ATTROWNER_INVALID) ? HAPI_ATTROWNER_MAX - 1 : (int32)InOwner;
+
+	FPartAttributes* Part = IsActive() ? &GetPartAttributes(InGeoId, InPartId) : nullptr;
+	if (!Part || !Part->bValid)
+	{
+		// No cached names, query HAPI for each owner
+		for (int32 OwnerIdx = FirstOwner; OwnerIdx <= LastOwner; ++OwnerIdx)
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+				FHoudiniEngine::Get().GetSession(),
+				InGeoId, InPartId, InAttribName,
+				(HAPI_AttributeOwner)OwnerIdx, &OutAttributeInfo), false);
+
+			if (OutAttributeInfo.exists)
+				break;
+		}
+
+		return true;
+	}
+
+	const FString AttribName = UTF8_TO_TCHAR(InAttribName);
+	
+	// Number of GetAttributeInfo calls that would have been made without the cache
+	int32 OwnerProbes = 0;
+	for (int32 OwnerIdx = FirstOwner; OwnerIdx <= LastOwner; ++OwnerIdx)
+	{
+		OwnerProbes++;
+		if (!Part->Names[OwnerIdx].Contains(AttribName))
+			continue;
+
+		const HAPI_AttributeInfo* CachedInfo = Part->Infos[OwnerIdx].Find(AttribName);
+		if (CachedInfo)
+		{
+			OutAttributeInfo = *CachedInfo;
+			InfoHits++;
+			HapiCallsSaved += OwnerProbes;
+			return true;
+		}
+
+		HAPI_AttributeInfo AttributeInfo;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartId, InAttribName,
+			(HAPI_AttributeOwner)OwnerIdx, &AttributeInfo), false);
+
+		InfoMisses++;
+		HapiCallsMade++;
+		HapiCallsSaved += OwnerProbes - 1;
+		OwnerProbes = 0;
+
+		Part->Infos[OwnerIdx].Add(AttribName, AttributeInfo);
+		if (AttributeInfo.exists)
+		{
+			OutAttributeInfo = AttributeInfo;
+			return true;
+		}
+	}
+
+	// The attribute doesn't exist on the requested owner(s)
+	InfoHits++;
+	HapiCallsSaved += OwnerProbes;
+	OutAttributeInfo.exists = false;
+	return true;
+}
+
+FHoudiniPartAttributeCache::FBufferKey
+FHoudiniPartAttributeCache::MakeKey(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+	const int32& InTupleSize, const HAPI_AttributeOwner& InOwner)
+{
+	FBufferKey Key;
+	Key.GeoId = InGeoId;
+	Key.PartId = InPartId;
+	Key.TupleSize = InTupleSize > 0 ? InTupleSize : -1;
+	Key.Owner = InOwner;
+	Key.Name = UTF8_TO_TCHAR(InAttribName);
+	return Key;
+}
+
+bool
+FHoudiniPartAttributeCache::ShouldCacheBuffer(const HAPI_AttributeOwner& InOwner, const int32& InNumValues)
+{
+	return InOwner == HAPI_ATTROWNER_DETAIL || InNumValues <= MaxCachedBufferValues;
+}
+
+template<typename TBuffer>
+bool
+FHoudiniPartAttributeCache::FindDataInternal(
+	TMap<FBufferKey, TCachedBuffer<TBuffer>>& InCache, const FBufferKey& InKey,
+	HAPI_AttributeInfo& OutAttributeInfo, TArray<TBuffer>& OutData)
+{
+	const TCachedBuffer<TBuffer>* CachedBuffer = InCache.Find(InKey);
+	if (!CachedBuffer)
+	{
+		BufferMisses++;
+		return false;
+	}
+
+	OutAttributeInfo = CachedBuffer->AttributeInfo;
+	OutData = CachedBuffer->Data;
+	BufferHits++;
+	// At least one GetAttributeInfo and one Get*Data call
+	HapiCallsSaved += 2;
+	return true;
+}
+
+bool
+FHoudiniPartAttributeCache::FindData(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+	const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo, TArray<float>& OutData)
+{
+	if (!IsActive())
+		return false;
+
+	return FindDataInternal(FloatBuffers, MakeKey(InGeoId, InPartId, InAttribName, InTupleSize, InOwner), OutAttributeInfo, OutData);
+}
+
+bool
+FHoudiniPartAttributeCache::FindData(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+	const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo, TArray<int32>& OutData)
+{
+	if (!IsActive())
+		return false;
+
+	return FindDataInternal(IntBuffers, MakeKey(InGeoId, InPartId, InAttribName, InTupleSize, InOwner), OutAttributeInfo, OutData);
+}
+
+bool
+FHoudiniPartAttributeCache::FindData(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+	const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo, TArray<FString>& OutData)
+{
+	if (!IsActive())
+		return false;
+
+	return FindDataInternal(StringBuffers, MakeKey(InGeoId, InPartId, InAttribName, InTupleSize, InOwner), OutAttributeInfo, OutData);
+}
+
+void
+FHoudiniPartAttributeCache::AddData(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+	const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+	const HAPI_AttributeInfo& InAttributeInfo, const TArray<float>& InData)
+{
+	if (!IsActive() || !ShouldCacheBuffer(InOwner, InData.Num()))
+		return;
+
+	FloatBuffers.Add(MakeKey(InGeoId, InPartId, InAttribName, InTupleSize, InOwner), { InAttributeInfo, InData });
+}
+
+void
+FHoudiniPartAttributeCache::AddData(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+	const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+	const HAPI_AttributeInfo& InAttributeInfo, const TArray<int32>& InData)
+{
+	if (!IsActive() || !ShouldCacheBuffer(InOwner, InData.Num()))
+		return;
+
+	IntBuffers.Add(MakeKey(InGeoId, InPartId, InAttribName, InTupleSize, InOwner), { InAttributeInfo, InData });
+}
+
+void
+FHoudiniPartAttributeCache::AddData(
+	const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+	const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+	const HAPI_AttributeInfo& InAttributeInfo, const TArray<FString>& InData)
+{
+	if (!IsActive() || !ShouldCacheBuffer(InOwner, InData.Num()))
+		return;
+
+	StringBuffers.Add(MakeKey(InGeoId, InPartId, InAttribName, InTupleSize, InOwner), { InAttributeInfo, InData });
+}
+
+void
+FHoudiniPartAttributeCache::LogAndResetStats()
+{
+	if (InfoHits + InfoMisses + BufferHits + BufferMisses > 0)
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Attribute cache: %d/%d info lookups and %d/%d buffers served from the cache, %d HAPI calls saved for %d made."),
+			InfoHits, InfoHits + InfoMisses, BufferHits, BufferHits + BufferMisses, HapiCallsSaved, HapiCallsMade);
+	}
+
+	InfoHits = 0;
+	InfoMisses = 0;
+	BufferHits = 0;
+	BufferMisses = 0;
+	HapiCallsSaved = 0;
+	HapiCallsMade = 0;
+}
+
+FHoudiniScopedPartAttributeCache::FHoudiniScopedPartAttributeCache()
+{
+	if (IsInGameThread())
+		FHoudiniPartAttributeCache::ScopeCount++;
+}
+
+FHoudiniScopedPartAttributeCache::~FHoudiniScopedPartAttributeCache()
+{
+	if (!IsInGameThread())
+		return;
+
+	FHoudiniPartAttributeCache::ScopeCount--;
+	if (FHoudiniPartAttributeCache::ScopeCount <= 0)
+	{
+		FHoudiniPartAttributeCache::ScopeCount = 0;
+		FHoudiniPartAttributeCache::Invalidate();
+		FHoudiniPartAttributeCache::LogAndResetStats();
+	}
+}
@@ -0,0 +1,203 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+// Caches the attribute queries made while processing the outputs of a cook.
+// For each part, the attribute names are fetched once per owner (HAPI_GetAttributeNames) so that
+// existence checks and attribute info lookups can be answered without calling HAPI again,
+// and the small attribute buffers that have been fetched (detail attributes, or buffers of up to
+// MaxCachedBufferValues values) are kept until the end of the outermost FHoudiniScopedPartAttributeCache.
+// Large buffers (P, N, uv...) are not kept, copying them in and out of the cache would double their memory. The cache is only used on the game thread, and is cleared
+// when a node is cooked, since the part's data may have changed.
+class HOUDINIENGINE_API FHoudiniPartAttributeCache
+{
+	public:
+
+		// Returns the info for the given attribute, using the cached attribute names if possible.
+		// If InOwner is HAPI_ATTROWNER_INVALID, the owners are checked in order (vertex, point, prim, detail).
+		// Returns false if HAPI failed, OutAttributeInfo.exists is false if the attribute was not found.
+		static bool HapiGetAttributeInfo(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId,
+			const char * InAttribName, const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
+		// Look for a buffer previously fetched with the same parameters.
+		static bool FindData(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+			const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo, TArray<float>& OutData);
+		static bool FindData(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+			const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo, TArray<int32>& OutData);
+		static bool FindData(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+			const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo, TArray<FString>& OutData);
+
+		// Store a fetched buffer so it can be reused by later requests, if it is small enough.
+		static void AddData(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+			const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+			const HAPI_AttributeInfo& InAttributeInfo, const TArray<float>& InData);
+		static void AddData(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+			const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+			const HAPI_AttributeInfo& InAttributeInfo, const TArray<int32>& InData);
+		static void AddData(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+			const int32& InTupleSize, const HAPI_AttributeOwner& InOwner,
+			const HAPI_AttributeInfo& InAttributeInfo, const TArray<FString>& InData);
+
+		// Clears all the cached data (the stats are kept). Only has an effect on the game thread.
+		static void Invalidate();
+
+		// Returns true if the cache is currently in use.
+		static bool IsActive();
+
+	private:
+
+		friend class FHoudiniScopedPartAttributeCache;
+
+#if WITH_DEV_AUTOMATION_TESTS
+		// Seeds the part's attributes without a HAPI session.
+		friend class HoudiniCorePartAttributeCacheCaseTest;
+#endif
+
+		// Adds an attribute to the cached names and infos of a part, as if they had been fetched from HAPI.
+		// The part's names are then considered complete, and lookups for other attributes won't call HAPI.
+		static void AddPartAttribute(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId,
+			const FString& InAttribName, const HAPI_AttributeInfo& InAttributeInfo);
+
+		// Maximum number of values of a cached non-detail buffer.
+		static const int32 MaxCachedBufferValues = 4096;
+
+		// Returns true if a fetched buffer should be kept in the cache.
+		static bool ShouldCacheBuffer(const HAPI_AttributeOwner& InOwner, const int32& InNumValues);
+
+		// Houdini attribute names are case sensitive (N / n, Cd / cd, uv / UV),
+		// unlike the default FString key funcs.
+		struct FAttributeNameKeyFuncs : BaseKeyFuncs<FString, FString, false>
+		{
+			static const FString& GetSetKey(const FString& Element) { return Element; }
+			static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+			static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+		};
+
+		template<typename ValueType>
+		struct TAttributeNameMapKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+		{
+			static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+			static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+		};
+
+		// Attribute names and infos of a part.
+		struct FPartAttributes
+		{
+			// Indicates that the part's names could be fetched, if not, lookups go directly to HAPI.
+			bool bValid = false;
+			TSet<FString, FAttributeNameKeyFuncs> Names[HAPI_ATTROWNER_MAX];
+			TMap<FString, HAPI_AttributeInfo, FDefaultSetAllocator, TAttributeNameMapKeyFuncs<HAPI_AttributeInfo>> Infos[HAPI_ATTROWNER_MAX];
+		};
+
+		// Identifies a fetched buffer.
+		struct FBufferKey
+		{
+			HAPI_NodeId GeoId;
+			HAPI_PartId PartId;
+			int32 TupleSize;
+			HAPI_AttributeOwner Owner;
+			FString Name;
+
+			bool operator==(const FBufferKey& Other) const
+			{
+				return GeoId == Other.GeoId && PartId == Other.PartId && TupleSize == Other.TupleSize
+					&& Owner == Other.Owner && Name.Equals(Other.Name, ESearchCase::CaseSensitive);
+			}
+
+			friend uint32 GetTypeHash(const FBufferKey& Key)
+			{
+				uint32 Hash = HashCombine(GetTypeHash(Key.GeoId), GetTypeHash(Key.PartId));
+				Hash = HashCombine(Hash, GetTypeHash(Key.TupleSize));
+				Hash = HashCombine(Hash, GetTypeHash((int32)Key.Owner));
+				return HashCombine(Hash, FCrc::StrCrc32(*Key.Name));
+			}
+		};
+
+		template<typename TBuffer>
+		struct TCachedBuffer
+		{
+			HAPI_AttributeInfo AttributeInfo;
+			TArray<TBuffer> Data;
+		};
+
+		template<typename TBuffer>
+		static bool FindDataInternal(
+			TMap<FBufferKey, TCachedBuffer<TBuffer>>& InCache, const FBufferKey& InKey,
+			HAPI_AttributeInfo& OutAttributeInfo, TArray<TBuffer>& OutData);
+
+		static FBufferKey MakeKey(
+			const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const char * InAttribName,
+			const int32& InTupleSize, const HAPI_AttributeOwner& InOwner);
+
+		// Returns the cached attributes for a part, fetching its attribute names if needed.
+		static FPartAttributes& GetPartAttributes(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId);
+
+		// Logs the hit/miss stats and resets them.
+		static void LogAndResetStats();
+
+		static TMap<uint64, FPartAttributes> Parts;
+		static TMap<FBufferKey, TCachedBuffer<float>> FloatBuffers;
+		static TMap<FBufferKey, TCachedBuffer<int32>> IntBuffers;
+		static TMap<FBufferKey, TCachedBuffer<FString>> StringBuffers;
+
+		// Number of FHoudiniScopedPartAttributeCache currently alive.
+		static int32 ScopeCount;
+
+		// Lookups answered by the cache / lookups that needed HAPI calls.
+		static int32 InfoHits;
+		static int32 InfoMisses;
+		static int32 BufferHits;
+		static int32 BufferMisses;
+		// HAPI calls avoided, and HAPI calls made to fill the cache.
+		static int32 HapiCallsSaved;
+		static int32 HapiCallsMade;
+};
+
+// While an instance of this class is alive, attribute queries made on the game thread
+// go through FHoudiniPartAttributeCache. The cache is emptied when the outermost scope ends.
+class HOUDINIENGINE_API FHoudiniScopedPartAttributeCache
+{
+	public:
+
+		FHoudiniScopedPartAttributeCache();
+		~FHoudiniScopedPartAttributeCache();
+};
@@ -0,0 +1,227 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniSharedInputNodeRegistry.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniInputObject.h"
+#include "UnrealMeshTranslator.h"
+
+#include "Engine/StaticMesh.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineSharedInputNodes(
+	TEXT("HoudiniEngine.SharedInputNodes"),
+	1,
+	TEXT("Marshal each static mesh asset used as an input once per session, and let all the inputs using it reference that shared node.\n")
+	TEXT("0: Every input object uploads its own copy of the mesh\n")
+	TEXT("1: Static mesh inputs use shared input nodes (default)\n")
+);
+
+TMap<FString, FHoudiniSharedInputNodeRegistry::FSharedNode> FHoudiniSharedInputNodeRegistry::SharedNodes;
+TMap<HAPI_NodeId, FString> FHoudiniSharedInputNodeRegistry::ProxyKeys;
+int32 FHoudiniSharedInputNodeRegistry::NumUploads = 0;
+int32 FHoudiniSharedInputNodeRegistry::NumReuses = 0;
+
+bool
+FHoudiniSharedInputNodeRegistry::IsEnabled()
+{
+	return CVarHoudiniEngineSharedInputNodes.GetValueOnAnyThread() != 0 && IsInGameThread();
+}
+
+FString
+FHoudiniSharedInputNodeRegistry::MakeKey(
+	UStaticMesh* InStaticMesh, const bool& bExportLODs, const bool& bExportSockets, const bool& bExportColliders)
+{
+	return FString::Printf(TEXT("%s|lods=%d|sockets=%d|colliders=%d"),
+		*InStaticMesh->GetPathName(), bExportLODs ? 1 : 0, bExportSockets ? 1 : 0, bExportColliders ? 1 : 0);
+}
+
+bool
+FHoudiniSharedInputNodeRegistry::HapiSetProxyTarget(const HAPI_NodeId& InMergeNodeId, const HAPI_NodeId& InSharedNodeId)
+{
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmNodeValue(
+		FHoudiniEngine::Get().GetSession(), InMergeNodeId, "objpath1", InSharedNodeId), false);
+
+	// The proxy's OBJ node carries the input object's transform, so the shared geometry is merged as is
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmIntValue(
+		FHoudiniEngine::Get().GetSession(), InMergeNodeId, "xformtype", 0, 0), false);
+
+	return true;
+}
+
+bool
+FHoudiniSharedInputNodeRegistry::HapiCreateProxyForStaticMesh(
+	UHoudiniInputObject* InObject,
+	UStaticMesh* InStaticMesh,
+	const FString& InNodeName,
+	const bool& bExportLODs,
+	const bool& bExportSockets,
+	const bool& bExportColliders,
+	const bool& bUseGeoBlob)
+{
+	if (!InObject || InObject->IsPendingKill())
+		return false;
+
+	if (!InStaticMesh || InStaticMesh->IsPendingKill())
+		return false;
+
+	const FString Key = MakeKey(InStaticMesh, bExportLODs, bExportSockets, bExportColliders);
+	const uint32 DataHash = FUnrealMeshTranslator::ComputeStaticMeshInputHash(
+		InStaticMesh, nullptr, bExportLODs, bExportSockets, bExportColliders);
+
+	// Make sure the shared node exists and holds the current data of the asset
+	FSharedNode& SharedNode = SharedNodes.FindOrAdd(Key);
+	const bool bIsUpToDate = DataHash != 0
+		&& DataHash == SharedNode.DataHash
+		&& SharedNode.NodeId >= 0
+		&& FHoudiniEngineUtils::IsHoudiniNodeValid(SharedNode.NodeId);
+
+	if (!bIsUpToDate)
+	{
+		// The asset is new or has changed, (re)marshal it.
+		// This replaces and deletes the previous shared node if there was one.
+		SharedNode.DataHash = 0;
+		const FString SharedNodeName = TEXT("SharedInput_") + InStaticMesh->GetName();
+		if (!FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
+			InStaticMesh, SharedNode.NodeId, SharedNodeName, nullptr, bExportLODs, bExportSockets, bExportColliders, bUseGeoBlob))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to create the shared input node for %s."), *InStaticMesh->GetPathName());
+			return false;
+		}
+
+		SharedNode.DataHash = DataHash;
+		NumUploads++;
+
+		// The proxies created for the previous node now need to reference the new one
+		for (const FProxy& CurProxy : SharedNode.Proxies)
+			HapiSetProxyTarget(CurProxy.MergeNodeId, SharedNode.NodeId);
+	}
+	else
+	{
+		NumReuses++;
+	}
+
+	// If the object already has a valid proxy for this shared node, we're done
+	const HAPI_NodeId PreviousNodeId = InObject->InputNodeId;
+	const HAPI_NodeId PreviousObjectNodeId = InObject->InputObjectNodeId;
+	const FString* PreviousKey = PreviousObjectNodeId >= 0 ? ProxyKeys.Find(PreviousObjectNodeId) : nullptr;
+	if (PreviousKey && PreviousKey->Equals(Key) && FHoudiniEngineUtils::IsHoudiniNodeValid(PreviousNodeId))
+		return true;
+
+	// Create the object's proxy: an object merge of the shared node, in its own OBJ node
+	HAPI_NodeId MergeNodeId = -1;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+		-1, TEXT("SOP/object_merge"), InNodeName, false, &MergeNodeId), false);
+
+	FProxy NewProxy;
+	NewProxy.MergeNodeId = MergeNodeId;
+	NewProxy.ObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(MergeNodeId);
+	if (!HapiSetProxyTarget(MergeNodeId, SharedNode.NodeId))
+	{
+		FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NewProxy.ObjectNodeId);
+		return false;
+	}
+
+	SharedNode.Proxies.Add(NewProxy);
+	ProxyKeys.Add(NewProxy.ObjectNodeId, Key);
+
+	HOUDINI_LOG_MESSAGE(TEXT("%s uses the shared input node of %s (%d users, %d uploads / %d reuses this session)."),
+		*InNodeName, *InStaticMesh->GetPathName(), SharedNode.Proxies.Num(), NumUploads, NumReuses);
+
+	// Update the object's nodes
+	InObject->InputNodeId = NewProxy.MergeNodeId;
+	InObject->InputObjectNodeId = NewProxy.ObjectNodeId;
+	InObject->InputDataHash = 0;
+
+	// Now that the new proxy is registered, release and delete the object's previous nodes
+	// (SharedNode must not be used past this point as releasing can remove entries from the map)
+	if (PreviousNodeId >= 0)
+	{
+		HAPI_NodeId PreviousParentNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousNodeId);
+		ReleaseProxy(PreviousParentNodeId);
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+			FHoudiniEngine::Get().GetSession(), PreviousNodeId))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input node for %s."), *InNodeName);
+		}
+
+		if (PreviousParentNodeId >= 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+			FHoudiniEngine::Get().GetSession(), PreviousParentNodeId))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input OBJ node for %s."), *InNodeName);
+		}
+	}
+
+	return true;
+}
+
+void
+FHoudiniSharedInputNodeRegistry::ReleaseProxy(const HAPI_NodeId& InProxyNodeId)
+{
+	if (InProxyNodeId < 0 || !IsInGameThread())
+		return;
+
+	FString Key;
+	if (!ProxyKeys.RemoveAndCopyValue(InProxyNodeId, Key))
+		return;
+
+	FSharedNode* SharedNode = SharedNodes.Find(Key);
+	if (!SharedNode)
+		return;
+
+	SharedNode->Proxies.RemoveAll([&InProxyNodeId](const FProxy& InProxy) { return InProxy.ObjectNodeId == InProxyNodeId; });
+	if (SharedNode->Proxies.Num() > 0)
+		return;
+
+	// This was the last user of the shared node, delete it along with its OBJ parent
+	if (SharedNode->NodeId >= 0 && FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(SharedNode->NodeId, true);
+
+	SharedNodes.Remove(Key);
+}
+
+void
+FHoudiniSharedInputNodeRegistry::Reset()
+{
+	if (!IsInGameThread())
+		return;
+
+	if (NumUploads > 0 || NumReuses > 0)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Shared input nodes: %d uploads, %d reuses during the session."), NumUploads, NumReuses);
+	}
+
+	// The nodes belonged to the previous session, just forget about them
+	SharedNodes.Empty();
+	ProxyKeys.Empty();
+	NumUploads = 0;
+	NumReuses = 0;
+}
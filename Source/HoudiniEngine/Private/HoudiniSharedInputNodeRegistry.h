@@ -0,0 +1,105 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+#include "CoreMinimal.h"
+
+class UStaticMesh;
+class UHoudiniInputObject;
+
+// Session-wide registry of input nodes shared by the static mesh inputs of all the HDAs.
+// A static mesh asset is marshalled once per set of export options into a shared node, and every
+// input object using it gets a lightweight proxy (an object merge in its own OBJ node) pointing at it.
+// The proxies carry the input objects' transform offsets, and are the nodes the HDA inputs connect to.
+// Shared nodes are re-uploaded when the asset's data changes, and deleted once their last proxy is released.
+// The registry is emptied when the session is stopped or lost. It is only used on the game thread.
+class HOUDINIENGINE_API FHoudiniSharedInputNodeRegistry
+{
+	public:
+
+		// Returns true if static mesh inputs should use the shared input nodes.
+		static bool IsEnabled();
+
+		// Makes sure a shared node holding InStaticMesh exists and is up to date, and points
+		// InObject's input nodes (InputNodeId / InputObjectNodeId) to a proxy of that shared node.
+		// bUseGeoBlob only applies when the shared node has to be (re)marshalled.
+		// Returns true on success.
+		static bool HapiCreateProxyForStaticMesh(
+			UHoudiniInputObject* InObject,
+			UStaticMesh* InStaticMesh,
+			const FString& InNodeName,
+			const bool& bExportLODs,
+			const bool& bExportSockets,
+			const bool& bExportColliders,
+			const bool& bUseGeoBlob = false);
+
+		// Notifies the registry that a proxy node is being deleted.
+		// The proxy's shared node is marked for deletion when it has no more users.
+		static void ReleaseProxy(const HAPI_NodeId& InProxyNodeId);
+
+		// Forgets all the shared nodes, without deleting them. Called when the session is stopped.
+		static void Reset();
+
+	private:
+
+		// A proxy using a shared node.
+		struct FProxy
+		{
+			// The proxy's OBJ node
+			HAPI_NodeId ObjectNodeId = -1;
+			// The object merge SOP referencing the shared node
+			HAPI_NodeId MergeNodeId = -1;
+		};
+
+		// A shared input node.
+		struct FSharedNode
+		{
+			// The SOP node holding the marshalled mesh
+			HAPI_NodeId NodeId = -1;
+			// Hash of the marshalled data, 0 if unknown
+			uint32 DataHash = 0;
+			// Proxies currently referencing the node
+			TArray<FProxy> Proxies;
+		};
+
+		static FString MakeKey(
+			UStaticMesh* InStaticMesh, const bool& bExportLODs, const bool& bExportSockets, const bool& bExportColliders);
+
+		// Points a proxy's object merge to a shared node
+		static bool HapiSetProxyTarget(const HAPI_NodeId& InMergeNodeId, const HAPI_NodeId& InSharedNodeId);
+
+		// Shared nodes, per asset path and export options.
+		static TMap<FString, FSharedNode> SharedNodes;
+
+		// Shared node key for each proxy OBJ node.
+		static TMap<HAPI_NodeId, FString> ProxyKeys;
+
+		// Number of times a shared node was uploaded / reused since the last reset.
+		static int32 NumUploads;
+		static int32 NumReuses;
+};
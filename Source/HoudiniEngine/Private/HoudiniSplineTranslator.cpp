@@ -34,6 +34,7 @@
 #include "HoudiniSplineComponent.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniDataConversion.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniGeoPartObject.h"
 #include "Components/SplineComponent.h"
@@ -67,15 +68,11 @@ FHoudiniSplineTranslator::ExtractStringPositions(const FString& Positions, TArra
 void
 FHoudiniSplineTranslator::ConvertToVectorData(const TArray<float> & InRawData, TArray<FVector>& OutVectorData)
 {
-	OutVectorData.SetNum(InRawData.Num() / 3);
+	OutVectorData.SetNumUninitialized(InRawData.Num() / 3);
 
-	for (int32 OutIndex = 0; OutIndex < OutVectorData.Num(); OutIndex++)
-	{
-		const int32& InIndex = OutIndex * 3;
-		OutVectorData[OutIndex].X = InRawData[InIndex + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		OutVectorData[OutIndex].Y = InRawData[InIndex + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		OutVectorData[OutIndex].Z = InRawData[InIndex + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
+	// Swap Y/Z and convert from m to cm
+	FHoudiniDataConversion::SwizzleAndScaleFloat3(
+		InRawData.GetData(), (float*)OutVectorData.GetData(), OutVectorData.Num(), HAPI_UNREAL_SCALE_FACTOR_POSITION);
 }
 
 void 
@@ -99,17 +96,15 @@ FHoudiniSplineTranslator::ConvertToVectorData(const TArray<float> & InRawData, T
 		TArray<FVector> & NextVectorDataArray = OutVectorData[n];
 		NextVectorDataArray.SetNumZeroed(CurveCounts[n]);
 
-		for (int32 PtIdx = 0; PtIdx < CurveCounts[n]; ++PtIdx)
-		{
-			if (Itr + 2 >= InRawData.Num())
-				return;
+		// Only convert the points we have data for
+		const int32 NumPoints = FMath::Clamp((InRawData.Num() - Itr) / 3, 0, CurveCounts[n]);
+		FHoudiniDataConversion::SwizzleAndScaleFloat3(
+			InRawData.GetData() + Itr, (float*)NextVectorDataArray.GetData(), NumPoints, HAPI_UNREAL_SCALE_FACTOR_POSITION);
 
-			NextVectorDataArray[PtIdx].X = InRawData[Itr]     * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			NextVectorDataArray[PtIdx].Y = InRawData[Itr + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			NextVectorDataArray[PtIdx].Z = InRawData[Itr + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		if (NumPoints < CurveCounts[n])
+			return;
 
-			Itr += 3;
-		}
+		Itr += NumPoints * 3;
 	}
 }
 void
@@ -3,6 +3,37 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 
+#include "../HoudiniMeshTranslator.h"
+#include "../HoudiniDataConversion.h"
+#include "../HoudiniGeoBlobWriter.h"
+#include "../UnrealMeshTranslator.h"
+#include "../HoudiniEngineUtils.h"
+#include "../HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "../HoudiniApiRecorder.h"
+#include "../HoudiniPartAttributeCache.h"
+#include "../HoudiniParameterTranslator.h"
+#include "../HoudiniOutputTranslator.h"
+#include "../HoudiniInstanceTranslator.h"
+#include "../HoudiniLandscapeTranslator.h"
+#include "../HoudiniPackageParams.h"
+#include "HoudiniOutput.h"
+#include "HoudiniParameter.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniRuntimeSettings.h"
+#include "Misc/Paths.h"
+#include "HoudiniStaticMesh.h"
+#include "HAL/PlatformTime.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "InstancedFoliageActor.h"
+#include "Interfaces/IPluginManager.h"
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTest, "Houdini.Core.TestAutomation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
 bool HoudiniCoreTest::RunTest(const FString & Parameters)
@@ -10,4 +41,1148 @@ bool HoudiniCoreTest::RunTest(const FString & Parameters)
 	return true;
 }
 
-#endif
\ No newline at end of file
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreStaticMeshSplitBuildBenchmark, "Houdini.Core.Benchmarks.StaticMeshSplitBuild", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreStaticMeshSplitBuildBenchmark::RunTest(const FString & Parameters)
+{
+	// Synthetic part: a grid of GridSize x GridSize points, 2 triangles per cell, 
+	// with point normals, colors and uvs, divided in NumSplits horizontal bands.
+	const int32 GridSize = 1024;
+	const int32 NumSplits = 4;
+	const int32 NumPoints = GridSize * GridSize;
+
+	TArray<float> Positions, Normals, Colors, UVs;
+	Positions.SetNumUninitialized(NumPoints * 3);
+	Normals.SetNumUninitialized(NumPoints * 3);
+	Colors.SetNumUninitialized(NumPoints * 3);
+	UVs.SetNumUninitialized(NumPoints * 2);
+	for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+	{
+		const float U = (float)(PointIdx % GridSize) / GridSize;
+		const float V = (float)(PointIdx / GridSize) / GridSize;
+		Positions[PointIdx * 3 + 0] = U;
+		Positions[PointIdx * 3 + 1] = FMath::Sin(U * 10.0f) * FMath::Cos(V * 10.0f);
+		Positions[PointIdx * 3 + 2] = V;
+		Normals[PointIdx * 3 + 0] = 0.0f;
+		Normals[PointIdx * 3 + 1] = 1.0f;
+		Normals[PointIdx * 3 + 2] = 0.0f;
+		Colors[PointIdx * 3 + 0] = U;
+		Colors[PointIdx * 3 + 1] = V;
+		Colors[PointIdx * 3 + 2] = 1.0f - U;
+		UVs[PointIdx * 2 + 0] = U;
+		UVs[PointIdx * 2 + 1] = V;
+	}
+
+	auto MakePointAttribInfo = [](int32 InTupleSize, int32 InCount)
+	{
+		HAPI_AttributeInfo AttribInfo;
+		FMemory::Memzero(AttribInfo);
+		AttribInfo.exists = true;
+		AttribInfo.owner = HAPI_ATTROWNER_POINT;
+		AttribInfo.storage = HAPI_STORAGETYPE_FLOAT;
+		AttribInfo.tupleSize = InTupleSize;
+		AttribInfo.count = InCount;
+		return AttribInfo;
+	};
+
+	const HAPI_AttributeInfo AttribInfoNormals = MakePointAttribInfo(3, NumPoints);
+	const HAPI_AttributeInfo AttribInfoColors = MakePointAttribInfo(3, NumPoints);
+	TArray<TArray<float>> UVSets = { UVs };
+	TArray<HAPI_AttributeInfo> AttribInfoUVSets = { MakePointAttribInfo(2, NumPoints) };
+
+	FHoudiniStaticMeshSplitBuildData BuildData;
+	BuildData.PartPositions = &Positions;
+	BuildData.PartNormals = &Normals;
+	BuildData.AttribInfoNormals = &AttribInfoNormals;
+	BuildData.PartColors = &Colors;
+	BuildData.AttribInfoColors = &AttribInfoColors;
+	BuildData.PartUVSets = &UVSets;
+	BuildData.AttribInfoUVSets = &AttribInfoUVSets;
+	BuildData.bReadTangents = false;
+
+	// The split vertex lists contain the point index of each vertex of the part, or -1 if it is not in the split
+	const int32 NumCells = (GridSize - 1) * (GridSize - 1);
+	TArray<TArray<int32>> SplitVertexLists;
+	SplitVertexLists.SetNum(NumSplits);
+	for (TArray<int32>& SplitVertexList : SplitVertexLists)
+		SplitVertexList.Init(-1, NumCells * 6);
+
+	for (int32 CellIdx = 0; CellIdx < NumCells; CellIdx++)
+	{
+		const int32 Row = CellIdx / (GridSize - 1);
+		const int32 P0 = Row * GridSize + CellIdx % (GridSize - 1);
+		const int32 Corners[6] = { P0, P0 + 1, P0 + GridSize, P0 + 1, P0 + GridSize + 1, P0 + GridSize };
+		TArray<int32>& SplitVertexList = SplitVertexLists[Row * NumSplits / (GridSize - 1)];
+		for (int32 CornerIdx = 0; CornerIdx < 6; CornerIdx++)
+			SplitVertexList[CellIdx * 6 + CornerIdx] = Corners[CornerIdx];
+	}
+
+	auto BuildSplits = [&](bool bParallel, TArray<UHoudiniStaticMesh*>& OutMeshes)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		ParallelFor(NumSplits, [&](int32 SplitIdx)
+		{
+			FHoudiniMeshTranslator::BuildHoudiniStaticMeshSplit(
+				BuildData, SplitVertexLists[SplitIdx], FString::Printf(TEXT("Benchmark split %d"), SplitIdx), OutMeshes[SplitIdx], bParallel);
+		}, !bParallel);
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	TArray<UHoudiniStaticMesh*> SerialMeshes, ParallelMeshes;
+	for (int32 SplitIdx = 0; SplitIdx < NumSplits; SplitIdx++)
+	{
+		SerialMeshes.Add(NewObject<UHoudiniStaticMesh>());
+		ParallelMeshes.Add(NewObject<UHoudiniStaticMesh>());
+	}
+
+	const double SerialTime = BuildSplits(false, SerialMeshes);
+	const double ParallelTime = BuildSplits(true, ParallelMeshes);
+
+	AddInfo(FString::Printf(
+		TEXT("Built %d splits (%d triangles): serial %.3fs, parallel %.3fs (x%.2f)."),
+		NumSplits, NumCells * 2, SerialTime, ParallelTime, ParallelTime > 0.0 ? SerialTime / ParallelTime : 0.0));
+
+	// The parallel build must produce exactly the same meshes
+	for (int32 SplitIdx = 0; SplitIdx < NumSplits; SplitIdx++)
+	{
+		const UHoudiniStaticMesh* Serial = SerialMeshes[SplitIdx];
+		const UHoudiniStaticMesh* Parallel = ParallelMeshes[SplitIdx];
+		TestTrue(TEXT("Positions match"), Serial->GetVertexPositions() == Parallel->GetVertexPositions());
+		TestTrue(TEXT("Triangles match"), Serial->GetTriangleIndices() == Parallel->GetTriangleIndices());
+		TestTrue(TEXT("Normals match"), Serial->GetVertexInstanceNormals() == Parallel->GetVertexInstanceNormals());
+		TestTrue(TEXT("Colors match"), Serial->GetVertexInstanceColors() == Parallel->GetVertexInstanceColors());
+		TestTrue(TEXT("UVs match"), Serial->GetVertexInstanceUVs() == Parallel->GetVertexInstanceUVs());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreConversionKernelsBenchmark, "Houdini.Core.Benchmarks.ConversionKernels", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreConversionKernelsBenchmark::RunTest(const FString & Parameters)
+{
+	const int32 NumElements = 4 * 1024 * 1024 + 3;
+	const int32 NumIterations = 10;
+
+	TArray<float> Input;
+	Input.SetNumUninitialized(NumElements * 4);
+	for (int32 Idx = 0; Idx < Input.Num(); Idx++)
+		Input[Idx] = FMath::FRandRange(-0.25f, 1.25f);
+
+	// Runs both versions of a kernel, reports their throughput and checks they produce the same output
+	auto Benchmark = [&](const TCHAR* InName, const int64& InBytesPerIteration, TFunctionRef<void(bool)> InKernel, TFunctionRef<bool()> InOutputsMatch)
+	{
+		double Times[2];
+		for (int32 Version = 0; Version < 2; Version++)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+				InKernel(Version == 0);
+			Times[Version] = FMath::Max(FPlatformTime::Seconds() - StartTime, SMALL_NUMBER);
+		}
+
+		const double GigaBytes = (double)InBytesPerIteration * NumIterations / (1024.0 * 1024.0 * 1024.0);
+		AddInfo(FString::Printf(TEXT("%s: %.2f GB/s (scalar %.2f GB/s)"), InName, GigaBytes / Times[1], GigaBytes / Times[0]));
+		TestTrue(FString::Printf(TEXT("%s outputs match"), InName), InOutputsMatch());
+	};
+
+	{
+		TArray<float> Scalar, Vectorized;
+		Scalar.SetNumUninitialized(NumElements * 3);
+		Vectorized.SetNumUninitialized(NumElements * 3);
+		Benchmark(TEXT("SwizzleAndScaleFloat3"), (int64)NumElements * 3 * sizeof(float) * 2,
+			[&](bool bScalar)
+			{
+				if (bScalar)
+					FHoudiniDataConversion::SwizzleAndScaleFloat3Scalar(Input.GetData(), Scalar.GetData(), NumElements, 100.0f);
+				else
+					FHoudiniDataConversion::SwizzleAndScaleFloat3(Input.GetData(), Vectorized.GetData(), NumElements, 100.0f);
+			},
+			[&]() { return Scalar == Vectorized; });
+	}
+
+	{
+		TArray<float> Scalar, Vectorized;
+		Scalar.SetNumUninitialized(NumElements * 2);
+		Vectorized.SetNumUninitialized(NumElements * 2);
+		Benchmark(TEXT("FlipUVs"), (int64)NumElements * 2 * sizeof(float) * 2,
+			[&](bool bScalar)
+			{
+				if (bScalar)
+					FHoudiniDataConversion::FlipUVsScalar(Input.GetData(), Scalar.GetData(), NumElements);
+				else
+					FHoudiniDataConversion::FlipUVs(Input.GetData(), Vectorized.GetData(), NumElements);
+			},
+			[&]() { return Scalar == Vectorized; });
+	}
+
+	{
+		// Indexed positions, as gathered for a split, with a few invalid indices
+		const int32 NumPositions = NumElements / 2;
+		TArray<int32> Indices;
+		Indices.SetNumUninitialized(NumElements);
+		for (int32 Idx = 0; Idx < NumElements; Idx++)
+			Indices[Idx] = FMath::RandRange(0, NumPositions - 1);
+		Indices[0] = -1;
+		Indices[NumElements - 1] = NumPositions;
+
+		TArray<float> Scalar, Vectorized;
+		Scalar.SetNumUninitialized(NumElements * 3);
+		Vectorized.SetNumUninitialized(NumElements * 3);
+		Benchmark(TEXT("GatherSwizzleAndScaleFloat3"), (int64)NumElements * (3 * sizeof(float) * 2 + sizeof(int32)),
+			[&](bool bScalar)
+			{
+				if (bScalar)
+				{
+					for (int32 Idx = 0; Idx < NumElements; Idx++)
+					{
+						const int32 Index = Indices[Idx];
+						const bool bValid = Index >= 0 && Index < NumPositions;
+						Scalar[Idx * 3 + 0] = bValid ? Input[Index * 3 + 0] * 100.0f : 0.0f;
+						Scalar[Idx * 3 + 1] = bValid ? Input[Index * 3 + 2] * 100.0f : 0.0f;
+						Scalar[Idx * 3 + 2] = bValid ? Input[Index * 3 + 1] * 100.0f : 0.0f;
+					}
+				}
+				else
+				{
+					FHoudiniDataConversion::GatherSwizzleAndScaleFloat3(
+						Input.GetData(), NumPositions * 3, Indices.GetData(), Vectorized.GetData(), NumElements, 100.0f);
+				}
+			},
+			[&]() { return Scalar == Vectorized; });
+	}
+
+	{
+		TArray<FColor> Scalar, Vectorized;
+		Scalar.SetNumUninitialized(NumElements);
+		Vectorized.SetNumUninitialized(NumElements);
+		Benchmark(TEXT("ConvertColors"), (int64)NumElements * (4 * sizeof(float) + sizeof(FColor)),
+			[&](bool bScalar)
+			{
+				if (bScalar)
+					FHoudiniDataConversion::ConvertColorsScalar(Input.GetData(), 4, nullptr, Scalar.GetData(), NumElements);
+				else
+					FHoudiniDataConversion::ConvertColors(Input.GetData(), 4, nullptr, Vectorized.GetData(), NumElements);
+			},
+			[&]() { return Scalar == Vectorized; });
+	}
+
+	{
+		const int32 NumTransforms = NumElements / 16;
+		TArray<HAPI_Transform> HapiTransforms;
+		HapiTransforms.SetNumZeroed(NumTransforms);
+		for (int32 Idx = 0; Idx < NumTransforms; Idx++)
+		{
+			FMemory::Memcpy(HapiTransforms[Idx].position, &Input[Idx * 10 + 0], 3 * sizeof(float));
+			FMemory::Memcpy(HapiTransforms[Idx].rotationQuaternion, &Input[Idx * 10 + 3], 4 * sizeof(float));
+			FMemory::Memcpy(HapiTransforms[Idx].scale, &Input[Idx * 10 + 7], 3 * sizeof(float));
+		}
+
+		TArray<FTransform> Scalar, Vectorized;
+		Scalar.SetNum(NumTransforms);
+		Vectorized.SetNum(NumTransforms);
+		Benchmark(TEXT("ConvertHapiTransforms"), (int64)NumTransforms * (sizeof(HAPI_Transform) + sizeof(FTransform)),
+			[&](bool bScalar)
+			{
+				if (bScalar)
+					FHoudiniDataConversion::ConvertHapiTransformsScalar(HapiTransforms.GetData(), Scalar.GetData(), NumTransforms);
+				else
+					FHoudiniDataConversion::ConvertHapiTransforms(HapiTransforms.GetData(), Vectorized.GetData(), NumTransforms);
+			},
+			[&]() { return FMemory::Memcmp(Scalar.GetData(), Vectorized.GetData(), NumTransforms * sizeof(FTransform)) == 0; });
+	}
+
+	{
+		// RewindTriangles works in place, so each iteration rewinds a fresh copy of the indices,
+		// the scalar reference writes the expected {0, 2, 1} order out of place.
+		const int32 NumTriangles = NumElements / 3;
+		TArray<int32> Indices, Scalar, Rewound;
+		Indices.SetNumUninitialized(NumTriangles * 3);
+		for (int32 Idx = 0; Idx < Indices.Num(); Idx++)
+			Indices[Idx] = Idx;
+		Scalar.SetNumUninitialized(Indices.Num());
+		Rewound.SetNumUninitialized(Indices.Num());
+
+		Benchmark(TEXT("RewindTriangles"), (int64)Indices.Num() * sizeof(int32) * 2,
+			[&](bool bScalar)
+			{
+				if (bScalar)
+				{
+					for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
+					{
+						Scalar[TriIdx * 3 + 0] = Indices[TriIdx * 3 + 0];
+						Scalar[TriIdx * 3 + 1] = Indices[TriIdx * 3 + 2];
+						Scalar[TriIdx * 3 + 2] = Indices[TriIdx * 3 + 1];
+					}
+				}
+				else
+				{
+					FMemory::Memcpy(Rewound.GetData(), Indices.GetData(), Indices.Num() * sizeof(int32));
+					FHoudiniDataConversion::RewindTriangles(Rewound.GetData(), NumTriangles);
+				}
+			},
+			[&]() { return Scalar == Rewound && Rewound[1] == 2 && Rewound[2] == 1; });
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreGeoBlobUploadBenchmark, "Houdini.Core.Benchmarks.GeoBlobUpload", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreGeoBlobUploadBenchmark::RunTest(const FString & Parameters)
+{
+	// Synthetic input mesh: a grid of GridSize x GridSize points, 2 triangles per cell,
+	// with vertex normals, uvs and colors and a primitive material, like a static mesh input.
+	const int32 GridSize = 512;
+	const int32 NumPoints = GridSize * GridSize;
+	const int32 NumCells = (GridSize - 1) * (GridSize - 1);
+	const int32 NumTriangles = NumCells * 2;
+	const int32 NumVertices = NumTriangles * 3;
+	const TArray<FString> MaterialPaths = { TEXT("/Game/Materials/M_A.M_A"), TEXT("/Game/Materials/M_B.M_B") };
+
+	auto GetVertexPoint = [GridSize](const int32& InVertexIdx)
+	{
+		static const int32 CornerOffsets[2][3] = { { 0, 1, 0 }, { 1, 1, 0 } };
+		static const int32 CornerRows[2][3] = { { 0, 0, 1 }, { 0, 1, 1 } };
+		const int32 TriangleIdx = InVertexIdx / 3;
+		const int32 Cell = TriangleIdx / 2;
+		const int32 Half = TriangleIdx % 2;
+		const int32 Corner = InVertexIdx % 3;
+		const int32 X = Cell % (GridSize - 1) + CornerOffsets[Half][Corner];
+		const int32 Y = Cell / (GridSize - 1) + CornerRows[Half][Corner];
+		return Y * GridSize + X;
+	};
+
+	// Attribute by attribute: interleaved arrays, one AddAttribute + Set*Data per attribute
+	TArray<float> Positions, Normals, UVs, Colors;
+	TArray<int32> VertexList, FaceCounts;
+	TArray<const char*> Materials;
+	TArray<std::string> MaterialStrings;
+	auto BuildAttributeArrays = [&]()
+	{
+		Positions.SetNumUninitialized(NumPoints * 3);
+		for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+		{
+			Positions[PointIdx * 3 + 0] = (float)(PointIdx % GridSize);
+			Positions[PointIdx * 3 + 1] = 0.0f;
+			Positions[PointIdx * 3 + 2] = (float)(PointIdx / GridSize);
+		}
+
+		Normals.SetNumUninitialized(NumVertices * 3);
+		UVs.SetNumUninitialized(NumVertices * 3);
+		Colors.SetNumUninitialized(NumVertices * 3);
+		VertexList.SetNumUninitialized(NumVertices);
+		for (int32 VertexIdx = 0; VertexIdx < NumVertices; VertexIdx++)
+		{
+			const int32 PointIdx = GetVertexPoint(VertexIdx);
+			VertexList[VertexIdx] = PointIdx;
+			Normals[VertexIdx * 3 + 0] = 0.0f;
+			Normals[VertexIdx * 3 + 1] = 1.0f;
+			Normals[VertexIdx * 3 + 2] = 0.0f;
+			UVs[VertexIdx * 3 + 0] = Positions[PointIdx * 3 + 0] / GridSize;
+			UVs[VertexIdx * 3 + 1] = 1.0f - Positions[PointIdx * 3 + 2] / GridSize;
+			UVs[VertexIdx * 3 + 2] = 0.0f;
+			Colors[VertexIdx * 3 + 0] = UVs[VertexIdx * 3 + 0];
+			Colors[VertexIdx * 3 + 1] = UVs[VertexIdx * 3 + 1];
+			Colors[VertexIdx * 3 + 2] = 1.0f;
+		}
+
+		FaceCounts.Init(3, NumTriangles);
+		MaterialStrings.SetNum(MaterialPaths.Num());
+		for (int32 Idx = 0; Idx < MaterialPaths.Num(); Idx++)
+			MaterialStrings[Idx] = TCHAR_TO_ANSI(*MaterialPaths[Idx]);
+		Materials.SetNumUninitialized(NumTriangles);
+		for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; TriangleIdx++)
+			Materials[TriangleIdx] = MaterialStrings[TriangleIdx % 2].c_str();
+	};
+
+	// Blob: every value is written once, in place
+	TUniquePtr<FHoudiniGeoBlobWriter> Blob;
+	auto BuildBlob = [&]()
+	{
+		Blob = MakeUnique<FHoudiniGeoBlobWriter>(NumPoints, NumTriangles);
+		const int32 NormalAttribute = Blob->AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_NORMAL), HAPI_ATTROWNER_VERTEX, 3);
+		const int32 UVAttribute = Blob->AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_UV), HAPI_ATTROWNER_VERTEX, 3);
+		const int32 ColorAttribute = Blob->AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_COLOR), HAPI_ATTROWNER_VERTEX, 3);
+		const int32 MaterialAttribute = Blob->AddStringAttribute(TEXT(HAPI_UNREAL_ATTRIB_MATERIAL), HAPI_ATTROWNER_PRIM, MaterialPaths);
+		Blob->Allocate();
+
+		float* P[3];
+		float* N[3];
+		float* UV[3];
+		float* Cd[3];
+		for (int32 Component = 0; Component < 3; Component++)
+		{
+			P[Component] = Blob->GetFloatValues(FHoudiniGeoBlobWriter::PositionAttribute, Component);
+			N[Component] = Blob->GetFloatValues(NormalAttribute, Component);
+			UV[Component] = Blob->GetFloatValues(UVAttribute, Component);
+			Cd[Component] = Blob->GetFloatValues(ColorAttribute, Component);
+		}
+
+		for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+		{
+			P[0][PointIdx] = (float)(PointIdx % GridSize);
+			P[1][PointIdx] = 0.0f;
+			P[2][PointIdx] = (float)(PointIdx / GridSize);
+		}
+
+		int32* VertexPoints = Blob->GetVertexPointIndices();
+		for (int32 VertexIdx = 0; VertexIdx < NumVertices; VertexIdx++)
+		{
+			const int32 PointIdx = GetVertexPoint(VertexIdx);
+			VertexPoints[VertexIdx] = PointIdx;
+			N[0][VertexIdx] = 0.0f;
+			N[1][VertexIdx] = 1.0f;
+			N[2][VertexIdx] = 0.0f;
+			UV[0][VertexIdx] = P[0][PointIdx] / GridSize;
+			UV[1][VertexIdx] = 1.0f - P[2][PointIdx] / GridSize;
+			UV[2][VertexIdx] = 0.0f;
+			Cd[0][VertexIdx] = UV[0][VertexIdx];
+			Cd[1][VertexIdx] = UV[1][VertexIdx];
+			Cd[2][VertexIdx] = 1.0f;
+		}
+
+		int32* TriangleMaterials = Blob->GetIntValues(MaterialAttribute, 0);
+		for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; TriangleIdx++)
+			TriangleMaterials[TriangleIdx] = TriangleIdx % 2;
+	};
+
+	double StartTime = FPlatformTime::Seconds();
+	BuildAttributeArrays();
+	const double AttributeBuildTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	BuildBlob();
+	const double BlobBuildTime = FPlatformTime::Seconds() - StartTime;
+
+	const int64 AttributeBytes = (int64)(Positions.Num() + Normals.Num() + UVs.Num() + Colors.Num()) * sizeof(float)
+		+ (int64)(VertexList.Num() + FaceCounts.Num()) * sizeof(int32) + (int64)Materials.Num() * sizeof(const char*);
+
+	// SetPartInfo, AddAttribute + Set*Data for P, N, uv, Cd and the material, SetVertexList, SetFaceCounts and CommitGeo
+	const int32 AttributeHapiCalls = 1 + 2 * 5 + 3;
+	// LoadGeoFromMemory
+	const int32 BlobHapiCalls = 1;
+
+	AddInfo(FString::Printf(
+		TEXT("%d triangles: attribute arrays built in %.3fs (%.1f MB, %d HAPI calls), blob built in %.3fs (%.1f MB, %d HAPI call)."),
+		NumTriangles, AttributeBuildTime, AttributeBytes / (1024.0 * 1024.0), AttributeHapiCalls,
+		BlobBuildTime, Blob->GetBuffer().Num() / (1024.0 * 1024.0), BlobHapiCalls));
+
+	TestEqual(TEXT("Blob vertex count"), Blob->GetElementCount(HAPI_ATTROWNER_VERTEX), NumVertices);
+	TestEqual(TEXT("Blob point count"), Blob->GetElementCount(HAPI_ATTROWNER_POINT), NumPoints);
+
+	// The actual upload can only be timed with a running session
+	if (!FHoudiniEngineUtils::IsInitialized())
+	{
+		AddInfo(TEXT("No Houdini Engine session, skipping the upload timings."));
+		return true;
+	}
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	HAPI_NodeId AttributeNodeId = -1;
+	HAPI_NodeId BlobNodeId = -1;
+	if (!TestTrue(TEXT("Create input nodes"),
+		FHoudiniApi::CreateInputNode(Session, &AttributeNodeId, "GeoBlobBenchmark_Attributes") == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::CreateInputNode(Session, &BlobNodeId, "GeoBlobBenchmark_Blob") == HAPI_RESULT_SUCCESS))
+		return false;
+
+	FHoudiniEngineUtils::HapiCookNode(AttributeNodeId, nullptr, true);
+	FHoudiniEngineUtils::HapiCookNode(BlobNodeId, nullptr, true);
+
+	StartTime = FPlatformTime::Seconds();
+	{
+		HAPI_PartInfo Part;
+		FHoudiniApi::PartInfo_Init(&Part);
+		Part.type = HAPI_PARTTYPE_MESH;
+		Part.pointCount = NumPoints;
+		Part.vertexCount = NumVertices;
+		Part.faceCount = NumTriangles;
+		FHoudiniApi::SetPartInfo(Session, AttributeNodeId, 0, &Part);
+
+		auto UploadFloatAttribute = [&](const char* InName, const HAPI_AttributeOwner& InOwner, const TArray<float>& InValues)
+		{
+			HAPI_AttributeInfo AttributeInfo;
+			FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+			AttributeInfo.tupleSize = 3;
+			AttributeInfo.count = InValues.Num() / 3;
+			AttributeInfo.exists = true;
+			AttributeInfo.owner = InOwner;
+			AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+			AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+			FHoudiniApi::AddAttribute(Session, AttributeNodeId, 0, InName, &AttributeInfo);
+			FHoudiniApi::SetAttributeFloatData(Session, AttributeNodeId, 0, InName, &AttributeInfo, InValues.GetData(), 0, AttributeInfo.count);
+		};
+
+		UploadFloatAttribute(HAPI_UNREAL_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, Positions);
+		UploadFloatAttribute(HAPI_UNREAL_ATTRIB_NORMAL, HAPI_ATTROWNER_VERTEX, Normals);
+		UploadFloatAttribute(HAPI_UNREAL_ATTRIB_UV, HAPI_ATTROWNER_VERTEX, UVs);
+		UploadFloatAttribute(HAPI_UNREAL_ATTRIB_COLOR, HAPI_ATTROWNER_VERTEX, Colors);
+
+		HAPI_AttributeInfo MaterialInfo;
+		FHoudiniApi::AttributeInfo_Init(&MaterialInfo);
+		MaterialInfo.tupleSize = 1;
+		MaterialInfo.count = NumTriangles;
+		MaterialInfo.exists = true;
+		MaterialInfo.owner = HAPI_ATTROWNER_PRIM;
+		MaterialInfo.storage = HAPI_STORAGETYPE_STRING;
+		MaterialInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+		FHoudiniApi::AddAttribute(Session, AttributeNodeId, 0, HAPI_UNREAL_ATTRIB_MATERIAL, &MaterialInfo);
+		FHoudiniApi::SetAttributeStringData(Session, AttributeNodeId, 0, HAPI_UNREAL_ATTRIB_MATERIAL, &MaterialInfo, Materials.GetData(), 0, NumTriangles);
+
+		FHoudiniApi::SetVertexList(Session, AttributeNodeId, 0, VertexList.GetData(), 0, NumVertices);
+		FHoudiniApi::SetFaceCounts(Session, AttributeNodeId, 0, FaceCounts.GetData(), 0, NumTriangles);
+		FHoudiniApi::CommitGeo(Session, AttributeNodeId);
+	}
+	const double AttributeUploadTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	const bool bBlobLoaded = Blob->HapiLoadIntoNode(BlobNodeId);
+	const double BlobUploadTime = FPlatformTime::Seconds() - StartTime;
+
+	TestTrue(TEXT("Blob loaded"), bBlobLoaded);
+	if (bBlobLoaded && FHoudiniEngineUtils::HapiCookNode(BlobNodeId, nullptr, true))
+	{
+		HAPI_PartInfo BlobPart;
+		FHoudiniApi::PartInfo_Init(&BlobPart);
+		if (FHoudiniApi::GetPartInfo(Session, BlobNodeId, 0, &BlobPart) == HAPI_RESULT_SUCCESS)
+		{
+			TestEqual(TEXT("Loaded point count"), BlobPart.pointCount, NumPoints);
+			TestEqual(TEXT("Loaded vertex count"), BlobPart.vertexCount, NumVertices);
+			TestEqual(TEXT("Loaded face count"), BlobPart.faceCount, NumTriangles);
+		}
+	}
+
+	AddInfo(FString::Printf(
+		TEXT("Upload: attribute by attribute %.3fs, blob %.3fs (x%.2f)."),
+		AttributeUploadTime, BlobUploadTime, BlobUploadTime > 0.0 ? AttributeUploadTime / BlobUploadTime : 0.0));
+
+	// Delete the input nodes' OBJ parents
+	FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(AttributeNodeId));
+	FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(BlobNodeId));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreGeoBlobStaticMeshTest, "Houdini.Core.GeoBlob.StaticMeshLODResources", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreGeoBlobStaticMeshTest::RunTest(const FString & Parameters)
+{
+	// Serializes the LOD0 of an engine mesh with CreateGeoBlobForStaticMeshLODResources and checks its positions,
+	// normals, uvs and indices against the LOD's render data. With a session, the blob upload is also compared
+	// with the attribute by attribute upload (CreateInputNodeForStaticMeshLODResources).
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Fixture mesh"), Mesh) || !TestTrue(TEXT("Fixture mesh render data"), Mesh->RenderData && Mesh->RenderData->LODResources.Num() > 0))
+		return false;
+
+	const FStaticMeshLODResources& LODResources = Mesh->RenderData->LODResources[0];
+	const FPositionVertexBuffer& PositionBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+	const FStaticMeshVertexBuffer& VertexBuffer = LODResources.VertexBuffers.StaticMeshVertexBuffer;
+	const FVector BuildScale = Mesh->GetSourceModel(0).BuildSettings.BuildScale3D;
+	const int32 NumTriangles = LODResources.GetNumTriangles();
+	const int32 NumVertices = NumTriangles * 3;
+
+	TUniquePtr<FHoudiniGeoBlobWriter> Blob;
+	if (!TestTrue(TEXT("Create the blob"), FUnrealMeshTranslator::CreateGeoBlobForStaticMeshLODResources(LODResources, 0, Mesh, nullptr, Blob) && Blob.IsValid()))
+		return false;
+
+	if (!TestEqual(TEXT("Blob vertex count"), Blob->GetElementCount(HAPI_ATTROWNER_VERTEX), NumVertices))
+		return false;
+
+	const int32 NormalAttribute = Blob->FindAttribute(TEXT(HAPI_UNREAL_ATTRIB_NORMAL));
+	const int32 UVAttribute = Blob->FindAttribute(TEXT(HAPI_UNREAL_ATTRIB_UV));
+	if (!TestTrue(TEXT("Blob has N and uv"), NormalAttribute != INDEX_NONE && UVAttribute != INDEX_NONE))
+		return false;
+
+	const int32* VertexPoints = Blob->GetVertexPointIndices();
+	int32 NumMismatches = 0;
+	int32 HoudiniVertexIdx = 0;
+	FIndexArrayView Indices = LODResources.IndexBuffer.GetArrayView();
+	for (const FStaticMeshSection& Section : LODResources.Sections)
+	{
+		for (uint32 TriangleIdx = 0; TriangleIdx < Section.NumTriangles; TriangleIdx++)
+		{
+			for (int32 Corner = 0; Corner < 3; Corner++, HoudiniVertexIdx++)
+			{
+				// Houdini's winding order is reversed: {0, 2, 1}
+				const uint32 UEVertexIdx = Indices[Section.FirstIndex + TriangleIdx * 3 + (3 - Corner) % 3];
+				const FVector& Position = PositionBuffer.VertexPosition(UEVertexIdx);
+				const FVector Normal = VertexBuffer.VertexTangentZ(UEVertexIdx);
+				const FVector2D UV = VertexBuffer.GetVertexUV(UEVertexIdx, 0);
+
+				const int32 PointIdx = VertexPoints[HoudiniVertexIdx];
+				const FVector BlobPosition(
+					Blob->GetFloatValues(FHoudiniGeoBlobWriter::PositionAttribute, 0)[PointIdx],
+					Blob->GetFloatValues(FHoudiniGeoBlobWriter::PositionAttribute, 2)[PointIdx],
+					Blob->GetFloatValues(FHoudiniGeoBlobWriter::PositionAttribute, 1)[PointIdx]);
+				const FVector BlobNormal(
+					Blob->GetFloatValues(NormalAttribute, 0)[HoudiniVertexIdx],
+					Blob->GetFloatValues(NormalAttribute, 2)[HoudiniVertexIdx],
+					Blob->GetFloatValues(NormalAttribute, 1)[HoudiniVertexIdx]);
+				const FVector2D BlobUV(
+					Blob->GetFloatValues(UVAttribute, 0)[HoudiniVertexIdx],
+					1.0f - Blob->GetFloatValues(UVAttribute, 1)[HoudiniVertexIdx]);
+
+				if (!BlobPosition.Equals(Position / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScale, KINDA_SMALL_NUMBER)
+					|| !BlobNormal.Equals(Normal, KINDA_SMALL_NUMBER)
+					|| !BlobUV.Equals(UV, KINDA_SMALL_NUMBER))
+					NumMismatches++;
+			}
+		}
+	}
+	TestEqual(TEXT("Blob vertices matching the render data"), NumMismatches, 0);
+
+	// The upload paths can only be compared with a running session
+	if (!FHoudiniEngineUtils::IsInitialized())
+	{
+		AddInfo(TEXT("No Houdini Engine session, skipping the comparison with the attribute upload."));
+		return !HasAnyErrors();
+	}
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	HAPI_NodeId AttributeNodeId = -1;
+	HAPI_NodeId BlobNodeId = -1;
+	if (!TestTrue(TEXT("Create input nodes"),
+		FHoudiniApi::CreateInputNode(Session, &AttributeNodeId, "GeoBlobTest_Attributes") == HAPI_RESULT_SUCCESS
+		&& FHoudiniApi::CreateInputNode(Session, &BlobNodeId, "GeoBlobTest_Blob") == HAPI_RESULT_SUCCESS))
+		return false;
+
+	FHoudiniEngineUtils::HapiCookNode(AttributeNodeId, nullptr, true);
+	FHoudiniEngineUtils::HapiCookNode(BlobNodeId, nullptr, true);
+
+	TestTrue(TEXT("Attribute upload"), FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(AttributeNodeId, LODResources, 0, false, Mesh, nullptr));
+	TestTrue(TEXT("Blob upload"), FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResourcesAsGeoBlob(BlobNodeId, LODResources, 0, Mesh, nullptr));
+
+	// Per vertex positions, normals and uvs, and the vertex list, of a cooked input node
+	struct FUploadedMesh
+	{
+		TArray<int32> VertexList;
+		TArray<float> Positions;
+		TArray<float> Normals;
+		TArray<float> UVs;
+	};
+
+	auto ReadUploadedMesh = [&](const HAPI_NodeId& InNodeId, FUploadedMesh& OutMesh)
+	{
+		if (!FHoudiniEngineUtils::HapiCookNode(InNodeId, nullptr, true))
+			return false;
+
+		HAPI_PartInfo PartInfo;
+		FHoudiniApi::PartInfo_Init(&PartInfo);
+		if (FHoudiniApi::GetPartInfo(Session, InNodeId, 0, &PartInfo) != HAPI_RESULT_SUCCESS || PartInfo.vertexCount <= 0)
+			return false;
+
+		OutMesh.VertexList.SetNumZeroed(PartInfo.vertexCount);
+		if (FHoudiniApi::GetVertexList(Session, InNodeId, 0, OutMesh.VertexList.GetData(), 0, PartInfo.vertexCount) != HAPI_RESULT_SUCCESS)
+			return false;
+
+		HAPI_AttributeInfo AttributeInfo;
+		TArray<float> PointPositions;
+		if (!FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(InNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, AttributeInfo, PointPositions, 3, HAPI_ATTROWNER_POINT)
+			|| !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(InNodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, AttributeInfo, OutMesh.Normals, 3, HAPI_ATTROWNER_VERTEX)
+			|| !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(InNodeId, 0, HAPI_UNREAL_ATTRIB_UV, AttributeInfo, OutMesh.UVs, 3, HAPI_ATTROWNER_VERTEX))
+			return false;
+
+		OutMesh.Positions.SetNumUninitialized(PartInfo.vertexCount * 3);
+		for (int32 VertexIdx = 0; VertexIdx < PartInfo.vertexCount; VertexIdx++)
+		{
+			const int32 PointIdx = OutMesh.VertexList[VertexIdx];
+			for (int32 Component = 0; Component < 3; Component++)
+				OutMesh.Positions[VertexIdx * 3 + Component] = PointPositions.IsValidIndex(PointIdx * 3 + Component) ? PointPositions[PointIdx * 3 + Component] : 0.0f;
+		}
+
+		return true;
+	};
+
+	auto ArraysMatch = [](const TArray<float>& InA, const TArray<float>& InB)
+	{
+		if (InA.Num() != InB.Num())
+			return false;
+
+		for (int32 Idx = 0; Idx < InA.Num(); Idx++)
+		{
+			if (!FMath::IsNearlyEqual(InA[Idx], InB[Idx], KINDA_SMALL_NUMBER))
+				return false;
+		}
+
+		return true;
+	};
+
+	FUploadedMesh AttributeMesh, BlobMesh;
+	if (TestTrue(TEXT("Read the attribute upload"), ReadUploadedMesh(AttributeNodeId, AttributeMesh))
+		&& TestTrue(TEXT("Read the blob upload"), ReadUploadedMesh(BlobNodeId, BlobMesh)))
+	{
+		TestTrue(TEXT("Indices match"), AttributeMesh.VertexList == BlobMesh.VertexList);
+		TestTrue(TEXT("Positions match"), ArraysMatch(AttributeMesh.Positions, BlobMesh.Positions));
+		TestTrue(TEXT("Normals match"), ArraysMatch(AttributeMesh.Normals, BlobMesh.Normals));
+		TestTrue(TEXT("UVs match"), ArraysMatch(AttributeMesh.UVs, BlobMesh.UVs));
+	}
+
+	// Delete the input nodes' OBJ parents
+	FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(AttributeNodeId));
+	FHoudiniApi::DeleteNode(Session, FHoudiniEngineUtils::HapiGetParentNodeId(BlobNodeId));
+
+	return !HasAnyErrors();
+}
+
+static TAutoConsoleVariable<FString> CVarHoudiniEngineBenchmarksHAPIReplayFile(
+	TEXT("HoudiniEngine.Benchmarks.HAPIReplayFile"),
+	TEXT(""),
+	TEXT("HAPI recording replayed by the Houdini.Core.Benchmarks.HAPIReplay test, recorded with HoudiniEngine.HAPIRecorder.Start/Stop.\n")
+	TEXT("Defaults to Saved/HoudiniEngine/HAPIRecording.hrec.\n")
+);
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreHAPIReplayBenchmark, "Houdini.Core.Benchmarks.HAPIReplay", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreHAPIReplayBenchmark::RunTest(const FString & Parameters)
+{
+	// Replays the recording of a real cook, and runs the parameter, output, mesh, instancer and heightfield
+	// translators on the recorded assets without a Houdini Engine session.
+	FString ReplayFile = CVarHoudiniEngineBenchmarksHAPIReplayFile.GetValueOnGameThread();
+	if (ReplayFile.IsEmpty())
+		ReplayFile = FPaths::ProjectSavedDir() / TEXT("HoudiniEngine/HAPIRecording.hrec");
+
+	if (!FPaths::FileExists(ReplayFile))
+	{
+		AddError(FString::Printf(TEXT("No HAPI recording found at %s, record one with HoudiniEngine.HAPIRecorder.Start/Stop."), *ReplayFile));
+		return false;
+	}
+
+	if (!TestTrue(TEXT("Start the replay"), FHoudiniApiRecorder::StartReplay(ReplayFile)))
+		return false;
+
+	TArray<HAPI_NodeId> AssetIds;
+	FHoudiniApiRecorder::GetRecordedAssetIds(AssetIds);
+
+	const int32 NumIterations = 5;
+	double ParameterTime = 0.0;
+	double OutputTime = 0.0;
+	double MeshTime = 0.0;
+	double InstancerTime = 0.0;
+	double HeightfieldTime = 0.0;
+	int32 NumParameters = 0;
+	int32 NumMeshes = 0;
+	int32 NumInstancers = 0;
+	int32 NumHeightfields = 0;
+	int32 NumMissedCalls = 0;
+	// The results of each iteration, which must all match the first one's
+	TArray<FString> Results;
+
+	const FHoudiniStaticMeshGenerationProperties SMGenerationProperties;
+	const FMeshBuildSettings MeshBuildSettings;
+
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		FHoudiniApiRecorder::RewindReplay();
+		const bool bCount = Iteration == 0;
+		FString& Result = Results.AddDefaulted_GetRef();
+
+		for (const HAPI_NodeId& AssetId : AssetIds)
+		{
+			double StartTime = FPlatformTime::Seconds();
+			TArray<UHoudiniParameter*> OldParameters;
+			TArray<UHoudiniParameter*> NewParameters;
+			FHoudiniParameterTranslator::BuildAllParameters(AssetId, GetTransientPackage(), OldParameters, NewParameters, true, true);
+			ParameterTime += FPlatformTime::Seconds() - StartTime;
+			NumParameters += bCount ? NewParameters.Num() : 0;
+			for (UHoudiniParameter* CurParam : NewParameters)
+				Result += (CurParam ? CurParam->GetParameterName() : FString()) + TEXT(";");
+
+			StartTime = FPlatformTime::Seconds();
+			TArray<UHoudiniOutput*> OldOutputs;
+			TArray<UHoudiniOutput*> NewOutputs;
+			FHoudiniOutputTranslator::BuildAllOutputs(AssetId, GetTransientPackage(), OldOutputs, NewOutputs, false);
+			OutputTime += FPlatformTime::Seconds() - StartTime;
+			Result += FString::Printf(TEXT("%d outputs;"), NewOutputs.Num());
+
+			FHoudiniPackageParams PackageParams;
+			PackageParams.OuterPackage = GetTransientPackage();
+			PackageParams.HoudiniAssetName = FString::Printf(TEXT("HAPIReplay_%d"), AssetId);
+			PackageParams.ComponentGUID = FGuid::NewGuid();
+
+			for (UHoudiniOutput* CurOutput : NewOutputs)
+			{
+				if (!CurOutput)
+					continue;
+
+				for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->GetHoudiniGeoPartObjects())
+				{
+					StartTime = FPlatformTime::Seconds();
+					if (CurHGPO.Type == EHoudiniPartType::Mesh)
+					{
+						TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> NewOutputObjects;
+						TMap<FString, UMaterialInterface*> AssignmentMaterials;
+						TMap<FString, UMaterialInterface*> ReplacementMaterials;
+						FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
+							CurHGPO, PackageParams, CurOutput->GetOutputObjects(), NewOutputObjects,
+							AssignmentMaterials, ReplacementMaterials, true,
+							EHoudiniStaticMeshMethod::UHoudiniStaticMesh, SMGenerationProperties, MeshBuildSettings);
+						MeshTime += FPlatformTime::Seconds() - StartTime;
+						NumMeshes += bCount ? 1 : 0;
+						Result += FString::Printf(TEXT("%d mesh objects;"), NewOutputObjects.Num());
+					}
+					else if (CurHGPO.Type == EHoudiniPartType::Instancer)
+					{
+						FHoudiniInstancedOutputPartData InstancedOutputPartData;
+						FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(CurHGPO, NewOutputs, InstancedOutputPartData);
+						InstancerTime += FPlatformTime::Seconds() - StartTime;
+						NumInstancers += bCount ? 1 : 0;
+						Result += FString::Printf(TEXT("%d instanced objects;"), InstancedOutputPartData.OriginalInstancedObjects.Num());
+					}
+					else if (CurHGPO.Type == EHoudiniPartType::Volume && !CurHGPO.VolumeInfo.bIsVDB)
+					{
+						TArray<float> FloatValues;
+						float FloatMin = 0.0f;
+						float FloatMax = 0.0f;
+						FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(&CurHGPO, FloatValues, FloatMin, FloatMax);
+						HeightfieldTime += FPlatformTime::Seconds() - StartTime;
+						NumHeightfields += bCount ? 1 : 0;
+						Result += FString::Printf(TEXT("%d heights %g %g;"), FloatValues.Num(), FloatMin, FloatMax);
+					}
+				}
+			}
+		}
+
+		// The stats are reset by each rewind
+		NumMissedCalls += FHoudiniApiRecorder::GetStats().NumMissedCalls;
+	}
+
+	const FHoudiniApiRecorder::FStats Stats = FHoudiniApiRecorder::GetStats();
+	FHoudiniApiRecorder::StopReplay();
+
+	AddInfo(FString::Printf(
+		TEXT("Replayed %d assets from %s (%d recorded calls, %.1f MB), %d iterations."),
+		AssetIds.Num(), *ReplayFile, Stats.NumRecords, Stats.NumBytes / (1024.0 * 1024.0), NumIterations));
+	AddInfo(FString::Printf(
+		TEXT("Per iteration: parameters %.2fms (%d), outputs %.2fms, meshes %.2fms (%d), instancers %.2fms (%d), heightfields %.2fms (%d)."),
+		ParameterTime * 1000.0 / NumIterations, NumParameters, OutputTime * 1000.0 / NumIterations,
+		MeshTime * 1000.0 / NumIterations, NumMeshes, InstancerTime * 1000.0 / NumIterations, NumInstancers,
+		HeightfieldTime * 1000.0 / NumIterations, NumHeightfields));
+
+	// Calls that aren't in the recording mean the translators no longer query HAPI the way they did
+	TestEqual(TEXT("HAPI calls not found in the recording"), NumMissedCalls, 0);
+	TestTrue(TEXT("The recording contains assets"), AssetIds.Num() > 0);
+	TestTrue(TEXT("The replay created parameters or outputs"), NumParameters + NumMeshes + NumInstancers + NumHeightfields > 0);
+	for (int32 Iteration = 1; Iteration < Results.Num(); Iteration++)
+		TestEqual(FString::Printf(TEXT("Results of iteration %d"), Iteration), Results[Iteration], Results[0]);
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreHAPIReplayFixtureTest, "Houdini.Core.HAPIReplay.Heightfield", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreHAPIReplayFixtureTest::RunTest(const FString & Parameters)
+{
+	// Tests/Fixtures/HAPIReplay_Heightfield.hrec is the recording of the heightfield fetch of a 8x4 heightfield,
+	// geo 7 part 0, whose height at (X, Y) is X * 0.25 + Y * 0.5 - 1: VolumeInfo_Init, GetVolumeInfo and GetHeightFieldData.
+	TSharedPtr<IPlugin> HoudiniPlugin = IPluginManager::Get().FindPlugin(TEXT("HoudiniEngine"));
+	if (!TestTrue(TEXT("Find the Houdini Engine plugin"), HoudiniPlugin.IsValid()))
+		return false;
+
+	const FString ReplayFile = HoudiniPlugin->GetBaseDir() / TEXT("Source/HoudiniEngine/Private/Tests/Fixtures/HAPIReplay_Heightfield.hrec");
+	if (!FPaths::FileExists(ReplayFile))
+	{
+		AddError(FString::Printf(TEXT("The HAPI replay fixture %s is missing."), *ReplayFile));
+		return false;
+	}
+
+	if (!TestTrue(TEXT("Start the replay"), FHoudiniApiRecorder::StartReplay(ReplayFile)))
+		return false;
+
+	FHoudiniGeoPartObject HGPO;
+	HGPO.Type = EHoudiniPartType::Volume;
+	HGPO.GeoId = 7;
+	HGPO.PartId = 0;
+
+	TArray<float> FloatValues;
+	float FloatMin = 0.0f;
+	float FloatMax = 0.0f;
+	const bool bSuccess = FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(&HGPO, FloatValues, FloatMin, FloatMax);
+
+	const FHoudiniApiRecorder::FStats Stats = FHoudiniApiRecorder::GetStats();
+	FHoudiniApiRecorder::StopReplay();
+
+	TestEqual(TEXT("Recorded calls"), Stats.NumRecords, 3);
+	TestEqual(TEXT("Replayed calls"), Stats.NumReplayedCalls, 3);
+	TestEqual(TEXT("HAPI calls not found in the recording"), Stats.NumMissedCalls, 0);
+
+	if (!TestTrue(TEXT("Fetch the heightfield"), bSuccess) || !TestEqual(TEXT("Number of heights"), FloatValues.Num(), 32))
+		return false;
+
+	TestEqual(TEXT("Min height"), FloatMin, -1.0f);
+	TestEqual(TEXT("Max height"), FloatMax, 2.25f);
+	for (int32 Idx = 0; Idx < FloatValues.Num(); Idx++)
+	{
+		const float Expected = (Idx % 8) * 0.25f + (Idx / 8) * 0.5f - 1.0f;
+		if (!FMath::IsNearlyEqual(FloatValues[Idx], Expected))
+		{
+			AddError(FString::Printf(TEXT("Height %d is %f, expected %f."), Idx, FloatValues[Idx], Expected));
+			break;
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreFoliageBatchBenchmark, "Houdini.Core.Benchmarks.FoliageBatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreFoliageBatchBenchmark::RunTest(const FString & Parameters)
+{
+	// NumInstancers foliage instancers of the same mesh, NumInstances instances each, each instancer on its own
+	// parent component (like separate HDAs). A "cook" cleans up the previous instances and adds the new ones.
+	const int32 NumInstancers = 64;
+	const int32 NumInstances = 4096;
+
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Foliage mesh"), Mesh))
+		return false;
+
+	IConsoleVariable* BatchUpdateCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.FoliageBatchUpdate"));
+	if (!TestNotNull(TEXT("HoudiniEngine.FoliageBatchUpdate"), BatchUpdateCVar))
+		return false;
+	const int32 PreviousBatchUpdate = BatchUpdateCVar->GetInt();
+
+	// Run the cooks in a transient world, so the benchmark doesn't modify the edited level
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Editor);
+	WorldContext.SetCurrentWorld(World);
+	TGuardValue<UWorld*> WorldGuard(GWorld, World);
+
+	TArray<USceneComponent*> ParentComponents;
+	TArray<TArray<FTransform>> Transforms;
+	for (int32 InstancerIdx = 0; InstancerIdx < NumInstancers; InstancerIdx++)
+	{
+		AActor* Actor = World->SpawnActor<AActor>();
+		USceneComponent* ParentComponent = NewObject<USceneComponent>(Actor);
+		Actor->SetRootComponent(ParentComponent);
+		ParentComponent->RegisterComponent();
+		ParentComponents.Add(ParentComponent);
+
+		TArray<FTransform>& InstancerTransforms = Transforms.AddDefaulted_GetRef();
+		InstancerTransforms.SetNum(NumInstances);
+		for (int32 InstanceIdx = 0; InstanceIdx < NumInstances; InstanceIdx++)
+			InstancerTransforms[InstanceIdx].SetLocation(FVector(InstancerIdx * 10000.0f + (InstanceIdx % 64) * 100.0f, (InstanceIdx / 64) * 100.0f, 0.0f));
+	}
+
+	TArray<USceneComponent*> FoliageComponents;
+	FoliageComponents.SetNumZeroed(NumInstancers);
+	auto Cook = [&]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		FHoudiniFoliageBatchScope FoliageBatchScope;
+		for (int32 InstancerIdx = 0; InstancerIdx < NumInstancers; InstancerIdx++)
+		{
+			UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(FoliageComponents[InstancerIdx]);
+			if (IsValid(FoliageHISMC))
+				FHoudiniInstanceTranslator::CleanupFoliageInstances(FoliageHISMC, Mesh, ParentComponents[InstancerIdx]);
+
+			FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
+				Mesh, nullptr, Transforms[InstancerIdx], TArray<FHoudiniGenericAttribute>(), FHoudiniGeoPartObject(),
+				ParentComponents[InstancerIdx], FoliageComponents[InstancerIdx], nullptr);
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	auto GetNumFoliageInstances = [&]()
+	{
+		AInstancedFoliageActor* FoliageActor = AInstancedFoliageActor::GetInstancedFoliageActorForLevel(World->GetCurrentLevel(), false);
+		UFoliageType* FoliageType = FoliageActor ? FoliageActor->GetLocalFoliageTypeForSource(Mesh) : nullptr;
+		FFoliageInfo* FoliageInfo = FoliageType ? FoliageActor->FindInfo(FoliageType) : nullptr;
+		return FoliageInfo ? FoliageInfo->Instances.Num() : 0;
+	};
+
+	// For each path: a first cook creates the instances, the second replaces them
+	double Times[2][2];
+	int32 NumFoliageInstances[2];
+	for (int32 BatchUpdate = 0; BatchUpdate < 2; BatchUpdate++)
+	{
+		BatchUpdateCVar->Set(BatchUpdate);
+		Times[BatchUpdate][0] = Cook();
+		Times[BatchUpdate][1] = Cook();
+		NumFoliageInstances[BatchUpdate] = GetNumFoliageInstances();
+	}
+
+	BatchUpdateCVar->Set(PreviousBatchUpdate);
+
+	AddInfo(FString::Printf(
+		TEXT("%d foliage instancers x %d instances: one by one %.3fs / %.3fs, batched %.3fs / %.3fs (create / update)."),
+		NumInstancers, NumInstances, Times[0][0], Times[0][1], Times[1][0], Times[1][1]));
+
+	TestEqual(TEXT("Number of foliage instances"), NumFoliageInstances[1], NumFoliageInstances[0]);
+	TestEqual(TEXT("All instances were added"), NumFoliageInstances[1], NumInstancers * NumInstances);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreLandscapeConversionBenchmark, "Houdini.Core.Benchmarks.LandscapeConversion", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool HoudiniCoreLandscapeConversionBenchmark::RunTest(const FString & Parameters)
+{
+	// Square terrains from 1k to 16k, converted both ways with the reference and the blocked/parallel kernels
+	const int32 Sizes[] = { 1024, 2048, 4096, 8192, 16384 };
+
+	auto Time = [](TFunctionRef<void()> InKernel)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		InKernel();
+		return FMath::Max(FPlatformTime::Seconds() - StartTime, SMALL_NUMBER);
+	};
+
+	for (const int32& Size : Sizes)
+	{
+		const int64 NumPoints = (int64)Size * Size;
+		const double MegaPoints = (double)NumPoints / (1024.0 * 1024.0);
+
+		TArray<float> Heightfield;
+		Heightfield.SetNumUninitialized(NumPoints);
+		for (int32 nX = 0; nX < Size; nX++)
+		{
+			for (int32 nY = 0; nY < Size; nY++)
+				Heightfield[(int64)nX * Size + nY] = 100.0f * FMath::Sin(nX * 0.01f) * FMath::Cos(nY * 0.013f) + FMath::FRandRange(-0.5f, 0.5f);
+		}
+
+		// Houdini to Unreal
+		const double ZSpacing = 49152.0 / 201.0;
+		const double DigitCenterOffset = 8191.0;
+		TArray<uint16> ScalarHeights, Heights;
+		ScalarHeights.SetNumUninitialized(NumPoints);
+		Heights.SetNumUninitialized(NumPoints);
+		const double ToLandscapeScalar = Time([&]()
+		{
+			FHoudiniDataConversion::ConvertHeightfieldToLandscapeHeightsScalar(
+				Heightfield.GetData(), Size, Size, ScalarHeights.GetData(), Size, -100.5f, ZSpacing, DigitCenterOffset);
+		});
+		const double ToLandscape = Time([&]()
+		{
+			FHoudiniDataConversion::ConvertHeightfieldToLandscapeHeights(
+				Heightfield.GetData(), Size, Size, Heights.GetData(), Size, -100.5f, ZSpacing, DigitCenterOffset);
+		});
+		TestTrue(FString::Printf(TEXT("%d: landscape heights match"), Size), ScalarHeights == Heights);
+
+		TArray<uint8> ScalarLayer, Layer;
+		ScalarLayer.SetNumUninitialized(NumPoints);
+		Layer.SetNumUninitialized(NumPoints);
+		const double ToLayerScalar = Time([&]()
+		{
+			FHoudiniDataConversion::ConvertHeightfieldToLandscapeLayerScalar(
+				Heightfield.GetData(), Size, Size, ScalarLayer.GetData(), Size, 0.0f, 100.0f, 2.55);
+		});
+		const double ToLayer = Time([&]()
+		{
+			FHoudiniDataConversion::ConvertHeightfieldToLandscapeLayer(
+				Heightfield.GetData(), Size, Size, Layer.GetData(), Size, 0.0f, 100.0f, 2.55);
+		});
+		TestTrue(FString::Printf(TEXT("%d: landscape layers match"), Size), ScalarLayer == Layer);
+		ScalarHeights.Empty();
+		ScalarLayer.Empty();
+
+		// Unreal to Houdini, reuses the Heightfield array for the reference output
+		TArray<float> HeightfieldValues;
+		HeightfieldValues.SetNumUninitialized(NumPoints);
+		const double ToHeightfieldScalar = Time([&]()
+		{
+			FHoudiniDataConversion::ConvertLandscapeHeightsToHeightfieldScalar(
+				Heights.GetData(), Size, Size, Heightfield.GetData(), Size, 32767.0, 512.0 / 65535.0, 0.0);
+		});
+		const double ToHeightfield = Time([&]()
+		{
+			FHoudiniDataConversion::ConvertLandscapeHeightsToHeightfield(
+				Heights.GetData(), Size, Size, HeightfieldValues.GetData(), Size, 32767.0, 512.0 / 65535.0, 0.0);
+		});
+		TestTrue(FString::Printf(TEXT("%d: heightfield values match"), Size), Heightfield == HeightfieldValues);
+
+		const double ToMaskScalar = Time([&]()
+		{
+			FHoudiniDataConversion::ConvertLandscapeLayerToHeightfieldScalar(
+				Layer.GetData(), Size, Size, Heightfield.GetData(), Size, 0, 1.0f / 255.0f, 0.0f);
+		});
+		const double ToMask = Time([&]()
+		{
+			FHoudiniDataConversion::ConvertLandscapeLayerToHeightfield(
+				Layer.GetData(), Size, Size, HeightfieldValues.GetData(), Size, 0, 1.0f / 255.0f, 0.0f);
+		});
+		TestTrue(FString::Printf(TEXT("%d: heightfield masks match"), Size), Heightfield == HeightfieldValues);
+
+		AddInfo(FString::Printf(
+			TEXT("%d x %d: to landscape %.0f Mpts/s (scalar %.0f), to layer %.0f Mpts/s (scalar %.0f), to heightfield %.0f Mpts/s (scalar %.0f), to mask %.0f Mpts/s (scalar %.0f)"),
+			Size, Size,
+			MegaPoints / ToLandscape, MegaPoints / ToLandscapeScalar,
+			MegaPoints / ToLayer, MegaPoints / ToLayerScalar,
+			MegaPoints / ToHeightfield, MegaPoints / ToHeightfieldScalar,
+			MegaPoints / ToMask, MegaPoints / ToMaskScalar));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCorePartAttributeCacheCaseTest, "Houdini.Core.PartAttributeCache.CaseSensitiveNames", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCorePartAttributeCacheCaseTest::RunTest(const FString & Parameters)
+{
+	// Attributes whose names only differ by case must not be confused by the cache.
+	// The part's names are seeded directly, so no HAPI session is needed.
+	const HAPI_NodeId GeoId = 1001;
+	const HAPI_PartId PartId = 0;
+
+	FHoudiniScopedPartAttributeCache AttributeCache;
+
+	HAPI_AttributeInfo NormalInfo;
+	FHoudiniApi::AttributeInfo_Init(&NormalInfo);
+	NormalInfo.exists = true;
+	NormalInfo.owner = HAPI_ATTROWNER_POINT;
+	NormalInfo.tupleSize = 3;
+	NormalInfo.count = 8;
+	FHoudiniPartAttributeCache::AddPartAttribute(GeoId, PartId, TEXT("N"), NormalInfo);
+
+	HAPI_AttributeInfo LowerInfo = NormalInfo;
+	LowerInfo.tupleSize = 1;
+	FHoudiniPartAttributeCache::AddPartAttribute(GeoId, PartId, TEXT("n"), LowerInfo);
+
+	HAPI_AttributeInfo ColorInfo = NormalInfo;
+	ColorInfo.owner = HAPI_ATTROWNER_PRIM;
+	FHoudiniPartAttributeCache::AddPartAttribute(GeoId, PartId, TEXT("cd"), ColorInfo);
+
+	HAPI_AttributeInfo FoundInfo;
+	TestTrue(TEXT("N lookup"), FHoudiniPartAttributeCache::HapiGetAttributeInfo(GeoId, PartId, "N", HAPI_ATTROWNER_POINT, FoundInfo));
+	TestTrue(TEXT("N exists"), FoundInfo.exists);
+	TestEqual(TEXT("N tuple size"), FoundInfo.tupleSize, 3);
+
+	TestTrue(TEXT("n lookup"), FHoudiniPartAttributeCache::HapiGetAttributeInfo(GeoId, PartId, "n", HAPI_ATTROWNER_POINT, FoundInfo));
+	TestTrue(TEXT("n exists"), FoundInfo.exists);
+	TestEqual(TEXT("n tuple size"), FoundInfo.tupleSize, 1);
+
+	TestTrue(TEXT("Cd lookup"), FHoudiniPartAttributeCache::HapiGetAttributeInfo(GeoId, PartId, "Cd", HAPI_ATTROWNER_INVALID, FoundInfo));
+	TestFalse(TEXT("Cd does not exist when only cd does"), FoundInfo.exists);
+
+	TestTrue(TEXT("cd lookup"), FHoudiniPartAttributeCache::HapiGetAttributeInfo(GeoId, PartId, "cd", HAPI_ATTROWNER_INVALID, FoundInfo));
+	TestTrue(TEXT("cd exists"), FoundInfo.exists);
+	TestEqual(TEXT("cd owner"), (int32)FoundInfo.owner, (int32)HAPI_ATTROWNER_PRIM);
+
+	// Fetched buffers are keyed case sensitively as well
+	TArray<float> UVData = { 0.0f, 1.0f };
+	FHoudiniPartAttributeCache::AddData(GeoId, PartId, "uv", 2, HAPI_ATTROWNER_VERTEX, NormalInfo, UVData);
+
+	TArray<float> FoundData;
+	TestFalse(TEXT("UV buffer not found when only uv was cached"),
+		FHoudiniPartAttributeCache::FindData(GeoId, PartId, "UV", 2, HAPI_ATTROWNER_VERTEX, FoundInfo, FoundData));
+	TestTrue(TEXT("uv buffer found"),
+		FHoudiniPartAttributeCache::FindData(GeoId, PartId, "uv", 2, HAPI_ATTROWNER_VERTEX, FoundInfo, FoundData));
+	TestEqual(TEXT("uv buffer size"), FoundData.Num(), 2);
+
+	// Large buffers are not kept, only detail attributes are cached regardless of their size
+	TArray<float> LargeData;
+	LargeData.SetNumZeroed(3 * 4096);
+	FHoudiniPartAttributeCache::AddData(GeoId, PartId, "P", 3, HAPI_ATTROWNER_POINT, NormalInfo, LargeData);
+	TestFalse(TEXT("Large point buffer not cached"),
+		FHoudiniPartAttributeCache::FindData(GeoId, PartId, "P", 3, HAPI_ATTROWNER_POINT, FoundInfo, FoundData));
+
+	FHoudiniPartAttributeCache::AddData(GeoId, PartId, "bigdetail", 3, HAPI_ATTROWNER_DETAIL, NormalInfo, LargeData);
+	TestTrue(TEXT("Large detail buffer cached"),
+		FHoudiniPartAttributeCache::FindData(GeoId, PartId, "bigdetail", 3, HAPI_ATTROWNER_DETAIL, FoundInfo, FoundData));
+
+	return true;
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniDataConversion.h"
 
 #include "UnrealLandscapeTranslator.h"
 #include "HoudiniGeoPartObject.h"
@@ -41,6 +42,176 @@
 #include "LightMap.h"
 #include "Engine/MapBuildDataRegistry.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLandscapeInputPartialUpload(
+	TEXT("HoudiniEngine.LandscapeInputPartialUpload"),
+	1,
+	TEXT("When a landscape input sent as a heightfield changes, update the existing heightfield by only sending the landscape components that changed.\n")
+	TEXT("0: Always recreate the heightfield\n")
+	TEXT("1: Only send the changed components when possible\n")
+);
+
+// A volume of a heightfield created for a landscape input, and the hashes of its data for each landscape component.
+struct FHoudiniLandscapeInputVolume
+{
+	FString Name;
+	HAPI_NodeId NodeId = -1;
+	TArray<uint32> ComponentHashes;
+};
+
+// What was last sent to a heightfield created for a landscape input.
+struct FHoudiniLandscapeInputUpload
+{
+	TWeakObjectPtr<ALandscapeProxy> Landscape;
+	int32 UniqueHoudiniNodeId = -1;
+	int32 XSize = 0;
+	int32 YSize = 0;
+	int32 ComponentSizeQuads = 0;
+	HAPI_Transform VolumeTransform;
+	uint32 AttributesHash = 0;
+
+	// The height volume, followed by the layer volumes in the landscape info's order
+	TArray<FHoudiniLandscapeInputVolume> Volumes;
+};
+
+// Uploads of the heightfields created for landscape inputs, by heightfield node id.
+static TMap<HAPI_NodeId, FHoudiniLandscapeInputUpload> LandscapeInputUploads;
+
+// Hashes the heightfield values covering each landscape component, edges included.
+// The values are in Houdini's order: Unreal's X is the row (of YSize values), Unreal's Y the column.
+static void
+ComputeHeightfieldComponentHashes(
+	const TArray<float>& InData, const int32& InXSize, const int32& InYSize, const int32& InComponentSizeQuads,
+	TArray<uint32>& OutHashes)
+{
+	OutHashes.Empty();
+	if (InComponentSizeQuads <= 0 || InData.Num() != InXSize * InYSize)
+		return;
+
+	if ((InXSize - 1) % InComponentSizeQuads != 0 || (InYSize - 1) % InComponentSizeQuads != 0)
+		return;
+
+	const int32 NumComponentsX = (InXSize - 1) / InComponentSizeQuads;
+	const int32 NumComponentsY = (InYSize - 1) / InComponentSizeQuads;
+	OutHashes.SetNumZeroed(NumComponentsX * NumComponentsY);
+
+	ParallelFor(NumComponentsX, [&](int32 ComponentX)
+	{
+		for (int32 ComponentY = 0; ComponentY < NumComponentsY; ComponentY++)
+		{
+			uint32 Hash = 0;
+			for (int32 X = ComponentX * InComponentSizeQuads; X <= (ComponentX + 1) * InComponentSizeQuads; X++)
+			{
+				const float* Row = InData.GetData() + X * InYSize + ComponentY * InComponentSizeQuads;
+				Hash = FCrc::MemCrc32(Row, (InComponentSizeQuads + 1) * sizeof(float), Hash);
+			}
+			OutHashes[ComponentX * NumComponentsY + ComponentY] = Hash;
+		}
+	});
+}
+
+// Hashes everything, besides the volumes' data, that is sent as attributes on the heightfield's volumes.
+static uint32
+ComputeLandscapeInputAttributesHash(ALandscapeProxy* LandscapeProxy)
+{
+	uint32 Hash = FCrc::StrCrc32(*GetPathNameSafe(LandscapeProxy));
+	Hash = FCrc::StrCrc32(*GetPathNameSafe(LandscapeProxy->GetLevel()), Hash);
+	Hash = FCrc::StrCrc32(*GetPathNameSafe(LandscapeProxy->GetLandscapeMaterial()), Hash);
+	Hash = FCrc::StrCrc32(*GetPathNameSafe(LandscapeProxy->GetLandscapeHoleMaterial()), Hash);
+	Hash = FCrc::StrCrc32(*GetPathNameSafe(LandscapeProxy->DefaultPhysMaterial), Hash);
+	for (const FName& Tag : LandscapeProxy->Tags)
+		Hash = FCrc::StrCrc32(*Tag.ToString(), Hash);
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (LandscapeInfo)
+	{
+		for (const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers)
+		{
+			UPhysicalMaterial* LayerPhysicalMat = LayerSettings.LayerInfoObj ? LayerSettings.LayerInfoObj->PhysMaterial : nullptr;
+			Hash = FCrc::StrCrc32(*GetPathNameSafe(LayerPhysicalMat), Hash);
+		}
+	}
+
+	return Hash;
+}
+
+// Sends the rows of a volume covering the landscape components whose hash has changed, consecutive rows are sent together.
+// Returns the number of values sent, or INDEX_NONE if HAPI failed.
+static int32
+SetChangedHeightfieldRows(
+	const FHoudiniLandscapeInputVolume& InVolume, const TArray<float>& InData,
+	const int32& InXSize, const int32& InYSize, const int32& InComponentSizeQuads,
+	const TArray<uint32>& InHashes)
+{
+	const int32 NumComponentsX = (InXSize - 1) / InComponentSizeQuads;
+	const int32 NumComponentsY = (InYSize - 1) / InComponentSizeQuads;
+	auto HasComponentColumnChanged = [&](const int32& InComponentX)
+	{
+		for (int32 ComponentY = 0; ComponentY < NumComponentsY; ComponentY++)
+		{
+			const int32 HashIdx = InComponentX * NumComponentsY + ComponentY;
+			if (InHashes[HashIdx] != InVolume.ComponentHashes[HashIdx])
+				return true;
+		}
+		return false;
+	};
+
+	HAPI_GeoInfo GeoInfo;
+	FHoudiniApi::GeoInfo_Init(&GeoInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetGeoInfo(
+		FHoudiniEngine::Get().GetSession(), InVolume.NodeId, &GeoInfo), INDEX_NONE);
+
+	std::string NameStr;
+	FHoudiniEngineUtils::ConvertUnrealString(InVolume.Name, NameStr);
+
+	int32 NumSent = 0;
+	int32 ComponentX = 0;
+	while (ComponentX < NumComponentsX)
+	{
+		if (!HasComponentColumnChanged(ComponentX))
+		{
+			ComponentX++;
+			continue;
+		}
+
+		int32 EndComponentX = ComponentX + 1;
+		while (EndComponentX < NumComponentsX && HasComponentColumnChanged(EndComponentX))
+			EndComponentX++;
+
+		const int32 Start = ComponentX * InComponentSizeQuads * InYSize;
+		const int32 Length = ((EndComponentX - ComponentX) * InComponentSizeQuads + 1) * InYSize;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			GeoInfo.nodeId, 0, NameStr.c_str(), InData.GetData() + Start, Start, Length), INDEX_NONE);
+
+		NumSent += Length;
+		ComponentX = EndComponentX;
+	}
+
+	return NumSent;
+}
+
+// Sets the heightfield's OBJ transform and center from the landscape's.
+static void
+SetHeightfieldTransformFromLandscape(const HAPI_NodeId& HeightFieldId, FTransform LandscapeTransform, const FVector& CenterOffset)
+{
+	HAPI_TransformEuler HAPIObjectTransform;
+	FHoudiniApi::TransformEuler_Init(&HAPIObjectTransform);
+	//FMemory::Memzero< HAPI_TransformEuler >( HAPIObjectTransform );
+	LandscapeTransform.SetScale3D(FVector::OneVector);
+	FHoudiniEngineUtils::TranslateUnrealTransform(LandscapeTransform, HAPIObjectTransform);
+	HAPIObjectTransform.position[1] = 0.0f;
+
+	HAPI_NodeId ParentObjNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(HeightFieldId);
+	FHoudiniApi::SetObjectTransform(FHoudiniEngine::Get().GetSession(), ParentObjNodeId, &HAPIObjectTransform);
+
+	// Since HF are centered but landscape aren't, we need to set the HF's center parameter
+	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 0, CenterOffset.X);
+	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 1, 0.0);
+	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 2, CenterOffset.Y);
+}
 
 
 bool 
@@ -354,6 +525,24 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
 		FHoudiniEngine::Get().GetSession(), HeightId), false);
 
+	// Keep track of what is sent to the volumes, to be able to only send the components that change afterwards
+	const bool bTrackUpload = CVarHoudiniEngineLandscapeInputPartialUpload.GetValueOnAnyThread() != 0;
+	FHoudiniLandscapeInputUpload Upload;
+	if (bTrackUpload)
+	{
+		Upload.Landscape = LandscapeProxy;
+		Upload.XSize = XSize;
+		Upload.YSize = YSize;
+		Upload.ComponentSizeQuads = LandscapeProxy->ComponentSizeQuads;
+		Upload.VolumeTransform = HeightfieldVolumeInfo.transform;
+		Upload.AttributesHash = ComputeLandscapeInputAttributesHash(LandscapeProxy);
+
+		FHoudiniLandscapeInputVolume& HeightVolume = Upload.Volumes.AddDefaulted_GetRef();
+		HeightVolume.Name = TEXT("height");
+		HeightVolume.NodeId = HeightId;
+		ComputeHeightfieldComponentHashes(HeightfieldFloatValues, XSize, YSize, Upload.ComponentSizeQuads, HeightVolume.ComponentHashes);
+	}
+
 	//--------------------------------------------------------------------------------------------------
     // 5. Extract and convert all the layers
     //--------------------------------------------------------------------------------------------------
@@ -443,6 +632,14 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
 			FHoudiniEngine::Get().GetSession(), LayerVolumeNodeId), false);
 
+		if (bTrackUpload)
+		{
+			FHoudiniLandscapeInputVolume& LayerVolume = Upload.Volumes.AddDefaulted_GetRef();
+			LayerVolume.Name = LayerName;
+			LayerVolume.NodeId = LayerVolumeNodeId;
+			ComputeHeightfieldComponentHashes(CurrentLayerFloatData, XSize, YSize, Upload.ComponentSizeQuads, LayerVolume.ComponentHashes);
+		}
+
 		if (!IsMask)
 		{
 			// We had to create a new volume for this layer, so we need to connect it to the HF's merge node
@@ -483,20 +680,7 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 			FHoudiniEngine::Get().GetSession(), MaskId), false);
 	}
 
-	HAPI_TransformEuler HAPIObjectTransform;
-	FHoudiniApi::TransformEuler_Init(&HAPIObjectTransform);
-	//FMemory::Memzero< HAPI_TransformEuler >( HAPIObjectTransform );
-	LandscapeTransform.SetScale3D(FVector::OneVector);
-	FHoudiniEngineUtils::TranslateUnrealTransform(LandscapeTransform, HAPIObjectTransform);
-	HAPIObjectTransform.position[1] = 0.0f;
-
-	HAPI_NodeId ParentObjNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(HeightFieldId);
-	FHoudiniApi::SetObjectTransform(FHoudiniEngine::Get().GetSession(), ParentObjNodeId, &HAPIObjectTransform);
-
-	// Since HF are centered but landscape aren't, we need to set the HF's center parameter
-	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 0, CenterOffset.X);
-	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 1, 0.0);
-	FHoudiniApi::SetParmFloatValue(FHoudiniEngine::Get().GetSession(), HeightFieldId, "t", 2, CenterOffset.Y);
+	SetHeightfieldTransformFromLandscape(HeightFieldId, LandscapeTransform, CenterOffset);
 
 	// Finally, cook the Heightfield node
 	/*
@@ -509,9 +693,158 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	CreatedHeightfieldNodeId = HeightFieldId;
 
+	// Remember what we've sent, so the next changes can be sent by UpdateHeightfieldFromLandscape
+	if (bTrackUpload)
+	{
+		HAPI_NodeInfo NodeInfo;
+		FHoudiniApi::NodeInfo_Init(&NodeInfo);
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), HeightFieldId, &NodeInfo))
+		{
+			// Forget the uploads of deleted landscapes while we're at it
+			for (auto It = LandscapeInputUploads.CreateIterator(); It; ++It)
+			{
+				if (!It.Value().Landscape.IsValid())
+					It.RemoveCurrent();
+			}
+
+			Upload.UniqueHoudiniNodeId = NodeInfo.uniqueHoudiniNodeId;
+			LandscapeInputUploads.Add(HeightFieldId, MoveTemp(Upload));
+		}
+	}
+
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(
+	ALandscapeProxy* LandscapeProxy, const HAPI_NodeId& HeightfieldNodeId)
+{
+	if (!LandscapeProxy || CVarHoudiniEngineLandscapeInputPartialUpload.GetValueOnAnyThread() == 0)
+		return false;
+
+	FHoudiniLandscapeInputUpload* Upload = LandscapeInputUploads.Find(HeightfieldNodeId);
+	if (!Upload)
+		return false;
+
+	// Make sure the node is still the heightfield we've created for this landscape
+	HAPI_NodeInfo NodeInfo;
+	FHoudiniApi::NodeInfo_Init(&NodeInfo);
+	if (Upload->Landscape.Get() != LandscapeProxy
+		|| HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), HeightfieldNodeId, &NodeInfo)
+		|| NodeInfo.uniqueHoudiniNodeId != Upload->UniqueHoudiniNodeId)
+	{
+		LandscapeInputUploads.Remove(HeightfieldNodeId);
+		return false;
+	}
+
+	//--------------------------------------------------------------------------------------------------
+	// 1. Extract and convert the height data, like CreateHeightfieldFromLandscape
+	//--------------------------------------------------------------------------------------------------
+	TArray<uint16> HeightData;
+	int32 XSize, YSize;
+	FVector Min, Max;
+	if (!GetLandscapeData(LandscapeProxy, HeightData, XSize, YSize, Min, Max))
+		return false;
+
+	TArray<TArray<float>> VolumesData;
+	TArray<float>& HeightfieldFloatValues = VolumesData.AddDefaulted_GetRef();
+	HAPI_VolumeInfo HeightfieldVolumeInfo;
+	FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
+	FTransform LandscapeTransform = LandscapeProxy->ActorToWorld();
+	FVector CenterOffset = FVector::ZeroVector;
+	if (!ConvertLandscapeDataToHeightfieldData(
+		HeightData, XSize, YSize, Min, Max, LandscapeTransform,
+		HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset))
+		return false;
+
+	// Anything changing the volumes' infos or attributes requires a new heightfield
+	if (XSize != Upload->XSize || YSize != Upload->YSize
+		|| LandscapeProxy->ComponentSizeQuads != Upload->ComponentSizeQuads
+		|| FMemory::Memcmp(&HeightfieldVolumeInfo.transform, &Upload->VolumeTransform, sizeof(HAPI_Transform)) != 0
+		|| ComputeLandscapeInputAttributesHash(LandscapeProxy) != Upload->AttributesHash)
+		return false;
+
+	//--------------------------------------------------------------------------------------------------
+	// 2. Extract and convert the layers, they need to match the volumes that were created
+	//--------------------------------------------------------------------------------------------------
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	TArray<FString> VolumeNames;
+	VolumeNames.Add(TEXT("height"));
+	for (int32 n = 0; n < LandscapeInfo->Layers.Num(); n++)
+	{
+		TArray<uint8> CurrentLayerIntData;
+		FLinearColor LayerUsageDebugColor;
+		FString LayerName;
+		if (!GetLandscapeLayerData(LandscapeInfo, n, CurrentLayerIntData, LayerUsageDebugColor, LayerName))
+			continue;
+
+		HAPI_VolumeInfo CurrentLayerVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&CurrentLayerVolumeInfo);
+		TArray<float> CurrentLayerFloatData;
+		if (!ConvertLandscapeLayerDataToHeightfieldData(
+			CurrentLayerIntData, XSize, YSize, LayerUsageDebugColor,
+			CurrentLayerFloatData, CurrentLayerVolumeInfo))
+			continue;
+
+		VolumeNames.Add(LayerName);
+		VolumesData.Add(MoveTemp(CurrentLayerFloatData));
+	}
+
+	if (VolumeNames.Num() != Upload->Volumes.Num())
+		return false;
+
+	for (int32 VolumeIdx = 0; VolumeIdx < VolumeNames.Num(); VolumeIdx++)
+	{
+		if (!VolumeNames[VolumeIdx].Equals(Upload->Volumes[VolumeIdx].Name))
+			return false;
+	}
+
+	//--------------------------------------------------------------------------------------------------
+	// 3. Only send the rows of the volumes covering the landscape components that changed
+	//--------------------------------------------------------------------------------------------------
+	TArray<TArray<uint32>> VolumesHashes;
+	VolumesHashes.SetNum(VolumesData.Num());
+	for (int32 VolumeIdx = 0; VolumeIdx < VolumesData.Num(); VolumeIdx++)
+	{
+		ComputeHeightfieldComponentHashes(VolumesData[VolumeIdx], XSize, YSize, Upload->ComponentSizeQuads, VolumesHashes[VolumeIdx]);
+		if (VolumesHashes[VolumeIdx].Num() == 0 || VolumesHashes[VolumeIdx].Num() != Upload->Volumes[VolumeIdx].ComponentHashes.Num())
+			return false;
+	}
+
+	int32 NumSent = 0;
+	for (int32 VolumeIdx = 0; VolumeIdx < VolumesData.Num(); VolumeIdx++)
+	{
+		FHoudiniLandscapeInputVolume& Volume = Upload->Volumes[VolumeIdx];
+		const int32 VolumeNumSent = SetChangedHeightfieldRows(
+			Volume, VolumesData[VolumeIdx], XSize, YSize, Upload->ComponentSizeQuads, VolumesHashes[VolumeIdx]);
+
+		// The volumes might be partially updated now, the heightfield will have to be recreated
+		if (VolumeNumSent < 0
+			|| (VolumeNumSent > 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::CommitGeo(FHoudiniEngine::Get().GetSession(), Volume.NodeId)))
+		{
+			LandscapeInputUploads.Remove(HeightfieldNodeId);
+			return false;
+		}
+
+		Volume.ComponentHashes = MoveTemp(VolumesHashes[VolumeIdx]);
+		NumSent += VolumeNumSent;
+	}
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Landscape input %s: sent %d of %d heightfield values."),
+		*LandscapeProxy->GetName(), NumSent, XSize * YSize * VolumesData.Num());
+
+	//--------------------------------------------------------------------------------------------------
+	// 4. Update the heightfield's transform and cook it
+	//--------------------------------------------------------------------------------------------------
+	SetHeightfieldTransformFromLandscape(HeightfieldNodeId, LandscapeTransform, CenterOffset);
+
+	return FHoudiniEngineUtils::HapiCookNode(HeightfieldNodeId, nullptr, true);
+}
+
 // Converts Unreal uint16 values to Houdini Float
 bool
 FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
@@ -575,20 +908,11 @@ FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
 	// Convert the Int data to Float
 	LayerFloatValues.SetNumUninitialized(SizeInPoints);
 
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
-		{
-			// We need to invert X/Y when reading the value from Unreal
-			int32 nHoudini = nX + nY * HoudiniXSize;
-			int32 nUnreal = nY + nX * XSize;
-
-			// Convert the int values to meter
-			// Unreal's digit value have a zero value of 32768
-			double DoubleValue = ((double)IntHeightData[nUnreal] - (double)IntMin) * LayerSpacing + LayerMin;
-			LayerFloatValues[nHoudini] = (float)DoubleValue;
-		}
-	}
+	// We need to invert X/Y when reading the value from Unreal
+	FHoudiniDataConversion::ConvertLandscapeLayerToHeightfield(
+		IntHeightData.GetData(), HoudiniXSize, XSize,
+		LayerFloatValues.GetData(), HoudiniXSize,
+		IntMin, LayerSpacing, LayerMin);
 
 	/*
 	// Verifying the converted ZMin / ZMax
@@ -765,20 +1089,12 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 	// Convert the Int data to Float
 	HeightfieldFloatValues.SetNumUninitialized(SizeInPoints);
 
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
-		{
-			// We need to invert X/Y when reading the value from Unreal
-			int32 nHoudini = nX + nY * HoudiniXSize;
-			int32 nUnreal = nY + nX * XSize;
-
-			// Convert the int values to meter
-			// Unreal's digit value have a zero value of 32768
-			double DoubleValue = ((double)IntHeightData[nUnreal] - ZCenterOffset) * ZSpacing + ZPositionOffset;
-			HeightfieldFloatValues[nHoudini] = (float)DoubleValue;
-		}
-	}
+	// We need to invert X/Y when reading the value from Unreal
+	// Convert the int values to meter, Unreal's digit value have a zero value of 32768
+	FHoudiniDataConversion::ConvertLandscapeHeightsToHeightfield(
+		IntHeightData.GetData(), HoudiniXSize, XSize,
+		HeightfieldFloatValues.GetData(), HoudiniXSize,
+		ZCenterOffset, ZSpacing, ZPositionOffset);
 
 	//--------------------------------------------------------------------------------------------------
 	// 2. Convert the Unreal Transform to a HAPI_transform
@@ -44,6 +44,13 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			HAPI_NodeId& CreatedHeightfieldNodeId,
 			const FString &InputNodeNameStr);
 
+		// Updates a heightfield created by CreateHeightfieldFromLandscape for the same landscape in place,
+		// only sending the parts of its volumes that cover the landscape components that changed since the last upload.
+		// Returns false if the heightfield can't be updated and needs to be recreated.
+		static bool UpdateHeightfieldFromLandscape(
+			ALandscapeProxy* LandscapeProxy,
+			const HAPI_NodeId& HeightfieldNodeId);
+
 		// Extracts the uint16 values of a given landscape
 		static bool GetLandscapeData(
 			ALandscapeProxy* LandscapeProxy,
@@ -29,6 +29,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniGeoBlobWriter.h"
 
 #include "RawMesh.h"
 #include "MeshDescription.h"
@@ -36,6 +37,7 @@
 #include "Engine/StaticMesh.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Engine/StaticMeshSocket.h"
+#include "Engine/Level.h"
 #include "Components/StaticMeshComponent.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInterface.h"
@@ -54,7 +56,8 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	UStaticMeshComponent* StaticMeshComponent /* = nullptr */,
 	const bool& ExportAllLODs /* = false */,
 	const bool& ExportSockets /* = false */,
-	const bool& ExportColliders /* = false */)
+	const bool& ExportColliders /* = false */,
+	const bool& bUseGeoBlob /* = false */)
 {
 	// If we don't have a static mesh there's nothing to do.
 	if (!StaticMesh || StaticMesh->IsPendingKill())
@@ -211,6 +214,31 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 				StaticMeshComponent);
 			HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForMeshDescription completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
 		}
+		else if (ExportMethod == 2 && bUseGeoBlob && CanUseGeoBlobForStaticMeshLODResources(DoExportLODs, StaticMeshComponent))
+		{
+			// Send the LOD Mesh in a single bgeo blob
+			const double StartTime = FPlatformTime::Seconds();
+			bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResourcesAsGeoBlob(
+				CurrentLODNodeId,
+				StaticMesh->GetLODForExport(LODIndex),
+				LODIndex,
+				StaticMesh,
+				StaticMeshComponent);
+			HOUDINI_LOG_MESSAGE(TEXT("FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResourcesAsGeoBlob completed in %.4f seconds"), FPlatformTime::Seconds() - StartTime);
+
+			if (!bMeshSuccess)
+			{
+				// Fall back to the attribute by attribute upload
+				HOUDINI_LOG_WARNING(TEXT("Failed to upload LOD %d of %s as a geometry blob, uploading its attributes instead."), LODIndex, *StaticMesh->GetName());
+				bMeshSuccess = FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
+					CurrentLODNodeId,
+					StaticMesh->GetLODForExport(LODIndex),
+					LODIndex,
+					DoExportLODs,
+					StaticMesh,
+					StaticMeshComponent);
+			}
+		}
 		else if (ExportMethod == 2)
 		{
 			// Convert the LOD Mesh using FStaticMeshLODResources
@@ -363,6 +391,194 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 	return true;
 }
 
+uint32
+FUnrealMeshTranslator::ComputeStaticMeshInputHash(
+	UStaticMesh* StaticMesh,
+	UStaticMeshComponent* StaticMeshComponent /* = nullptr */,
+	const bool& ExportAllLODs /* = false */,
+	const bool& ExportSockets /* = false */,
+	const bool& ExportColliders /* = false */)
+{
+	if (!StaticMesh || StaticMesh->IsPendingKill() || !StaticMesh->RenderData)
+		return 0;
+
+	if (StaticMeshComponent && StaticMeshComponent->IsPendingKill())
+		StaticMeshComponent = nullptr;
+
+	// Mirror the export choices made in HapiCreateInputNodeForStaticMesh
+	const bool DoExportSockets = ExportSockets && (StaticMesh->Sockets.Num() > 0);
+	const bool DoExportLODs = ExportAllLODs && (StaticMesh->GetNumLODs() > 1);
+	const bool DoExportColliders = ExportColliders && StaticMesh->BodySetup && StaticMesh->BodySetup->AggGeom.GetElementCount() > 0;
+
+	uint32 Hash = GetTypeHash(StaticMesh->GetPathName());
+	Hash = HashCombine(Hash, (DoExportLODs ? 1u : 0u) | (DoExportSockets ? 2u : 0u) | (DoExportColliders ? 4u : 0u));
+
+	auto HashBytes = [&Hash](const void* InData, const int64& InSize)
+	{
+		if (InData && InSize > 0)
+			Hash = FCrc::MemCrc32(InData, static_cast<int32>(InSize), Hash);
+	};
+
+	auto HashString = [&Hash](const FString& InString)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(InString));
+	};
+
+	// Materials, as resolved by the input component
+	const int32 NumStaticMaterials = StaticMesh->StaticMaterials.Num();
+	Hash = HashCombine(Hash, NumStaticMaterials);
+	for (int32 MaterialIndex = 0; MaterialIndex < NumStaticMaterials; MaterialIndex++)
+	{
+		UMaterialInterface* Material = StaticMeshComponent
+			? StaticMeshComponent->GetMaterial(MaterialIndex)
+			: StaticMesh->StaticMaterials[MaterialIndex].MaterialInterface;
+
+		HashString(Material ? Material->GetPathName() : FString());
+	}
+
+	// Detail attributes
+	Hash = HashCombine(Hash, StaticMesh->LightMapResolution);
+	if (UAssetImportData* ImportData = StaticMesh->AssetImportData)
+	{
+		if (ImportData->SourceData.SourceFiles.Num() > 0)
+			HashString(ImportData->SourceData.SourceFiles[0].RelativeFilename);
+	}
+
+	// Render data of every exported LOD
+	const int32 NumLODsToExport = DoExportLODs ? StaticMesh->GetNumLODs() : 1;
+	for (int32 LODIndex = 0; LODIndex < NumLODsToExport; LODIndex++)
+	{
+		const FStaticMeshLODResources& LODResources = StaticMesh->GetLODForExport(LODIndex);
+		const FPositionVertexBuffer& PositionBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+		const FStaticMeshVertexBuffer& VertexBuffer = LODResources.VertexBuffers.StaticMeshVertexBuffer;
+		const FColorVertexBuffer& ColorBuffer = LODResources.VertexBuffers.ColorVertexBuffer;
+
+		const uint32 NumVertices = PositionBuffer.GetNumVertices();
+		const uint32 NumIndices = LODResources.IndexBuffer.GetNumIndices();
+		Hash = HashCombine(Hash, NumVertices);
+		Hash = HashCombine(Hash, NumIndices);
+		Hash = HashCombine(Hash, VertexBuffer.GetNumTexCoords());
+
+		// Without CPU access to the buffers we can't tell if the mesh has changed
+		if (NumVertices > 0 && (!VertexBuffer.GetTangentData() || !VertexBuffer.GetTexCoordData()))
+			return 0;
+
+		if (NumVertices > 0)
+		{
+			HashBytes(&PositionBuffer.VertexPosition(0), (int64)NumVertices * PositionBuffer.GetStride());
+			HashBytes(VertexBuffer.GetTangentData(), VertexBuffer.GetTangentSize());
+			HashBytes(VertexBuffer.GetTexCoordData(), VertexBuffer.GetTexCoordSize());
+		}
+
+		if (LODResources.bHasColorVertexData && ColorBuffer.GetNumVertices() > 0)
+			HashBytes(&ColorBuffer.VertexColor(0), (int64)ColorBuffer.GetNumVertices() * sizeof(FColor));
+
+		if (NumIndices > 0)
+		{
+			if (LODResources.IndexBuffer.Is32Bit())
+				HashBytes(LODResources.IndexBuffer.AccessStream32(), (int64)NumIndices * sizeof(uint32));
+			else
+				HashBytes(LODResources.IndexBuffer.AccessStream16(), (int64)NumIndices * sizeof(uint16));
+		}
+
+		for (const FStaticMeshSection& Section : LODResources.Sections)
+		{
+			Hash = HashCombine(Hash, Section.MaterialIndex);
+			Hash = HashCombine(Hash, Section.FirstIndex);
+			Hash = HashCombine(Hash, Section.NumTriangles);
+		}
+
+		// Vertex color overrides painted on the component
+		if (StaticMeshComponent
+			&& StaticMeshComponent->LODData.IsValidIndex(LODIndex)
+			&& StaticMeshComponent->LODData[LODIndex].OverrideVertexColors)
+		{
+			const FColorVertexBuffer& OverrideColors = *StaticMeshComponent->LODData[LODIndex].OverrideVertexColors;
+			if (OverrideColors.GetNumVertices() > 0)
+				HashBytes(&OverrideColors.VertexColor(0), (int64)OverrideColors.GetNumVertices() * sizeof(FColor));
+		}
+
+		const FStaticMeshSourceModel& SourceModel = StaticMesh->GetSourceModel(LODIndex);
+		HashBytes(&SourceModel.BuildSettings.BuildScale3D, sizeof(FVector));
+		if (DoExportLODs && !StaticMesh->bAutoComputeLODScreenSize)
+			HashBytes(&SourceModel.ScreenSize.Default, sizeof(float));
+	}
+
+	// Simple colliders
+	if (DoExportColliders)
+	{
+		const FKAggregateGeom& SimpleColliders = StaticMesh->BodySetup->AggGeom;
+		for (const FKBoxElem& CurBox : SimpleColliders.BoxElems)
+		{
+			HashBytes(&CurBox.Center, sizeof(FVector));
+			HashBytes(&CurBox.Rotation, sizeof(FRotator));
+			const FVector BoxExtent(CurBox.X, CurBox.Y, CurBox.Z);
+			HashBytes(&BoxExtent, sizeof(FVector));
+		}
+
+		for (const FKSphereElem& CurSphere : SimpleColliders.SphereElems)
+		{
+			HashBytes(&CurSphere.Center, sizeof(FVector));
+			HashBytes(&CurSphere.Radius, sizeof(float));
+		}
+
+		for (const FKSphylElem& CurSphyl : SimpleColliders.SphylElems)
+		{
+			HashBytes(&CurSphyl.Center, sizeof(FVector));
+			HashBytes(&CurSphyl.Rotation, sizeof(FRotator));
+			HashBytes(&CurSphyl.Radius, sizeof(float));
+			HashBytes(&CurSphyl.Length, sizeof(float));
+		}
+
+		for (const FKConvexElem& CurConvex : SimpleColliders.ConvexElems)
+		{
+			HashBytes(CurConvex.VertexData.GetData(), (int64)CurConvex.VertexData.Num() * sizeof(FVector));
+			HashBytes(CurConvex.IndexData.GetData(), (int64)CurConvex.IndexData.Num() * sizeof(int32));
+			const FTransform ConvexTransform = CurConvex.GetTransform();
+			Hash = HashCombine(Hash, GetTypeHash(ConvexTransform.GetLocation()));
+			Hash = HashCombine(Hash, GetTypeHash(ConvexTransform.GetRotation().Euler()));
+			Hash = HashCombine(Hash, GetTypeHash(ConvexTransform.GetScale3D()));
+		}
+	}
+
+	// Sockets
+	if (DoExportSockets)
+	{
+		for (UStaticMeshSocket* CurrentSocket : StaticMesh->Sockets)
+		{
+			if (!CurrentSocket || CurrentSocket->IsPendingKill())
+				continue;
+
+			HashString(CurrentSocket->SocketName.ToString());
+			HashString(CurrentSocket->Tag);
+			HashBytes(&CurrentSocket->RelativeLocation, sizeof(FVector));
+			HashBytes(&CurrentSocket->RelativeRotation, sizeof(FRotator));
+			HashBytes(&CurrentSocket->RelativeScale, sizeof(FVector));
+		}
+	}
+
+	// Component and actor tags, actor and level paths
+	if (StaticMeshComponent)
+	{
+		for (const FName& CurTag : StaticMeshComponent->ComponentTags)
+			Hash = HashCombine(Hash, GetTypeHash(CurTag));
+
+		AActor* ParentActor = StaticMeshComponent->GetOwner();
+		if (ParentActor && !ParentActor->IsPendingKill())
+		{
+			for (const FName& CurTag : ParentActor->Tags)
+				Hash = HashCombine(Hash, GetTypeHash(CurTag));
+
+			HashString(ParentActor->GetPathName());
+			if (ULevel* Level = ParentActor->GetLevel())
+				HashString(Level->GetPathName());
+		}
+	}
+
+	// Never return the "no hash" value for valid data
+	return Hash != 0 ? Hash : 1;
+}
+
 bool
 FUnrealMeshTranslator::CreateInputNodeForMeshSockets(
 	const TArray<UStaticMeshSocket*>& InMeshSocket, const HAPI_NodeId& InParentNodeId, HAPI_NodeId& OutSocketsNodeId)
@@ -2358,6 +2574,288 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 }
 
 
+bool
+FUnrealMeshTranslator::CanUseGeoBlobForStaticMeshLODResources(
+	const bool& bAddLODGroups,
+	UStaticMeshComponent* StaticMeshComponent)
+{
+	// LOD groups and tag groups are only supported by the attribute by attribute upload
+	if (bAddLODGroups)
+		return false;
+
+	if (StaticMeshComponent && !StaticMeshComponent->IsPendingKill())
+	{
+		if (StaticMeshComponent->ComponentTags.Num() > 0)
+			return false;
+
+		AActor* ParentActor = StaticMeshComponent->GetOwner();
+		if (ParentActor && !ParentActor->IsPendingKill() && ParentActor->Tags.Num() > 0)
+			return false;
+	}
+
+	return true;
+}
+
+bool
+FUnrealMeshTranslator::CreateGeoBlobForStaticMeshLODResources(
+	const FStaticMeshLODResources& LODResources,
+	const int32& InLODIndex,
+	UStaticMesh* StaticMesh,
+	UStaticMeshComponent* StaticMeshComponent,
+	TUniquePtr<FHoudiniGeoBlobWriter>& OutBlob)
+{
+	if (!StaticMesh || StaticMesh->IsPendingKill())
+		return false;
+
+	if (LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices() == 0 || LODResources.Sections.Num() == 0)
+		return false;
+
+	const FPositionVertexBuffer& PositionBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+	const FStaticMeshVertexBuffer& VertexBuffer = LODResources.VertexBuffers.StaticMeshVertexBuffer;
+
+	const uint32 OrigNumVertexInstances = VertexBuffer.GetNumVertices();
+	const int32 NumTriangles = LODResources.GetNumTriangles();
+	const FVector BuildScaleVector = StaticMesh->GetSourceModel(InLODIndex).BuildSettings.BuildScale3D;
+
+	// Share the points between vertex instances with the same position, like the attribute upload does.
+	// We need the final number of points before laying out the blob.
+	TArray<int32> UEVertexInstanceIdxToPointIdx;
+	UEVertexInstanceIdxToPointIdx.SetNumUninitialized(OrigNumVertexInstances);
+	TArray<FVector> PointPositions;
+	PointPositions.Reserve(OrigNumVertexInstances);
+	{
+		TMap<FVector, int32> PositionToPointIndexMap;
+		PositionToPointIndexMap.Reserve(OrigNumVertexInstances);
+		for (uint32 VertexInstanceIndex = 0; VertexInstanceIndex < OrigNumVertexInstances; ++VertexInstanceIndex)
+		{
+			const FVector& PositionVector = PositionBuffer.VertexPosition(VertexInstanceIndex);
+			int32& PointIndex = PositionToPointIndexMap.FindOrAdd(PositionVector, INDEX_NONE);
+			if (PointIndex == INDEX_NONE)
+				PointIndex = PointPositions.Add(PositionVector);
+
+			UEVertexInstanceIdxToPointIdx[VertexInstanceIndex] = PointIndex;
+		}
+	}
+
+	// Colors, from the component's overrides if it has some
+	const FColorVertexBuffer* ColorBuffer = LODResources.bHasColorVertexData ? &LODResources.VertexBuffers.ColorVertexBuffer : nullptr;
+	if (StaticMeshComponent &&
+		StaticMeshComponent->LODData.IsValidIndex(InLODIndex) &&
+		StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors &&
+		StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors->GetNumVertices() == LODResources.GetNumVertices())
+	{
+		ColorBuffer = StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors;
+	}
+
+	// Material of each slot, with the same fallbacks as the attribute upload
+	const bool bIsStaticMeshComponentValid = (StaticMeshComponent && !StaticMeshComponent->IsPendingKill() && StaticMeshComponent->IsValidLowLevel());
+	const int32 NumStaticMaterials = StaticMesh->StaticMaterials.Num();
+	TArray<FString> MaterialPaths;
+	MaterialPaths.Reserve(NumStaticMaterials + 1);
+	for (int32 MaterialIndex = 0; MaterialIndex < NumStaticMaterials; ++MaterialIndex)
+	{
+		UMaterialInterface* Material = bIsStaticMeshComponentValid
+			? StaticMeshComponent->GetMaterial(MaterialIndex)
+			: StaticMesh->StaticMaterials[MaterialIndex].MaterialInterface;
+
+		if (!Material || Material->IsPendingKill())
+			Material = UMaterial::GetDefaultMaterial(EMaterialDomain::MD_Surface);
+
+		MaterialPaths.Add(Material->GetPathName());
+	}
+
+	// Sections referencing an invalid slot use the default material
+	int32 DefaultMaterialIndex = INDEX_NONE;
+	for (const FStaticMeshSection& Section : LODResources.Sections)
+	{
+		if (!MaterialPaths.IsValidIndex(Section.MaterialIndex) && DefaultMaterialIndex == INDEX_NONE)
+			DefaultMaterialIndex = MaterialPaths.Add(UMaterial::GetDefaultMaterial(EMaterialDomain::MD_Surface)->GetPathName());
+	}
+
+	// Source file and owner paths
+	FString SourceFilename;
+	if (UAssetImportData* ImportData = StaticMesh->AssetImportData)
+	{
+		if (ImportData->SourceData.SourceFiles.Num() > 0)
+			SourceFilename = UAssetImportData::ResolveImportFilename(ImportData->SourceData.SourceFiles[0].RelativeFilename, ImportData->GetOutermost());
+	}
+
+	FString ActorPath;
+	FString LevelPath;
+	AActor* ParentActor = StaticMeshComponent && !StaticMeshComponent->IsPendingKill() ? StaticMeshComponent->GetOwner() : nullptr;
+	if (ParentActor && !ParentActor->IsPendingKill())
+	{
+		ActorPath = ParentActor->GetPathName();
+		if (ULevel* Level = ParentActor->GetLevel())
+		{
+			LevelPath = Level->GetPathName();
+
+			// We just want the path up to the first point
+			int32 DotIndex;
+			if (LevelPath.FindChar('.', DotIndex))
+				LevelPath.LeftInline(DotIndex, false);
+		}
+	}
+
+	// Declare the attributes and lay out the blob
+	OutBlob = MakeUnique<FHoudiniGeoBlobWriter>(PointPositions.Num(), NumTriangles);
+	FHoudiniGeoBlobWriter& Blob = *OutBlob;
+
+	const uint32 NumUVLayers = FMath::Min<uint32>(VertexBuffer.GetNumTexCoords(), MAX_STATIC_TEXCOORDS);
+	TArray<int32, TInlineAllocator<MAX_STATIC_TEXCOORDS>> UVAttributes;
+	for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; UVLayerIndex++)
+	{
+		FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
+		if (UVLayerIndex > 0)
+			UVAttributeName += FString::Printf(TEXT("%d"), UVLayerIndex + 1);
+
+		UVAttributes.Add(Blob.AddFloatAttribute(UVAttributeName, HAPI_ATTROWNER_VERTEX, 3));
+	}
+
+	const int32 NormalAttribute = Blob.AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_NORMAL), HAPI_ATTROWNER_VERTEX, 3);
+	const int32 TangentAttribute = Blob.AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_TANGENTU), HAPI_ATTROWNER_VERTEX, 3);
+	const int32 BinormalAttribute = Blob.AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_TANGENTV), HAPI_ATTROWNER_VERTEX, 3);
+	const int32 ColorAttribute = ColorBuffer ? Blob.AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_COLOR), HAPI_ATTROWNER_VERTEX, 3) : INDEX_NONE;
+	const int32 AlphaAttribute = ColorBuffer ? Blob.AddFloatAttribute(TEXT(HAPI_UNREAL_ATTRIB_ALPHA), HAPI_ATTROWNER_VERTEX, 1) : INDEX_NONE;
+	const int32 MaterialAttribute = Blob.AddStringAttribute(TEXT(HAPI_UNREAL_ATTRIB_MATERIAL), HAPI_ATTROWNER_PRIM, MaterialPaths);
+	const int32 MeshNameAttribute = Blob.AddStringAttribute(TEXT(HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME), HAPI_ATTROWNER_PRIM, { StaticMesh->GetPathName() });
+	const int32 SourceFileAttribute = !SourceFilename.IsEmpty()
+		? Blob.AddStringAttribute(TEXT(HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE), HAPI_ATTROWNER_PRIM, { SourceFilename }) : INDEX_NONE;
+	const int32 ActorPathAttribute = !ActorPath.IsEmpty()
+		? Blob.AddStringAttribute(TEXT(HAPI_UNREAL_ATTRIB_ACTOR_PATH), HAPI_ATTROWNER_PRIM, { ActorPath }) : INDEX_NONE;
+	const int32 LevelPathAttribute = !LevelPath.IsEmpty()
+		? Blob.AddStringAttribute(TEXT(HAPI_UNREAL_ATTRIB_LEVEL_PATH), HAPI_ATTROWNER_PRIM, { LevelPath }) : INDEX_NONE;
+
+	// Same default lightmap resolution as the attribute upload (CreateInputNodeForStaticMeshLODResources)
+	const int32 GeneratedLightMapResolution = 32;
+	const int32 LightMapAttribute = StaticMesh->LightMapResolution != GeneratedLightMapResolution
+		? Blob.AddIntAttribute(TEXT(HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION), HAPI_ATTROWNER_DETAIL, 1) : INDEX_NONE;
+
+	Blob.Allocate();
+
+	// Now fill the values in place
+	{
+		float* PX = Blob.GetFloatValues(FHoudiniGeoBlobWriter::PositionAttribute, 0);
+		float* PY = Blob.GetFloatValues(FHoudiniGeoBlobWriter::PositionAttribute, 1);
+		float* PZ = Blob.GetFloatValues(FHoudiniGeoBlobWriter::PositionAttribute, 2);
+		for (int32 PointIdx = 0; PointIdx < PointPositions.Num(); PointIdx++)
+		{
+			// Convert Unreal to Houdini
+			const FVector& PositionVector = PointPositions[PointIdx];
+			PX[PointIdx] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X;
+			PY[PointIdx] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z;
+			PZ[PointIdx] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y;
+		}
+	}
+
+	int32* VertexPoints = Blob.GetVertexPointIndices();
+
+	float* UVValues[MAX_STATIC_TEXCOORDS][3];
+	for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; UVLayerIndex++)
+	{
+		for (int32 Component = 0; Component < 3; Component++)
+			UVValues[UVLayerIndex][Component] = Blob.GetFloatValues(UVAttributes[UVLayerIndex], Component);
+	}
+
+	float* Normals[3];
+	float* Tangents[3];
+	float* Binormals[3];
+	float* Colors[3] = { nullptr, nullptr, nullptr };
+	for (int32 Component = 0; Component < 3; Component++)
+	{
+		Normals[Component] = Blob.GetFloatValues(NormalAttribute, Component);
+		Tangents[Component] = Blob.GetFloatValues(TangentAttribute, Component);
+		Binormals[Component] = Blob.GetFloatValues(BinormalAttribute, Component);
+		if (ColorBuffer)
+			Colors[Component] = Blob.GetFloatValues(ColorAttribute, Component);
+	}
+	float* Alphas = ColorBuffer ? Blob.GetFloatValues(AlphaAttribute, 0) : nullptr;
+	int32* TriangleMaterials = Blob.GetIntValues(MaterialAttribute, 0);
+
+	int32 TriangleIdx = 0;
+	int32 HoudiniVertexIdx = 0;
+	FIndexArrayView TriangleVertexIndices = LODResources.IndexBuffer.GetArrayView();
+	for (const FStaticMeshSection& Section : LODResources.Sections)
+	{
+		const int32 SectionMaterialIndex = MaterialPaths.IsValidIndex(Section.MaterialIndex) ? Section.MaterialIndex : DefaultMaterialIndex;
+		for (uint32 SectionTriangleIndex = 0; SectionTriangleIndex < Section.NumTriangles; ++SectionTriangleIndex)
+		{
+			for (int32 TriangleVertexIndex = 0; TriangleVertexIndex < 3; ++TriangleVertexIndex)
+			{
+				// Reverse the winding order for Houdini (but still start at 0)
+				const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
+				const uint32 UEVertexIndex = TriangleVertexIndices[Section.FirstIndex + SectionTriangleIndex * 3 + WindingIdx];
+
+				VertexPoints[HoudiniVertexIdx] = UEVertexInstanceIdxToPointIdx.IsValidIndex(UEVertexIndex) ? UEVertexInstanceIdxToPointIdx[UEVertexIndex] : 0;
+
+				for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
+				{
+					const FVector2D& UV = VertexBuffer.GetVertexUV(UEVertexIndex, UVLayerIndex);
+					UVValues[UVLayerIndex][0][HoudiniVertexIdx] = UV.X;
+					UVValues[UVLayerIndex][1][HoudiniVertexIdx] = 1.0f - UV.Y;
+					UVValues[UVLayerIndex][2][HoudiniVertexIdx] = 0.0f;
+				}
+
+				const FVector Normal = VertexBuffer.VertexTangentZ(UEVertexIndex);
+				Normals[0][HoudiniVertexIdx] = Normal.X;
+				Normals[1][HoudiniVertexIdx] = Normal.Z;
+				Normals[2][HoudiniVertexIdx] = Normal.Y;
+
+				const FVector Tangent = VertexBuffer.VertexTangentX(UEVertexIndex);
+				Tangents[0][HoudiniVertexIdx] = Tangent.X;
+				Tangents[1][HoudiniVertexIdx] = Tangent.Z;
+				Tangents[2][HoudiniVertexIdx] = Tangent.Y;
+
+				const FVector Binormal = VertexBuffer.VertexTangentY(UEVertexIndex);
+				Binormals[0][HoudiniVertexIdx] = Binormal.X;
+				Binormals[1][HoudiniVertexIdx] = Binormal.Z;
+				Binormals[2][HoudiniVertexIdx] = Binormal.Y;
+
+				if (ColorBuffer)
+				{
+					const FLinearColor Color = ColorBuffer->VertexColor(UEVertexIndex).ReinterpretAsLinear();
+					Colors[0][HoudiniVertexIdx] = Color.R;
+					Colors[1][HoudiniVertexIdx] = Color.G;
+					Colors[2][HoudiniVertexIdx] = Color.B;
+					Alphas[HoudiniVertexIdx] = Color.A;
+				}
+
+				HoudiniVertexIdx++;
+			}
+
+			TriangleMaterials[TriangleIdx] = SectionMaterialIndex;
+			TriangleIdx++;
+		}
+	}
+
+	// Constant string attributes all use their single string
+	for (const int32& CurAttribute : { MeshNameAttribute, SourceFileAttribute, ActorPathAttribute, LevelPathAttribute })
+	{
+		if (CurAttribute != INDEX_NONE)
+			FMemory::Memzero(Blob.GetIntValues(CurAttribute, 0), NumTriangles * sizeof(int32));
+	}
+
+	if (LightMapAttribute != INDEX_NONE)
+		Blob.GetIntValues(LightMapAttribute, 0)[0] = StaticMesh->LightMapResolution;
+
+	return true;
+}
+
+bool
+FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResourcesAsGeoBlob(
+	const HAPI_NodeId& NodeId,
+	const FStaticMeshLODResources& LODResources,
+	const int32& InLODIndex,
+	UStaticMesh* StaticMesh,
+	UStaticMeshComponent* StaticMeshComponent)
+{
+	TUniquePtr<FHoudiniGeoBlobWriter> Blob;
+	if (!CreateGeoBlobForStaticMeshLODResources(LODResources, InLODIndex, StaticMesh, StaticMeshComponent, Blob) || !Blob.IsValid())
+		return false;
+
+	return Blob->HapiLoadIntoNode(NodeId);
+}
+
 bool
 FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 	const HAPI_NodeId& NodeId,
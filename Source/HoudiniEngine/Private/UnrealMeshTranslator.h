@@ -53,6 +53,16 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			class UStaticMeshComponent* StaticMeshComponent = nullptr,
 			const bool& ExportAllLODs = false,
 			const bool& ExportSockets = false,
+			const bool& ExportColliders = false,
+			const bool& bUseGeoBlob = false);
+
+		// Hash the data that HapiCreateInputNodeForStaticMesh would marshal for this mesh/component and export settings.
+		// Returns 0 if the data can't be hashed (no CPU accessible render data), in which case the mesh must be uploaded.
+		static uint32 ComputeStaticMeshInputHash(
+			UStaticMesh* Mesh,
+			class UStaticMeshComponent* StaticMeshComponent = nullptr,
+			const bool& ExportAllLODs = false,
+			const bool& ExportSockets = false,
 			const bool& ExportColliders = false);
 
 		// Convert the Mesh using FStaticMeshLODResources
@@ -64,6 +74,28 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			UStaticMesh* StaticMesh,
 			UStaticMeshComponent* StaticMeshComponent);
 
+		// Returns true if a LOD can be sent with CreateInputNodeForStaticMeshLODResourcesAsGeoBlob
+		// (LOD and tag groups need the attribute by attribute upload)
+		static bool CanUseGeoBlobForStaticMeshLODResources(
+			const bool& bAddLODGroups,
+			UStaticMeshComponent* StaticMeshComponent);
+
+		// Serialize a FStaticMeshLODResources to a bgeo blob, with the same attributes as CreateInputNodeForStaticMeshLODResources
+		static bool CreateGeoBlobForStaticMeshLODResources(
+			const FStaticMeshLODResources& LODResources,
+			const int32& LODIndex,
+			UStaticMesh* StaticMesh,
+			UStaticMeshComponent* StaticMeshComponent,
+			TUniquePtr<class FHoudiniGeoBlobWriter>& OutBlob);
+
+		// Convert the Mesh using FStaticMeshLODResources, and send it with a single HAPI_LoadGeoFromMemory call
+		static bool CreateInputNodeForStaticMeshLODResourcesAsGeoBlob(
+			const HAPI_NodeId& NodeId,
+			const FStaticMeshLODResources& LODResources,
+			const int32& LODIndex,
+			UStaticMesh* StaticMesh,
+			UStaticMeshComponent* StaticMeshComponent);
+
 		// Convert the Mesh using FMeshDescription
 		static bool CreateInputNodeForMeshDescription(
 			const HAPI_NodeId& NodeId,
@@ -0,0 +1,351 @@
+#!/usr/bin/env python
+#
+# Copyright (c) <2021> Side Effects Software Inc.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. The name of Side Effects Software may not be used to endorse or
+#    promote products derived from this software without specific prior
+#    written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+# OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+# OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+# NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+# OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+# NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+# EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+# Generates Private/HoudiniApiRecorderHooks.inl, the FHoudiniApiRecorder hooks of every FHoudiniApi function,
+# from the function pointer typedefs of Public/HoudiniApi.h and the struct definitions of Public/HAPI/HAPI_Common.h.
+#
+# Run it again whenever HoudiniApi.h is regenerated for a new HAPI version:
+#   python Source/HoudiniEngine/Scripts/GenerateHoudiniApiRecorderHooks.py
+# and use --check to verify that the checked-in hooks are up to date.
+#
+# For each function, the hook keys the call on its scalar and string arguments (the session and the input
+# arrays are not part of the key), and records or replays the content of its non-const pointer arguments.
+# The struct pointers passed to the struct helpers (ParmInfo_IsInt...) are keyed field by field, so that
+# their padding bytes never end up in the key. The number of values of an output array is the function's
+# length/count argument matching the array, OUTPUT_COUNTS lists the arrays that can't be matched that way.
+
+from __future__ import print_function
+
+import argparse
+import io
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+MODULE_DIR = os.path.dirname(SCRIPT_DIR)
+API_HEADER = os.path.join(MODULE_DIR, 'Public', 'HoudiniApi.h')
+COMMON_HEADER = os.path.join(MODULE_DIR, 'Public', 'HAPI', 'HAPI_Common.h')
+OUTPUT_FILE = os.path.join(MODULE_DIR, 'Private', 'HoudiniApiRecorderHooks.inl')
+
+# Number of values of the output arrays whose size isn't given by a matching length/count argument
+OUTPUT_COUNTS = {
+	('ConvertTransformEulerToMatrix', 'matrix'): '16',
+	('ConvertTransformQuatToMatrix', 'matrix'): '16',
+}
+
+LICENSE = '''/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+'''
+
+TYPEDEF_RE = re.compile(r'^\s*typedef\s+(.+?)\s*\(\*(\w+)FuncPtr\)\((.*)\);\s*$')
+
+
+class Param(object):
+	def __init__(self, text):
+		self.text = text.strip()
+		match = re.match(r'^(.*?)(\w+)$', self.text)
+		self.type = match.group(1).strip()
+		self.name = match.group(2)
+		self.is_pointer = '*' in self.type
+		self.is_const = self.type.startswith('const ')
+		self.base_type = self.type.replace('const ', '').replace('*', '').strip()
+
+
+class Function(object):
+	def __init__(self, return_type, name, params):
+		self.return_type = return_type
+		self.name = name
+		self.params = [Param(p) for p in params.split(',')] if params.strip() else []
+
+	@property
+	def struct_helper_type(self):
+		# The struct helpers are named after the struct they work on: ParmInfo_IsInt works on a HAPI_ParmInfo
+		if '_' not in self.name:
+			return None
+		return 'HAPI_' + self.name.split('_')[0]
+
+	@property
+	def is_struct_initializer(self):
+		# The struct initializers always return the same thing, they only need to be recorded once
+		return self.struct_helper_type is not None and (self.name.endswith('_Create') or self.name.endswith('_Init'))
+
+	def is_keyed_struct(self, param):
+		# The struct passed to a struct helper, other than the initializers which fill it
+		return (param.is_pointer and param.base_type == self.struct_helper_type
+			and not self.name.endswith('_Init'))
+
+	def output_count(self, param):
+		count = OUTPUT_COUNTS.get((self.name, param.name))
+		if count:
+			return count
+
+		# Attribute values: length elements of stride (or the attribute's tuple size) values each
+		param_names = [p.name for p in self.params]
+		if param.name == 'data_array' and 'attr_info' in param_names and 'length' in param_names:
+			if 'stride' in param_names:
+				return 'length * (stride > 0 ? stride : (attr_info ? attr_info->tupleSize : 1))'
+			return 'length * (attr_info ? attr_info->tupleSize : 1)'
+
+		is_array = (param.name.endswith('_array') or param.name.endswith('_buffer') or param.name == 'buffer'
+			or param.name == 'node_ids' or (param.base_type == 'char' and param.name.endswith('_value')))
+		if not is_array:
+			return '1'
+
+		# The scalar length/count argument sharing the longest prefix with the array:
+		# values_array -> value_count, int_values_array -> int_length, data_fixed_array -> data_fixed_length
+		candidates = [p.name for p in self.params if not p.is_pointer
+			and (p.name in ('length', 'count') or p.name.endswith('_length') or p.name.endswith('_count'))]
+		if not candidates:
+			raise RuntimeError('%s: no count for the output array %s, add it to OUTPUT_COUNTS' % (self.name, param.name))
+
+		def score(candidate):
+			prefix = candidate.rsplit('_', 1)[0] if '_' in candidate else ''
+			return (len(prefix) if prefix and param.name.startswith(prefix) else 0, candidate == 'length')
+
+		return max(candidates, key=score)
+
+
+def parse_functions(header_path):
+	functions = []
+	with io.open(header_path, encoding='utf-8') as header:
+		for line in header:
+			match = TYPEDEF_RE.match(line)
+			if match:
+				functions.append(Function(match.group(1), match.group(2), match.group(3)))
+
+	return sorted(functions, key=lambda f: f.name)
+
+
+def parse_struct_fields(header_path, struct_name):
+	with io.open(header_path, encoding='utf-8') as header:
+		source = header.read()
+
+	match = re.search(r'^struct HAPI_API %s\s*\{(.*?)^\};' % struct_name, source, re.M | re.S)
+	if not match:
+		raise RuntimeError('Struct %s not found in %s' % (struct_name, header_path))
+
+	fields = []
+	for line in match.group(1).splitlines():
+		line = line.split('///')[0].split('//')[0].strip()
+		field = re.match(r'^[\w ]+?\s+(\w+)\s*(?:\[\s*(\w+)\s*\])?\s*;$', line)
+		if field:
+			fields.append((field.group(1), field.group(2)))
+
+	return fields
+
+
+def generate(functions, common_header):
+	out = []
+	emit = out.append
+
+	emit(LICENSE)
+	emit('// Generated by Source/HoudiniEngine/Scripts/GenerateHoudiniApiRecorderHooks.py from HoudiniApi.h, do not edit.')
+	emit('// Included by HoudiniApiRecorder.cpp.')
+	emit('')
+
+	# Functions enum and names
+	emit('// The hooked FHoudiniApi functions')
+	emit('enum class EHoudiniApiFunction : uint16')
+	emit('{')
+	for function in functions:
+		emit('\t%s,' % function.name)
+	emit('\tCount')
+	emit('};')
+	emit('')
+	emit('static const char* HoudiniApiFunctionNames[] =')
+	emit('{')
+	for function in functions:
+		emit('\t"%s",' % function.name)
+	emit('};')
+	emit('')
+
+	# Field by field keys of the structs passed to the struct helpers
+	keyed_structs = sorted(set(
+		param.base_type for function in functions for param in function.params if function.is_keyed_struct(param)))
+
+	emit('namespace HoudiniApiRecorder')
+	emit('{')
+	for struct_index, struct_name in enumerate(keyed_structs):
+		if struct_index > 0:
+			emit('')
+		emit('\tstatic void')
+		emit('\tKeyFields(FCall& Call, const %s* InStruct)' % struct_name)
+		emit('\t{')
+		emit('\t\tCall.Key(InStruct != nullptr);')
+		emit('\t\tif (!InStruct)')
+		emit('\t\t\treturn;')
+		emit('')
+		for field_name, array_size in parse_struct_fields(common_header, struct_name):
+			if array_size:
+				emit('\t\tfor (int32 Idx = 0; Idx < %s; Idx++)' % array_size)
+				emit('\t\t\tCall.Key(InStruct->%s[Idx]);' % field_name)
+			else:
+				emit('\t\tCall.Key(InStruct->%s);' % field_name)
+		emit('\t}')
+	emit('}')
+	emit('')
+
+	# Hooks
+	emit('// The hooks replacing FHoudiniApi\'s functions while recording or replaying')
+	emit('struct FHoudiniApiRecorderHooks')
+	emit('{')
+	emit('\tusing FCall = HoudiniApiRecorder::FCall;')
+	emit('')
+	emit('\t// The functions that were hooked')
+	emit('\tstruct Original')
+	emit('\t{')
+	for function in functions:
+		emit('\t\tstatic FHoudiniApi::%sFuncPtr %s;' % (function.name, function.name))
+	emit('\t};')
+	emit('')
+
+	for function in functions:
+		params = ', '.join(param.text for param in function.params)
+		args = ', '.join(param.name for param in function.params)
+		is_void = function.return_type == 'void'
+
+		emit('\tstatic %s %s(%s)' % (function.return_type, function.name, params))
+		emit('\t{')
+		if function.is_struct_initializer:
+			emit('\t\tFCall Call(EHoudiniApiFunction::%s, true);' % function.name)
+		else:
+			emit('\t\tFCall Call(EHoudiniApiFunction::%s);' % function.name)
+
+		outputs = []
+		for param in function.params:
+			if param.base_type == 'HAPI_Session':
+				if not param.is_const:
+					outputs.append(param)
+			elif function.is_keyed_struct(param):
+				emit('\t\tHoudiniApiRecorder::KeyFields(Call, %s);' % param.name)
+			elif not param.is_pointer:
+				emit('\t\tCall.Key(%s);' % param.name)
+			elif param.type.replace(' ', '') == 'constchar*':
+				# Strings are part of the key, binary buffers (LoadGeoFromMemory...) are inputs
+				if not param.name.endswith('buffer'):
+					emit('\t\tCall.Key(%s);' % param.name)
+			elif not param.is_const and param.base_type != 'void':
+				outputs.append(param)
+
+		if is_void:
+			emit('\t\tif (!Call.Replay())')
+			emit('\t\t\tOriginal::%s(%s);' % (function.name, args))
+		else:
+			missed_value = 'HAPI_RESULT_FAILURE' if function.return_type == 'HAPI_Result' else '%s()' % function.return_type
+			emit('\t\tconst %s Result = Call.Replay() ? Call.ReplayResult<%s>(%s) : Original::%s(%s);' % (
+				function.return_type, function.return_type, missed_value, function.name, args))
+
+		for param in outputs:
+			emit('\t\tCall.Output(%s, %s);' % (param.name, function.output_count(param)))
+
+		if is_void:
+			emit('\t\tCall.Finish();')
+		else:
+			emit('\t\treturn Call.Finish(Result);')
+		emit('\t}')
+		emit('')
+
+	emit('\tstatic void Install();')
+	emit('\tstatic void Uninstall();')
+	emit('};')
+	emit('')
+
+	for function in functions:
+		emit('FHoudiniApi::%sFuncPtr FHoudiniApiRecorderHooks::Original::%s = nullptr;' % (function.name, function.name))
+	emit('')
+
+	emit('void')
+	emit('FHoudiniApiRecorderHooks::Install()')
+	emit('{')
+	for function in functions:
+		emit('\tOriginal::%s = FHoudiniApi::%s;' % (function.name, function.name))
+		emit('\tFHoudiniApi::%s = &FHoudiniApiRecorderHooks::%s;' % (function.name, function.name))
+	emit('}')
+	emit('')
+
+	emit('void')
+	emit('FHoudiniApiRecorderHooks::Uninstall()')
+	emit('{')
+	for function in functions:
+		emit('\tFHoudiniApi::%s = Original::%s;' % (function.name, function.name))
+	emit('}')
+
+	return '\n'.join(out) + '\n'
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Generate the FHoudiniApiRecorder hooks from HoudiniApi.h.')
+	parser.add_argument('--check', action='store_true', help='Only check that the generated file is up to date.')
+	args = parser.parse_args()
+
+	content = generate(parse_functions(API_HEADER), COMMON_HEADER)
+
+	existing = None
+	if os.path.exists(OUTPUT_FILE):
+		with io.open(OUTPUT_FILE, encoding='utf-8', newline='') as output:
+			existing = output.read().replace('\r\n', '\n')
+
+	if args.check:
+		if existing != content:
+			print('%s is out of date, run %s.' % (OUTPUT_FILE, os.path.basename(__file__)))
+			return 1
+		return 0
+
+	if existing != content:
+		with io.open(OUTPUT_FILE, 'w', encoding='utf-8', newline='\n') as output:
+			output.write(content)
+		print('Generated %s.' % OUTPUT_FILE)
+
+	return 0
+
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -701,6 +701,15 @@ FHoudiniInputDetails::AddExportCheckboxes(TSharedRef< SVerticalBox > VerticalBox
 		return InInput->GetExportColliders() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 	};
 
+	// Lambda returning a CheckState from the input's current UploadAsGeometryBlob state
+	auto IsCheckedUploadAsGeometryBlob = [](UHoudiniInput* InInput)
+	{
+		if (!InInput || InInput->IsPendingKill())
+			return ECheckBoxState::Unchecked;
+
+		return InInput->GetUploadAsGeometryBlob() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+	};
+
 	// Lambda for changing ExportLODs state
 	auto CheckStateChangedExportLODs = [MainInput](TArray<UHoudiniInput*> InInputsToUpdate, ECheckBoxState NewState)
 	{
@@ -800,9 +809,43 @@ FHoudiniInputDetails::AddExportCheckboxes(TSharedRef< SVerticalBox > VerticalBox
 		}
 	};
 
+	// Lambda for changing UploadAsGeometryBlob state
+	auto CheckStateChangedUploadAsGeometryBlob = [MainInput](TArray<UHoudiniInput*> InInputsToUpdate, ECheckBoxState NewState)
+	{
+		if (!MainInput || MainInput->IsPendingKill())
+			return;
+
+		bool bNewState = (NewState == ECheckBoxState::Checked);
+
+		if (MainInput->GetUploadAsGeometryBlob() == bNewState)
+			return;
+
+		// Record a transaction for undo/redo
+		FScopedTransaction Transaction(
+			TEXT(HOUDINI_MODULE_EDITOR),
+			LOCTEXT("HoudiniInputChange", "Houdini Input: Changing Upload As Geometry Blob"),
+			MainInput->GetOuter());
+
+		for (auto CurInput : InInputsToUpdate)
+		{
+			if (!CurInput || CurInput->IsPendingKill())
+				continue;
+
+			if (CurInput->GetUploadAsGeometryBlob() == bNewState)
+				continue;
+
+			CurInput->Modify();
+
+			CurInput->SetUploadAsGeometryBlob(bNewState);
+			CurInput->MarkChanged(true);
+			CurInput->MarkAllInputObjectsChanged(true);
+		}
+	};
+
 	TSharedPtr< SCheckBox > CheckBoxExportLODs;
 	TSharedPtr< SCheckBox > CheckBoxExportSockets;
 	TSharedPtr< SCheckBox > CheckBoxExportColliders;
+	TSharedPtr< SCheckBox > CheckBoxUploadAsGeometryBlob;
 	VerticalBox->AddSlot().Padding( 2, 2, 5, 2 ).AutoHeight()
 	[
 		SNew( SHorizontalBox )
@@ -872,6 +915,28 @@ FHoudiniInputDetails::AddExportCheckboxes(TSharedRef< SVerticalBox > VerticalBox
 				return CheckStateChangedExportColliders(InInputs, NewState);
 			})
 		]
+		+ SHorizontalBox::Slot()
+		.Padding( 1.0f )
+		.VAlign( VAlign_Center )
+		.AutoWidth()
+		[
+			SAssignNew( CheckBoxUploadAsGeometryBlob, SCheckBox )
+			.Content()
+			[
+				SNew( STextBlock )
+				.Text( LOCTEXT( "UploadAsGeometryBlob", "Upload as Blob" ) )
+				.ToolTipText( LOCTEXT( "UploadAsGeometryBlobTip", "If enabled, the static meshes will be sent to Houdini as a single bgeo blob instead of attribute by attribute. LOD and tag groups still use the attribute upload." ) )
+				.Font( FEditorStyle::GetFontStyle( TEXT( "PropertyWindow.NormalFont" ) ) )
+			]
+			.IsChecked_Lambda([=]()
+			{
+				return IsCheckedUploadAsGeometryBlob(MainInput);
+			})
+			.OnCheckStateChanged_Lambda([=](ECheckBoxState NewState)
+			{
+				return CheckStateChangedUploadAsGeometryBlob(InInputs, NewState);
+			})
+		]
 	];
 }
 
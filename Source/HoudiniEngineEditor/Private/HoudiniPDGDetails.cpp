@@ -91,6 +91,9 @@ FHoudiniPDGDetails::AddPDGAssetWidget(
 	// Commandlet Status row
 	AddPDGCommandletStatus(InPDGCategory, FHoudiniEngine::Get().GetPDGCommandletStatus());
 
+	// PDG event stats row
+	AddPDGEventStats(InPDGCategory);
+
 	// REFRESH / RESET Buttons
 	{
 		TSharedRef<SHorizontalBox> RefreshHBox = SNew(SHorizontalBox);
@@ -649,6 +652,42 @@ FHoudiniPDGDetails::AddPDGCommandletStatus(
     ];
 }
 
+void
+FHoudiniPDGDetails::AddPDGEventStats(IDetailCategoryBuilder& InPDGCategory)
+{
+	FDetailWidgetRow& PDGEventStatsRow = InPDGCategory.AddCustomRow(FText::GetEmpty())
+	.WholeRowContent()
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.0f)
+		.Padding(2.0f, 0.0f)
+		.VAlign(VAlign_Center)
+		.HAlign(HAlign_Center)
+		[
+			SNew(STextBlock)
+			.ToolTipText(LOCTEXT("PDGEventStatsTooltip", "Number of PDG events waiting to be processed, and the rate at which they are being processed."))
+			.Text_Lambda([]()
+			{
+				FHoudiniPDGEventStats Stats;
+				if (!FHoudiniEngine::Get().GetPDGEventStats(Stats))
+					return FText::GetEmpty();
+
+				return FText::FromString(FString::Printf(
+					TEXT("PDG events: %d in backlog, %.0f events/s"), Stats.NumBacklogEvents, Stats.DrainRate));
+			})
+			.ColorAndOpacity_Lambda([]()
+			{
+				FHoudiniPDGEventStats Stats;
+				if (FHoudiniEngine::Get().GetPDGEventStats(Stats) && Stats.NumBacklogEvents > 0)
+					return FSlateColor(FLinearColor::Yellow);
+
+				return FSlateColor(FLinearColor::White);
+			})
+		]
+	];
+}
+
 bool
 FHoudiniPDGDetails::GetWorkItemTallyValueAndColor(
 	UHoudiniPDGAssetLink* InAssetLink,
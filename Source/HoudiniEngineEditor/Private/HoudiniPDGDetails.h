@@ -76,6 +76,9 @@ class FHoudiniPDGDetails : public TSharedFromThis<FHoudiniPDGDetails, ESPMode::N
 		void AddPDGCommandletStatus(
 			IDetailCategoryBuilder& InPDGCategory, const EHoudiniBGEOCommandletStatus& InCommandletStatus);
 
+		// Adds a row displaying the PDG event backlog and drain rate
+		void AddPDGEventStats(IDetailCategoryBuilder& InPDGCategory);
+
 		void AddTOPNetworkWidget(
 			IDetailCategoryBuilder& InPDGCategory, UHoudiniPDGAssetLink* InPDGAssetLink);
 
@@ -71,6 +71,7 @@ UHoudiniInput::UHoudiniInput()
 	, bExportLODs(false)
 	, bExportSockets(false)
 	, bExportColliders(false)
+	, bUploadAsGeometryBlob(false)
 	, bCookOnCurveChanged(true)
 	, bStaticMeshChanged(false)
 	, bInputAssetConnectedInHoudini(false)
@@ -134,6 +134,7 @@ public:
 	bool GetExportLODs() const				{ return bExportLODs; };
 	bool GetExportSockets() const			{ return bExportSockets; };
 	bool GetExportColliders() const			{ return bExportColliders; };
+	bool GetUploadAsGeometryBlob() const	{ return bUploadAsGeometryBlob; };
 	bool IsObjectPathParameter() const		{ return bIsObjectPathParameter; };
 	float GetUnrealSplineResolution() const { return UnrealSplineResolution; };
 	
@@ -238,6 +239,7 @@ public:
 	void SetExportLODs(const bool& bInExportLODs)					{ bExportLODs = bInExportLODs; };
 	void SetExportSockets(const bool& bInExportSockets)				{ bExportSockets = bInExportSockets; };
 	void SetExportColliders(const bool& bInExportColliders)			{ bExportColliders = bInExportColliders; };
+	void SetUploadAsGeometryBlob(const bool& bInUploadAsBlob)		{ bUploadAsGeometryBlob = bInUploadAsBlob; };
 	void SetInputNodeId(const int32& InCreatedNodeId)				{ InputNodeId = InCreatedNodeId; };
 	void SetUnrealSplineResolution(const float& InResolution)		{ UnrealSplineResolution = InResolution; };
 
@@ -433,6 +435,11 @@ protected:
 	UPROPERTY()
 	bool bExportColliders;
 
+	// Indicates that the meshes in the input should be sent to Houdini as a single geometry blob,
+	// instead of attribute by attribute
+	UPROPERTY()
+	bool bUploadAsGeometryBlob;
+
 	// Indicates that if trigger cook automatically on curve Input spline modified
 	UPROPERTY()
 	bool bCookOnCurveChanged;
@@ -62,6 +62,7 @@ UHoudiniInputObject::UHoudiniInputObject(const FObjectInitializer& ObjectInitial
 	, Type(EHoudiniInputObjectType::Invalid)
 	, InputNodeId(-1)
 	, InputObjectNodeId(-1)
+	, InputDataHash(0)
 	, bHasChanged(false)
 	, bNeedsToTriggerUpdate(false)
 	, bTransformChanged(false)
@@ -770,6 +771,9 @@ UHoudiniInputObject::Matches(const UHoudiniInputObject& Other) const
 void
 UHoudiniInputObject::InvalidateData()
 {
+	// The node holding the uploaded data is going away
+	InputDataHash = 0;
+
 	// If valid, mark our input nodes for deletion..	
 	if (this->IsA<UHoudiniInputHoudiniAsset>() || !bCanDeleteHoudiniNodes)
 	{
@@ -1757,6 +1761,7 @@ UHoudiniInputObject::CopyStateFrom(UHoudiniInputObject* InInput, bool bCopyAllPr
 
 	InputNodeId = InInput->InputNodeId;
 	InputObjectNodeId = InInput->InputObjectNodeId;
+	InputDataHash = InInput->InputDataHash;
 	bHasChanged = InInput->bHasChanged;
 	bNeedsToTriggerUpdate = InInput->bNeedsToTriggerUpdate;
 	bTransformChanged = InInput->bTransformChanged;
@@ -172,6 +172,11 @@ public:
 	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
 	int32 InputObjectNodeId;
 
+	// Hash of the data last uploaded to InputNodeId, 0 if unknown.
+	// Lets the input translator reuse the existing node when the marshalled data hasn't changed.
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	uint32 InputDataHash;
+
 	// Guid that uniquely identifies this input object.
 	// Also useful to correlate inputs between blueprint component templates and instances.
 	UPROPERTY(DuplicateTransient)
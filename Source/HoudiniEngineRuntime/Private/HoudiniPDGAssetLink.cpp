@@ -60,6 +60,9 @@ UHoudiniPDGAssetLink::UHoudiniPDGAssetLink(const FObjectInitializer& ObjectIniti
 	, OutputCachePath()
 	, bNeedsUIRefresh(false)
 	, OutputParentActor(nullptr)
+	, bTOPNodeIndexIsValid(false)
+	, bWorkItemTallyIsValid(false)
+	, WorkItemTallyGeneration(0)
 {
 	TOPNodeFilter = HAPI_UNREAL_PDG_DEFAULT_TOP_FILTER;
 	TOPOutputFilter = HAPI_UNREAL_PDG_DEFAULT_TOP_OUTPUT_FILTER;
@@ -342,6 +345,13 @@ FAggregatedWorkItemTally::Subtract(const FWorkItemTallyBase& InWorkItemTally)
 	CookCancelledWorkItems -= InWorkItemTally.NumCookCancelledWorkItems();
 }
 
+bool
+FAggregatedWorkItemTally::IsZero() const
+{
+	return TotalWorkItems == 0 && WaitingWorkItems == 0 && ScheduledWorkItems == 0 && CookingWorkItems == 0
+		&& CookedWorkItems == 0 && ErroredWorkItems == 0 && CookCancelledWorkItems == 0;
+}
+
 
 UTOPNode::UTOPNode()
 {
@@ -364,6 +374,11 @@ UTOPNode::UTOPNode()
 	
 	bShow = false;
 
+	bWorkResultIndexIsValid = false;
+	bWorkResultIndexHasDuplicates = false;
+
+	WorkItemTallyGeneration = INDEX_NONE;
+
 	InvalidateLandscapeCache();
 }
 
@@ -386,8 +401,89 @@ void
 UTOPNode::Reset()
 {
 	NodeState = EPDGNodeState::None;
+	ZeroWorkItemTally();
+}
+
+void
+UTOPNode::ZeroWorkItemTally()
+{
+	FAggregatedWorkItemTally PreviousTally;
+	PreviousTally.Add(WorkItemTally);
 	WorkItemTally.ZeroAll();
-	AggregatedWorkItemTally.ZeroAll();
+	PropagateWorkItemTallyChange(PreviousTally);
+}
+
+void
+UTOPNode::PropagateWorkItemTallyChange(const FAggregatedWorkItemTally& InPreviousTally)
+{
+	// Only the tallys of nodes without children are aggregated
+	if (bHasChildNodes)
+		return;
+
+	// If the hierarchy is being rebuilt, the new tally will be picked up by the rebuild
+	UHoudiniPDGAssetLink* AssetLink = WorkItemTallyAssetLink.Get();
+	if (!IsValid(AssetLink) || !AssetLink->IsWorkItemTallyValid(WorkItemTallyGeneration))
+		return;
+
+	FAggregatedWorkItemTally Delta;
+	Delta.Add(WorkItemTally);
+	Delta.Subtract(InPreviousTally);
+	if (Delta.IsZero())
+		return;
+
+	for (const TWeakObjectPtr<UTOPNode>& ParentNodePtr : ParentTOPNodes)
+	{
+		UTOPNode* ParentNode = ParentNodePtr.Get();
+		if (IsValid(ParentNode))
+			ParentNode->AggregatedWorkItemTally.Add(Delta);
+	}
+
+	AssetLink->WorkItemTally.Add(Delta);
+}
+
+void
+UTOPNode::OnWorkItemRemoved(int32 InWorkItemID)
+{
+	FAggregatedWorkItemTally PreviousTally;
+	PreviousTally.Add(WorkItemTally);
+	WorkItemTally.RemoveWorkItem(InWorkItemID);
+	PropagateWorkItemTallyChange(PreviousTally);
+}
+
+void
+UTOPNode::OnWorkItemScheduled(int32 InWorkItemID)
+{
+	FAggregatedWorkItemTally PreviousTally;
+	PreviousTally.Add(WorkItemTally);
+	WorkItemTally.RecordWorkItemAsScheduled(InWorkItemID);
+	PropagateWorkItemTallyChange(PreviousTally);
+}
+
+void
+UTOPNode::OnWorkItemCooking(int32 InWorkItemID)
+{
+	FAggregatedWorkItemTally PreviousTally;
+	PreviousTally.Add(WorkItemTally);
+	WorkItemTally.RecordWorkItemAsCooking(InWorkItemID);
+	PropagateWorkItemTallyChange(PreviousTally);
+}
+
+void
+UTOPNode::OnWorkItemErrored(int32 InWorkItemID)
+{
+	FAggregatedWorkItemTally PreviousTally;
+	PreviousTally.Add(WorkItemTally);
+	WorkItemTally.RecordWorkItemAsErrored(InWorkItemID);
+	PropagateWorkItemTallyChange(PreviousTally);
+}
+
+void
+UTOPNode::OnWorkItemCookCancelled(int32 InWorkItemID)
+{
+	FAggregatedWorkItemTally PreviousTally;
+	PreviousTally.Add(WorkItemTally);
+	WorkItemTally.RecordWorkItemAsCookCancelled(InWorkItemID);
+	PropagateWorkItemTallyChange(PreviousTally);
 }
 
 void UTOPNode::OnWorkItemWaiting(int32 InWorkItemID)
@@ -401,7 +497,11 @@ void UTOPNode::OnWorkItemWaiting(int32 InWorkItemID)
 			WRO.SetAutoBakedSinceLastLoad(false);
 		}
 	}
+
+	FAggregatedWorkItemTally PreviousTally;
+	PreviousTally.Add(WorkItemTally);
 	WorkItemTally.RecordWorkItemAsWaiting(InWorkItemID);
+	PropagateWorkItemTallyChange(PreviousTally);
 }
 
 void
@@ -413,7 +513,11 @@ UTOPNode::OnWorkItemCooked(int32 InWorkItemID)
 		// all the work items are being recooked.
 		InvalidateLandscapeCache();
 	}
+
+	FAggregatedWorkItemTally PreviousTally;
+	PreviousTally.Add(WorkItemTally);
 	WorkItemTally.RecordWorkItemAsCooked(InWorkItemID);
+	PropagateWorkItemTallyChange(PreviousTally);
 }
 
 void
@@ -580,17 +684,27 @@ UTOPNode::GetBakedWorkResultObjectOutputs(int32 InWorkResultArrayIndex, int32 In
 int32
 UTOPNode::IndexOfWorkResultByID(const int32& InWorkItemID)
 {
-	const int32 NumEntries = WorkResult.Num();
-	for (int32 Index = 0; Index < NumEntries; ++Index)
+	if (InWorkItemID == INDEX_NONE)
 	{
-		const FTOPWorkResult& CurResult = WorkResult[Index];
-		if (CurResult.WorkItemID == InWorkItemID)
-		{
-			return Index;
-		}
+		// Entries with invalid IDs are not indexed
+		return WorkResult.IndexOfByPredicate(
+			[](const FTOPWorkResult& InWorkItem) { return InWorkItem.WorkItemID == INDEX_NONE; });
 	}
 
-	return INDEX_NONE;
+	if (!bWorkResultIndexIsValid)
+		RebuildWorkResultIndex();
+
+	const int32* FoundIndex = WorkResultIndexByID.Find(InWorkItemID);
+	if (!FoundIndex)
+		return INDEX_NONE;
+
+	// The WorkResult array is public, make sure the index wasn't invalidated by a direct modification
+	if (WorkResult.IsValidIndex(*FoundIndex) && WorkResult[*FoundIndex].WorkItemID == InWorkItemID)
+		return *FoundIndex;
+
+	RebuildWorkResultIndex();
+	FoundIndex = WorkResultIndexByID.Find(InWorkItemID);
+	return FoundIndex ? *FoundIndex : INDEX_NONE;
 }
 
 FTOPWorkResult*
@@ -606,6 +720,27 @@ UTOPNode::GetWorkResultByID(const int32& InWorkItemID)
 int32
 UTOPNode::IndexOfWorkResultByHAPIIndex(const int32& InWorkItemIndex, bool bInWithInvalidWorkItemID)
 {
+	if (bInWithInvalidWorkItemID)
+	{
+		if (!bWorkResultIndexIsValid)
+			RebuildWorkResultIndex();
+
+		const int32* FoundIndex = StaleWorkResultIndexByHAPIIndex.Find(InWorkItemIndex);
+		if (!FoundIndex)
+			return INDEX_NONE;
+
+		if (WorkResult.IsValidIndex(*FoundIndex)
+			&& WorkResult[*FoundIndex].WorkItemIndex == InWorkItemIndex
+			&& WorkResult[*FoundIndex].WorkItemID == INDEX_NONE)
+		{
+			return *FoundIndex;
+		}
+
+		RebuildWorkResultIndex();
+		FoundIndex = StaleWorkResultIndexByHAPIIndex.Find(InWorkItemIndex);
+		return FoundIndex ? *FoundIndex : INDEX_NONE;
+	}
+
 	const int32 NumEntries = WorkResult.Num();
 	for (int32 Index = 0; Index < NumEntries; ++Index)
 	{
@@ -636,6 +771,121 @@ UTOPNode::GetWorkResultByArrayIndex(const int32& InArrayIndex)
 	return &WorkResult[InArrayIndex];
 }
 
+void
+UTOPNode::AddWorkResultToIndex(const FTOPWorkResult& InWorkResult, const int32& InArrayIndex)
+{
+	TMap<int32, int32>& Index = InWorkResult.WorkItemID != INDEX_NONE ? WorkResultIndexByID : StaleWorkResultIndexByHAPIIndex;
+	const int32 Key = InWorkResult.WorkItemID != INDEX_NONE ? InWorkResult.WorkItemID : InWorkResult.WorkItemIndex;
+
+	// Keep the first entry, like the linear search did
+	if (Index.Contains(Key))
+		bWorkResultIndexHasDuplicates = true;
+	else
+		Index.Add(Key, InArrayIndex);
+}
+
+void
+UTOPNode::RemoveWorkResultFromIndex(const FTOPWorkResult& InWorkResult, const int32& InArrayIndex)
+{
+	TMap<int32, int32>& Index = InWorkResult.WorkItemID != INDEX_NONE ? WorkResultIndexByID : StaleWorkResultIndexByHAPIIndex;
+	const int32 Key = InWorkResult.WorkItemID != INDEX_NONE ? InWorkResult.WorkItemID : InWorkResult.WorkItemIndex;
+
+	// Only remove the entry if it points to this slot
+	const int32* FoundIndex = Index.Find(Key);
+	if (FoundIndex && *FoundIndex == InArrayIndex)
+		Index.Remove(Key);
+}
+
+int32
+UTOPNode::AddWorkResult(const FTOPWorkResult& InWorkResult)
+{
+	const int32 ArrayIndex = WorkResult.Add(InWorkResult);
+	if (bWorkResultIndexIsValid)
+		AddWorkResultToIndex(InWorkResult, ArrayIndex);
+
+	return ArrayIndex;
+}
+
+void
+UTOPNode::SetWorkResultWorkItemID(const int32& InArrayIndex, const int32& InWorkItemID)
+{
+	if (!WorkResult.IsValidIndex(InArrayIndex))
+		return;
+
+	FTOPWorkResult& CurResult = WorkResult[InArrayIndex];
+	if (CurResult.WorkItemID == InWorkItemID)
+		return;
+
+	if (bWorkResultIndexIsValid && bWorkResultIndexHasDuplicates)
+	{
+		// Another entry might have to take over the previous key, simply rebuild on the next lookup
+		bWorkResultIndexIsValid = false;
+	}
+	else if (bWorkResultIndexIsValid)
+	{
+		RemoveWorkResultFromIndex(CurResult, InArrayIndex);
+		CurResult.WorkItemID = InWorkItemID;
+		AddWorkResultToIndex(CurResult, InArrayIndex);
+		return;
+	}
+
+	CurResult.WorkItemID = InWorkItemID;
+}
+
+void
+UTOPNode::RemoveWorkResultAt(const int32& InArrayIndex)
+{
+	if (!WorkResult.IsValidIndex(InArrayIndex))
+		return;
+
+	if (bWorkResultIndexIsValid && bWorkResultIndexHasDuplicates)
+	{
+		// Another entry might have to take over the removed key, simply rebuild on the next lookup
+		bWorkResultIndexIsValid = false;
+	}
+	else if (bWorkResultIndexIsValid)
+	{
+		RemoveWorkResultFromIndex(WorkResult[InArrayIndex], InArrayIndex);
+
+		// The last entry is moved to the removed slot
+		const int32 LastIndex = WorkResult.Num() - 1;
+		if (InArrayIndex != LastIndex)
+		{
+			RemoveWorkResultFromIndex(WorkResult[LastIndex], LastIndex);
+			AddWorkResultToIndex(WorkResult[LastIndex], InArrayIndex);
+		}
+	}
+
+	// Swap the last entry into the removed slot so that removals don't shift (and re-index) the whole array
+	WorkResult.RemoveAtSwap(InArrayIndex);
+}
+
+void
+UTOPNode::EmptyWorkResults()
+{
+	WorkResult.Empty();
+	WorkResultIndexByID.Empty();
+	StaleWorkResultIndexByHAPIIndex.Empty();
+	bWorkResultIndexHasDuplicates = false;
+	bWorkResultIndexIsValid = true;
+}
+
+void
+UTOPNode::RebuildWorkResultIndex()
+{
+	WorkResultIndexByID.Reset();
+	StaleWorkResultIndexByHAPIIndex.Reset();
+	bWorkResultIndexHasDuplicates = false;
+
+	const int32 NumEntries = WorkResult.Num();
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		AddWorkResultToIndex(WorkResult[Index], Index);
+	}
+
+	bWorkResultIndexIsValid = true;
+}
+
 bool
 UTOPNode::IsParentTOPNetwork(UTOPNetwork const * const InNetwork) const
 {
@@ -946,6 +1196,8 @@ UHoudiniPDGAssetLink::ClearAllTOPData()
 	}
 
 	AllTOPNetworks.Empty();
+	InvalidateTOPNodeIndex();
+	InvalidateWorkItemTally();
 }
 
 void 
@@ -975,7 +1227,7 @@ UHoudiniPDGAssetLink::ClearTOPNodeWorkItemResults(UTOPNode* TOPNode)
 	{
 		DestroyWorkItemResultData(CurrentWorkResult);
 	}
-	TOPNode->WorkResult.Empty();
+	TOPNode->EmptyWorkResults();
 
 	FOutputActorOwner& OutputActorOwner = TOPNode->GetOutputActorOwner();
 	AActor* OutputActor = OutputActorOwner.GetOutputActor();
@@ -1026,14 +1278,13 @@ UHoudiniPDGAssetLink::DestroyWorkItemByID(const int32& InWorkItemID, UTOPNode* I
 	if (!IsValid(InTOPNode))
 		return;
 	
-	// TODO: Update ClearWorkItemResultByID or GetWorkResultByID to return the index of the work item
-	// so that we don't have to find its index again to remove it from the array
-	ClearWorkItemResultByID(InWorkItemID, InTOPNode);
-	// Find the index of the FTOPWorkResult for InWorkItemID in InTOPNode.WorkResult and remove it
-	const int32 Index = InTOPNode->WorkResult.IndexOfByPredicate(
-		[InWorkItemID](const FTOPWorkResult& InWorkItem) { return InWorkItem.WorkItemID == InWorkItemID; });
+	// Find the index of the FTOPWorkResult for InWorkItemID in InTOPNode.WorkResult, clear and remove it
+	const int32 Index = InTOPNode->IndexOfWorkResultByID(InWorkItemID);
 	if (Index != INDEX_NONE && Index >= 0)
-		InTOPNode->WorkResult.RemoveAt(Index);
+	{
+		DestroyWorkItemResultData(InTOPNode->WorkResult[Index]);
+		InTOPNode->RemoveWorkResultAt(Index);
+	}
 }
 
 FTOPWorkResult*
@@ -1073,6 +1324,28 @@ UHoudiniPDGAssetLink::DestroyWorkItemResultData(FTOPWorkResult& Result)
 UTOPNode*
 UHoudiniPDGAssetLink::GetTOPNode(const int32& InNodeID)
 {
+	if (!bTOPNodeIndexIsValid)
+		RebuildTOPNodeIndex();
+
+	const TWeakObjectPtr<UTOPNode>* FoundNode = TOPNodesByNodeId.Find(InNodeID);
+	if (!FoundNode)
+		return nullptr;
+
+	UTOPNode* TOPNode = FoundNode->Get();
+	if (IsValid(TOPNode) && TOPNode->NodeId == InNodeID)
+		return TOPNode;
+
+	// The index is stale, rebuild it and try again
+	RebuildTOPNodeIndex();
+	FoundNode = TOPNodesByNodeId.Find(InNodeID);
+	TOPNode = FoundNode ? FoundNode->Get() : nullptr;
+	return IsValid(TOPNode) ? TOPNode : nullptr;
+}
+
+void
+UHoudiniPDGAssetLink::RebuildTOPNodeIndex()
+{
+	TOPNodesByNodeId.Reset();
 	for (UTOPNetwork* CurrentTOPNet : AllTOPNetworks)
 	{
 		if (!IsValid(CurrentTOPNet))
@@ -1082,13 +1355,14 @@ UHoudiniPDGAssetLink::GetTOPNode(const int32& InNodeID)
 		{
 			if (!IsValid(CurrentTOPNode))
 				continue;
-			
-			if (CurrentTOPNode->NodeId == InNodeID)
-				return CurrentTOPNode;
+
+			// Keep the first node found for a given id
+			if (!TOPNodesByNodeId.Contains(CurrentTOPNode->NodeId))
+				TOPNodesByNodeId.Add(CurrentTOPNode->NodeId, CurrentTOPNode);
 		}
 	}
 
-	return nullptr;
+	bTOPNodeIndexIsValid = true;
 }
 
 void
@@ -1104,19 +1378,10 @@ UHoudiniPDGAssetLink::UpdateTOPNodeWithChildrenWorkItemTallyAndState(UTOPNode* I
 	if (!PrefixPath.EndsWith("/"))
 		PrefixPath += "/";
 	InNode->ZeroWorkItemTally();
-	InNode->NodeState = EPDGNodeState::None;
-
-	TMap<EPDGNodeState, int8> NodeStateOrder;
-	NodeStateOrder.Add(EPDGNodeState::None, 0);
-	NodeStateOrder.Add(EPDGNodeState::Cook_Complete, 1);
-	NodeStateOrder.Add(EPDGNodeState::Dirtied, 2);
-	NodeStateOrder.Add(EPDGNodeState::Cook_Failed, 3);
-	NodeStateOrder.Add(EPDGNodeState::Dirtying, 4);
-	NodeStateOrder.Add(EPDGNodeState::Cooking, 5);
+	InNode->AggregatedWorkItemTally.ZeroAll();
+	InNode->AggregatedChildTOPNodes.Reset();
 
-	int8 CurrentState = 0;
-	
-	for (const UTOPNode* Node : InNetwork->AllTOPNodes)
+	for (UTOPNode* Node : InNetwork->AllTOPNodes)
 	{
 		if (!IsValid(Node))
 			continue;
@@ -1124,20 +1389,105 @@ UHoudiniPDGAssetLink::UpdateTOPNodeWithChildrenWorkItemTallyAndState(UTOPNode* I
 		if (Node->NodePath.StartsWith(PrefixPath) && !Node->bHasChildNodes)
 		{
 			InNode->AggregateTallyFromChildNode(Node);
-			const int8 VisitedNodeState = NodeStateOrder.FindChecked(Node->NodeState);
-			if (VisitedNodeState > CurrentState)
-				CurrentState = VisitedNodeState;
+			InNode->AggregatedChildTOPNodes.Add(Node);
+			Node->ParentTOPNodes.AddUnique(InNode);
 		}
 	}
 
-	EPDGNodeState const* const NewState = NodeStateOrder.FindKey(CurrentState);
-	if (NewState)
-		InNode->NodeState = *NewState;
+	UpdateTOPNodeStateFromChildNodes(InNode);
+}
+
+void
+UHoudiniPDGAssetLink::UpdateTOPNodeStateFromChildNodes(UTOPNode* InNode)
+{
+	if (!IsValid(InNode) || !InNode->bHasChildNodes)
+		return;
+
+	// The state of a node with children is the "most active" state of its children
+	auto GetNodeStateOrder = [](const EPDGNodeState& InState) -> int8
+	{
+		switch (InState)
+		{
+			case EPDGNodeState::Cook_Complete: return 1;
+			case EPDGNodeState::Dirtied: return 2;
+			case EPDGNodeState::Cook_Failed: return 3;
+			case EPDGNodeState::Dirtying: return 4;
+			case EPDGNodeState::Cooking: return 5;
+			case EPDGNodeState::None:
+			default:
+				return 0;
+		}
+	};
+
+	EPDGNodeState NewState = EPDGNodeState::None;
+	int8 CurrentState = 0;
+	for (const TWeakObjectPtr<UTOPNode>& ChildNodePtr : InNode->AggregatedChildTOPNodes)
+	{
+		const UTOPNode* ChildNode = ChildNodePtr.Get();
+		if (!IsValid(ChildNode))
+			continue;
+
+		const int8 VisitedNodeState = GetNodeStateOrder(ChildNode->NodeState);
+		if (VisitedNodeState > CurrentState)
+		{
+			CurrentState = VisitedNodeState;
+			NewState = ChildNode->NodeState;
+		}
+	}
+
+	InNode->NodeState = NewState;
+}
+
+void
+UHoudiniPDGAssetLink::OnTOPNodeStateChanged(UTOPNode* InNode)
+{
+	if (!IsValid(InNode))
+		return;
+
+	if (InNode->bHasChildNodes)
+	{
+		// Nodes with children always reflect the state of their child nodes
+		if (bWorkItemTallyIsValid)
+			UpdateTOPNodeStateFromChildNodes(InNode);
+		return;
+	}
+
+	if (!IsWorkItemTallyValid(InNode->WorkItemTallyGeneration))
+		return;
+
+	for (const TWeakObjectPtr<UTOPNode>& ParentNodePtr : InNode->ParentTOPNodes)
+	{
+		UpdateTOPNodeStateFromChildNodes(ParentNodePtr.Get());
+	}
 }
 
 void
 UHoudiniPDGAssetLink::UpdateWorkItemTally()
 {
+	// Work item events keep the tallys up to date, only rebuild them if the TOP nodes changed
+	if (bWorkItemTallyIsValid)
+		return;
+
+	// Invalidate the hierarchy of nodes that are not in the asset link anymore
+	WorkItemTallyGeneration++;
+
+	for (UTOPNetwork* CurrentTOPNet : AllTOPNetworks)
+	{
+		if (!IsValid(CurrentTOPNet))
+			continue;
+
+		for (UTOPNode* CurrentTOPNode : CurrentTOPNet->AllTOPNodes)
+		{
+			if (!IsValid(CurrentTOPNode))
+				continue;
+
+			CurrentTOPNode->ParentTOPNodes.Reset();
+			CurrentTOPNode->AggregatedChildTOPNodes.Reset();
+			CurrentTOPNode->WorkItemTallyAssetLink = this;
+			CurrentTOPNode->WorkItemTallyGeneration = WorkItemTallyGeneration;
+		}
+	}
+
 	WorkItemTally.ZeroAll();		
 	for(UTOPNetwork* CurrentTOPNet : AllTOPNetworks)
 	{
@@ -1160,6 +1510,8 @@ UHoudiniPDGAssetLink::UpdateWorkItemTally()
 			}
 		}
 	}
+
+	bWorkItemTallyIsValid = true;
 }
 
 
@@ -1455,6 +1807,10 @@ UHoudiniPDGAssetLink::PostTransacted(const FTransactionObjectEvent& TransactionE
 	if (TransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
 		return;
 
+	// The TOP networks / nodes might have been restored
+	InvalidateTOPNodeIndex();
+	InvalidateWorkItemTally();
+
 	bool bDoFilterTOPNodesAndOutputs = false;
 	for (const FName& PropName : TransactionEvent.GetChangedProperties())
 	{
@@ -347,12 +347,16 @@ public:
 
 	void Subtract(const FWorkItemTallyBase& InWorkItemTally);
 
+	// Returns true if all counts are zero (used to skip the propagation of empty deltas).
+	bool IsZero() const;
+
 	virtual int32 NumWorkItems() const override { return TotalWorkItems; }
 	virtual int32 NumWaitingWorkItems() const override { return WaitingWorkItems; }
 	virtual int32 NumScheduledWorkItems() const override { return ScheduledWorkItems; }
 	virtual int32 NumCookingWorkItems() const override { return CookingWorkItems; }
 	virtual int32 NumCookedWorkItems() const override { return CookedWorkItems; }
 	virtual int32 NumErroredWorkItems() const override { return ErroredWorkItems; }
+	virtual int32 NumCookCancelledWorkItems() const override { return CookCancelledWorkItems; }
 
 protected:
 	UPROPERTY()
@@ -384,8 +388,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniPDGWorkResultObjectBakedOutput
 		TArray<FHoudiniBakedOutput> BakedOutputs;
 };
 
-// Forward declare the UTOPNetwork here for some references in the UTOPNode
+// Forward declare the UTOPNetwork and UHoudiniPDGAssetLink here for some references in the UTOPNode
 class UTOPNetwork;
+class UHoudiniPDGAssetLink;
 
 UCLASS()
 class HOUDINIENGINERUNTIME_API UTOPNode : public UObject
@@ -417,37 +422,36 @@ public:
 	bool AreAllWorkItemsComplete() const { return GetWorkItemTally().AreAllWorkItemsComplete(); };
 	bool AnyWorkItemsFailed() const { return GetWorkItemTally().AnyWorkItemsFailed(); };
 	bool AnyWorkItemsPending() const { return GetWorkItemTally().AnyWorkItemsPending(); };
-	void ZeroWorkItemTally()
-	{
-		WorkItemTally.ZeroAll();
-		AggregatedWorkItemTally.ZeroAll();
-	}
+	// Zero this node's own work item tally. The aggregated tally of nodes with children is the sum of their child
+	// nodes' tallys, and is kept.
+	void ZeroWorkItemTally();
 
-	// Called by PDG manager when work item events are received
+	// Called by PDG manager when work item events are received.
+	// The change in the work item tally is propagated to the parent nodes and to the asset link.
 	
 	// Notification that a work item has been created
 	void OnWorkItemCreated(int32 InWorkItemID) { };
 
 	// Notification that a work item has been removed.
-	void OnWorkItemRemoved(int32 InWorkItemID) { WorkItemTally.RemoveWorkItem(InWorkItemID); };
+	void OnWorkItemRemoved(int32 InWorkItemID);
 
 	// Notification that a work item has moved to the waiting state.
 	void OnWorkItemWaiting(int32 InWorkItemID);
 
 	// Notification that a work item has been scheduled.
-	void OnWorkItemScheduled(int32 InWorkItemID) { WorkItemTally.RecordWorkItemAsScheduled(InWorkItemID); };
+	void OnWorkItemScheduled(int32 InWorkItemID);
 
 	// Notification that a work item has started cooking.
-	void OnWorkItemCooking(int32 InWorkItemID) { WorkItemTally.RecordWorkItemAsCooking(InWorkItemID); };
+	void OnWorkItemCooking(int32 InWorkItemID);
 
 	// Notification that a work item has been cooked.
 	void OnWorkItemCooked(int32 InWorkItemID);
 	
 	// Notification that a work item has errored.
-	void OnWorkItemErrored(int32 InWorkItemID) { WorkItemTally.RecordWorkItemAsErrored(InWorkItemID); };
+	void OnWorkItemErrored(int32 InWorkItemID);
 
 	// Notification that a work item cook has been cancelled.
-	void OnWorkItemCookCancelled(int32 InWorkItemID) { WorkItemTally.RecordWorkItemAsCookCancelled(InWorkItemID); };
+	void OnWorkItemCookCancelled(int32 InWorkItemID);
 
 	bool IsVisibleInLevel() const { return bShow; }
 	void SetVisibleInLevel(bool bInVisible);
@@ -497,6 +501,19 @@ public:
 	// Return the FTOPWorkResult at InArrayIndex in the WorkResult array, or nullptr if InArrayIndex is not a valid index.
 	FTOPWorkResult* GetWorkResultByArrayIndex(const int32& InArrayIndex);
 
+	// Mutators for the WorkResult array that keep the work result lookup index in sync.
+	// Add a FTOPWorkResult to the WorkResult array and return its array index.
+	int32 AddWorkResult(const FTOPWorkResult& InWorkResult);
+	// Set the WorkItemID of the FTOPWorkResult at InArrayIndex (used when relinking a stale entry).
+	void SetWorkResultWorkItemID(const int32& InArrayIndex, const int32& InWorkItemID);
+	// Remove the FTOPWorkResult at InArrayIndex. The last entry is moved into its slot (the array order is not kept).
+	void RemoveWorkResultAt(const int32& InArrayIndex);
+	// Remove all FTOPWorkResult entries.
+	void EmptyWorkResults();
+	// Force the work result lookup index to be rebuilt on the next lookup. Must be called if WorkResult is
+	// modified directly.
+	void InvalidateWorkResultIndex() { bWorkResultIndexIsValid = false; }
+
 	// Returns true if InNetwork is the parent TOP Net of this node.
 	bool IsParentTOPNetwork(UTOPNetwork const * const InNetwork) const;
 
@@ -560,6 +577,37 @@ public:
 
 protected:
 	void InvalidateLandscapeCache();
+
+	// Rebuild WorkResultIndexByID and StaleWorkResultIndexByHAPIIndex from the WorkResult array.
+	void RebuildWorkResultIndex();
+	// Add / remove the lookup index entry of the FTOPWorkResult at InArrayIndex.
+	void AddWorkResultToIndex(const FTOPWorkResult& InWorkResult, const int32& InArrayIndex);
+	void RemoveWorkResultFromIndex(const FTOPWorkResult& InWorkResult, const int32& InArrayIndex);
+
+	// Apply the change of WorkItemTally since InPreviousTally to the aggregated tallys of the parent nodes and of
+	// the asset link.
+	void PropagateWorkItemTallyChange(const FAggregatedWorkItemTally& InPreviousTally);
+
+	friend class UHoudiniPDGAssetLink;
+
+	// Work item tally hierarchy, built by UHoudiniPDGAssetLink::UpdateWorkItemTally().
+	// Nodes with children that aggregate this node's work item tally
+	TArray<TWeakObjectPtr<UTOPNode>> ParentTOPNodes;
+	// For nodes with children: the child nodes (without children) that are aggregated in AggregatedWorkItemTally
+	TArray<TWeakObjectPtr<UTOPNode>> AggregatedChildTOPNodes;
+	// The asset link aggregating this node's tally, and the generation of its hierarchy this node belongs to
+	TWeakObjectPtr<UHoudiniPDGAssetLink> WorkItemTallyAssetLink;
+	int32 WorkItemTallyGeneration;
+
+	// Transient lookup index for the WorkResult array: WorkItemID -> array index. Only contains entries with a
+	// valid WorkItemID, the first entry wins if IDs are duplicated.
+	TMap<int32, int32> WorkResultIndexByID;
+	// Transient lookup index for entries without a valid WorkItemID (after loading a map): WorkItemIndex -> array index.
+	TMap<int32, int32> StaleWorkResultIndexByHAPIIndex;
+	// False if the lookup indices must be rebuilt before being used.
+	bool bWorkResultIndexIsValid;
+	// True if some entries share a WorkItemID / WorkItemIndex and are not in the lookup indices.
+	bool bWorkResultIndexHasDuplicates;
 	
 	// Value caches used during landscape tile creation.
 	FHoudiniLandscapeReferenceLocation LandscapeReferenceLocation;
@@ -656,7 +704,18 @@ public:
 	static FLinearColor GetTOPNodeStatusColor(const UTOPNode* InTOPNode);
 
 	void UpdateTOPNodeWithChildrenWorkItemTallyAndState(UTOPNode* InNode, UTOPNetwork* InNetwork);
+	// Rebuild the aggregated work item tallys of the asset link and of the nodes with children, if the TOP
+	// networks/nodes changed since the last rebuild. Work item events update the tallys incrementally, so this
+	// does nothing for an idle asset link.
 	void UpdateWorkItemTally();
+	// Force the work item tallys to be rebuilt by the next UpdateWorkItemTally() call. Must be called when TOP
+	// networks / nodes are added, removed or their hierarchy changes.
+	void InvalidateWorkItemTally() { bWorkItemTallyIsValid = false; }
+	// Returns true if the work item tally hierarchy is up to date and was built for InGeneration
+	bool IsWorkItemTallyValid(const int32& InGeneration) const { return bWorkItemTallyIsValid && InGeneration == WorkItemTallyGeneration; }
+	// Update the state of the nodes with children that aggregate InNode, after InNode's state changed.
+	// If InNode has children itself, its state is updated from its child nodes.
+	void OnTOPNodeStateChanged(UTOPNode* InNode);
 	static void ResetTOPNetworkWorkItemTally(UTOPNetwork* TOPNetwork);
 
 	// Set the TOP network at the given index as currently selected TOP network
@@ -670,9 +729,14 @@ public:
 	FString GetSelectedTOPNodeName();
 	FString GetSelectedTOPNetworkName();
 
+	// Find the TOP node with the given NodeId in all the TOP networks.
 	UTOPNode* GetTOPNode(const int32& InNodeID);
 	UTOPNetwork* GetTOPNetwork(const int32& AtIndex);
 
+	// Force the NodeId -> UTOPNode lookup index to be rebuilt on the next GetTOPNode call. Must be called when TOP
+	// networks / nodes are added, removed or their NodeId changes.
+	void InvalidateTOPNodeIndex() { bTOPNodeIndexIsValid = false; }
+
 	// Find the node with relative path 'InNodePath' from its topnet.
 	static UTOPNode* GetTOPNodeByNodePath(const FString& InNodePath, const TArray<UTOPNode*>& InTOPNodes, int32& OutIndex);
 	// Find the network with relative path 'InNetPath' from the HDA
@@ -736,6 +800,22 @@ private:
 
 	static void DestoryWorkResultObjectData(FTOPWorkResultObject& ResultObject);
 
+	// Rebuild TOPNodesByNodeId from AllTOPNetworks
+	void RebuildTOPNodeIndex();
+
+	// Transient lookup index of the TOP nodes of all the TOP networks, by NodeId.
+	TMap<int32, TWeakObjectPtr<UTOPNode>> TOPNodesByNodeId;
+	// False if TOPNodesByNodeId must be rebuilt before being used.
+	bool bTOPNodeIndexIsValid;
+
+	// Update InNode's state from the state of its aggregated child nodes
+	static void UpdateTOPNodeStateFromChildNodes(UTOPNode* InNode);
+
+	// False if WorkItemTally and the nodes' aggregated tallys must be rebuilt by UpdateWorkItemTally()
+	bool bWorkItemTallyIsValid;
+	// Incremented each time the work item tally hierarchy is rebuilt
+	int32 WorkItemTallyGeneration;
+
 public:
 
 	//UPROPERTY()
@@ -212,6 +212,71 @@ void UHoudiniStaticMesh::SetTriangleMaterialID(uint32 InTriangleIndex, int32 InM
 	MaterialIDsPerTriangle[InTriangleIndex] = InMaterialID;
 }
 
+void UHoudiniStaticMesh::SetVertexPositions(uint32 InStartVertexIndex, const TArrayView<const FVector>& InPositions)
+{
+	if (InPositions.Num() <= 0)
+		return;
+
+	check(VertexPositions.IsValidIndex(InStartVertexIndex + InPositions.Num() - 1));
+	FMemory::Memcpy(&VertexPositions[InStartVertexIndex], InPositions.GetData(), InPositions.Num() * sizeof(FVector));
+}
+
+void UHoudiniStaticMesh::SetTriangleIndices(uint32 InStartTriangleIndex, const TArrayView<const FIntVector>& InTriangleVertexIndices)
+{
+	if (InTriangleVertexIndices.Num() <= 0)
+		return;
+
+	check(TriangleIndices.IsValidIndex(InStartTriangleIndex + InTriangleVertexIndices.Num() - 1));
+	FMemory::Memcpy(&TriangleIndices[InStartTriangleIndex], InTriangleVertexIndices.GetData(), InTriangleVertexIndices.Num() * sizeof(FIntVector));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceNormals(uint32 InStartVertexInstanceIndex, const TArrayView<const FVector>& InNormals)
+{
+	if (!bHasNormals || InNormals.Num() <= 0)
+		return;
+
+	check(VertexInstanceNormals.IsValidIndex(InStartVertexInstanceIndex + InNormals.Num() - 1));
+	FMemory::Memcpy(&VertexInstanceNormals[InStartVertexInstanceIndex], InNormals.GetData(), InNormals.Num() * sizeof(FVector));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceUTangents(uint32 InStartVertexInstanceIndex, const TArrayView<const FVector>& InUTangents)
+{
+	if (!bHasTangents || InUTangents.Num() <= 0)
+		return;
+
+	check(VertexInstanceUTangents.IsValidIndex(InStartVertexInstanceIndex + InUTangents.Num() - 1));
+	FMemory::Memcpy(&VertexInstanceUTangents[InStartVertexInstanceIndex], InUTangents.GetData(), InUTangents.Num() * sizeof(FVector));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceVTangents(uint32 InStartVertexInstanceIndex, const TArrayView<const FVector>& InVTangents)
+{
+	if (!bHasTangents || InVTangents.Num() <= 0)
+		return;
+
+	check(VertexInstanceVTangents.IsValidIndex(InStartVertexInstanceIndex + InVTangents.Num() - 1));
+	FMemory::Memcpy(&VertexInstanceVTangents[InStartVertexInstanceIndex], InVTangents.GetData(), InVTangents.Num() * sizeof(FVector));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceColors(uint32 InStartVertexInstanceIndex, const TArrayView<const FColor>& InColors)
+{
+	if (!bHasColors || InColors.Num() <= 0)
+		return;
+
+	check(VertexInstanceColors.IsValidIndex(InStartVertexInstanceIndex + InColors.Num() - 1));
+	FMemory::Memcpy(&VertexInstanceColors[InStartVertexInstanceIndex], InColors.GetData(), InColors.Num() * sizeof(FColor));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceUVs(uint32 InStartVertexInstanceIndex, uint8 InUVLayer, const TArrayView<const FVector2D>& InUVs)
+{
+	if (NumUVLayers <= 0 || InUVs.Num() <= 0)
+		return;
+
+	const uint32 StartUVIndex = InUVLayer * GetNumVertexInstances() + InStartVertexInstanceIndex;
+	check(InStartVertexInstanceIndex + InUVs.Num() <= GetNumVertexInstances());
+	check(VertexInstanceUVs.IsValidIndex(StartUVIndex + InUVs.Num() - 1));
+	FMemory::Memcpy(&VertexInstanceUVs[StartUVIndex], InUVs.GetData(), InUVs.Num() * sizeof(FVector2D));
+}
+
 void UHoudiniStaticMesh::SetStaticMaterial(uint32 InMaterialIndex, const FStaticMaterial& InStaticMaterial)
 {
 	check(StaticMaterials.IsValidIndex(InMaterialIndex));
@@ -118,6 +118,23 @@ public:
 	UFUNCTION()
 	void SetTriangleMaterialID(uint32 InTriangleIndex, int32 InMaterialID);
 
+	// Bulk setters, copy a contiguous range of values starting at the given index.
+	// Vertex instances are indexed by InTriangleIndex * 3 + InTriangleVertexIndex.
+	// Setting distinct ranges from different threads is safe.
+	void SetVertexPositions(uint32 InStartVertexIndex, const TArrayView<const FVector>& InPositions);
+
+	void SetTriangleIndices(uint32 InStartTriangleIndex, const TArrayView<const FIntVector>& InTriangleVertexIndices);
+
+	void SetVertexInstanceNormals(uint32 InStartVertexInstanceIndex, const TArrayView<const FVector>& InNormals);
+
+	void SetVertexInstanceUTangents(uint32 InStartVertexInstanceIndex, const TArrayView<const FVector>& InUTangents);
+
+	void SetVertexInstanceVTangents(uint32 InStartVertexInstanceIndex, const TArrayView<const FVector>& InVTangents);
+
+	void SetVertexInstanceColors(uint32 InStartVertexInstanceIndex, const TArrayView<const FColor>& InColors);
+
+	void SetVertexInstanceUVs(uint32 InStartVertexInstanceIndex, uint8 InUVLayer, const TArrayView<const FVector2D>& InUVs);
+
 	UFUNCTION()
 	void SetStaticMaterial(uint32 InMaterialIndex, const FStaticMaterial& InStaticMaterial);
 